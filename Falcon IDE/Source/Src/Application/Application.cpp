@@ -89,6 +89,8 @@ Application::~Application()
 
 void Application::Update()
 {
+	FL_PROFILE_FUNCTION();
+
 	GraphicsDevice::Instance().PreDraw();
 
 	Shader::Instance().Begin();
@@ -123,8 +125,13 @@ void Application::Execute()
 
 	FlScene::Instance().Initializer();
 
+	FL_PROFILE_THREAD("Main");
+
 	for ( ; ; )
 	{
+		FL_PROFILE_FRAME();
+		FlFrameMemory::Instance().BeginFrame();
+
 		if (GetAsyncKeyState(VK_ESCAPE) & 0x8000)
 		{
 			if (MessageBoxA(m_window.GetWndHandle(), "{ɃQ[I܂H",
@@ -136,10 +143,16 @@ void Application::Execute()
 		// <XV֘A>
 		Update();
 
-		auto titleBar{ std::string{"Falcon IDE <Fps = " + std::to_string(m_spFrameRateController->GetCurrentFPS()) + ">"} };
-		SetWindowTextA(m_window.GetWndHandle(), titleBar.c_str());
+		// t[̂Ńq[vg킸Œ蒷ɏ
+		auto titleBar{ std::array<char, 128>{} };
+		std::format_to_n(titleBar.data(), titleBar.size() - Def::ULongLongOne, "Falcon IDE <Fps = {:.1f} / P99 = {:.2f}ms>",
+			m_spFrameRateController->GetCurrentFPS(), m_spFrameRateController->GetFrameStatistics().p99Ms);
+		SetWindowTextA(m_window.GetWndHandle(), titleBar.data());
 
-		m_spFrameRateController->EndFrame();
+		{
+			FL_PROFILE_SCOPE("FlFrameRateController::EndFrame");
+			m_spFrameRateController->EndFrame();
+		}
 
 		if (!m_window.ProcessMessage()) End();
 		if (m_isEnd) break;
@@ -1,30 +1,181 @@
 #include "FlScene.h"
 
 #include "../../Core/FlEntityComponentSystemKernel.h"
+#include "../../Framework/Module/RuntimeModule/Camera.h"
+#include "../../Framework/Module/RuntimeModule/Transform.h"
+#include "../../Framework/Module/RuntimeModule/ModelRender.h"
+
+namespace
+{
+    constexpr auto ScenePath  { "Assets/Scene/lastTime.flscene" };
+    constexpr auto ChangesPath{ "Assets/Scene/lastTime.flscene.changes" };
+}
 
 void FlScene::Initializer()
 {
     FlEntityComponentSystemKernel::Instance().initialize();
 
-    auto j{ nlohmann::json{} };
-    if (FlJsonUtility::Deserialize(j, "Assets/Scene/lastTime.flscene"))
-        FlEntityComponentSystemKernel::Instance().DeserializeScene(j);
-    else
-        FlEditorAdministrator::Instance().GetLogger()->AddWarningLog("Failed load scene %s", "Assets/Scene/lastTime.flscene");
+    auto& kernel{ FlEntityComponentSystemKernel::Instance() };
+    if (!kernel.LoadScene(ScenePath))
+        FlEditorAdministrator::Instance().GetLogger()->AddWarningLog("Failed load scene %s", ScenePath);
+
+    // OIɑŜۑłȂ (Ȃ) 𓖂Ă
+    if (std::filesystem::exists(ChangesPath) && !kernel.LoadSceneChanges(ChangesPath))
+        FlEditorAdministrator::Instance().GetLogger()->AddWarningLog("Failed load scene changes %s", ChangesPath);
+
+    m_savedVersion = kernel.GetChangeVersion();
+    m_lastAutoSave = std::chrono::steady_clock::now();
 
     FlEditorAdministrator::Instance().RefreshHierarchy();
 }
 
 void FlScene::PostProcess()
 {
-    FlJsonUtility::Serialize(FlEntityComponentSystemKernel::Instance().SerializeScene(), "Assets/Scene/lastTime.flscene");
+    // Ŝۑ獷͗vȂ
+    if (FlEntityComponentSystemKernel::Instance().SaveScene(ScenePath))
+    {
+        std::error_code ec;
+        std::filesystem::remove(ChangesPath, ec);
+    }
 }
 
 void FlScene::Update(float deltaTime)
 {
+    FL_PROFILE_FUNCTION();
+
     if(FlEditorAdministrator::Instance().GetIsStop()) deltaTime = Def::FloatZero;
 
     m_upLoader->Update();
 
+    CullRenderables();
+
     FlEntityComponentSystemKernel::Instance().UpdateAll(deltaTime);
+
+    AutoSave();
+}
+
+void FlScene::AutoSave()
+{
+    const auto now{ std::chrono::steady_clock::now() };
+    if (now - m_lastAutoSave < AutoSaveInterval) return;
+    m_lastAutoSave = now;
+
+    // ςǋL
+    auto& kernel{ FlEntityComponentSystemKernel::Instance() };
+    if (kernel.SaveSceneChanges(ChangesPath, m_savedVersion)) return;
+
+    const auto version{ kernel.GetChangeVersion() };
+    if (!kernel.SaveScene(ScenePath))
+    {
+        FlEditorAdministrator::Instance().GetLogger()->AddWarningLog("Failed auto save scene %s", ScenePath);
+        return;
+    }
+
+    std::error_code ec;
+    std::filesystem::remove(ChangesPath, ec);
+    m_savedVersion = version;
+}
+
+void FlScene::CullRenderables()
+{
+    FL_PROFILE_FUNCTION();
+
+    auto& kernel{ FlEntityComponentSystemKernel::Instance() };
+    auto& culler{ FlFrustumCuller::Instance() };
+
+    // CameraComponent ̓GfB^J̌ɒ萔obt@㏑邽ߗD
+    auto isFound{ false };
+    auto mView{ Def::Mat }, mProj{ Def::Mat };
+
+    for (auto& [id, comp] : kernel.GetComponentsOfType("Camera"))
+    {
+        auto cc{ static_cast<CameraComponent*>(comp) };
+        if (!cc || !cc->m_isEnable) continue;
+
+        auto tc{ static_cast<TransformComponent*>(kernel.GetComponent("Transform", id)) };
+        if (!tc) continue;
+
+        auto mWorld{ tc->m_transform->GetWorldMatrix() };
+
+        // Ǐ]J Camera  Update Ɠʒuɍ킹
+        if (cc->m_targetId != -Def::IntOne)
+            if (auto ttc{ static_cast<TransformComponent*>(kernel.GetComponent("Transform", cc->m_targetId)) })
+                mWorld.Translation(ttc->m_transform->GetLocalPosition() + cc->m_offset);
+
+        mView   = mWorld.Invert();
+        mProj   = cc->m_mProj;
+        isFound = true;
+    }
+
+    if (!isFound && FlEditorAdministrator::Instance().GetEditorCameraIsEnable())
+    {
+        const auto& camera{ FlEditorAdministrator::Instance().GetEditorCamera()->GetCameraData() };
+        mView   = camera.mView;
+        mProj   = camera.mProj;
+        isFound = true;
+    }
+
+    auto& occlusion{ FlOcclusionCuller::Instance() };
+
+    if (!isFound)
+    {
+        culler.Skip();
+        occlusion.Skip();
+        return;
+    }
+
+    culler.Begin(mView, mProj);
+    occlusion.Begin(mView, mProj);
+
+    struct Renderable
+    {
+        entityId              id;
+        ModelRenderComponent* pModelRender;
+        Math::Matrix          mWorld;
+    };
+    // Օ̏I܂ŎgȂ̂Ńt[A[iɒu
+    auto renderables{ FlArenaVector<Renderable>{ FlFrameMemory::Instance().WorkFrameArena() } };
+
+    for (auto& [id, comp] : kernel.GetComponentsOfType("ModelRender"))
+    {
+        auto mc{ static_cast<ModelRenderComponent*>(comp) };
+        if (!mc || !mc->m_spModel) continue;
+
+        auto tc{ static_cast<TransformComponent*>(kernel.GetComponent("Transform", id)) };
+        if (!tc) continue;
+
+        renderables.push_back({ id, mc, tc->m_transform->GetWorldMatrix() });
+        culler.AddModel(id, *mc->m_spModel, renderables.back().mWorld);
+    }
+
+    culler.Execute();
+
+    if (!occlusion.IsEnable()) return;
+
+    // ɎĉՕEΏۂɂ
+    for (const auto& r : renderables)
+    {
+        if (!r.pModelRender->m_isOccluder || !culler.IsEntityVisible(r.id)) continue;
+        occlusion.AddOccluder(*r.pModelRender->m_spModel, r.mWorld);
+    }
+
+    for (const auto& r : renderables)
+    {
+        if (r.pModelRender->m_isOccluder || !culler.IsEntityVisible(r.id)) continue;
+
+        const auto& model{ *r.pModelRender->m_spModel };
+        auto box{ model.GetBounds() };
+        if (model.IsSkinMesh())
+        {
+            box.Extents.x *= FlFrustumCuller::SkinBoundsScale;
+            box.Extents.y *= FlFrustumCuller::SkinBoundsScale;
+            box.Extents.z *= FlFrustumCuller::SkinBoundsScale;
+        }
+
+        auto worldBox{ DirectX::BoundingBox{} };
+        box.Transform(worldBox, r.mWorld);
+        occlusion.AddOccludee(r.id, worldBox);
+    }
+
+    occlusion.Execute();
 }
@@ -20,8 +20,24 @@ public:
 
 private:
 
+    /// <summary>
+    /// 描画前に ModelRender を持つエンティティを有効なカメラの視錐台で判定
+    /// </summary>
+    void CullRenderables();
+
+    /// <summary>
+    /// 前回の保存からの差分を変更の記録に追記 (差分を作れなければ全体を保存し直す)
+    /// </summary>
+    void AutoSave();
+
+    // 自動保存の間隔
+    static constexpr auto AutoSaveInterval{ std::chrono::seconds{ 30 } };
+
     FlScene() {
         m_upLoader = std::make_unique<FlScriptModuleLoader>("Src/Framework/Module/ScriptDLLs/");
     }
     std::unique_ptr<FlScriptModuleLoader> m_upLoader;
+
+    uint64_t                              m_savedVersion = Def::ULongLongZero; // 保存済みの変更の版
+    std::chrono::steady_clock::time_point m_lastAutoSave;
 };
\ No newline at end of file
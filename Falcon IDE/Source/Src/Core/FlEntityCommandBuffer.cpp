@@ -0,0 +1,90 @@
+#include "FlEntityCommandBuffer.h"
+#include "FlEntityComponentSystemKernel.h"
+
+FlEntityCommandBuffer::~FlEntityCommandBuffer()
+{
+    // fȂƎgȂ\ԂicƂ̃Xbg͎wIDłȂj
+    if (m_creates.empty() && m_reservedIds.empty()) return;
+
+    auto& kernel{ FlEntityComponentSystemKernel::Instance() };
+    kernel.CancelReservedIds(m_creates);
+    kernel.CancelReservedIds(m_reservedIds);
+}
+
+entityId FlEntityCommandBuffer::CreateEntity()
+{
+    const auto id{ CreateEmptyEntity() };
+    if (id == InvalidEntityId) return InvalidEntityId;
+
+    AddComponent(id, "Name");
+    AddComponent(id, "Transform");
+    return id;
+}
+
+entityId FlEntityCommandBuffer::CreateEmptyEntity()
+{
+    if (m_reservedIds.empty())
+    {
+        m_reservedIds.resize(ReserveBlockSize);
+        const auto reserved{ FlEntityComponentSystemKernel::Instance().ReserveEntityIds(m_reservedIds) };
+        m_reservedIds.resize(reserved);
+
+        // ԍg
+        std::ranges::reverse(m_reservedIds);
+    }
+    if (m_reservedIds.empty()) return InvalidEntityId;
+
+    const auto id{ m_reservedIds.back() };
+    m_reservedIds.pop_back();
+    m_creates.push_back(id);
+    return id;
+}
+
+void FlEntityCommandBuffer::DestroyEntity(const entityId id)
+{
+    m_destroys.push_back(id);
+}
+
+void FlEntityCommandBuffer::AddComponent(const entityId id, const std::string_view typeName, Initializer initializer)
+{
+    auto index{ UINT32_MAX };
+    if (initializer)
+    {
+        index = static_cast<uint32_t>(m_initializers.size());
+        m_initializers.push_back(std::move(initializer));
+    }
+    m_commands.push_back({ CommandType::Add, InternType(typeName), id, index, nullptr });
+}
+
+void FlEntityCommandBuffer::AddComponentCopy(const entityId id, const std::string_view typeName, void* pSource)
+{
+    m_commands.push_back({ CommandType::AddCopy, InternType(typeName), id, UINT32_MAX, pSource });
+}
+
+void FlEntityCommandBuffer::RemoveComponent(const entityId id, const std::string_view typeName)
+{
+    m_commands.push_back({ CommandType::Remove, InternType(typeName), id, UINT32_MAX, nullptr });
+}
+
+uint32_t FlEntityCommandBuffer::InternType(const std::string_view typeName)
+{
+    // ^Ƃ̂ŒÔ̂Ɍ
+    if (!m_commands.empty() && m_typeNames[m_commands.back().typeIndex] == typeName) return m_commands.back().typeIndex;
+
+    auto key{ std::string{ typeName } };
+    auto [it, isInserted]{ m_typeIndices.try_emplace(key, static_cast<uint32_t>(m_typeNames.size())) };
+    if (isInserted) m_typeNames.push_back(std::move(key));
+    return it->second;
+}
+
+void FlEntityCommandBuffer::Clear()
+{
+    m_commands.clear();
+    m_creates.clear();
+    m_destroys.clear();
+    m_initializers.clear();
+
+    if (m_reservedIds.empty()) return;
+    FlEntityComponentSystemKernel::Instance().CancelReservedIds(m_reservedIds);
+    m_reservedIds.clear();
+}
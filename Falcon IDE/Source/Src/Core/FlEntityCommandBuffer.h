@@ -0,0 +1,90 @@
+#pragma once
+#include "../Module/FlRunTimeAndDLLsCommon.h++"
+
+/// <summary>
+/// ECS ւ̍\̕ύXiGeBeB̐EjAR|[lg̒ǉE폜jL^ĂA
+/// _iFlEntityComponentSystemKernel::FlushCommandBuffersjł܂Ƃ߂Ĕf܂B
+/// obt@̓XbhƁiWorkCommandBufferjȂ̂ŁAL^̓bN܂B
+///  E ID ͂̏ŗ\ς݂Ȃ̂ŁAobt@̖߂eqtɂg܂BiɂȂ͔̂fj
+///  EGeBeBE^ւ̒ǉE폜͍Ō̂̂܂B
+///  Ej͍ŌɍŝŁAt[Œǉ̂Ə܂B
+///  EfȂ܂ܔjobt@̐ƁAfŎgȂ\̓J[l֕Ԃ܂B
+/// </summary>
+class FlEntityCommandBuffer
+{
+public:
+
+    // lފ֐ifAJ[l̊OŎ̂ɌĂԁj
+    using Initializer = std::function<void(void*)>;
+
+    FlEntityCommandBuffer() = default;
+    ~FlEntityCommandBuffer();
+
+    FlEntityCommandBuffer(const FlEntityCommandBuffer&) = delete;
+    FlEntityCommandBuffer& operator=(const FlEntityCommandBuffer&) = delete;
+
+    /// <summary>
+    /// Name / Transform t̃GeBeB𐶐܂BiJ[l CreateEntity Ɠj
+    /// </summary>
+    /// <returns>\񂵂 IDiXbgsꍇ InvalidEntityIdj</returns>
+    entityId CreateEntity();
+
+    /// <summary>
+    /// tȂGeBeB𐶐܂BiʂɐČ^Ƃɕt鎞j
+    /// </summary>
+    entityId CreateEmptyEntity();
+
+    void DestroyEntity(const entityId id);
+
+    void AddComponent(const entityId id, const std::string_view typeName, Initializer initializer = {});
+
+    /// <summary>
+    /// pSource  Reflection  Copy ŕĕt܂BipSource ͔f܂ŐĂƁj
+    /// </summary>
+    void AddComponentCopy(const entityId id, const std::string_view typeName, void* pSource);
+
+    void RemoveComponent(const entityId id, const std::string_view typeName);
+
+    size_t GetCommandCount() const noexcept { return m_commands.size() + m_creates.size() + m_destroys.size(); }
+
+    bool IsEmpty() const noexcept { return GetCommandCount() == Def::ULongLongZero; }
+
+private:
+
+    friend class FlEntityComponentSystemKernel;
+
+    // 1̗\ł܂Ƃ߂Ď ID ̐
+    static constexpr size_t ReserveBlockSize{ 64U };
+
+    enum class CommandType : uint8_t
+    {
+        Add,
+        AddCopy,
+        Remove,
+    };
+
+    struct Command
+    {
+        CommandType type;
+        uint32_t    typeIndex;   // m_typeNames ̈ʒu
+        entityId    id;
+        uint32_t    initializer; // m_initializers ̈ʒui UINT32_MAXj
+        void*       pSource;
+    };
+
+    uint32_t InternType(const std::string_view typeName);
+
+    // fɖ߂ɂAgȂ\Ԃi^͎̃t[֎zj
+    void Clear();
+
+    std::vector<std::string>                  m_typeNames;
+    std::unordered_map<std::string, uint32_t> m_typeIndices;
+
+    FlTrackedVector<Command, FlMemoryTag::Ecs>  m_commands;
+    FlTrackedVector<entityId, FlMemoryTag::Ecs> m_creates;
+    FlTrackedVector<entityId, FlMemoryTag::Ecs> m_destroys;
+    std::vector<Initializer>                    m_initializers;
+
+    // \񂵂܂gĂȂ IDigj
+    FlTrackedVector<entityId, FlMemoryTag::Ecs> m_reservedIds;
+};
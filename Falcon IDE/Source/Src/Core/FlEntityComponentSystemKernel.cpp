@@ -1,4 +1,5 @@
 #include "FlEntityComponentSystemKernel.h"
+#include "FlPrefabCache.h"
 #include "../../Framework/Module/RuntimeModule/ResistCamera.h"
 #include "../../Framework/Module/RuntimeModule/ResistTransform.h"
 #include "../../Framework/Module/RuntimeModule/ResistModelRender.h"
@@ -6,6 +7,7 @@
 #include "../../Framework/Module/RuntimeModule/ResistCollision.h"
 
 #include "../../Framework/Module/RuntimeModule/Transform.h"
+#include "../Framework/Resource/Binary/FlSceneBinaryFormat.h"
 
 template<typename FnType>
 static HMODULE GetModuleFromStdFunction(const std::function<FnType>& f)
@@ -22,6 +24,16 @@ static HMODULE GetModuleFromStdFunction(const std::function<FnType>& f)
     return static_cast<HMODULE>(mbi.AllocationBase);
 }
 
+FlEntityComponentSystemKernel::~FlEntityComponentSystemKernel()
+{
+    // XbgƖȂ̂ŁAꏏɏobt@͗\ԂȂ
+    for (const auto& upBuffer : m_commandBuffers)
+    {
+        upBuffer->buffer.m_creates.clear();
+        upBuffer->buffer.m_reservedIds.clear();
+    }
+}
+
 void FlEntityComponentSystemKernel::initialize()
 {
     ResistCamera ca;
@@ -33,42 +45,145 @@ void FlEntityComponentSystemKernel::initialize()
 
 const entityId FlEntityComponentSystemKernel::CreateEntity()
 {
-    entityId id{ Def::UIntZero };
+    entityId id{ InvalidEntityId };
+    {
+        std::lock_guard<std::mutex> lk(m_mu);
+        id = AllocateId();
+    }
+    if (id == InvalidEntityId)
+    {
+        FlEditorAdministrator::Instance().GetLogger()->AddErrorLog("Entity ID slots exhausted!");
+        return InvalidEntityId;
+    }
 
-    if (!m_freeIds.empty())
+	AddComponent("Name", id);
+	AddComponent("Transform", id);
+
+    return id;
+}
+
+std::vector<entityId> FlEntityComponentSystemKernel::CreateEntities(const size_t count)
+{
+    auto ids{ std::vector<entityId>{} };
+    ids.reserve(count);
     {
-        auto it = m_freeIds.begin();
-        id = *it;
-        m_freeIds.erase(it);
+        std::lock_guard<std::mutex> lk(m_mu);
+        for (auto i{ size_t{} }; i < count; ++i)
+        {
+            const auto id{ AllocateId() };
+            if (id == InvalidEntityId) break;
+            ids.push_back(id);
+        }
+    }
+    if (ids.size() != count)
+        FlEditorAdministrator::Instance().GetLogger()->AddErrorLog("Entity ID slots exhausted! (%zu / %zu)", ids.size(), count);
+
+    return ids;
+}
+
+entityId FlEntityComponentSystemKernel::AllocateId()
+{
+    const auto index{ PopFreeSlot() };
+    if (index == InvalidEntityId) return InvalidEntityId;
+
+    ActivateSlot(index, m_slots[index].generation);
+    return MakeEntityId(index, m_slots[index].generation);
+}
+
+uint32_t FlEntityComponentSystemKernel::PopFreeSlot()
+{
+    // w蔭sŖ܂XbgĚɑޖXbg͓ǂݔ΂
+    while (m_freeHead != InvalidEntityId &&
+        (m_slots[m_freeHead].denseIndex != InvalidEntityId || m_slots[m_freeHead].isRetired))
+    {
+        auto& slot{ m_slots[m_freeHead] };
+        slot.isInFreeList = false;
+        m_freeHead = slot.nextFree;
+    }
+
+    auto index{ m_freeHead };
+    if (index != InvalidEntityId)
+    {
+        auto& slot{ m_slots[index] };
+        slot.isInFreeList = false;
+        m_freeHead = slot.nextFree;
     }
     else
     {
-        id = m_nextId;
-        ++m_nextId;
+        // ő̃Xbgԍ InvalidEntityId ƏdȂ̂ŎgȂ
+        index = static_cast<uint32_t>(m_slots.size());
+        if (index >= EntityIndexMask) return InvalidEntityId;
+        m_slots.emplace_back();
+    }
+    return index;
+}
+
+size_t FlEntityComponentSystemKernel::ReserveEntityIds(std::span<entityId> out)
+{
+    std::lock_guard<std::mutex> lk(m_mu);
+
+    auto reserved{ size_t{} };
+    for (; reserved < out.size(); ++reserved)
+    {
+        const auto index{ PopFreeSlot() };
+        if (index == InvalidEntityId) break;
+
+        auto& slot{ m_slots[index] };
+        slot.isReserved = true;
+        out[reserved] = MakeEntityId(index, slot.generation);
+    }
+    return reserved;
+}
+
+void FlEntityComponentSystemKernel::CancelReservedIds(std::span<const entityId> ids)
+{
+    std::lock_guard<std::mutex> lk(m_mu);
+
+    for (auto id : ids)
+    {
+        const auto index{ GetEntityIndex(id) };
+        if (index >= m_slots.size()) continue;
+
+        auto& slot{ m_slots[index] };
+        if (!slot.isReserved || slot.generation != GetEntityGeneration(id)) continue;
 
-        if (m_nextId == UINT32_MAX)
+        slot.isReserved = false;
+        if (!slot.isInFreeList)
         {
-            //throw std::overflow_error("Entity ID counter overflowed!");
-            FlEditorAdministrator::Instance().GetLogger()->AddWarningLog("Entity ID counter overflowed!");
+            slot.isInFreeList = true;
+            slot.nextFree     = m_freeHead;
+            m_freeHead        = index;
         }
     }
+}
 
-    m_activeIds.insert(id);
+const bool FlEntityComponentSystemKernel::CanActivateSpecified(entityId specifiedId, const bool isRestore) const
+{
+    const auto index{ GetEntityIndex(specifiedId) };
+    if (specifiedId == InvalidEntityId || index >= EntityIndexMask) return false;
+    if (index >= m_slots.size()) return true; // ܂mۂĂȂXbg
 
-	AddComponent("Name", id);
-	AddComponent("Transform", id);
+    const auto& slot{ m_slots[index] };
+    if (slot.denseIndex != InvalidEntityId) return false; // ɃANeBuȃXbgƂĎgĂ (Փ)
+    if (slot.isReserved || slot.isRetired) return false;  // R}hobt@\񒆁Eޖς
 
-    return id;
+    // ς݂̌ÂID͐Ԃ点Ȃ (ɖ߂̒O̐ゾ͕)
+    const auto generation{ GetEntityGeneration(specifiedId) };
+    return generation >= slot.generation || (isRestore && generation + Def::UIntOne == slot.generation);
 }
 
-const bool FlEntityComponentSystemKernel::CreateEntity(entityId specifiedId)
+const bool FlEntityComponentSystemKernel::CreateSpecifiedEntity(entityId specifiedId, const bool isRestore)
 {
-    if (m_activeIds.count(specifiedId)) return false; // ɃANeBuIDƂĎgĂ (Փ)
+    {
+        std::lock_guard<std::mutex> lk(m_mu);
+        if (!CanActivateSpecified(specifiedId, isRestore)) return false;
 
-    m_freeIds.erase(specifiedId);
-    m_activeIds.insert(specifiedId);
+        const auto index{ GetEntityIndex(specifiedId) };
+        if (index >= m_slots.size()) GrowSlots(index);
 
-    m_nextId = std::max(m_nextId, specifiedId + Def::UIntOne);
+        // 󂫃Xg͊OAoɓǂݔ΂
+        ActivateSlot(index, GetEntityGeneration(specifiedId));
+    }
 
 	AddComponent("Name", specifiedId);
 	AddComponent("Transform", specifiedId);
@@ -76,38 +191,128 @@ const bool FlEntityComponentSystemKernel::CreateEntity(entityId specifiedId)
     return true;
 }
 
-const bool FlEntityComponentSystemKernel::ReleaseId(entityId id)
+const bool FlEntityComponentSystemKernel::ReleaseId(entityId id, const bool isRevert)
 {
-    if (m_activeIds.find(id) == m_activeIds.end()) return false; // ݂ȂIDA܂͊ɉς݂ID悤Ƃ
+    std::lock_guard<std::mutex> lk(m_mu);
+    if (!IsActiveLocked(id)) return false; // ݂ȂIDAÂA܂͊ɉς݂ID悤Ƃ
 
-    m_activeIds.erase(id);
+    const auto index{ GetEntityIndex(id) };
+    auto& slot{ m_slots[index] };
 
-    m_freeIds.insert(id);
+    // Ɠւċl߂
+    const auto lastId{ m_aliveIds.back() };
+    m_aliveIds[slot.denseIndex] = lastId;
+    m_slots[GetEntityIndex(lastId)].denseIndex = slot.denseIndex;
+    m_aliveIds.pop_back();
+
+    slot.denseIndex = InvalidEntityId;
+
+    // s̎͐i߂Ȃ
+    if (!isRevert)
+    {
+        // ƓID܂Ă܂̂ŁA̐܂ŎgXbg͑ޖ
+        if (slot.generation == EntityGenerationMask)
+        {
+            slot.isRetired = true;
+            ++m_retiredSlotCount;
+            return true;
+        }
+        ++slot.generation;
+    }
+
+    if (!slot.isInFreeList)
+    {
+        slot.isInFreeList = true;
+        slot.nextFree     = m_freeHead;
+        m_freeHead        = index;
+    }
     return true;
 }
 
+void FlEntityComponentSystemKernel::ActivateSlot(uint32_t index, uint32_t generation)
+{
+    auto& slot{ m_slots[index] };
+    slot.generation = generation;
+    slot.denseIndex = static_cast<uint32_t>(m_aliveIds.size());
+    m_aliveIds.push_back(MakeEntityId(index, generation));
+}
+
+void FlEntityComponentSystemKernel::GrowSlots(uint32_t index)
+{
+    const auto begin{ static_cast<uint32_t>(m_slots.size()) };
+    m_slots.resize(static_cast<size_t>(index) + Def::ULongLongOne);
+
+    // ΂Xbg͏ԍg悤ɐς
+    for (auto i{ index }; i-- > begin; )
+    {
+        auto& slot{ m_slots[i] };
+        slot.isInFreeList = true;
+        slot.nextFree     = m_freeHead;
+        m_freeHead        = i;
+    }
+}
+
 void FlEntityComponentSystemKernel::DestroyEntity(entityId id)
 {
-    for (auto& [_, name, storage] : m_storages) {
-        auto it = storage.components.find(id);
-        if (it != storage.components.end())
+    DestroyEntity(id, false);
+}
+
+void FlEntityComponentSystemKernel::RevertCreatedEntity(entityId id)
+{
+    DestroyEntity(id, true);
+}
+
+void FlEntityComponentSystemKernel::DestroyEntity(entityId id, const bool isRevert)
+{
+    // ̂̔j͗p҂̃R[hiOnDestroyjȂ̂ŃbN̊OŌĂԁi g_runtimeApi Ăł~܂Ȃj
+    struct PendingDestroy
+    {
+        DestroyFn destroy;
+        void*     pComponent;
+    };
+
+    auto scratch { FlScratchScope{} };
+    auto pendings{ scratch.MakeVector<PendingDestroy>() };
+    {
+        std::lock_guard<std::mutex> lk(m_mu);
+
+        // ̂󂷑OɈꗗO
+        for (auto& query : m_queries) RemoveQueryRow(query, id);
+
+        if (IsActiveLocked(id))
         {
-            if (storage.reflection.Destroy && it->second)
-                storage.reflection.Destroy(it->second);
-            storage.components.erase(it);
+            m_destroyed.push_back({ m_changeVersion.fetch_add(Def::ULongLongOne, std::memory_order_acq_rel) + Def::ULongLongOne, id });
+            if (m_destroyed.size() > MaxRemovalRecords) TrimRecords(m_destroyed, m_destroyedHorizon);
+        }
+
+        for (auto& [_, name, storage] : m_storages) {
+            auto it = storage.components.find(id);
+            if (it != storage.components.end())
+            {
+                if (storage.reflection.Destroy && it->second)
+                    pendings.push_back({ storage.reflection.Destroy, it->second });
+                storage.components.erase(it);
+                StampRemoved(storage, id);
+            }
         }
     }
-    ReleaseId(id);
+    ReleaseId(id, isRevert);
+
+    for (const auto& pending : pendings) pending.destroy(pending.pComponent);
 }
 
 void FlEntityComponentSystemKernel::AllDestroyEntities()
 {
-    for (auto& id : m_activeIds)
+    // DestroyEntity  m_aliveIds lߒ̂Ŏʂ
+    for (auto id : GetAllEntityIds())
         DestroyEntity(id);
 }
 
 void FlEntityComponentSystemKernel::RegisterModule(const std::string& typeName, ComponentReflection refl, const priority prio)
 {
+    // ւO Reflection ōvnu̐`A DLL cĂɔj
+    FlPrefabCache::Instance().ReleaseType(typeName);
+
     std::lock_guard<std::mutex> lk(m_mu);
     auto it = FindStorageIterator(typeName);
 
@@ -145,25 +350,74 @@ void* FlEntityComponentSystemKernel::AddComponent(const std::string& name, entit
 
     void* comp = storage.reflection.Create();
     storage.components[entity] = comp;
+    StampChanged(storage, entity);
+    RefreshQueries(name, entity);
     return comp;
 }
 
-void FlEntityComponentSystemKernel::RemoveComponent(const std::string& name, entityId entity)
+size_t FlEntityComponentSystemKernel::AddComponentCopies(const std::string& name, void* src, std::span<const entityId> entities)
 {
     std::lock_guard<std::mutex> lk(m_mu);
     auto itStorage = FindStorageIterator(name);
-    if (itStorage == m_storages.end()) return;
+    if (itStorage == m_storages.end()) return Def::ULongLongZero;
 
     auto& s = std::get<ComponentStorage>(*itStorage);
+    if (!s.reflection.Copy || !src) return Def::ULongLongZero;
 
-    auto it = s.components.find(entity);
-    if (it != s.components.end())
+    s.components.reserve(s.components.size() + entities.size());
+
+    auto copied{ size_t{} };
+    for (auto id : entities)
     {
-        if (s.reflection.Destroy && it->second)
-            s.reflection.Destroy(it->second);
+        auto* comp{ s.reflection.Copy(src) };
+        if (!comp) continue;
+
+        auto [it, isInserted] = s.components.try_emplace(id, comp);
+        if (!isInserted)
+        {
+            if (s.reflection.Destroy && it->second)
+                s.reflection.Destroy(it->second);
+            it->second = comp;
+        }
+        StampChanged(s, id);
+        RefreshQueries(name, id);
+        ++copied;
+    }
+    return copied;
+}
+
+std::optional<ComponentReflection> FlEntityComponentSystemKernel::GetReflection(const std::string_view name) const
+{
+    std::lock_guard<std::mutex> lk(m_mu);
+    auto itStorage = FindStorageIterator(name);
+    if (itStorage == m_storages.end()) return std::nullopt;
+    return std::get<ComponentStorage>(*itStorage).reflection;
+}
+
+void FlEntityComponentSystemKernel::RemoveComponent(const std::string& name, entityId entity)
+{
+    auto destroy   { DestroyFn{} };
+    auto pComponent{ static_cast<void*>(nullptr) };
+    {
+        std::lock_guard<std::mutex> lk(m_mu);
+        auto itStorage = FindStorageIterator(name);
+        if (itStorage == m_storages.end()) return;
+
+        auto& s = std::get<ComponentStorage>(*itStorage);
+
+        auto it = s.components.find(entity);
+        if (it == s.components.end()) return;
+
+        destroy    = s.reflection.Destroy;
+        pComponent = it->second;
 
         s.components.erase(it);
+        StampRemoved(s, entity);
+        RefreshQueries(name, entity);
     }
+
+    // DestroyEntity Ɠp҂̃R[h̓bN̊O
+    if (destroy && pComponent) destroy(pComponent);
 }
 
 void* FlEntityComponentSystemKernel::GetComponent(const std::string& name, entityId entity)
@@ -186,42 +440,419 @@ bool FlEntityComponentSystemKernel::HasComponent(const std::string& name, entity
     return std::get<ComponentStorage>(*itStorage).components.count(entity) != FALSE;
 }
 
+void* FlEntityComponentSystemKernel::WorkComponent(const std::string& name, entityId entity)
+{
+    std::lock_guard<std::mutex> lk(m_mu);
+    auto* pStorage{ FindStorage(name) };
+    if (!pStorage) return nullptr;
+
+    auto it{ pStorage->components.find(entity) };
+    if (it == pStorage->components.end()) return nullptr;
+
+    StampChanged(*pStorage, entity);
+    return it->second;
+}
+
+void FlEntityComponentSystemKernel::MarkComponentChanged(const std::string& name, entityId entity)
+{
+    std::lock_guard<std::mutex> lk(m_mu);
+    auto* pStorage{ FindStorage(name) };
+    if (pStorage && pStorage->components.contains(entity)) StampChanged(*pStorage, entity);
+}
+
+uint64_t FlEntityComponentSystemKernel::GetComponentVersion(const std::string& name, entityId entity) const
+{
+    std::lock_guard<std::mutex> lk(m_mu);
+    const auto* pStorage{ FindStorage(name) };
+    if (!pStorage) return Def::ULongLongZero;
+
+    auto it{ pStorage->versions.find(entity) };
+    return it == pStorage->versions.end() ? Def::ULongLongZero : it->second;
+}
+
+uint64_t FlEntityComponentSystemKernel::GetStorageVersion(const std::string_view name) const
+{
+    std::lock_guard<std::mutex> lk(m_mu);
+    const auto* pStorage{ FindStorage(name) };
+    return pStorage ? pStorage->version : Def::ULongLongZero;
+}
+
+uint64_t FlEntityComponentSystemKernel::GetRemovedVersion(const std::string_view name) const
+{
+    std::lock_guard<std::mutex> lk(m_mu);
+    const auto* pStorage{ FindStorage(name) };
+    return pStorage ? pStorage->removedVersion : Def::ULongLongZero;
+}
+
+bool FlEntityComponentSystemKernel::CollectChangedEntities(const std::string_view name, uint64_t since, std::vector<entityId>& outChanged, std::vector<entityId>* outRemoved) const
+{
+    std::lock_guard<std::mutex> lk(m_mu);
+    const auto* pStorage{ FindStorage(name) };
+    if (!pStorage) return since >= m_typeRemovedVersion;
+
+    return CollectChanges(*pStorage, since, outChanged, outRemoved);
+}
+
+bool FlEntityComponentSystemKernel::CollectChanges(const ComponentStorage& storage, uint64_t since, std::vector<entityId>& outChanged, std::vector<entityId>* outRemoved) const
+{
+    // eGeBeB̍ŐV̋L^E
+    for (auto it{ std::ranges::upper_bound(storage.changes, since, {}, &ChangeRecord::version) }; it != storage.changes.end(); ++it)
+    {
+        auto found{ storage.versions.find(it->id) };
+        if (found != storage.versions.end() && found->second == it->version) outChanged.push_back(it->id);
+    }
+
+    if (outRemoved)
+    {
+        // tꂽ͕̂ύX̑ɓ
+        const auto first{ outRemoved->size() };
+        for (auto it{ std::ranges::upper_bound(storage.removals, since, {}, &ChangeRecord::version) }; it != storage.removals.end(); ++it)
+            if (!storage.components.contains(it->id)) outRemoved->push_back(it->id);
+
+        std::sort(outRemoved->begin() + static_cast<ptrdiff_t>(first), outRemoved->end());
+        outRemoved->erase(std::unique(outRemoved->begin() + static_cast<ptrdiff_t>(first), outRemoved->end()), outRemoved->end());
+    }
+    return since >= storage.removedHorizon && since >= m_typeRemovedVersion;
+}
+
+void FlEntityComponentSystemKernel::CollectChangedRows(queryId query, uint64_t since, std::vector<entityId>& outEntities) const
+{
+    std::lock_guard<std::mutex> lk(m_mu);
+    if (query >= m_queries.size()) return;
+
+    const auto& cache{ m_queries[query] };
+    const auto first{ outEntities.size() };
+    for (const auto& type : cache.required)
+    {
+        const auto* pStorage{ FindStorage(type) };
+        if (!pStorage || pStorage->version <= since) continue;
+
+        for (auto it{ std::ranges::upper_bound(pStorage->changes, since, {}, &ChangeRecord::version) }; it != pStorage->changes.end(); ++it)
+        {
+            auto found{ pStorage->versions.find(it->id) };
+            if (found != pStorage->versions.end() && found->second == it->version && cache.rows.contains(it->id))
+                outEntities.push_back(it->id);
+        }
+    }
+
+    // ̕K{^ςGeBeB1
+    if (cache.required.size() > Def::ULongLongOne)
+    {
+        std::sort(outEntities.begin() + static_cast<ptrdiff_t>(first), outEntities.end());
+        outEntities.erase(std::unique(outEntities.begin() + static_cast<ptrdiff_t>(first), outEntities.end()), outEntities.end());
+    }
+}
+
+uint32_t FlEntityComponentSystemKernel::CopyChangedRows(queryId query, uint64_t since, entityId* outEntities, uint32_t capacity) const
+{
+    auto entities{ std::vector<entityId>{} };
+    CollectChangedRows(query, since, entities);
+
+    const auto count{ static_cast<uint32_t>(entities.size()) };
+    if (outEntities && count <= capacity) std::ranges::copy(entities, outEntities);
+    return count;
+}
+
+void FlEntityComponentSystemKernel::StampChanged(ComponentStorage& storage, entityId id)
+{
+    const auto version{ m_changeVersion.fetch_add(Def::ULongLongOne, std::memory_order_acq_rel) + Def::ULongLongOne };
+    storage.versions.insert_or_assign(id, version);
+    storage.changes.push_back({ version, id });
+    storage.version = version;
+
+    // ÂL^Ă鐔𒴂ŐV̂̂ɋl߂ił̏͂̂܂܁j
+    if (storage.changes.size() > storage.versions.size() * 2U + CompactSlack)
+        std::erase_if(storage.changes, [&](const ChangeRecord& record) {
+            auto it{ storage.versions.find(record.id) };
+            return it == storage.versions.end() || it->second != record.version;
+            });
+}
+
+void FlEntityComponentSystemKernel::StampRemoved(ComponentStorage& storage, entityId id)
+{
+    const auto version{ m_changeVersion.fetch_add(Def::ULongLongOne, std::memory_order_acq_rel) + Def::ULongLongOne };
+    storage.versions.erase(id);
+    storage.removals.push_back({ version, id });
+    storage.version        = version;
+    storage.removedVersion = version;
+
+    if (storage.removals.size() > MaxRemovalRecords) TrimRecords(storage.removals, storage.removedHorizon);
+}
+
+void FlEntityComponentSystemKernel::TrimRecords(FlTrackedVector<ChangeRecord, FlMemoryTag::Ecs>& records, uint64_t& horizon)
+{
+    const auto half{ records.size() / 2U };
+    horizon = records[half - Def::ULongLongOne].version;
+    records.erase(records.begin(), records.begin() + static_cast<ptrdiff_t>(half));
+}
+
+queryId FlEntityComponentSystemKernel::RegisterQuery(std::span<const std::string> required, std::span<const std::string> excluded)
+{
+    if (required.empty() || required.size() > MaxQueryComponents || excluded.size() > MaxQueryComponents)
+    {
+        FlEditorAdministrator::Instance().GetLogger()->AddErrorLog("RegisterQuery: required types must be 1 to %zu and excluded up to %zu (%zu, %zu).",
+            MaxQueryComponents, MaxQueryComponents, required.size(), excluded.size());
+        return InvalidQueryId;
+    }
+
+    // O^͕тɈӖ̂őĂׂ
+    auto excludedTypes{ std::vector<std::string>{ excluded.begin(), excluded.end() } };
+    std::ranges::sort(excludedTypes);
+    excludedTypes.erase(std::unique(excludedTypes.begin(), excludedTypes.end()), excludedTypes.end());
+
+    std::lock_guard<std::mutex> lk(m_mu);
+
+    for (auto i{ size_t{} }; i < m_queries.size(); ++i)
+    {
+        const auto& query{ m_queries[i] };
+        if (std::ranges::equal(query.required, required) && query.excluded == excludedTypes)
+            return static_cast<queryId>(i);
+    }
+
+    const auto id{ static_cast<queryId>(m_queries.size()) };
+    auto& query{ m_queries.emplace_back() };
+    query.required.assign(required.begin(), required.end());
+    query.excluded = std::move(excludedTypes);
+
+    for (const auto& name : query.required) m_queriesByType[name].push_back(id);
+    for (const auto& name : query.excluded) m_queriesByType[name].push_back(id);
+
+    RebuildQuery(query);
+    return id;
+}
+
+uint64_t FlEntityComponentSystemKernel::GetQueryVersion(queryId query) const
+{
+    std::lock_guard<std::mutex> lk(m_mu);
+    return query < m_queries.size() ? m_queries[query].version : Def::ULongLongZero;
+}
+
+bool FlEntityComponentSystemKernel::SyncQuery(queryId query, FlEcsQueryView& view) const
+{
+    std::lock_guard<std::mutex> lk(m_mu);
+    if (query >= m_queries.size()) return false;
+
+    const auto& cache{ m_queries[query] };
+    if (view.version == cache.version) return false;
+
+    view.version = cache.version;
+    view.width   = static_cast<uint32_t>(cache.required.size());
+    view.entities.assign(cache.entities.begin(), cache.entities.end());
+    view.components.assign(cache.components.begin(), cache.components.end());
+    return true;
+}
+
+uint32_t FlEntityComponentSystemKernel::CopyQuery(queryId query, uint64_t* outVersion, uint32_t* outWidth, entityId* outEntities, void** outComponents, uint32_t capacity) const
+{
+    std::lock_guard<std::mutex> lk(m_mu);
+    if (query >= m_queries.size()) return Def::UIntZero;
+
+    const auto& cache{ m_queries[query] };
+    const auto count{ static_cast<uint32_t>(cache.entities.size()) };
+    if (outVersion) *outVersion = cache.version;
+    if (outWidth)   *outWidth   = static_cast<uint32_t>(cache.required.size());
+
+    if (outEntities && outComponents && count <= capacity)
+    {
+        std::ranges::copy(cache.entities, outEntities);
+        std::ranges::copy(cache.components, outComponents);
+    }
+    return count;
+}
+
+void FlEntityComponentSystemKernel::RefreshQueries(const std::string& typeName, entityId id)
+{
+    auto it{ m_queriesByType.find(typeName) };
+    if (it == m_queriesByType.end()) return;
+
+    for (auto query : it->second) RefreshQueryRow(m_queries[query], id);
+}
+
+void FlEntityComponentSystemKernel::RefreshQueryRows(QueryCache& query, std::span<const entityId> ids)
+{
+    const auto width{ query.required.size() };
+
+    // ^̈Ă͍ŏ1񂾂iK{^o^ȂSĊOj
+    auto required{ std::array<const ComponentStorage*, MaxQueryComponents>{} };
+    auto excluded{ std::array<const ComponentStorage*, MaxQueryComponents>{} };
+    auto isRegistered{ true };
+    for (auto i{ size_t{} }; i < width; ++i)
+    {
+        required[i] = FindStorage(query.required[i]);
+        if (!required[i]) isRegistered = false;
+    }
+    for (auto i{ size_t{} }; i < query.excluded.size(); ++i)
+        excluded[i] = FindStorage(query.excluded[i]);
+
+    // ̍s𒴂ꊇǉɍLit[̏ʂ̒ǉŊmۂȂj
+    if (ids.size() > query.entities.size())
+    {
+        query.entities.reserve(query.entities.size() + ids.size());
+        query.components.reserve(query.components.size() + ids.size() * width);
+        query.rows.reserve(query.rows.size() + ids.size());
+    }
+
+    for (auto id : ids)
+    {
+        auto isMatch{ isRegistered && IsActiveLocked(id) };
+
+        for (auto i{ size_t{} }; isMatch && i < query.excluded.size(); ++i)
+            if (excluded[i] && excluded[i]->components.contains(id)) isMatch = false;
+
+        auto components{ std::array<void*, MaxQueryComponents>{} };
+        for (auto i{ size_t{} }; isMatch && i < width; ++i)
+        {
+            const auto it{ required[i]->components.find(id) };
+            if (it == required[i]->components.end()) isMatch = false;
+            else components[i] = it->second;
+        }
+
+        if (!isMatch)
+        {
+            RemoveQueryRow(query, id);
+            continue;
+        }
+
+        auto [it, isInserted]{ query.rows.try_emplace(id, static_cast<uint32_t>(query.entities.size())) };
+        if (isInserted)
+        {
+            query.entities.push_back(id);
+            query.components.insert(query.components.end(), components.begin(), components.begin() + width);
+            query.version = ++m_queryVersion;
+            continue;
+        }
+
+        // uꂽ̂
+        auto row{ query.components.begin() + static_cast<ptrdiff_t>(it->second * width) };
+        if (!std::equal(components.begin(), components.begin() + width, row))
+        {
+            std::copy(components.begin(), components.begin() + width, row);
+            query.version = ++m_queryVersion;
+        }
+    }
+}
+
+void FlEntityComponentSystemKernel::RemoveQueryRow(QueryCache& query, entityId id)
+{
+    auto it{ query.rows.find(id) };
+    if (it == query.rows.end()) return;
+
+    // ̍s󂢂sֈڂ
+    const auto width{ query.required.size() };
+    const auto row  { it->second };
+    const auto last { static_cast<uint32_t>(query.entities.size() - Def::ULongLongOne) };
+    if (row != last)
+    {
+        const auto lastId{ query.entities[last] };
+        query.entities[row] = lastId;
+        std::copy_n(query.components.begin() + static_cast<ptrdiff_t>(last * width), width, query.components.begin() + static_cast<ptrdiff_t>(row * width));
+        query.rows[lastId] = row;
+    }
+
+    query.entities.pop_back();
+    query.components.resize(query.components.size() - width);
+    query.rows.erase(id);
+    query.version = ++m_queryVersion;
+}
+
+void FlEntityComponentSystemKernel::RebuildQuery(QueryCache& query)
+{
+    query.entities.clear();
+    query.components.clear();
+    query.rows.clear();
+    query.version = ++m_queryVersion;
+
+    // K{^̒ňԏȂ̂
+    const ComponentStorage* pSmallest{ nullptr };
+    for (const auto& name : query.required)
+    {
+        const auto storage{ FindStorage(name) };
+        if (!storage) return; // o^̌^K{Ȃ
+        if (!pSmallest || storage->components.size() < pSmallest->components.size()) pSmallest = storage;
+    }
+
+    query.entities.reserve(pSmallest->components.size());
+    query.components.reserve(pSmallest->components.size() * query.required.size());
+    query.rows.reserve(pSmallest->components.size());
+
+    auto scratch   { FlScratchScope{} };
+    auto candidates{ scratch.MakeVector<entityId>() };
+    candidates.reserve(pSmallest->components.size());
+    for (const auto& [id, _] : pSmallest->components) candidates.push_back(id);
+
+    RefreshQueryRows(query, candidates);
+}
+
+void FlEntityComponentSystemKernel::RebuildQueries(const std::string& typeName)
+{
+    auto it{ m_queriesByType.find(typeName) };
+    if (it == m_queriesByType.end()) return;
+
+    for (auto query : it->second) RebuildQuery(m_queries[query]);
+}
+
 void FlEntityComponentSystemKernel::UpdateAll(float dt)
 {
-    struct Snap {
-        std::string name{};
-        entityId id{};
-        void* comp{};
+    FL_PROFILE_FUNCTION();
+
+    // ֐ƖO͌^Ƃ1񂾂TAGeBeB (ID, ) ̑gׂiꎞ̈̓XNb`j
+    struct TypeSnap {
+        std::string_view name{};
         std::function<void(void*, entityId, float)> updateFn{}; // Rs[ĕێ
         HMODULE ownerModule{};
+        uint64_t lastUpdateVersion{};
+        size_t first{};
+        size_t count{};
+    };
+
+    struct EntitySnap {
+        entityId id{};
+        void* comp{};
     };
 
-    std::vector<Snap> snaps;
-    snaps.reserve(Def::BitMaskPos8);
+    auto scratch { FlScratchScope{} };
+    auto types   { scratch.MakeVector<TypeSnap>() };
+    auto entities{ scratch.MakeVector<EntitySnap>() };
 
     { // Xibv擾ibNj
         std::lock_guard<std::mutex> lk(m_mu);
+
+        auto total{ size_t{} };
+        for (auto& [_, name, storage] : m_storages)
+            if (storage.reflection.Update) total += storage.components.size();
+
+        types.reserve(m_storages.size());
+        entities.reserve(total);
+
         for (auto& [_, name, storage] : m_storages)
         {
-            if (!storage.reflection.Update) continue;
+            if (!storage.reflection.Update || storage.components.empty()) continue;
 
-            for (auto& [id, comp] : storage.components)
-            {
-                Snap s;
-                s.name        = name;
-                s.id          = id;
-                s.comp        = comp;
-                s.updateFn    = storage.reflection.Update;
-                s.ownerModule = GetModuleFromStdFunction<void(void*, entityId, float)>(s.updateFn);
-                snaps.push_back(std::move(s));
-            }
+            auto& t = types.emplace_back();
+            t.name        = scratch.CopyString(name);
+            t.updateFn    = storage.reflection.Update;
+            t.ownerModule = GetModuleFromStdFunction<void(void*, entityId, float)>(t.updateFn);
+            t.first       = entities.size();
+
+            // ̊Jn̔łoAO̕ GetLastUpdateVersion œn
+            t.lastUpdateVersion    = storage.updatedVersion;
+            storage.updatedVersion = m_changeVersion.load(std::memory_order_acquire);
+
+            for (auto& [id, comp] : storage.components) entities.push_back({ id, comp });
+
+            t.count       = entities.size() - t.first;
         }
     } // bN
 
-    // eĂяoOɊYW[̃JEg𑝂₵ĂĂяoAI猸炷
-    for (auto& s : snaps)
+    // ^ƂɌĂяoOɊYW[̃JEg𑝂₵ĂĂяoAI猸炷
+    s_isUpdating = true;
+    for (const auto& t : types)
     {
-        HMODULE mod = s.ownerModule;
+#if FL_PROFILER_ENABLED
+        const FlProfiler::Scope typeZone{ FlProfiler::Instance().Intern(t.name) };
+#endif // FL_PROFILER_ENABLED
+
+        HMODULE mod = t.ownerModule;
         if (mod)
         {
             // CNgi}bv\̂ŃbNđj
@@ -233,15 +864,19 @@ void FlEntityComponentSystemKernel::UpdateAll(float dt)
             }
         }
 
-        // siO̓Lb`ăOɏôj
-        try {
-            if (s.updateFn) s.updateFn(s.comp, s.id, dt);
-        }
-        catch (const std::exception& ex) {
-            ToLogError(std::string{ "UpdateAll: exception in updateFn: " } + ex.what());
-        }
-        catch (...) {
-            ToLogError("UpdateAll: unknown exception in updateFn");
+        s_lastUpdateVersion = t.lastUpdateVersion;
+        for (const auto& e : std::span{ entities }.subspan(t.first, t.count))
+        {
+            // siO̓Lb`ăOɏôj
+            try {
+                if (t.updateFn) t.updateFn(e.comp, e.id, dt);
+            }
+            catch (const std::exception& ex) {
+                ToLogError(std::string{ "UpdateAll: exception in updateFn: " } + ex.what());
+            }
+            catch (...) {
+                ToLogError("UpdateAll: unknown exception in updateFn");
+            }
         }
 
         if (mod)
@@ -256,6 +891,258 @@ void FlEntityComponentSystemKernel::UpdateAll(float dt)
             m_moduleCv.notify_all();
         }
     }
+    s_lastUpdateVersion = Def::ULongLongZero;
+    s_isUpdating        = false;
+
+    // _FUpdate ɋL^ꂽ\̕ύX𔽉f
+    FlushCommandBuffers();
+}
+
+FlEntityComponentSystemKernel::RegisteredCommandBuffer& FlEntityComponentSystemKernel::RegisterCommandBuffer()
+{
+    // Xbh̏IŃobt@ic߂͎̔fŗAobt@͎̃Xbh։񂷁j
+    struct Holder
+    {
+        RegisteredCommandBuffer* pBuffer = nullptr;
+        ~Holder() { if (pBuffer) pBuffer->isOrphaned.store(true, std::memory_order_release); }
+    };
+    thread_local auto holder{ Holder{} };
+
+    auto& kernel{ Instance() };
+    std::lock_guard<std::mutex> lk(kernel.m_commandBuffersMu);
+
+    auto pBuffer{ static_cast<RegisteredCommandBuffer*>(nullptr) };
+    for (const auto& upBuffer : kernel.m_commandBuffers)
+    {
+        auto isOrphaned{ true };
+        if (upBuffer->isOrphaned.compare_exchange_strong(isOrphaned, false, std::memory_order_acq_rel))
+        {
+            pBuffer = upBuffer.get();
+            break;
+        }
+    }
+    if (!pBuffer) pBuffer = kernel.m_commandBuffers.emplace_back(std::make_unique<RegisteredCommandBuffer>()).get();
+
+    holder.pBuffer    = pBuffer;
+    s_pCommandBuffer  = pBuffer;
+    return *pBuffer;
+}
+
+size_t FlEntityComponentSystemKernel::FlushCommandBuffers()
+{
+    FL_PROFILE_FUNCTION();
+
+    using CommandType = FlEntityCommandBuffer::CommandType;
+
+    // בւ̌i^ԍ << 32 | IDj͖߂H炸ɔׂ悤ʂĂ
+    struct PendingCommand
+    {
+        uint64_t                              key;
+        FlEntityCommandBuffer*                pBuffer;
+        const FlEntityCommandBuffer::Command* pCommand;
+
+        uint32_t GetTypeIndex() const noexcept { return static_cast<uint32_t>(key >> 32U); }
+        entityId GetId() const noexcept { return static_cast<entityId>(key); }
+    };
+
+    // t̗vNGƃGeBeBiŌɃNG1ŕtj
+    struct DirtyRow
+    {
+        queryId  query;
+        entityId id;
+    };
+
+    struct PendingComponent
+    {
+        entityId id;
+        void*    pComponent; // nullptr Ȃ폜
+    };
+
+    auto scratch{ FlScratchScope{} };
+    auto buffers{ scratch.MakeVector<FlEntityCommandBuffer*>() };
+    {
+        std::lock_guard<std::mutex> lk(m_commandBuffersMu);
+        for (const auto& upBuffer : m_commandBuffers)
+            if (!upBuffer->buffer.IsEmpty()) buffers.push_back(&upBuffer->buffer);
+    }
+    if (buffers.empty()) return Def::ULongLongZero;
+
+    auto applied{ size_t{} };
+
+    // (1) F\񂵂ĂXbg𐶑ɂ
+    {
+        std::lock_guard<std::mutex> lk(m_mu);
+        for (auto pBuffer : buffers)
+        {
+            for (auto id : pBuffer->m_creates)
+            {
+                const auto index{ GetEntityIndex(id) };
+                auto& slot{ m_slots[index] };
+                if (!slot.isReserved || slot.generation != GetEntityGeneration(id)) continue;
+
+                slot.isReserved = false;
+                ActivateSlot(index, slot.generation);
+                ++applied;
+            }
+        }
+    }
+
+    // (2) obt@Ƃ̌^ԍ𑵂A^EGeBeBEL^ɕׂ
+    auto typeNames{ scratch.MakeVector<std::string_view>() };
+    auto commands { scratch.MakeVector<PendingCommand>() };
+    auto remap    { scratch.MakeVector<uint32_t>() };
+
+    auto commandCount{ size_t{} };
+    for (auto pBuffer : buffers) commandCount += pBuffer->m_commands.size();
+    commands.reserve(commandCount);
+
+    for (auto pBuffer : buffers)
+    {
+        remap.clear();
+        for (const auto& name : pBuffer->m_typeNames)
+        {
+            const auto it{ std::ranges::find(typeNames, std::string_view{ name }) };
+            remap.push_back(static_cast<uint32_t>(it - typeNames.begin()));
+            if (it == typeNames.end()) typeNames.push_back(name);
+        }
+
+        for (const auto& command : pBuffer->m_commands)
+            commands.push_back({ (static_cast<uint64_t>(remap[command.typeIndex]) << 32U) | command.id, pBuffer, &command });
+    }
+
+    // ^EGeBeB̒ł͋L^ۂiŌ̖߂j
+    std::ranges::stable_sort(commands, {}, &PendingCommand::key);
+
+    // (3) ^ƂɁÂ̓bN̊OōďA݂̓bN1ł܂Ƃ߂čs
+    auto pendings { scratch.MakeVector<PendingComponent>() };
+    auto dirtyRows{ scratch.MakeVector<DirtyRow>() };
+    for (auto first{ size_t{} }; first < commands.size(); )
+    {
+        const auto typeIndex{ commands[first].GetTypeIndex() };
+        auto last{ first };
+        while (last < commands.size() && commands[last].GetTypeIndex() == typeIndex) ++last;
+
+        const auto name      { std::string{ typeNames[typeIndex] } };
+        const auto reflection{ GetReflection(name) };
+        if (!reflection)
+        {
+            ToLogError("FlushCommandBuffers: unregistered component type " + name);
+            first = last;
+            continue;
+        }
+
+        pendings.clear();
+        for (auto i{ first }; i < last; ++i)
+        {
+            // GeBeBւ̖߂͍Ō̂̂
+            const auto& command{ *commands[i].pCommand };
+            if (i + Def::ULongLongOne < last && commands[i + Def::ULongLongOne].key == commands[i].key) continue;
+
+            if (command.type == CommandType::Remove)
+            {
+                pendings.push_back({ command.id, nullptr });
+                continue;
+            }
+
+            void* comp = nullptr;
+            try {
+                if (command.type == CommandType::AddCopy) comp = reflection->Copy && command.pSource ? reflection->Copy(command.pSource) : nullptr;
+                else                                      comp = reflection->Create ? reflection->Create() : nullptr;
+
+                if (comp && command.initializer != UINT32_MAX) commands[i].pBuffer->m_initializers[command.initializer](comp);
+            }
+            catch (const std::exception& ex) {
+                ToLogError("FlushCommandBuffers: " + name + ": " + ex.what());
+                if (comp && reflection->Destroy) reflection->Destroy(comp);
+                comp = nullptr;
+            }
+            if (comp) pendings.push_back({ command.id, comp });
+        }
+
+        {
+            std::lock_guard<std::mutex> lk(m_mu);
+            auto itStorage = FindStorageIterator(name);
+            auto* pStorage = itStorage == m_storages.end() ? nullptr : &std::get<ComponentStorage>(*itStorage);
+            if (pStorage) pStorage->components.reserve(pStorage->components.size() + pendings.size());
+
+            auto itQueries{ m_queriesByType.find(name) };
+            const auto* pQueries{ itQueries == m_queriesByType.end() ? nullptr : &itQueries->second };
+
+            for (const auto& pending : pendings)
+            {
+                // fɌ^ƊOꂽEȂGeBeB
+                if (!pStorage || (pending.pComponent && !IsActiveLocked(pending.id)))
+                {
+                    if (pending.pComponent && reflection->Destroy) reflection->Destroy(pending.pComponent);
+                    continue;
+                }
+
+                auto it = pStorage->components.find(pending.id);
+                if (it == pStorage->components.end())
+                {
+                    if (!pending.pComponent) continue; // tĂȂ̂̍폜
+
+                    // Vt̂͌ł܂Ƃ߂Ĉꗗ֑
+                    pStorage->components.emplace(pending.id, pending.pComponent);
+                    StampChanged(*pStorage, pending.id);
+                    if (pQueries)
+                        for (auto query : *pQueries) dirtyRows.push_back({ query, pending.id });
+                    ++applied;
+                    continue;
+                }
+
+                // 폜Eu͉󂵂̂ꗗɎcȂ悤̏ŕt
+                if (reflection->Destroy && it->second) reflection->Destroy(it->second);
+                if (pending.pComponent)
+                {
+                    it->second = pending.pComponent;
+                    StampChanged(*pStorage, pending.id);
+                }
+                else
+                {
+                    pStorage->components.erase(it);
+                    StampRemoved(*pStorage, pending.id);
+                }
+                RefreshQueries(name, pending.id);
+                ++applied;
+            }
+        }
+        first = last;
+    }
+
+    // ̌^tGeBeBNGƂ1񂾂t
+    if (!dirtyRows.empty())
+    {
+        std::ranges::sort(dirtyRows, {}, [](const DirtyRow& row) { return (static_cast<uint64_t>(row.query) << 32U) | row.id; });
+
+        auto ids{ scratch.MakeVector<entityId>() };
+        std::lock_guard<std::mutex> lk(m_mu);
+        for (auto first{ size_t{} }; first < dirtyRows.size(); )
+        {
+            const auto query{ dirtyRows[first].query };
+            ids.clear();
+            for (; first < dirtyRows.size() && dirtyRows[first].query == query; ++first)
+                if (ids.empty() || ids.back() != dirtyRows[first].id) ids.push_back(dirtyRows[first].id);
+
+            RefreshQueryRows(m_queries[query], ids);
+        }
+    }
+
+    // (4) jiID1j
+    auto destroys{ scratch.MakeVector<entityId>() };
+    for (auto pBuffer : buffers) destroys.insert(destroys.end(), pBuffer->m_destroys.begin(), pBuffer->m_destroys.end());
+    std::ranges::sort(destroys);
+    destroys.erase(std::unique(destroys.begin(), destroys.end()), destroys.end());
+
+    for (auto id : destroys)
+    {
+        if (!IsActive(id)) continue;
+        DestroyEntity(id);
+        ++applied;
+    }
+
+    for (auto pBuffer : buffers) pBuffer->Clear();
+    return applied;
 }
 
 nlohmann::json FlEntityComponentSystemKernel::SerializeEntity(entityId id)
@@ -285,21 +1172,64 @@ void FlEntityComponentSystemKernel::DeserializeEntity(entityId id, const nlohman
 
 nlohmann::json FlEntityComponentSystemKernel::SerializeScene()
 {
-	auto scene{ nlohmann::json{} };
-	for (auto id : m_activeIds)
+	nlohmann::json scene;
+	for (auto id : m_aliveIds)
 		scene["Entities"][std::to_string(id)] = SerializeEntity(id);
 
+	// vnũCX^X͌̃vnuƍiGeBeB̒g͏ɑSēĂj
+	if (nlohmann::json prefabs = FlPrefabCache::Instance().SerializeInstances(); !prefabs.empty())
+		scene["Prefabs"] = std::move(prefabs);
+
 	return scene;
 }
 
 void FlEntityComponentSystemKernel::DeserializeScene(const nlohmann::json& src)
 {
 	if (!src.contains("Entities")) return;
+
+	auto remap{ std::unordered_map<entityId, entityId>{} };
+	auto ids  { std::vector<entityId>{} };
 	for (auto& [idStr, compJson] : src["Entities"].items()) {
-		entityId id{ std::stoul(idStr) };
-		CreateEntity(id);
+		const auto id{ CreateLoadedEntity(static_cast<entityId>(std::stoul(idStr)), remap) };
+		if (id == InvalidEntityId) continue;
+
 		DeserializeEntity(id, compJson);
+		ids.push_back(id);
 	}
+	RemapTransformLinks(ids, remap);
+
+	if (src.contains("Prefabs")) FlPrefabCache::Instance().DeserializeInstances(src["Prefabs"], remap);
+}
+
+entityId FlEntityComponentSystemKernel::CreateLoadedEntity(entityId id, std::unordered_map<entityId, entityId>& remap)
+{
+    if (CreateEntity(id)) return id;
+
+    // E\񒆁Eޖς݂̃XbgÂwĂVIDō
+    const auto newId{ CreateEntity() };
+    if (newId == InvalidEntityId) return InvalidEntityId;
+
+    FlEditorAdministrator::Instance().GetLogger()->AddWarningLog("Entity %u could not be restored and was loaded as %u", id, newId);
+    remap[id] = newId;
+    return newId;
+}
+
+void FlEntityComponentSystemKernel::RemapTransformLinks(std::span<const entityId> ids, const std::unordered_map<entityId, entityId>& remap)
+{
+    if (remap.empty()) return;
+
+    auto map{ [&](entityId& id) {
+        if (const auto it{ remap.find(id) }; it != remap.end()) id = it->second;
+    } };
+
+    for (auto id : ids)
+    {
+        auto tc{ static_cast<TransformComponent*>(GetComponent("Transform", id)) };
+        if (!tc) continue;
+
+        if (tc->m_parent != UINT32_MAX) map(tc->m_parent);
+        for (auto& child : tc->m_children) map(child);
+    }
 }
 
 void FlEntityComponentSystemKernel::DeserializeScene(
@@ -336,12 +1266,249 @@ void FlEntityComponentSystemKernel::DeserializeScene(
 		}
 	}
 
+	if (src.contains("Prefabs")) FlPrefabCache::Instance().DeserializeInstances(src["Prefabs"], localRemap);
+
 	if (outRemap)
 		*outRemap = std::move(localRemap);
 }
 
+nlohmann::json FlEntityComponentSystemKernel::SerializeSceneChanges(uint64_t since)
+{
+    nlohmann::json delta;
+    auto isComplete{ true };
+
+    auto changed{ std::vector<entityId>{} };
+    auto removed{ std::vector<entityId>{} };
+
+    std::lock_guard<std::mutex> lk(m_mu);
+    delta["Version"] = GetChangeVersion();
+
+    for (auto& [_, name, storage] : m_storages)
+    {
+        if (storage.version <= since) continue; // ^ƕςĂȂ
+
+        changed.clear();
+        removed.clear();
+        if (!CollectChanges(storage, since, changed, &removed)) isComplete = false;
+
+        if (storage.reflection.Serialize)
+        {
+            for (auto id : changed)
+            {
+                if (!IsActiveLocked(id)) continue;
+
+                nlohmann::json cjson;
+                storage.reflection.Serialize(storage.components.at(id), cjson);
+                delta["Entities"][std::to_string(id)][name] = std::move(cjson);
+            }
+        }
+
+        // jŊOꂽ̂ Destroyed ɔC
+        std::erase_if(removed, [&](entityId id) { return !IsActiveLocked(id); });
+        if (!removed.empty()) delta["Removed"][name] = removed;
+    }
+
+    nlohmann::json destroyed = nlohmann::json::array();
+    for (auto it{ std::ranges::upper_bound(m_destroyed, since, {}, &ChangeRecord::version) }; it != m_destroyed.end(); ++it)
+        if (!IsActiveLocked(it->id)) destroyed.push_back(it->id);
+
+    delta["Destroyed"] = std::move(destroyed);
+    delta["Complete"]  = isComplete && since >= m_destroyedHorizon && since >= m_typeRemovedVersion;
+    return delta;
+}
+
+void FlEntityComponentSystemKernel::DeserializeSceneChanges(const nlohmann::json& src)
+{
+    if (src.contains("Destroyed"))
+        for (const auto& id : src["Destroyed"])
+            if (IsActive(id.get<entityId>())) DestroyEntity(id.get<entityId>());
+
+    if (src.contains("Removed"))
+        for (auto& [name, ids] : src["Removed"].items())
+            for (const auto& id : ids) RemoveComponent(name, id.get<entityId>());
+
+    if (!src.contains("Entities")) return;
+
+    for (auto& [idStr, compJson] : src["Entities"].items())
+    {
+        const entityId id{ static_cast<entityId>(std::stoul(idStr)) };
+        if (!IsActive(id) && !CreateEntity(id)) continue;
+
+        // DeserializeEntity ƓDxɁAtĂ̂͂̂܂܏㏑
+        for (auto& [_, name, storage] : m_storages)
+        {
+            if (!compJson.contains(name) || !storage.reflection.Deserialize) continue;
+
+            void* comp = GetComponent(name, id);
+            if (!comp) comp = AddComponent(name, id);
+            if (!comp) continue;
+
+            storage.reflection.Deserialize(comp, compJson[name]);
+            MarkComponentChanged(name, id);
+        }
+    }
+}
+
+std::vector<uint8_t> FlEntityComponentSystemKernel::SerializeSceneBinary(const bool isCompress)
+{
+    auto writer{ FlSceneBinaryFormat::Writer{} };
+    writer.SetEntities({ m_aliveIds.begin(), m_aliveIds.end() });
+    if (nlohmann::json prefabs = FlPrefabCache::Instance().SerializeInstances(); !prefabs.empty())
+        writer.SetPrefabs(nlohmann::json::to_msgpack(prefabs));
+
+    auto buffer{ std::vector<uint8_t>{} };
+    for (auto& [_, name, storage] : m_storages)
+    {
+        if (!storage.reflection.Serialize) continue;
+
+        const auto type{ writer.AddType(name) };
+        for (auto& [id, comp] : storage.components)
+        {
+            if (!IsActive(id)) continue;
+
+            nlohmann::json cjson;
+            storage.reflection.Serialize(comp, cjson);
+
+            buffer.clear();
+            nlohmann::json::to_msgpack(cjson, buffer);
+            writer.AddComponent(type, id, buffer);
+        }
+    }
+    return writer.Finish(isCompress);
+}
+
+bool FlEntityComponentSystemKernel::DeserializeSceneBinary(std::span<const uint8_t> src)
+{
+    auto scene{ FlSceneBinaryFormat::SceneData{} };
+    if (!FlSceneBinaryFormat::Read(src, scene))
+    {
+        ToLogError("DeserializeSceneBinary: invalid or unsupported scene data");
+        return false;
+    }
+
+    auto remap{ std::unordered_map<entityId, entityId>{} };
+    auto ids  { std::vector<entityId>{} };
+    ids.reserve(scene.entities.size());
+    for (auto id : scene.entities)
+    {
+        const auto loadedId{ CreateLoadedEntity(id, remap) };
+        if (loadedId != InvalidEntityId) ids.push_back(loadedId);
+    }
+    auto toLoaded{ [&](entityId id) {
+        const auto it{ remap.find(id) };
+        return it == remap.end() ? id : it->second;
+    } };
+
+    auto blocks{ std::unordered_map<std::string_view, const FlSceneBinaryFormat::ComponentBlock*>{} };
+    for (const auto& block : scene.blocks) blocks.emplace(block.typeName, &block);
+
+    // DeserializeEntity ƓDxɗށiǂݍ܂ĂȂ^͔΂j
+    for (auto& [_, name, storage] : m_storages)
+    {
+        auto it = blocks.find(name);
+        if (it == blocks.end() || !storage.reflection.Deserialize) continue;
+
+        const auto& block{ *it->second };
+        for (auto i{ size_t{} }; i < block.entities.size(); ++i)
+        {
+            void* comp = AddComponent(name, toLoaded(block.entities[i]));
+            if (!comp) continue;
+
+            try {
+                const auto data{ block.GetData(i) };
+                storage.reflection.Deserialize(comp, nlohmann::json::from_msgpack(data.begin(), data.end()));
+            }
+            catch (const std::exception& ex) {
+                ToLogError(std::string{ "DeserializeSceneBinary: " } + name + ": " + ex.what());
+            }
+        }
+    }
+    RemapTransformLinks(ids, remap);
+
+    if (!scene.prefabs.empty())
+    {
+        try {
+            FlPrefabCache::Instance().DeserializeInstances(nlohmann::json::from_msgpack(scene.prefabs), remap);
+        }
+        catch (const std::exception& ex) {
+            ToLogError(std::string{ "DeserializeSceneBinary: Prefabs: " } + ex.what());
+        }
+    }
+    return true;
+}
+
+bool FlEntityComponentSystemKernel::SaveScene(const std::filesystem::path& path)
+{
+    if (path.extension() == ".flsceneb")
+        return FlSceneBinaryFormat::SaveFile(path, SerializeSceneBinary());
+
+    return FlJsonUtility::Serialize(SerializeScene(), path);
+}
+
+bool FlEntityComponentSystemKernel::LoadScene(const std::filesystem::path& path)
+{
+    auto bytes{ std::vector<uint8_t>{} };
+    if (!FlSceneBinaryFormat::LoadFile(path, bytes)) return false;
+
+    // ꂽt@CŊmہEϊɎsĂǂݍ݂̎sƂĕԂ
+    try {
+        if (FlSceneBinaryFormat::IsBinaryScene(bytes))
+            return DeserializeSceneBinary(bytes);
+
+        DeserializeScene(nlohmann::json::parse(bytes.begin(), bytes.end()));
+        return true;
+    }
+    catch (const std::exception& ex) {
+        ToLogError(std::string{ "LoadScene: " } + path.string() + ": " + ex.what());
+        return false;
+    }
+}
+
+bool FlEntityComponentSystemKernel::SaveSceneChanges(const std::filesystem::path& path, uint64_t& since)
+{
+    const nlohmann::json delta = SerializeSceneChanges(since);
+    if (!delta["Complete"].get<bool>()) return false;
+
+    const auto version{ delta["Version"].get<uint64_t>() };
+    if (version == since) return true; // ςĂȂ
+
+    // 1s1̍ (rŗĂIs܂ł͓Ă)
+    auto ofs{ std::ofstream{ path, std::ios::binary | std::ios::app } };
+    if (!ofs) return false;
+
+    ofs << delta.dump() << '\n';
+    if (!ofs.flush()) return false;
+
+    since = version;
+    return true;
+}
+
+bool FlEntityComponentSystemKernel::LoadSceneChanges(const std::filesystem::path& path)
+{
+    auto ifs{ std::ifstream{ path, std::ios::binary } };
+    if (!ifs) return false;
+
+    auto line{ std::string{} };
+    while (std::getline(ifs, line))
+    {
+        if (line.empty()) continue;
+
+        // ̍sŎ~߂ (܂ł͓Ă)
+        const nlohmann::json delta = nlohmann::json::parse(line, nullptr, false);
+        if (delta.is_discarded())
+        {
+            ToLogError("LoadSceneChanges: " + path.string() + ": broken record");
+            return false;
+        }
+        DeserializeSceneChanges(delta);
+    }
+    return true;
+}
+
 void FlEntityComponentSystemKernel::ClearComponent(const std::string_view name)
 {
+    FlPrefabCache::Instance().ReleaseType(std::string{ name });
+
     std::lock_guard<std::mutex> lk(m_mu);
     auto itStorage = FindStorageIterator(name);
     if (itStorage == m_storages.end()) return;
@@ -353,12 +1520,19 @@ void FlEntityComponentSystemKernel::ClearComponent(const std::string_view name)
     }
     s.components.clear();
     m_storages.erase(itStorage);
+
+    // ^Ə̂ŁAO͍̍Ȃ
+    m_typeRemovedVersion = m_changeVersion.fetch_add(Def::ULongLongOne, std::memory_order_acq_rel) + Def::ULongLongOne;
+
+    RebuildQueries(std::string{ name });
 }
 
 void FlEntityComponentSystemKernel::RemoveAllComponentsByModule(HMODULE module)
 {
     if (!module) return;
 
+    auto releasedTypes{ std::vector<std::string>{} };
+
     // (1) bNđΏۂ̌^WđɔjiR|[lĝ Destroyj
     {
         std::lock_guard<std::mutex> lk(m_mu);
@@ -403,6 +1577,8 @@ void FlEntityComponentSystemKernel::RemoveAllComponentsByModule(HMODULE module)
 
             if (belongs)
             {
+                releasedTypes.push_back(typeName);
+
                 // Destroy components
                 for (auto& [id, comp] : storage.components)
                 {
@@ -419,8 +1595,18 @@ void FlEntityComponentSystemKernel::RemoveAllComponentsByModule(HMODULE module)
             }
             else ++it;
         }
+
+        if (!releasedTypes.empty())
+            m_typeRemovedVersion = m_changeVersion.fetch_add(Def::ULongLongOne, std::memory_order_acq_rel) + Def::ULongLongOne;
+
+        for (const auto& typeName : releasedTypes)
+            RebuildQueries(typeName);
     }
 
+    // vnu̐` DLL  Destroy ŔjibNOŁj
+    for (const auto& typeName : releasedTypes)
+        FlPrefabCache::Instance().ReleaseType(typeName);
+
     // (2) ANeBuR[Î҂iW[Ƃ̃JEg 0 ɂȂ܂Łj
     {
         std::unique_lock<std::mutex> lk(m_moduleCallsMu);
@@ -437,10 +1623,7 @@ void FlEntityComponentSystemKernel::RemoveAllComponentsByModule(HMODULE module)
 std::vector<entityId> FlEntityComponentSystemKernel::GetAllEntityIds() const
 {
     std::lock_guard<std::mutex> lk(m_mu);
-    std::vector<entityId> out;
-    out.reserve(m_activeIds.size());
-    for (auto id : m_activeIds) out.push_back(id);
-    return out;
+    return { m_aliveIds.begin(), m_aliveIds.end() };
 }
 
 std::vector<std::string> FlEntityComponentSystemKernel::GetRegisteredComponentTypes() const
@@ -452,6 +1635,19 @@ std::vector<std::string> FlEntityComponentSystemKernel::GetRegisteredComponentTy
     return out;
 }
 
+std::vector<std::pair<entityId, void*>> FlEntityComponentSystemKernel::GetComponentsOfType(const std::string_view name) const
+{
+    std::lock_guard<std::mutex> lk(m_mu);
+    std::vector<std::pair<entityId, void*>> out;
+    auto it = FindStorageIterator(name);
+    if (it == m_storages.end()) return out;
+
+    const auto& storage = std::get<ComponentStorage>(*it);
+    out.reserve(storage.components.size());
+    for (auto& [id, comp] : storage.components) out.emplace_back(id, comp);
+    return out;
+}
+
 std::vector<std::string> FlEntityComponentSystemKernel::GetEntityComponentTypes(entityId id) const
 {
     std::lock_guard<std::mutex> lk(m_mu);
@@ -462,16 +1658,38 @@ std::vector<std::string> FlEntityComponentSystemKernel::GetEntityComponentTypes(
     return out;
 }
 
-bool FlEntityComponentSystemKernel::RenderComponentEditor(const std::string& typeName, entityId id) const
+bool FlEntityComponentSystemKernel::RenderComponentEditor(const std::string& typeName, entityId id)
 {
+    // RenderEditor ͗p҂̃R[hȂ̂ŃbN̊OŌĂсAłi߂鎞蒼
+    auto render    { RenderEditorFn{} };
+    auto pComponent{ static_cast<void*>(nullptr) };
+    {
+        std::lock_guard<std::mutex> lk(m_mu);
+        auto it = FindStorageIterator(typeName);
+        if (it == m_storages.end()) return false;
+        auto& storage = std::get<ComponentStorage>(*it);
+        if (!storage.reflection.RenderEditor) return false;
+        auto compIt = storage.components.find(id);
+        if (compIt == storage.components.end()) return false;
+
+        render     = storage.reflection.RenderEditor;
+        pComponent = compIt->second;
+    }
+
+    // O[vɂ܂Ƃ߂ƁÂǂꂩҏW
+    ImGui::BeginGroup();
+    render(pComponent, id);
+    ImGui::EndGroup();
+
+    if (!ImGui::IsItemEdited()) return true;
+
     std::lock_guard<std::mutex> lk(m_mu);
     auto it = FindStorageIterator(typeName);
-    if (it == m_storages.end()) return false;
-    const auto& storage = std::get<ComponentStorage>(*it);
-    if (!storage.reflection.RenderEditor) return false;
-    auto compIt = storage.components.find(id);
-    if (compIt == storage.components.end()) return false;
+    if (it == m_storages.end()) return true;
 
-    storage.reflection.RenderEditor(compIt->second, id);
+    // `撆ɊOꂽEuꂽ̂̕ҏW͐Ȃ
+    auto& storage = std::get<ComponentStorage>(*it);
+    auto compIt = storage.components.find(id);
+    if (compIt != storage.components.end() && compIt->second == pComponent) StampChanged(storage, id);
     return true;
 }
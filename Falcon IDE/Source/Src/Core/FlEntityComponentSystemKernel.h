@@ -1,52 +1,126 @@
 #pragma once
 #include "../Module/FlRunTimeAndDLLsCommon.h++"
+#include "FlEntityCommandBuffer.h"
 
 class FlEntityComponentSystemKernel
 {
 public:
 
+    // ύX̋L^ (ł͑SĂ̌^Œʂ̔ԍ)
+    struct ChangeRecord
+    {
+        uint64_t version;
+        entityId id;
+    };
+
     struct ComponentStorage {
-        std::unordered_map<uint32_t, void*> components;
+        FlTrackedUnorderedMap<uint32_t, void*, FlMemoryTag::Ecs> components;
         ComponentReflection reflection;
+
+        // GeBeB  ŌɒǉEύXꂽ
+        FlTrackedUnorderedMap<entityId, uint64_t, FlMemoryTag::Ecs> versions;
+
+        // ł̏ɕ񂾋L^ (ÂL^ versions ƐHႤ̂œǂݔ΂B܂l߂)
+        FlTrackedVector<ChangeRecord, FlMemoryTag::Ecs> changes;
+        FlTrackedVector<ChangeRecord, FlMemoryTag::Ecs> removals;
+
+        uint64_t version        = Def::ULongLongZero; // ǉEύXE폜̂ǂꂩŌ̔
+        uint64_t removedVersion = Def::ULongLongZero; // ŌɊOꂽ
+        uint64_t removedHorizon = Def::ULongLongZero; // ȑO̍폜̋L^͎̂Ă
+        uint64_t updatedVersion = Def::ULongLongZero; // O Update ̊Jn̔
     };
 
     void initialize();
 
     /**
-     * @brief VID𔭍s邩Aėp\IDԂ (s)
-     * @return ӂEntity ID
+     * @brief VID𔭍s邩Aς݃Xbg̐ōėp (s)
+     * @return ӂEntity ID (Xbgsꍇ InvalidEntityId)
      */
     const entityId CreateEntity(); // FreeList
 
     /**
      * @brief w肳ꂽIDgpEntityo^ (w蔭s)
-     * @param specifiedId o^ID
-     * @return o^ɐ (Փ˂ꍇ false)
+     * @param specifiedId o^ID (XbgԍƐ̂܂܎g)
+     * @return o^ɐ (ՓˁEޖXbgEXbg̍̐Â̏ꍇ false)
+     * @note ͐i߂ɂȂ̂ŁAς݂̌ÂIDԂ邱Ƃ͂Ȃ
+     */
+    const bool CreateEntity(entityId specifiedId) { return CreateSpecifiedEntity(specifiedId, false); }
+
+    /**
+     * @brief ɖ߂̂߁AOɉID̂܂ܐԂ点
+     * @param id Entity ID (Xbg̐オID̎̂܂܂ŁAɎgĂȂ)
+     * @return Ԃ点 (ȌɍėpE\񂳂ꂽXbgAޖXbg false)
+     */
+    const bool RestoreEntity(entityId id) { return CreateSpecifiedEntity(id, true); }
+
+    /**
+     * @brief CreateEntity(specifiedId) / RestoreEntity 邩Aςɒׂ
+     */
+    const bool CanCreateEntity(entityId specifiedId, const bool isRestore = false) const
+    {
+        std::lock_guard<std::mutex> lk(m_mu);
+        return CanActivateSpecified(specifiedId, isRestore);
+    }
+
+    /**
+     * @brief ID count ܂Ƃ߂Ĕs (bN1AName/Transform ͕tȂ)
+     * @return słID (Xbgsꍇ count )
+     */
+    std::vector<entityId> CreateEntities(const size_t count);
+
+
+    /**
+     * @brief 󂫃Xbg𐶑ɂɊmۂ (FlEntityCommandBuffer fOIDg)
+     * @return \ł (Xbgsꍇ out ̑傫)
      */
-    const bool CreateEntity(entityId specifiedId);
+    size_t ReserveEntityIds(std::span<entityId> out);
 
+    // gȂ\󂫃Xg֖߂
+    void CancelReservedIds(std::span<const entityId> ids);
 
     /**
-     * @brief gpς݂IDAėp\ɂ
+     * @brief gpς݂IDAXbg̐i߂čėp\ɂ
      * @param id Entity ID
-     * @return ɐ (ID݂Ȃꍇ false)
+     * @param isRevert i߂ɁAsȌԂ֖߂ (RevertCreatedEntity)
+     * @note オɒBXbg͈ɑޖAȌ͎gȂ
+     * @return ɐ (ID݂ȂEÂ̏ꍇ false)
      */
-    const bool ReleaseId(entityId id);
+    const bool ReleaseId(entityId id, const bool isRevert = false);
 
     /**
-     * @brief w肳ꂽIDݎgpmF
+     * @brief w肳ꂽIDݎgpmF (XNvg̃XbhĂ΂̂ m_mu )
      * @param id mFID
-     * @return gpł true
+     * @return gpオv true
      */
-    const bool IsActive(entityId id) const { return m_activeIds.count(id) > Def::UIntZero; }
+    const bool IsActive(entityId id) const
+    {
+        std::lock_guard<std::mutex> lk(m_mu);
+        return IsActiveLocked(id);
+    }
+
+    /**
+     * @brief ޖXbg̐ (g؂Xbg͍ėpȂ)
+     */
+    const size_t GetRetiredSlotCount() const
+    {
+        std::lock_guard<std::mutex> lk(m_mu);
+        return m_retiredSlotCount;
+    }
 
     /**
      * @brief ݃ANeBuID̐Ԃ
      */
-    const size_t GetActiveIdCount() const { return m_activeIds.size(); }
+    const size_t GetActiveIdCount() const { return m_aliveIds.size(); }
 
 	void DestroyEntity(entityId id);
 
+    /**
+     * @brief ɖ߂̂߁AGeBeBjăXbgO̐ɖ߂
+     * @note 蒼ł͓ID RestoreEntity ō蒼ȂOɂ̃XbgŉID߂悤ɂȂB
+     *       ɂID͎̔sł܂ĝŁA̕ҏWɎg
+     */
+    void RevertCreatedEntity(entityId id);
+
     void AllDestroyEntities();
 
     void RegisterModule(const std::string& typeName, ComponentReflection refl, const priority prio = Def::BitMaskPos4);
@@ -54,6 +128,12 @@ public:
     // R|[lgǉ
     void* AddComponent(const std::string& name, entityId entity);
 
+    // src  Copy ŕ entities SĂɕtiɂΒujB߂l͕t
+    size_t AddComponentCopies(const std::string& name, void* src, std::span<const entityId> entities);
+
+    // o^Ă^ Reflection ̎ʂ
+    std::optional<ComponentReflection> GetReflection(const std::string_view name) const;
+
     // 폜
     void RemoveComponent(const std::string& name, entityId entity);
 
@@ -62,19 +142,130 @@ public:
 
     bool HasComponent(const std::string& name, entityId entity) const;
 
-    // UpdateifbhbNj
+    // 1̃NGŎwłK{^EO^ꂼ̐
+    static constexpr size_t MaxQueryComponents{ 8U };
+
+    /**
+     * @brief K{^SĎAO^1ȂGeBeB̈ꗗo^
+     *        ꗗ̓R|[lg̒ǉE폜EGeBeB̔jōXVAȂ
+     * @param required K{^ (т SyncQuery ̗ɂȂB1`MaxQueryComponents )
+     * @param excluded O^ (MaxQueryComponents ܂)
+     * @return Ȃ瓯ID (sȂ InvalidQueryId)
+     */
+    queryId RegisterQuery(std::span<const std::string> required, std::span<const std::string> excluded = {});
+
+    // ꗗς邽тɑ (0 ͖)
+    uint64_t GetQueryVersion(queryId query) const;
+
+    /**
+     * @brief ꗗ view.version ςĂ view Ɏʂ
+     * @return ʂ true
+     */
+    bool SyncQuery(queryId query, FlEcsQueryView& view) const;
+
+    // C ABI pBsԂAcapacity ȉ̎ outEntities[capacity]  outComponents[capacity * ] Ɏʂ
+    uint32_t CopyQuery(queryId query, uint64_t* outVersion, uint32_t* outWidth, entityId* outEntities, void** outComponents, uint32_t capacity) const;
+
+    // ގ̎Q (GetComponent ƓύX̔łi߂)
+    void* WorkComponent(const std::string& name, entityId entity);
+
+    // |C^܂܏ɕύXm点
+    void MarkComponentChanged(const std::string& name, entityId entity);
+
+    // ŌɐUύX̔ (oĂAɁu̕ύXv𕷂)
+    uint64_t GetChangeVersion() const noexcept { return m_changeVersion.load(std::memory_order_acquire); }
+
+    // ŌɒǉEύXꂽ (tĂȂ 0)
+    uint64_t GetComponentVersion(const std::string& name, entityId entity) const;
+
+    // ^̂ǂꂩǉEύXE폜ꂽŌ̔ (since ȉȂ^Ɠǂݔ΂)
+    uint64_t GetStorageVersion(const std::string_view name) const;
+
+    // ^̂ǂꂩOꂽŌ̔
+    uint64_t GetRemovedVersion(const std::string_view name) const;
+
+    /**
+     * @brief Update ̒ŌĂԂƁǍ^̑O Update ̊Jn̔łԂ
+     *        Vł̃R|[lgO Update ς ( 0)
+     */
+    static uint64_t GetLastUpdateVersion() noexcept { return s_lastUpdateVersion; }
+
+    // UpdateAll  Update ĂłԂ (jE폜͑̎̂󂷂̂ WorkCommandBuffer ֋L^)
+    static bool IsUpdating() noexcept { return s_isUpdating; }
+
+    /**
+     * @brief since ɒǉEύXꂽGeBeB (ƊOꂽGeBeB) W߂
+     *        ύX̋L^ł񕪒T̂ŁAςɔႷ
+     * @return 폜̋L^ since ܂ŎcĂȂ false (Ŝ)
+     */
+    bool CollectChangedEntities(const std::string_view name, uint64_t since, std::vector<entityId>& outChanged, std::vector<entityId>* outRemoved = nullptr) const;
+
+    // since ɕK{^̂ǂꂩςs̃GeBeB (s̏o GetQueryVersion ŕ)
+    void CollectChangedRows(queryId query, uint64_t since, std::vector<entityId>& outEntities) const;
+
+    // C ABI pBԂAcapacity ȉ̎ outEntities Ɏʂ
+    uint32_t CopyChangedRows(queryId query, uint64_t since, entityId* outEntities, uint32_t capacity) const;
+
+    // UpdateifbhbNjBŌ FlushCommandBuffers Ă
     void UpdateAll(float dt);
 
+    /**
+     * @brief ĂяoXbh̃R}hobt@ (ɓo^)
+     *        Update ̍\̕ύX͂ɋL^ƁÃXibvVbg󂳂Ȃ
+     */
+    static FlEntityCommandBuffer& WorkCommandBuffer()
+    {
+        return s_pCommandBuffer ? s_pCommandBuffer->buffer : RegisterCommandBuffer().buffer;
+    }
+
+    /**
+     * @brief SXbh̃R}hobt@܂Ƃ߂Ĕf (_Bǂ̃XbhL^ĂȂɌĂ)
+     *          ^ƁEGeBeBɕׂǉE폜 (^ƂɃbN1)  j ̏
+     * @return f߂̐
+     */
+    size_t FlushCommandBuffers();
+
     nlohmann::json SerializeEntity(entityId id);
 
     void DeserializeEntity(entityId id, const nlohmann::json& src);
 
+    // "Entities" ɑSGeBeBA"Prefabs" ɃvnũCX^Xƍ (FlPrefabCache::SerializeInstances)
     nlohmann::json SerializeScene();
 
     void DeserializeScene(const nlohmann::json& src);
 
     void DeserializeScene(const nlohmann::json& src, std::unordered_map<entityId, entityId>* outRemap);
 
+    /**
+     * @brief since ̍o (ۑEzbg[hEp)
+     * @return "Version"iɓnŁj, "Complete"ifalse ȂL^Ȃ̂őŜ𑗂j,
+     *         "Entities"iςR|[lgj, "Removed"i^Ƃ̊OꂽIDj, "Destroyed"
+     */
+    nlohmann::json SerializeSceneChanges(uint64_t since);
+
+    // SerializeSceneChanges ̍𓖂Ă (ID̂܂܁BGeBeB͍)
+    void DeserializeSceneChanges(const nlohmann::json& src);
+
+    // oCiV[i^Ƃ̗ubN + MessagePackjBJSON ͌pɂ̂܂܎c
+    std::vector<uint8_t> SerializeSceneBinary(const bool isCompress = true);
+
+    bool DeserializeSceneBinary(std::span<const uint8_t> src);
+
+    // gq .flsceneb ȂoCiAȊO JSON ŕۑ
+    bool SaveScene(const std::filesystem::path& path);
+
+    // 擪Č`𔻒肵ēǂݍ
+    bool LoadScene(const std::filesystem::path& path);
+
+    /**
+     * @brief since ̍ (SerializeSceneChanges)  path 1sǋLAsince ̔łɐi߂ (ۑp)
+     * @return L^肸ȂEȂ false (SaveScene őŜۑApath )
+     */
+    bool SaveSceneChanges(const std::filesystem::path& path, uint64_t& since);
+
+    // SaveSceneChanges ŒǋLɓĂ (ɂŜ LoadScene ɌĂ)
+    bool LoadSceneChanges(const std::filesystem::path& path);
+
     void ToLogInfo(const std::string& str)
     {
         std::lock_guard<std::mutex> lk(m_mu);
@@ -104,15 +295,18 @@ public:
     // o^ĂR|[lg^ꗗistorages_ ̃L[j
     std::vector<std::string> GetRegisteredComponentTypes() const;
 
+    // w^̃R|[lgSė񋓁iGeBeBIDƎ̃|C^̑gj
+    std::vector<std::pair<entityId, void*>> GetComponentsOfType(const std::string_view name) const;
+
     // wGeBeBR|[lg^ꗗiserialize Ȉ՗pj
     std::vector<std::string> GetEntityComponentTypes(entityId id) const;
 
-    // ߂l:  trueireflection ݂ RenderEditor Ă񂾁j
-    bool RenderComponentEditor(const std::string& typeName, entityId id) const;
+    // ߂l:  trueireflection ݂ RenderEditor Ă񂾁jBlҏWύX̔łi߂
+    bool RenderComponentEditor(const std::string& typeName, entityId id);
 
 private:
     FlEntityComponentSystemKernel() = default;
-    ~FlEntityComponentSystemKernel() = default;
+    ~FlEntityComponentSystemKernel();
 
     enum { Prio, Comp_Name, Comp_Stor };
 
@@ -128,6 +322,120 @@ private:
             [&](const auto& t) { return std::get<std::string>(t) == name; });
     }
 
+    // 󂫃XbgoĐԂɂim_mu ێČĂԁjBs InvalidEntityId
+    entityId AllocateId();
+
+    // Xbg𐶑Ԃɂiindex ͊mۍς݂ł邱Ɓj
+    void ActivateSlot(uint32_t index, uint32_t generation);
+
+    // index ܂ŃXbgmۂA󂫃Xg֐ς
+    void GrowSlots(uint32_t index);
+
+    // DestroyEntity / RevertCreatedEntity ̖{
+    void DestroyEntity(entityId id, const bool isRevert);
+
+    // w蔭s̖{́BisRestore Ȃ璼Oɉゾ͖߂
+    const bool CreateSpecifiedEntity(entityId specifiedId, const bool isRestore);
+
+    // w肵IDŃXbg𐶑ɂł邩 (m_mu ێČĂ)
+    const bool CanActivateSpecified(entityId specifiedId, const bool isRestore) const;
+
+    // IsActive ̖{ (m_mu ێČĂԁBz1)
+    const bool IsActiveLocked(entityId id) const
+    {
+        const auto index{ GetEntityIndex(id) };
+        return id != InvalidEntityId && index < m_slots.size() &&
+            m_slots[index].denseIndex != InvalidEntityId && m_slots[index].generation == GetEntityGeneration(id);
+    }
+
+    // ǂݍރV[IDōBgȂΐVIDōAremap ɋL^
+    entityId CreateLoadedEntity(entityId id, std::unordered_map<entityId, entityId>& remap);
+
+    // tւIDwĂ Transform ̐eqVID֒
+    void RemapTransformLinks(std::span<const entityId> ids, const std::unordered_map<entityId, entityId>& remap);
+
+    struct QueryCache
+    {
+        std::vector<std::string> required;
+        std::vector<std::string> excluded;
+
+        // l߂ĕׂꗗ (폜͖Ɠւ)
+        FlTrackedVector<entityId, FlMemoryTag::Ecs> entities;
+        FlTrackedVector<void*, FlMemoryTag::Ecs>    components; // s * required.size() + 
+        FlTrackedUnorderedMap<entityId, uint32_t, FlMemoryTag::Ecs> rows; // ID  s
+
+        uint64_t version = Def::ULongLongZero;
+    };
+
+    const ComponentStorage* FindStorage(const std::string_view name) const
+    {
+        auto it{ FindStorageIterator(name) };
+        return it == m_storages.end() ? nullptr : &std::get<ComponentStorage>(*it);
+    }
+
+    ComponentStorage* FindStorage(const std::string_view name)
+    {
+        auto it{ FindStorageIterator(name) };
+        return it == m_storages.end() ? nullptr : &std::get<ComponentStorage>(*it);
+    }
+
+    // 1̌^EjŎc폜̋L^̐ (Â̂Ă)
+    static constexpr size_t MaxRemovalRecords{ 4096U };
+
+    // ύX̋L^l߂܂łɋÂL^̗]
+    static constexpr size_t CompactSlack{ 64U };
+
+    // ǉEύX̔łU (m_mu ێČĂ)
+    void StampChanged(ComponentStorage& storage, entityId id);
+
+    // OL^c (̂ɌĂ)
+    void StampRemoved(ComponentStorage& storage, entityId id);
+
+    // L^ł̏Ɍꂽc
+    static void TrimRecords(FlTrackedVector<ChangeRecord, FlMemoryTag::Ecs>& records, uint64_t& horizon);
+
+    // CollectChangedEntities ̖{ (m_mu ێČĂ)
+    bool CollectChanges(const ComponentStorage& storage, uint64_t since, std::vector<entityId>& outChanged, std::vector<entityId>* outRemoved) const;
+
+    // ȉ̃NGXV m_mu ێČĂ
+
+    // typeName gNG id ̍st (ǉEuE폜)
+    void RefreshQueries(const std::string& typeName, entityId id);
+
+    // id 𖞂𒲂ׂčs𑫂EEO
+    void RefreshQueryRow(QueryCache& query, entityId id) { RefreshQueryRows(query, { &id, Def::ULongLongOne }); }
+
+    // ids ܂Ƃ߂ĕt (^̈Ă1)
+    void RefreshQueryRows(QueryCache& query, std::span<const entityId> ids);
+
+    void RemoveQueryRow(QueryCache& query, entityId id);
+
+    // ԏȂK{^蒼 (^ƏEo^)
+    void RebuildQuery(QueryCache& query);
+
+    void RebuildQueries(const std::string& typeName);
+
+    // 󂫃Xg1o (m_mu ێČĂ)Bs InvalidEntityId
+    uint32_t PopFreeSlot();
+
+    struct EntitySlot
+    {
+        uint32_t generation   = Def::UIntZero;
+        uint32_t denseIndex   = InvalidEntityId; // Ȃ m_aliveIds ̈ʒu
+        uint32_t nextFree     = InvalidEntityId;
+        bool     isInFreeList = false;           // w蔭sŎgꂽXbg͎oɓǂݔ΂
+        bool     isReserved   = false;           // R}hobt@\ (ł͂ȂɓnȂ)
+        bool     isRetired    = false;           // g؂ (ÂIDԂȂ悤xƎgȂ)
+    };
+
+    struct RegisteredCommandBuffer
+    {
+        FlEntityCommandBuffer buffer;
+        std::atomic<bool>     isOrphaned{ false }; // ̃XbhIiɓo^Xbhgj
+    };
+
+    static RegisteredCommandBuffer& RegisterCommandBuffer();
+
     mutable std::mutex m_mu;
     mutable std::mutex m_moduleCallsMu;
 
@@ -136,12 +444,42 @@ private:
 
     std::vector<std::tuple<priority, std::string, ComponentStorage>> m_storages;
 
-    // ݎgpID̃Zbg (ՓˉƑ݊mFp)
-    std::unordered_set<entityId> m_activeIds;
+    // Xbgԍ  E
+    FlTrackedVector<EntitySlot, FlMemoryTag::Ecs> m_slots;
+
+    // IDl߂ĕׂ (񋓗pA폜͖Ɠւ)
+    FlTrackedVector<entityId, FlMemoryTag::Ecs> m_aliveIds;
+
+    // ėp҂Xbg̐擪 (߂ɉ̂g)
+    uint32_t m_freeHead{ InvalidEntityId };
+
+    // g؂đޖXbg̐
+    size_t m_retiredSlotCount{};
+
+    // NGID  ꗗ (o^̂͏Ȃ)
+    std::vector<QueryCache> m_queries;
+
+    // ^  ̌^K{EOɎgNG
+    std::unordered_map<std::string, std::vector<queryId>> m_queriesByType;
+
+    // SNGŒʂ̔ (ʂ̃NG̎ʂƎႦȂ)
+    uint64_t m_queryVersion{ Def::ULongLongZero };
+
+    // SĂ̌^Œʂ̕ύX̔ (ǂނȂ烍bNȂ)
+    std::atomic<uint64_t> m_changeVersion{ Def::ULongLongZero };
+
+    // jGeBeB̋L^ƁA^ƊO (O͍̍Ȃ) 
+    FlTrackedVector<ChangeRecord, FlMemoryTag::Ecs> m_destroyed;
+    uint64_t m_destroyedHorizon{ Def::ULongLongZero };
+    uint64_t m_typeRemovedVersion{ Def::ULongLongZero };
+
+    // Update ̌^́AO Update ̊Jn̔
+    static inline thread_local uint64_t s_lastUpdateVersion = Def::ULongLongZero;
+    static inline thread_local bool     s_isUpdating        = false;
 
-    // Aėp҂ID̃Zbg (wIDš/폜)
-    std::unordered_set<entityId> m_freeIds;
+    // XbhƂ̃R}hobt@ (IXbh̕f܂Ŏc)
+    mutable std::mutex                                    m_commandBuffersMu;
+    std::vector<std::unique_ptr<RegisteredCommandBuffer>> m_commandBuffers;
 
-    // ɔsuVvID̃JE^[
-    entityId m_nextId{ Def::UIntZero };
+    static inline thread_local RegisteredCommandBuffer* s_pCommandBuffer = nullptr;
 };
\ No newline at end of file
@@ -0,0 +1,496 @@
+#include "FlPrefabCache.h"
+#include "FlEntityComponentSystemKernel.h"
+
+#include "../../Framework/Module/RuntimeModule/Transform.h"
+
+std::vector<entityId> FlPrefabCache::Instantiate(const std::filesystem::path& path, const size_t count, const nlohmann::json* pOverrides)
+{
+    if (count == Def::ULongLongZero) return {};
+
+    const auto spTemplate{ Acquire(path) };
+    if (!spTemplate) return {};
+
+    auto& kernel{ FlEntityComponentSystemKernel::Instance() };
+
+    // ids[e * count + c] = c ڂ̃CX^X e Ԗڂ̃GeBeBi^Ƃ̕A͈͂œn߁j
+    const auto entityCount{ spTemplate->entities.size() };
+    auto ids{ kernel.CreateEntities(entityCount * count) };
+    if (ids.size() != entityCount * count)
+    {
+        for (auto id : ids) kernel.DestroyEntity(id);
+        return {};
+    }
+
+    for (auto e{ size_t{} }; e < entityCount; ++e)
+    {
+        const auto& entity{ spTemplate->entities[e] };
+        const auto column{ std::span<const entityId>{ ids }.subspan(e * count, count) };
+
+        auto hasName     { false };
+        auto hasTransform{ false };
+        for (const auto& component : entity.components)
+        {
+            hasName      |= component.typeName == "Name";
+            hasTransform |= component.typeName == "Transform";
+
+            if (component.pObject && kernel.AddComponentCopies(component.typeName, component.pObject, column) == column.size()) continue;
+
+            // Copy ^͊1
+            const auto reflection{ kernel.GetReflection(component.typeName) };
+            if (!reflection || !reflection->Deserialize) continue;
+
+            const nlohmann::json json = nlohmann::json::from_msgpack(component.baseline);
+            for (auto id : column)
+            {
+                if (kernel.HasComponent(component.typeName, id)) continue;
+                if (auto* pComp{ kernel.AddComponent(component.typeName, id) }) reflection->Deserialize(pComp, json);
+            }
+        }
+
+        // CreateEntity Ɠ Name / Transform ͕K
+        for (auto id : column)
+        {
+            if (!hasName)      kernel.AddComponent("Name", id);
+            if (!hasTransform) kernel.AddComponent("Transform", id);
+        }
+    }
+
+    // eq֌WCX^XID֕tւ
+    for (auto e{ size_t{} }; e < entityCount; ++e)
+    {
+        const auto& entity{ spTemplate->entities[e] };
+        for (auto c{ size_t{} }; c < count; ++c)
+        {
+            auto* pTransform{ static_cast<TransformComponent*>(kernel.GetComponent("Transform", ids[e * count + c])) };
+            if (!pTransform) continue;
+
+            pTransform->m_parent = entity.parentIndex == InvalidEntityId ? UINT32_MAX : ids[entity.parentIndex * count + c];
+
+            pTransform->m_children.resize(entity.childIndices.size());
+            for (auto i{ size_t{} }; i < entity.childIndices.size(); ++i)
+                pTransform->m_children[i] = ids[entity.childIndices[i] * count + c];
+        }
+    }
+
+    auto roots{ std::vector<entityId>{} };
+    roots.reserve(count);
+    {
+        auto lock{ std::lock_guard{ m_mutex } };
+
+        // jς݂̃CX^X͂ŖY
+        std::erase_if(m_instances, [&](const auto& pair) { return !kernel.IsActive(pair.first); });
+
+        for (auto c{ size_t{} }; c < count; ++c)
+        {
+            auto record{ InstanceRecord{ spTemplate, {} } };
+            record.entities.reserve(entityCount);
+            for (auto e{ size_t{} }; e < entityCount; ++e) record.entities.push_back(ids[e * count + c]);
+
+            const auto root{ record.entities[spTemplate->rootIndex] };
+            roots.push_back(root);
+            m_instances.insert_or_assign(root, std::move(record));
+        }
+    }
+
+    if (pOverrides)
+        for (auto root : roots) ApplyOverrides(root, *pOverrides);
+
+    return roots;
+}
+
+nlohmann::json FlPrefabCache::CollectOverrides(const entityId root)
+{
+    auto record{ InstanceRecord{} };
+    {
+        auto lock{ std::lock_guard{ m_mutex } };
+        auto it{ m_instances.find(root) };
+        if (it == m_instances.end()) return nlohmann::json::object();
+        record = it->second;
+    }
+
+    auto& kernel{ FlEntityComponentSystemKernel::Instance() };
+
+    nlohmann::json overrides = nlohmann::json::object();
+    for (auto e{ size_t{} }; e < record.entities.size(); ++e)
+    {
+        const auto id{ record.entities[e] };
+        if (!kernel.IsActive(id)) continue;
+
+        nlohmann::json current = kernel.SerializeEntity(id);
+
+        // eq̓CX^XƂɈႤIDȂ̂ŔׂȂ
+        if (current.contains("Transform"))
+        {
+            current["Transform"].erase("parent");
+            current["Transform"].erase("children");
+        }
+
+        nlohmann::json delta = nlohmann::json::object();
+        for (const auto& component : record.spTemplate->entities[e].components)
+        {
+            auto it{ current.find(component.typeName) };
+            if (it == current.end())
+            {
+                delta[component.typeName] = nullptr;
+                continue;
+            }
+
+            nlohmann::json base = nlohmann::json::from_msgpack(component.baseline);
+            if (component.typeName == "Transform")
+            {
+                base.erase("parent");
+                base.erase("children");
+            }
+
+            if (nlohmann::json patch = nlohmann::json::diff(base, *it); !patch.empty()) delta[component.typeName] = std::move(patch);
+            current.erase(it);
+        }
+
+        // `ɖ^͑Ŝ
+        for (auto& [typeName, json] : current.items()) delta[typeName] = json;
+
+        if (!delta.empty()) overrides[std::to_string(e)] = std::move(delta);
+    }
+    return overrides;
+}
+
+bool FlPrefabCache::ApplyOverrides(const entityId root, const nlohmann::json& overrides)
+{
+    auto record{ InstanceRecord{} };
+    {
+        auto lock{ std::lock_guard{ m_mutex } };
+        auto it{ m_instances.find(root) };
+        if (it == m_instances.end()) return false;
+        record = it->second;
+    }
+
+    try {
+        for (auto& [indexStr, delta] : overrides.items())
+        {
+            const auto index{ std::stoul(indexStr) };
+            if (index >= record.entities.size()) continue;
+            ApplyEntityOverrides(record.spTemplate->entities[index], record.entities[index], delta);
+        }
+    }
+    catch (const std::exception& e) {
+        FlEditorAdministrator::Instance().GetLogger()->AddErrorLog("Prefab: Failed to apply overrides (%s)", e.what());
+        return false;
+    }
+    return true;
+}
+
+nlohmann::json FlPrefabCache::SerializeInstances()
+{
+    auto& kernel{ FlEntityComponentSystemKernel::Instance() };
+
+    auto instances{ std::vector<std::pair<entityId, InstanceRecord>>{} };
+    {
+        auto lock{ std::lock_guard{ m_mutex } };
+        std::erase_if(m_instances, [&](const auto& pair) { return !kernel.IsActive(pair.first); });
+        instances.assign(m_instances.begin(), m_instances.end());
+    }
+    // ۑ邽тɕтςȂ悤[gɂ
+    std::ranges::sort(instances, {}, [](const auto& pair) { return pair.first; });
+
+    nlohmann::json dst = nlohmann::json::array();
+    for (const auto& [root, record] : instances)
+    {
+        // CX^XꂽGeBeB͖IDŎciԍ𐗌`Ƒ邽߁j
+        auto ids{ record.entities };
+        for (auto& id : ids)
+            if (!kernel.IsActive(id)) id = InvalidEntityId;
+
+        nlohmann::json instance;
+        instance["Path"]      = record.spTemplate->path.string();
+        instance["Entities"]  = std::move(ids);
+        instance["Overrides"] = CollectOverrides(root);
+        dst.push_back(std::move(instance));
+    }
+    return dst;
+}
+
+void FlPrefabCache::DeserializeInstances(const nlohmann::json& src, const std::unordered_map<entityId, entityId>& remap)
+{
+    if (!src.is_array()) return;
+
+    auto& kernel{ FlEntityComponentSystemKernel::Instance() };
+
+    for (const auto& instance : src)
+    {
+        try {
+            const auto path{ std::filesystem::path{ instance.at("Path").get<std::string>() } };
+            auto record{ InstanceRecord{ Acquire(path), instance.at("Entities").get<std::vector<entityId>>() } };
+            if (!record.spTemplate || record.entities.size() != record.spTemplate->entities.size())
+            {
+                FlEditorAdministrator::Instance().GetLogger()->AddWarningLog("Prefab: Instance of %s was loaded without its prefab link", path.string().c_str());
+                continue;
+            }
+
+            for (auto& id : record.entities)
+                if (auto it{ remap.find(id) }; it != remap.end()) id = it->second;
+
+            const auto root{ record.entities[record.spTemplate->rootIndex] };
+            if (!kernel.IsActive(root)) continue;
+
+            // ̐`ɖ߂Ăۑꂽ𓖂Ēivnu̍XVCX^Xɓ͂j
+            const auto& overrides = instance.at("Overrides");
+            for (auto e{ size_t{} }; e < record.entities.size(); ++e)
+            {
+                const auto id{ record.entities[e] };
+                if (!kernel.IsActive(id)) continue;
+
+                const auto& entity{ record.spTemplate->entities[e] };
+                ResetEntity(entity, id);
+                if (auto it{ overrides.find(std::to_string(e)) }; it != overrides.end()) ApplyEntityOverrides(entity, id, *it);
+            }
+
+            auto lock{ std::lock_guard{ m_mutex } };
+            m_instances.insert_or_assign(root, std::move(record));
+        }
+        catch (const std::exception& e) {
+            FlEditorAdministrator::Instance().GetLogger()->AddErrorLog("Prefab: Failed to load instance (%s)", e.what());
+        }
+    }
+}
+
+std::filesystem::path FlPrefabCache::GetSourcePath(const entityId root)
+{
+    auto lock{ std::lock_guard{ m_mutex } };
+    auto it{ m_instances.find(root) };
+    if (it == m_instances.end() || !FlEntityComponentSystemKernel::Instance().IsActive(root)) return {};
+    return it->second.spTemplate->path;
+}
+
+void FlPrefabCache::ReleaseType(const std::string& typeName)
+{
+    auto lock{ std::lock_guard{ m_mutex } };
+    for (auto it{ m_templates.begin() }; it != m_templates.end(); )
+    {
+        if (it->second->UsesType(typeName))
+        {
+            it->second->DestroyObjects();
+            it = m_templates.erase(it);
+        }
+        else ++it;
+    }
+}
+
+void FlPrefabCache::Clear()
+{
+    auto lock{ std::lock_guard{ m_mutex } };
+    for (auto& [_, spTemplate] : m_templates) spTemplate->DestroyObjects();
+    m_templates.clear();
+    m_instances.clear();
+}
+
+bool FlPrefabCache::Template::UsesType(const std::string& typeName) const noexcept
+{
+    for (const auto& entity : entities)
+        for (const auto& component : entity.components)
+            if (component.typeName == typeName) return true;
+    return false;
+}
+
+void FlPrefabCache::Template::DestroyObjects() noexcept
+{
+    for (auto& entity : entities)
+    {
+        for (auto& component : entity.components)
+        {
+            if (component.pObject && component.reflection.Destroy)
+            {
+                try { component.reflection.Destroy(component.pObject); }
+                catch (...) {}
+            }
+            component.pObject = nullptr;
+        }
+    }
+}
+
+std::shared_ptr<const FlPrefabCache::Template> FlPrefabCache::Acquire(const std::filesystem::path& path)
+{
+    auto ec{ std::error_code{} };
+    const auto writeTime{ std::filesystem::last_write_time(path, ec) };
+    if (ec) return nullptr;
+    const auto size{ std::filesystem::file_size(path, ec) };
+    if (ec) return nullptr;
+
+    auto lock{ std::lock_guard{ m_mutex } };
+    if (auto it{ m_templates.find(path) }; it != m_templates.end())
+    {
+        if (it->second->writeTime == writeTime && it->second->size == size) return it->second;
+
+        // XVĂ΍蒼iCX^X̍̊͌Â܂܁j
+        it->second->DestroyObjects();
+        m_templates.erase(it);
+    }
+
+    nlohmann::json prefab;
+    if (!FlJsonUtility::Deserialize(prefab, path)) return nullptr;
+
+    auto spTemplate{ Build(path, prefab) };
+    if (!spTemplate)
+    {
+        FlEditorAdministrator::Instance().GetLogger()->AddErrorLog("Prefab: Failed to build template %s", path.string().c_str());
+        return nullptr;
+    }
+    spTemplate->writeTime = writeTime;
+    spTemplate->size      = size;
+
+    m_templates.emplace(path, spTemplate);
+    return spTemplate;
+}
+
+std::shared_ptr<FlPrefabCache::Template> FlPrefabCache::Build(const std::filesystem::path& path, const nlohmann::json& prefab)
+{
+    if (!prefab.contains("Entities") || !prefab.contains("Root")) return nullptr;
+
+    auto& kernel{ FlEntityComponentSystemKernel::Instance() };
+
+    auto spTemplate{ std::make_shared<Template>() };
+    spTemplate->path = path;
+
+    const auto& entitiesJson = prefab["Entities"];
+    const auto root{ prefab["Root"].get<entityId>() };
+    if (!entitiesJson.contains(std::to_string(root))) return nullptr;
+
+    // ID  `̔ԍB[gqHɐU
+    // it@CID̕тɈ˂Ȃ̂ŁAvnuۑĂۑς݂̃CX^XƔԍj
+    auto indices{ std::unordered_map<entityId, uint32_t>{} };
+    auto order  { std::vector<entityId>{ root } };
+    indices.emplace(root, Def::UIntZero);
+    for (auto i{ size_t{} }; i < order.size(); ++i)
+    {
+        const auto& entityJson = entitiesJson[std::to_string(order[i])];
+        if (!entityJson.contains("Transform") || !entityJson["Transform"].contains("children")) continue;
+
+        for (const auto& child : entityJson["Transform"]["children"])
+        {
+            const auto childId{ child.get<entityId>() };
+            if (entitiesJson.contains(std::to_string(childId)) && indices.emplace(childId, static_cast<uint32_t>(indices.size())).second)
+                order.push_back(childId);
+        }
+    }
+
+    // [gHȂ̂͌
+    for (auto& [idStr, _] : entitiesJson.items())
+        indices.emplace(static_cast<entityId>(std::stoul(idStr)), static_cast<uint32_t>(indices.size()));
+    spTemplate->rootIndex = Def::UIntZero;
+
+    const auto types{ kernel.GetRegisteredComponentTypes() };
+
+    spTemplate->entities.resize(indices.size());
+    for (auto& [idStr, entityJson] : entitiesJson.items())
+    {
+        auto& entity{ spTemplate->entities[indices.at(static_cast<entityId>(std::stoul(idStr)))] };
+
+        for (const auto& typeName : types)
+        {
+            auto it{ entityJson.find(typeName) };
+            if (it == entityJson.end()) continue;
+
+            auto reflection{ kernel.GetReflection(typeName) };
+            if (!reflection) continue;
+
+            auto& component{ entity.components.emplace_back() };
+            component.typeName   = typeName;
+            component.reflection = *reflection;
+
+            // ̎̂1x
+            auto* pObject{ reflection->Create && reflection->Deserialize ? reflection->Create() : nullptr };
+            if (pObject) reflection->Deserialize(pObject, *it);
+
+            // ̊ Serialize `ɂit@CɖlōoȂ悤Ɂj
+            if (pObject && reflection->Serialize)
+            {
+                nlohmann::json normalized;
+                reflection->Serialize(pObject, normalized);
+                component.baseline = nlohmann::json::to_msgpack(normalized);
+            }
+            else component.baseline = nlohmann::json::to_msgpack(*it);
+
+            if (pObject && reflection->Copy) component.pObject = pObject;
+            else if (pObject && reflection->Destroy) reflection->Destroy(pObject);
+        }
+
+        if (!entityJson.contains("Transform")) continue;
+
+        auto* pTransform{ static_cast<TransformComponent*>(nullptr) };
+        for (const auto& component : entity.components)
+            if (component.typeName == "Transform") pTransform = static_cast<TransformComponent*>(component.pObject);
+
+        // `̎̂ꍇ JSON eqǂ
+        auto parent  { entityId{ UINT32_MAX } };
+        auto children{ std::vector<entityId>{} };
+        if (pTransform)
+        {
+            parent   = pTransform->m_parent;
+            children = pTransform->m_children;
+        }
+        else
+        {
+            const auto& transformJson = entityJson["Transform"];
+            parent = transformJson.value("parent", UINT32_MAX);
+            if (transformJson.contains("children")) children = transformJson["children"].get<std::vector<entityId>>();
+        }
+
+        if (auto it{ indices.find(parent) }; it != indices.end()) entity.parentIndex = it->second;
+        for (auto child : children)
+            if (auto it{ indices.find(child) }; it != indices.end()) entity.childIndices.push_back(it->second);
+    }
+
+    // [g͐eŒu
+    spTemplate->entities[spTemplate->rootIndex].parentIndex = InvalidEntityId;
+
+    return spTemplate;
+}
+
+void FlPrefabCache::ApplyEntityOverrides(const TemplateEntity& entity, const entityId id, const nlohmann::json& overrides)
+{
+    auto& kernel{ FlEntityComponentSystemKernel::Instance() };
+
+    for (auto& [typeName, delta] : overrides.items())
+    {
+        if (delta.is_null())
+        {
+            kernel.RemoveComponent(typeName, id);
+            continue;
+        }
+
+        const auto reflection{ kernel.GetReflection(typeName) };
+        if (!reflection || !reflection->Deserialize) continue;
+
+        nlohmann::json json;
+        if (delta.is_array())
+        {
+            // `̊ Patch 𓖂Ă
+            auto it{ std::find_if(entity.components.begin(), entity.components.end(),
+                [&](const auto& component) { return component.typeName == typeName; }) };
+            if (it == entity.components.end()) continue;
+
+            json = nlohmann::json::from_msgpack(it->baseline).patch(delta);
+        }
+        else json = delta;
+
+        auto* pComp{ kernel.GetComponent(typeName, id) };
+        if (!pComp) pComp = kernel.AddComponent(typeName, id);
+
+        // eq̓CX^X̕g
+        if (auto* pTransform{ typeName == "Transform" ? static_cast<TransformComponent*>(pComp) : nullptr })
+        {
+            json["parent"]   = pTransform->m_parent;
+            json["children"] = pTransform->m_children;
+        }
+
+        if (pComp) reflection->Deserialize(pComp, json);
+    }
+}
+
+void FlPrefabCache::ResetEntity(const TemplateEntity& entity, const entityId id)
+{
+    nlohmann::json baseline = nlohmann::json::object();
+    for (const auto& component : entity.components)
+        baseline[component.typeName] = nlohmann::json::from_msgpack(component.baseline);
+
+    ApplyEntityOverrides(entity, id, baseline);
+}
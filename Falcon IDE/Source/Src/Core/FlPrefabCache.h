@@ -0,0 +1,115 @@
+#pragma once
+#include "../Module/FlRunTimeAndDLLsCommon.h++"
+
+/// <summary>
+/// vnu (.flprefab) 1x͂Đ`ƂĕێA
+/// zu͐`̃R|[lg Copy ł܂Ƃ߂ĕčs܂B
+/// CX^XƂ̕ύX͐`Ƃ̍ (JSON Patch) ƂĎo܂B
+/// </summary>
+class FlPrefabCache
+{
+public:
+
+    /// <summary>
+    /// vnu count zu܂B[g͐eɂȂ܂B
+    /// </summary>
+    /// <param name="pOverrides">CollectOverrides ̌ʁBSCX^XɓKp܂</param>
+    /// <returns>zueCX^X̃[gis͋j</returns>
+    std::vector<entityId> Instantiate(const std::filesystem::path& path, const size_t count = Def::ULongLongOne, const nlohmann::json* pOverrides = nullptr);
+
+    /// <summary>
+    /// CX^X`ςĂ鏊Ԃ܂B
+    /// { "GeBeBԍ": { "^": JSON Patch z | ǉꂽ^̑S | null(폜) } }
+    /// </summary>
+    nlohmann::json CollectOverrides(entityId root);
+
+    /// <summary>
+    /// CollectOverrides ̌ʂCX^XɓKp܂B
+    /// </summary>
+    bool ApplyOverrides(entityId root, const nlohmann::json& overrides);
+
+    /// <summary>
+    /// V[ƈꏏɕۑCX^ẌꗗԂ܂B
+    /// [ { "Path": vnu, "Entities": `̔ԍID, "Overrides": CollectOverrides ̌ } ]
+    /// </summary>
+    nlohmann::json SerializeInstances();
+
+    /// <summary>
+    /// SerializeInstances ̌ʂCX^XђA̐`ɍ𓖂Ē܂B
+    /// `ǂ߂ȂE`ςCX^X͕ۑꂽGeBeB̂܂܎c܂B
+    /// </summary>
+    /// <param name="remap">ǂݍ݂ŕtւIDi  Vj</param>
+    void DeserializeInstances(const nlohmann::json& src, const std::unordered_map<entityId, entityId>& remap);
+
+    /// <summary>
+    /// CX^X̃[gȂ猳̃vnũpXAႦ΋
+    /// </summary>
+    std::filesystem::path GetSourcePath(entityId root);
+
+    /// <summary>
+    /// typeName ܂ސ`j܂Bi^ Reflection ւEDLL OOɌĂԁj
+    /// </summary>
+    void ReleaseType(const std::string& typeName);
+
+    void Clear();
+
+    static auto& Instance() noexcept
+    {
+        static auto instance{ FlPrefabCache{} };
+        return instance;
+    }
+
+private:
+    FlPrefabCache() = default;
+    ~FlPrefabCache() = default;
+
+    struct TemplateComponent
+    {
+        std::string          typeName;
+        ComponentReflection  reflection;
+        void*                pObject = nullptr;  // `̎́iCopy jBCopy ^ nullptr
+        std::vector<uint8_t> baseline;           // ̊iMessagePackj
+    };
+
+    struct TemplateEntity
+    {
+        uint32_t                       parentIndex = InvalidEntityId; // vnu̐e̔ԍ
+        std::vector<uint32_t>          childIndices;
+        std::vector<TemplateComponent> components;                    // o^iDxj
+    };
+
+    struct Template
+    {
+        std::filesystem::path           path;
+        std::filesystem::file_time_type writeTime;
+        uintmax_t                       size      = Def::ULongLongZero;
+        uint32_t                        rootIndex = Def::UIntZero;
+        std::vector<TemplateEntity>     entities;
+
+        bool UsesType(const std::string& typeName) const noexcept;
+
+        // `̎̂ji̊͎cjBDLL Oꂽł͌ĂׂȂ߁A
+        // `oH (Acquire ̍ĉ́EReleaseTypeEClear) ŖIɌĂ
+        void DestroyObjects() noexcept;
+    };
+
+    struct InstanceRecord
+    {
+        std::shared_ptr<const Template> spTemplate;
+        std::vector<entityId>           entities; // `̃GeBeBԍ
+    };
+
+    std::shared_ptr<const Template> Acquire(const std::filesystem::path& path);
+
+    static std::shared_ptr<Template> Build(const std::filesystem::path& path, const nlohmann::json& prefab);
+
+    // 1̃GeBeBɍKp
+    static void ApplyEntityOverrides(const TemplateEntity& entity, entityId id, const nlohmann::json& overrides);
+
+    // 1̃GeBeB̐`̌^̒lɖ߂ieq͂̂܂܁j
+    static void ResetEntity(const TemplateEntity& entity, entityId id);
+
+    std::mutex m_mutex;
+    std::unordered_map<std::filesystem::path, std::shared_ptr<Template>> m_templates;
+    std::unordered_map<entityId, InstanceRecord>                         m_instances; // [g  CX^X
+};
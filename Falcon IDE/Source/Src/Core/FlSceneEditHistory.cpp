@@ -0,0 +1,301 @@
+#include "FlSceneEditHistory.h"
+#include "FlEntityComponentSystemKernel.h"
+
+void FlSceneEditHistory::BeginEdit(const std::string_view label, const uint64_t mergeKey)
+{
+    if (m_depth++ != Def::UIntZero) return;
+
+    m_pending = Command{};
+    m_pending.label    = std::string{ label };
+    m_pending.mergeKey = mergeKey;
+    m_captured.clear();
+    m_capturedEntities.clear();
+}
+
+void FlSceneEditHistory::Capture(entityId id, const std::string& typeName)
+{
+    if (m_depth == Def::UIntZero) return;
+    if (!m_captured.emplace(id, typeName).second) return;
+
+    m_pending.components.push_back({ id, typeName, Snapshot(id, typeName), {} });
+}
+
+void FlSceneEditHistory::CaptureEntity(entityId id)
+{
+    if (m_depth == Def::UIntZero) return;
+
+    auto& kernel{ FlEntityComponentSystemKernel::Instance() };
+    if (!kernel.IsActive(id) || !m_capturedEntities.insert(id).second) return;
+
+    m_pending.entities.push_back({ id, true, true });
+    for (const auto& typeName : kernel.GetEntityComponentTypes(id)) Capture(id, typeName);
+}
+
+void FlSceneEditHistory::CaptureCreatedEntity(entityId id)
+{
+    if (m_depth == Def::UIntZero) return;
+    if (!m_capturedEntities.insert(id).second) return;
+
+    m_pending.entities.push_back({ id, false, true });
+}
+
+void FlSceneEditHistory::EndEdit()
+{
+    if (m_depth == Def::UIntZero || --m_depth != Def::UIntZero) return;
+
+    auto& kernel{ FlEntityComponentSystemKernel::Instance() };
+
+    // L^GeBeBɌォt̂́uvԂ
+    for (auto& entity : m_pending.entities)
+    {
+        entity.isAlive = kernel.IsActive(entity.id);
+        if (!entity.isAlive) continue;
+
+        for (auto& typeName : kernel.GetEntityComponentTypes(entity.id))
+        {
+            if (m_captured.emplace(entity.id, typeName).second)
+                m_pending.components.push_back({ entity.id, std::move(typeName), {}, {} });
+        }
+    }
+
+    for (auto& state : m_pending.components) state.after = Snapshot(state.id, state.typeName);
+
+    m_captured.clear();
+    m_capturedEntities.clear();
+
+    m_pending.Compact();
+    if (!m_pending.IsEmpty()) Push(std::move(m_pending));
+    m_pending = Command{};
+}
+
+std::vector<uint8_t> FlSceneEditHistory::Snapshot(entityId id, const std::string& typeName)
+{
+    auto& kernel{ FlEntityComponentSystemKernel::Instance() };
+
+    const auto reflection{ kernel.GetReflection(typeName) };
+    if (!reflection || !reflection->Serialize) return {};
+
+    auto* pComponent{ kernel.GetComponent(typeName, id) };
+    if (!pComponent) return {};
+
+    nlohmann::json json;
+    reflection->Serialize(pComponent, json);
+    return nlohmann::json::to_msgpack(json);
+}
+
+void FlSceneEditHistory::PushComponentEdit(const std::string_view label, entityId id, const std::string& typeName, std::vector<uint8_t> before, const uint64_t mergeKey)
+{
+    auto after{ Snapshot(id, typeName) };
+    if (after == before) return;
+
+    auto command{ Command{} };
+    command.label    = std::string{ label };
+    command.mergeKey = mergeKey;
+    command.components.push_back({ id, typeName, std::move(before), std::move(after) });
+    Push(std::move(command));
+}
+
+bool FlSceneEditHistory::Undo()
+{
+    if (m_depth != Def::UIntZero || m_undo.empty()) return false;
+
+    auto command{ std::move(m_undo.back()) };
+    m_undo.pop_back();
+    m_isMergeable = false;
+
+    if (!Apply(command, false))
+    {
+        Clear();
+        return false;
+    }
+    m_redo.push_back(std::move(command));
+    return true;
+}
+
+bool FlSceneEditHistory::Redo()
+{
+    if (m_depth != Def::UIntZero || m_redo.empty()) return false;
+
+    auto command{ std::move(m_redo.back()) };
+    m_redo.pop_back();
+    m_isMergeable = false;
+
+    if (!Apply(command, true))
+    {
+        Clear();
+        return false;
+    }
+    m_undo.push_back(std::move(command));
+    return true;
+}
+
+void FlSceneEditHistory::Clear()
+{
+    m_undo.clear();
+    m_redo.clear();
+    m_isMergeable = false;
+    m_bytes       = Def::ULongLongZero;
+    m_charge.Set(m_bytes);
+}
+
+void FlSceneEditHistory::SetCapacity(const size_t bytes)
+{
+    m_capacity = bytes;
+    Trim();
+}
+
+void FlSceneEditHistory::Command::Compact()
+{
+    std::erase_if(components, [](const ComponentState& state) { return state.before == state.after; });
+    std::erase_if(entities,   [](const EntityState& state) { return state.wasAlive == state.isAlive; });
+}
+
+void FlSceneEditHistory::Command::UpdateBytes() noexcept
+{
+    bytes = sizeof(Command) + label.capacity() + entities.capacity() * sizeof(EntityState);
+    for (const auto& state : components)
+        bytes += sizeof(ComponentState) + state.typeName.capacity() + state.before.capacity() + state.after.capacity();
+}
+
+bool FlSceneEditHistory::Apply(const Command& command, const bool isAfter)
+{
+    auto& kernel{ FlEntityComponentSystemKernel::Instance() };
+
+    const auto isRecreated{ [&kernel, isAfter](const EntityState& entity) {
+        return (isAfter ? entity.isAlive : entity.wasAlive) && !kernel.IsActive(entity.id);
+    } };
+
+    // rŎsăV[[ɖ߂Ȃ悤A蒼SẴXbgɊm߂
+    for (const auto& entity : command.entities)
+    {
+        if (!isRecreated(entity) || kernel.CanCreateEntity(entity.id, true)) continue;
+
+        FlEditorAdministrator::Instance().GetLogger()->AddErrorLog("EditHistory: Failed to recreate entity %u (%s)", entity.id, command.label.c_str());
+        return false;
+    }
+
+    // 蒼iCreateEntity t̂͊OAԂ͋L^瓖Ăj
+    for (const auto& entity : command.entities)
+    {
+        if (!isRecreated(entity)) continue;
+
+        kernel.RestoreEntity(entity.id);
+        for (const auto& typeName : kernel.GetEntityComponentTypes(entity.id)) kernel.RemoveComponent(typeName, entity.id);
+    }
+
+    for (const auto& state : command.components) Restore(state.id, state.typeName, isAfter ? state.after : state.before);
+
+    // ߂̓Xbg̐߂ȂOɓXbgŔjGeBeB߂悤ɂ
+    for (const auto& entity : command.entities)
+    {
+        if ((isAfter ? entity.isAlive : entity.wasAlive) || !kernel.IsActive(entity.id)) continue;
+
+        if (isAfter) kernel.DestroyEntity(entity.id);
+        else kernel.RevertCreatedEntity(entity.id);
+    }
+    return true;
+}
+
+void FlSceneEditHistory::Restore(entityId id, const std::string& typeName, const std::vector<uint8_t>& state)
+{
+    auto& kernel{ FlEntityComponentSystemKernel::Instance() };
+
+    if (state.empty())
+    {
+        if (kernel.HasComponent(typeName, id)) kernel.RemoveComponent(typeName, id);
+        return;
+    }
+
+    const auto reflection{ kernel.GetReflection(typeName) };
+    if (!reflection || !reflection->Deserialize)
+    {
+        FlEditorAdministrator::Instance().GetLogger()->AddErrorLog("EditHistory: Unknown component type %s", typeName.c_str());
+        return;
+    }
+
+    auto* pComponent{ kernel.GetComponent(typeName, id) };
+    if (!pComponent) pComponent = kernel.AddComponent(typeName, id);
+    if (!pComponent) return;
+
+    try
+    {
+        reflection->Deserialize(pComponent, nlohmann::json::from_msgpack(state));
+    }
+    catch (const std::exception& e)
+    {
+        FlEditorAdministrator::Instance().GetLogger()->AddErrorLog("EditHistory: Failed to restore %s (%s)", typeName.c_str(), e.what());
+    }
+    kernel.MarkComponentChanged(typeName, id);
+}
+
+void FlSceneEditHistory::Push(Command&& command)
+{
+    const auto now{ std::chrono::steady_clock::now() };
+
+    for (const auto& redo : m_redo) m_bytes -= redo.bytes;
+    m_redo.clear();
+
+    const auto isMerge{ m_isMergeable && command.mergeKey != Def::ULongLongZero && !m_undo.empty() &&
+        m_undo.back().mergeKey == command.mergeKey && now - m_undo.back().time <= CoalesceWindow };
+
+    if (isMerge)
+    {
+        auto& last{ m_undo.back() };
+        m_bytes -= last.bytes;
+        Merge(last, std::move(command));
+        last.time = now;
+
+        // Čɖ߂ȂҏWƏ
+        if (last.IsEmpty()) m_undo.pop_back();
+        else
+        {
+            last.UpdateBytes();
+            m_bytes += last.bytes;
+        }
+    }
+    else
+    {
+        command.time = now;
+        command.UpdateBytes();
+        m_bytes += command.bytes;
+        m_undo.push_back(std::move(command));
+    }
+    m_isMergeable = true;
+
+    Trim();
+    m_charge.Set(m_bytes);
+}
+
+void FlSceneEditHistory::Merge(Command& into, Command&& command)
+{
+    for (const auto& entity : command.entities)
+    {
+        auto it{ std::ranges::find(into.entities, entity.id, &EntityState::id) };
+        if (it == into.entities.end()) into.entities.push_back(entity);
+        else it->isAlive = entity.isAlive;
+    }
+
+    for (auto& state : command.components)
+    {
+        auto it{ std::ranges::find_if(into.components, [&state](const ComponentState& s) { return s.id == state.id && s.typeName == state.typeName; }) };
+        if (it == into.components.end()) into.components.push_back(std::move(state));
+        else it->after = std::move(state.after);
+    }
+    into.Compact();
+}
+
+void FlSceneEditHistory::Trim()
+{
+    // ߂̕ҏW͏𒴂ĂĂc
+    while (m_bytes > m_capacity && m_undo.size() > Def::ULongLongOne)
+    {
+        m_bytes -= m_undo.front().bytes;
+        m_undo.pop_front();
+    }
+    while (m_bytes > m_capacity && !m_redo.empty())
+    {
+        m_bytes -= m_redo.front().bytes;
+        m_redo.pop_front();
+    }
+    m_charge.Set(m_bytes);
+}
@@ -0,0 +1,138 @@
+#pragma once
+#include "../Module/FlRunTimeAndDLLsCommon.h++"
+
+/// <summary> =Singleton= </summary>
+/// GfB^ł̃V[̕ҏWAGR|[lg̑ȌԁiReflection  Serialize  MessagePack ɂ́jƂĐς݁A
+/// ɖ߂E蒼s܂BĂ̂͋L^R|[lgȂ̂ŁAV[̑傫ł͂ȂҏW̑傫ɔႵ܂B
+///  EΏۂւ̑Ă̕ҏWihbOȂǁj CoalesceWindow ȓȂ1ɂ܂Ƃ߂܂B
+///  EL^̍v𒴂ÂҏŴĂ܂B
+/// GfB^̃XbhĂłBibN܂j
+class FlSceneEditHistory
+{
+public:
+
+    // Ă̕ҏW1ɂ܂Ƃ߂Ԋu
+    static constexpr auto CoalesceWindow{ std::chrono::milliseconds{ 500 } };
+
+    // L^̏̊l
+    static constexpr size_t DefaultCapacity{ 64U * 1024U * 1024U };
+
+    /// <summary>
+    /// ҏWn߂܂BEndEdit ܂ł Capture ̂1̕ҏWƂĐς݂܂Biq͈ԊOɂ܂Ƃ߂j
+    /// </summary>
+    /// <param name="mergeKey">0 ȊOŒO̕ҏWƓȂACoalesceWindow ȓ̎ɂ܂Ƃ߂</param>
+    void BeginEdit(const std::string_view label, const uint64_t mergeKey = Def::ULongLongZero);
+
+    // OɌĂԁiҏW̒2ڈȍ~͖jBtĂȂ΁uvԂƂĎc
+    void Capture(entityId id, const std::string& typeName);
+
+    // jOɌĂԁBԂƕtĂSẴR|[lgc
+    void CaptureEntity(entityId id);
+
+    // ɌĂԁBÓuȂvԁA EndEdit ̎_ŕtĂSẴR|[lg
+    void CaptureCreatedEntity(entityId id);
+
+    // ̏ԂĐςށBςĂȂΐς܂Ȃ
+    void EndEdit();
+
+    /// <summary>
+    /// R|[lg̍̏ԁBitĂȂ΋j
+    /// CXyN^̂悤ɐɎʂĂAҏWꂽ PushComponentEdit ŐςގɎg܂B
+    /// </summary>
+    static std::vector<uint8_t> Snapshot(entityId id, const std::string& typeName);
+
+    void PushComponentEdit(const std::string_view label, entityId id, const std::string& typeName, std::vector<uint8_t> before, const uint64_t mergeKey = Def::ULongLongZero);
+
+    bool Undo();
+
+    bool Redo();
+
+    bool CanUndo() const noexcept { return !m_undo.empty(); }
+
+    bool CanRedo() const noexcept { return !m_redo.empty(); }
+
+    std::string_view GetUndoLabel() const noexcept { return m_undo.empty() ? std::string_view{} : m_undo.back().label; }
+
+    std::string_view GetRedoLabel() const noexcept { return m_redo.empty() ? std::string_view{} : m_redo.back().label; }
+
+    size_t GetUndoCount() const noexcept { return m_undo.size(); }
+
+    size_t GetRedoCount() const noexcept { return m_redo.size(); }
+
+    // V[ǂݍݒȂǁAL^̃V[ƍȂȂɌĂ
+    void Clear();
+
+    void SetCapacity(const size_t bytes);
+
+    size_t GetCapacity() const noexcept { return m_capacity; }
+
+    size_t GetMemoryUsage() const noexcept { return m_bytes; }
+
+    static auto& Instance() noexcept
+    {
+        static auto instance{ FlSceneEditHistory{} };
+        return instance;
+    }
+
+private:
+    FlSceneEditHistory() = default;
+    ~FlSceneEditHistory() = default;
+
+    struct ComponentState
+    {
+        entityId             id;
+        std::string          typeName;
+        std::vector<uint8_t> before; // ȂtĂȂ
+        std::vector<uint8_t> after;
+    };
+
+    struct EntityState
+    {
+        entityId id;
+        bool     wasAlive;
+        bool     isAlive;
+    };
+
+    struct Command
+    {
+        std::string                           label;
+        uint64_t                              mergeKey = Def::ULongLongZero;
+        std::chrono::steady_clock::time_point time;
+        std::vector<EntityState>              entities;
+        std::vector<ComponentState>           components; // GeBeBƌ^̑gƂ1
+        size_t                                bytes = Def::ULongLongZero;
+
+        // Oオ̂
+        void Compact();
+
+        bool IsEmpty() const noexcept { return entities.empty() && components.empty(); }
+
+        void UpdateBytes() noexcept;
+    };
+
+    // O (isAfter = false) ̏Ԃ𓖂ĂB蒼ȂGeBeBΉς false
+    static bool Apply(const Command& command, const bool isAfter);
+
+    static void Restore(entityId id, const std::string& typeName, const std::vector<uint8_t>& state);
+
+    void Push(Command&& command);
+
+    // O̕ҏWɏd˂BiO͒ỐA͐V́j
+    void Merge(Command& into, Command&& command);
+
+    // 𒴂ÂҏŴĂ
+    void Trim();
+
+    std::deque<Command> m_undo;
+    std::deque<Command> m_redo;
+
+    Command                                    m_pending;
+    std::set<std::pair<entityId, std::string>> m_captured;         // m_pending ɓꂽR|[lg
+    std::unordered_set<entityId>               m_capturedEntities; // m_pending ɓꂽGeBeB
+    uint32_t                                   m_depth       = Def::UIntZero;
+    bool                                       m_isMergeable = false; // ߂E蒼̌͒O̕ҏWƂ܂Ƃ߂Ȃ
+
+    size_t         m_capacity{ DefaultCapacity };
+    size_t         m_bytes   { Def::ULongLongZero };
+    FlMemoryCharge m_charge  { FlMemoryTag::EditHistory };
+};
@@ -15,19 +15,36 @@
 
 // <Multithread:񏈗>
 #include "System/Multithread/FlMultithreadController.h"
+#include "System/Multithread/FlLockFreeRingBuffer.hpp"
+#include "System/Multithread/FlTripleBuffer.hpp"
+
+// <Memory:Ǘ>
+#include "System/Memory/FlMemoryTracker.h"
+#include "System/Memory/FlLinearArena.h"
+#include "System/Memory/FlFrameMemory.h"
 
 // <Math:vZ֘A>
 #include "Math/FlTransform.hpp"
 
 // <Debug:Jx֘A>
 #include "System/Debugger/Console/Console.hpp"
+#include "System/Debugger/Logger/FlAsyncLogBackend.h"
 #include "System/Debugger/Logger/FlDebugLogger.hpp"
+#include "System/Debugger/Profiler/FlProfiler.h"
+#include "System/Debugger/Profiler/FlProfilerFrameView.h"
 
 // <FramePerSecondController:t[>
+#include "System/FrameControl/FlHighResolutionClock.h"
+#include "System/FrameControl/FlFramePacer.hpp"
 #include "System/FrameControl/FlFrameRateController.h"
 
 // <Watcher:Ď֘A>
 #include "System/Watcher/FlFileWatcher.h"
+#include "System/Watcher/FlDirectoryModel.h"
+
+// <Monitor:v֘A>
+#include "System/Monitor/FlSystemMonitorBackend.h"
+#include "System/Monitor/FlSystemMonitor.h"
 
 // <Graphics:`֘A>
 #include "Graphics/Graphics.hxx"
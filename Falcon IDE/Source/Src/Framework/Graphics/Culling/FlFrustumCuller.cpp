@@ -0,0 +1,243 @@
+#include "FlFrustumCuller.h"
+
+FlFrustumCuller::FlFrustumCuller()
+{
+	auto hardware{ std::thread::hardware_concurrency() };
+	m_workerCount = hardware > Def::UIntOne ? hardware - Def::UIntOne : Def::UIntOne;
+	m_upWorkers   = std::make_unique<ScopedThreadPool>(m_workerCount);
+}
+
+void FlFrustumCuller::Begin(const Math::Matrix& mView, const Math::Matrix& mProj) noexcept
+{
+	m_centerX.clear(); m_centerY.clear(); m_centerZ.clear();
+	m_extentX.clear(); m_extentY.clear(); m_extentZ.clear();
+	m_visibility.clear();
+	m_itemNodeIndices.clear();
+	m_nodeVisibility.clear();
+	m_entityRecords.clear();
+
+	m_itemCount   = Def::UIntZero;
+	m_culledCount = Def::UIntZero;
+	m_isActive    = m_isEnable;
+
+	// sxNgK (v * M) ̃NbvW畽ʂ𒊏oiD3D: 0 <= z <= wj
+	const auto m{ mView * mProj };
+	auto column{ [&m](const int c) { return Math::Vector4{ m.m[0][c], m.m[1][c], m.m[2][c], m.m[3][c] }; } };
+
+	const auto c0{ column(0) }, c1{ column(1) }, c2{ column(2) }, c3{ column(3) };
+
+	m_planes[0] = c3 + c0; // Left
+	m_planes[1] = c3 - c0; // Right
+	m_planes[2] = c3 + c1; // Bottom
+	m_planes[3] = c3 - c1; // Top
+	m_planes[4] = c2;      // Near
+	m_planes[5] = c3 - c2; // Far
+
+	for (auto& plane : m_planes)
+	{
+		auto length{ Math::Vector3{ plane.x, plane.y, plane.z }.Length() };
+		if (length > Def::FloatZero) plane /= length;
+	}
+}
+
+void FlFrustumCuller::Skip() noexcept
+{
+	m_entityRecords.clear();
+	m_itemCount   = Def::UIntZero;
+	m_culledCount = Def::UIntZero;
+	m_isActive    = false;
+}
+
+uint32_t FlFrustumCuller::AddBounds(const DirectX::BoundingBox& worldBox)
+{
+	m_centerX.push_back(worldBox.Center.x);
+	m_centerY.push_back(worldBox.Center.y);
+	m_centerZ.push_back(worldBox.Center.z);
+	m_extentX.push_back(worldBox.Extents.x);
+	m_extentY.push_back(worldBox.Extents.y);
+	m_extentZ.push_back(worldBox.Extents.z);
+	m_itemNodeIndices.push_back(UINT32_MAX);
+
+	return m_itemCount++;
+}
+
+void FlFrustumCuller::AddModel(const uint32_t id, const ModelData& model, const Math::Matrix& mWorld)
+{
+	if (!m_isActive) return;
+
+	auto record{ EntityRecord{} };
+	record.firstItem = m_itemCount;
+
+	const auto& nodes{ model.GetNodes() };
+
+	if (model.IsSkinMesh())
+	{
+		// {[Œ_߁AfŜAABBc܂1񂾂
+		auto box{ model.GetBounds() };
+		box.Extents.x *= SkinBoundsScale;
+		box.Extents.y *= SkinBoundsScale;
+		box.Extents.z *= SkinBoundsScale;
+
+		auto worldBox{ DirectX::BoundingBox{} };
+		box.Transform(worldBox, mWorld);
+		AddBounds(worldBox);
+	}
+	else
+	{
+		record.isPerNode  = true;
+		record.nodeOffset = static_cast<uint32_t>(m_nodeVisibility.size());
+		record.nodeCount  = static_cast<uint32_t>(nodes.size());
+
+		// oEfBOȂm[h͏ɕ`悷
+		m_nodeVisibility.resize(m_nodeVisibility.size() + nodes.size(), Visible);
+
+		for (const auto& node : nodes)
+		{
+			if (!node.m_spMesh || !node.m_hasBounds) continue;
+
+			// DrawModel Ɠsinode.m_mLocal * worldjŕϊ
+			auto worldBox{ DirectX::BoundingBox{} };
+			node.m_localAABB.Transform(worldBox, node.m_mLocal * mWorld);
+
+			AddBounds(worldBox);
+			m_itemNodeIndices.back() = static_cast<uint32_t>(node.m_nodeIndex);
+		}
+	}
+
+	record.itemCount = m_itemCount - record.firstItem;
+	m_entityRecords[id] = record;
+}
+
+void FlFrustumCuller::Execute()
+{
+	if (!m_isActive) return;
+
+	// 4̔{ɃpfBOipfBO͌_E傫0Ŕ茋ʂ͎̂Ăj
+	const auto paddedCount{ (m_itemCount + 3U) & ~3U };
+	m_centerX.resize(paddedCount, Def::FloatZero);
+	m_centerY.resize(paddedCount, Def::FloatZero);
+	m_centerZ.resize(paddedCount, Def::FloatZero);
+	m_extentX.resize(paddedCount, Def::FloatZero);
+	m_extentY.resize(paddedCount, Def::FloatZero);
+	m_extentZ.resize(paddedCount, Def::FloatZero);
+	m_visibility.resize(paddedCount);
+
+	if (paddedCount < ParallelThreshold || m_workerCount <= Def::UIntOne)
+	{
+		TestRange(Def::UIntZero, paddedCount);
+	}
+	else
+	{
+		// CXbh1󂯎
+		const auto jobCount{ static_cast<uint32_t>(m_workerCount + Def::UIntOne) };
+		auto perJob{ std::max(MinJobItems, (paddedCount / jobCount + 3U) & ~3U) };
+
+		m_pendingJobs.clear();
+		auto begin{ perJob };
+		for (; begin < paddedCount; begin += perJob)
+		{
+			const auto end{ std::min(begin + perJob, paddedCount) };
+			m_pendingJobs.push_back(m_upWorkers->Enqueue([this, begin, end] { TestRange(begin, end); }));
+		}
+		TestRange(Def::UIntZero, std::min(perJob, paddedCount));
+
+		for (auto& job : m_pendingJobs) job.wait();
+		m_pendingJobs.clear();
+	}
+
+	ResolveEntities();
+}
+
+void FlFrustumCuller::TestRange(const uint32_t begin, const uint32_t end) noexcept
+{
+	using namespace DirectX;
+
+	// ʐe[փu[hLXgĂ
+	XMVECTOR planeX[6], planeY[6], planeZ[6], planeW[6];
+	XMVECTOR absX[6], absY[6], absZ[6];
+	for (auto p{ Def::UIntZero }; p < 6U; ++p)
+	{
+		planeX[p] = XMVectorReplicate(m_planes[p].x);
+		planeY[p] = XMVectorReplicate(m_planes[p].y);
+		planeZ[p] = XMVectorReplicate(m_planes[p].z);
+		planeW[p] = XMVectorReplicate(m_planes[p].w);
+		absX[p]   = XMVectorAbs(planeX[p]);
+		absY[p]   = XMVectorAbs(planeY[p]);
+		absZ[p]   = XMVectorAbs(planeZ[p]);
+	}
+
+	const auto zero{ XMVectorZero() };
+
+	for (auto i{ begin }; i < end; i += 4U)
+	{
+		const auto cx{ XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&m_centerX[i])) };
+		const auto cy{ XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&m_centerY[i])) };
+		const auto cz{ XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&m_centerZ[i])) };
+		const auto ex{ XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&m_extentX[i])) };
+		const auto ey{ XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&m_extentY[i])) };
+		const auto ez{ XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&m_extentZ[i])) };
+
+		auto outside{ XMVectorFalseInt() };
+		for (auto p{ Def::UIntZero }; p < 6U; ++p)
+		{
+			// S̕t + @ւ̎ˉea < 0 Ȃ畽ʂ̊O
+			auto dist{ XMVectorMultiplyAdd(planeX[p], cx, planeW[p]) };
+			dist = XMVectorMultiplyAdd(planeY[p], cy, dist);
+			dist = XMVectorMultiplyAdd(planeZ[p], cz, dist);
+
+			auto radius{ XMVectorMultiply(absX[p], ex) };
+			radius = XMVectorMultiplyAdd(absY[p], ey, radius);
+			radius = XMVectorMultiplyAdd(absZ[p], ez, radius);
+
+			outside = XMVectorOrInt(outside, XMVectorLess(XMVectorAdd(dist, radius), zero));
+		}
+
+		auto lanes{ XMUINT4{} };
+		XMStoreUInt4(&lanes, outside);
+
+		m_visibility[i + 0U] = lanes.x ? Hidden : Visible;
+		m_visibility[i + 1U] = lanes.y ? Hidden : Visible;
+		m_visibility[i + 2U] = lanes.z ? Hidden : Visible;
+		m_visibility[i + 3U] = lanes.w ? Hidden : Visible;
+	}
+}
+
+void FlFrustumCuller::ResolveEntities() noexcept
+{
+	m_culledCount = Def::UIntZero;
+	for (auto i{ Def::UIntZero }; i < m_itemCount; ++i)
+		if (!m_visibility[i]) ++m_culledCount;
+
+	for (auto& [id, record] : m_entityRecords)
+	{
+		auto anyVisible{ false };
+		for (auto i{ record.firstItem }; i < record.firstItem + record.itemCount; ++i)
+		{
+			const auto isVisible{ m_visibility[i] != Hidden };
+			anyVisible |= isVisible;
+
+			if (record.isPerNode && m_itemNodeIndices[i] < record.nodeCount)
+				m_nodeVisibility[record.nodeOffset + m_itemNodeIndices[i]] = isVisible ? Visible : Hidden;
+		}
+		// Ώۂ̃m[hf͕`摤ɔC
+		record.isVisible = anyVisible || record.itemCount == Def::UIntZero;
+	}
+}
+
+const bool FlFrustumCuller::IsEntityVisible(const uint32_t id) const noexcept
+{
+	if (!m_isActive) return true;
+
+	auto it{ m_entityRecords.find(id) };
+	return it == m_entityRecords.end() || it->second.isVisible;
+}
+
+const uint8_t* FlFrustumCuller::GetNodeVisibility(const uint32_t id) const noexcept
+{
+	if (!m_isActive) return nullptr;
+
+	auto it{ m_entityRecords.find(id) };
+	if (it == m_entityRecords.end() || !it->second.isPerNode) return nullptr;
+
+	return m_nodeVisibility.data() + it->second.nodeOffset;
+}
@@ -0,0 +1,129 @@
+#pragma once
+
+/// <summary> =Singleton= </summary>
+class FlFrustumCuller
+{
+public:
+
+	/// <summary>
+	/// t[JnBr[Eˉes񂩂\zAOt[̓o^j܂B
+	/// </summary>
+	/// <param name="mView">r[s</param>
+	/// <param name="mProj">ˉes</param>
+	void Begin(const Math::Matrix& mView, const Math::Matrix& mProj) noexcept;
+
+	/// <summary>
+	/// J݂Ȃt[ł͑SĉƂĈ܂B
+	/// </summary>
+	void Skip() noexcept;
+
+	/// <summary>
+	/// fo^܂BÓIbV̓m[hPʁAXLbV̓fŜŔ肵܂B
+	/// </summary>
+	/// <param name="id">GeBeBID</param>
+	/// <param name="model">ff[^</param>
+	/// <param name="mWorld">[hs</param>
+	void AddModel(const uint32_t id, const ModelData& model, const Math::Matrix& mWorld);
+
+	/// <summary>
+	/// Cӂ̃[hAABBo^܂B
+	/// </summary>
+	/// <param name="worldBox">[hԂAABB</param>
+	/// <returns>茋ʂ̎擾ɎgCfbNX</returns>
+	uint32_t AddBounds(const DirectX::BoundingBox& worldBox);
+
+	/// <summary>
+	/// o^ς݂AABB4SIMDł܂Ƃ߂Ĕ肵A΃[J[Xbh֕܂B
+	/// </summary>
+	void Execute();
+
+	/// <summary>
+	/// AddBounds œo^AABB̉
+	/// </summary>
+	const bool IsVisible(const uint32_t index) const noexcept
+	{
+		return !m_isActive || index >= m_itemCount || m_visibility[index] != Hidden;
+	}
+
+	/// <summary>
+	/// GeBeB̉io^̃GeBeB͉j
+	/// </summary>
+	const bool IsEntityVisible(const uint32_t id) const noexcept;
+
+	/// <summary>
+	/// m[hCfbNXňm[hPʂ̉tO
+	/// </summary>
+	/// <returns>肵ĂȂꍇ nullptriSm[h`j</returns>
+	const uint8_t* GetNodeVisibility(const uint32_t id) const noexcept;
+
+	inline const auto IsEnable() const noexcept { return m_isEnable; }
+	inline auto& WorkIsEnable() noexcept { return m_isEnable; }
+	inline auto SetIsEnable(const bool is) noexcept { m_isEnable = is; }
+
+	inline const auto GetTestedCount()  const noexcept { return m_itemCount; }
+	inline const auto GetCulledCount()  const noexcept { return m_culledCount; }
+
+	// XLbV̓oCh|[YAABB̔{Ŗc܂Ĕ
+	static constexpr float SkinBoundsScale{ 1.5f };
+
+	static auto& Instance() noexcept
+	{
+		static auto instance{ FlFrustumCuller{} };
+		return instance;
+	}
+
+private:
+
+	FlFrustumCuller();
+	~FlFrustumCuller() = default;
+
+	FlFrustumCuller(const FlFrustumCuller&) = delete;
+	FlFrustumCuller& operator=(const FlFrustumCuller&) = delete;
+
+	struct EntityRecord
+	{
+		uint32_t firstItem   = Def::UIntZero;
+		uint32_t itemCount   = Def::UIntZero;
+		uint32_t nodeOffset  = Def::UIntZero;	// m_nodeVisibility ̐擪
+		uint32_t nodeCount   = Def::UIntZero;
+		bool	 isPerNode   = false;			// false Ȃ烂fŜ1
+		bool	 isVisible   = true;
+	};
+
+	/// <summary>
+	/// [begin, end) ͈̔͂4vfPʂŔ肵܂ibegin 4̔{jB
+	/// </summary>
+	void TestRange(const uint32_t begin, const uint32_t end) noexcept;
+
+	void ResolveEntities() noexcept;
+
+	// 6ʁi@, xyz:@ w:j
+	std::array<Math::Vector4, 6> m_planes{};
+
+	// SoA: 4vf XMVECTOR ւ̂܂܃[hł
+	std::vector<float> m_centerX, m_centerY, m_centerZ;
+	std::vector<float> m_extentX, m_extentY, m_extentZ;
+	std::vector<uint8_t> m_visibility;
+
+	std::vector<uint32_t> m_itemNodeIndices;	// eACeΉm[hifŜȂ UINT32_MAXj
+	std::vector<uint8_t>  m_nodeVisibility;
+	std::unordered_map<uint32_t, EntityRecord> m_entityRecords;
+
+	std::unique_ptr<ScopedThreadPool> m_upWorkers;
+	std::vector<std::future<void>>	  m_pendingJobs;
+	size_t m_workerCount = Def::UIntZero;
+
+	uint32_t m_itemCount   = Def::UIntZero;
+	uint32_t m_culledCount = Def::UIntZero;
+
+	bool m_isEnable = true;
+	bool m_isActive = false;	// t[ɔs
+
+	static constexpr uint8_t Visible{ 1U };
+	static constexpr uint8_t Hidden { 0U };
+
+	// ꖢ̌̓CXbĥ݂ŏ
+	static constexpr uint32_t ParallelThreshold{ 4096U };
+	// [J[֓n1Wu̍ŏi4̔{j
+	static constexpr uint32_t MinJobItems{ 2048U };
+};
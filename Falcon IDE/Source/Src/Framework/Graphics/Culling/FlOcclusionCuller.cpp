@@ -0,0 +1,320 @@
+#include "FlOcclusionCuller.h"
+
+FlOcclusionCuller::FlOcclusionCuller()
+{
+	auto hardware{ std::thread::hardware_concurrency() };
+	m_workerCount = hardware > Def::UIntOne ? hardware - Def::UIntOne : Def::UIntOne;
+	m_upWorkers   = std::make_unique<ScopedThreadPool>(m_workerCount);
+
+	m_depth.resize(Width * Height, Def::FloatOne);
+	m_bins.resize(TileCount);
+}
+
+void FlOcclusionCuller::Begin(const Math::Matrix& mView, const Math::Matrix& mProj) noexcept
+{
+	m_beginTime = std::chrono::steady_clock::now();
+
+	std::fill(m_depth.begin(), m_depth.end(), Def::FloatOne);
+	m_triangles.clear();
+	for (auto& bin : m_bins) bin.clear();
+
+	m_occludeeIds.clear();
+	m_occludeeBoxes.clear();
+	m_occludeeVisibility.clear();
+	m_occludeeIndices.clear();
+
+	m_culledCount = Def::UIntZero;
+	m_mViewProj   = mView * mProj;
+	m_isActive    = m_isEnable;
+}
+
+void FlOcclusionCuller::Skip() noexcept
+{
+	m_occludeeIds.clear();
+	m_occludeeIndices.clear();
+	m_culledCount      = Def::UIntZero;
+	m_costMilliseconds = Def::FloatZero;
+	m_isActive         = false;
+}
+
+void FlOcclusionCuller::AddOccluder(const ModelData& model, const Math::Matrix& mWorld)
+{
+	using namespace DirectX;
+
+	// {[Ō`ς邽ߎՕɂ͂Ȃ
+	if (!m_isActive || model.IsSkinMesh()) return;
+
+	for (const auto& node : model.GetNodes())
+	{
+		if (!node.m_spMesh) continue;
+
+		const auto& positions{ node.m_spMesh->GetPositions() };
+		const auto& faces	 { node.m_spMesh->GetFaces() };
+		if (positions.empty()) continue;
+
+		// DrawModel Ɠsinode.m_mLocal * worldjŃNbvԂ
+		const XMMATRIX mClip{ node.m_mLocal * mWorld * m_mViewProj };
+
+		for (const auto& face : faces)
+		{
+			if (face.Idx[0] >= positions.size() || face.Idx[1] >= positions.size() || face.Idx[2] >= positions.size()) continue;
+
+			SetupTriangle(
+				XMVector3Transform(XMLoadFloat3(&positions[face.Idx[0]]), mClip),
+				XMVector3Transform(XMLoadFloat3(&positions[face.Idx[1]]), mClip),
+				XMVector3Transform(XMLoadFloat3(&positions[face.Idx[2]]), mClip));
+		}
+	}
+}
+
+void FlOcclusionCuller::SetupTriangle(DirectX::FXMVECTOR clip0, DirectX::FXMVECTOR clip1, DirectX::FXMVECTOR clip2)
+{
+	using namespace DirectX;
+
+	const XMVECTOR clips[3]{ clip0, clip1, clip2 };
+
+	// ՕĂĉBƂ͂Ȃ߁AjAʂׂOp`̓Nbvj
+	auto x{ std::array<float, 3>{} }, y{ std::array<float, 3>{} }, z{ std::array<float, 3>{} };
+	for (auto i{ Def::UIntZero }; i < 3U; ++i)
+	{
+		const auto w{ XMVectorGetW(clips[i]) };
+		if (w <= NearW) return;
+
+		const auto invW{ Def::FloatOne / w };
+		x[i] = (XMVectorGetX(clips[i]) * invW * 0.5f + 0.5f) * Width;
+		y[i] = (0.5f - XMVectorGetY(clips[i]) * invW * 0.5f) * Height;
+		z[i] = XMVectorGetZ(clips[i]) * invW;
+
+		// jAʂO͕̕`悳ȂߎՕɂȂȂ
+		if (z[i] < Def::FloatZero) return;
+	}
+
+	// ʊO̎Op`͎̂Ă
+	const auto minX{ std::max(std::floor(std::min({ x[0], x[1], x[2] })), Def::FloatZero) };
+	const auto minY{ std::max(std::floor(std::min({ y[0], y[1], y[2] })), Def::FloatZero) };
+	const auto maxX{ std::min(std::ceil (std::max({ x[0], x[1], x[2] })), static_cast<float>(Width)) };
+	const auto maxY{ std::min(std::ceil (std::max({ y[0], y[1], y[2] })), static_cast<float>(Height)) };
+	if (minX >= maxX || minY >= maxY) return;
+	if (std::min({ z[0], z[1], z[2] }) > Def::FloatOne) return;
+
+	// Ɋւ炸ɂȂ悤ɑiʂՕƂĈj
+	auto area{ (x[1] - x[0]) * (y[2] - y[0]) - (y[1] - y[0]) * (x[2] - x[0]) };
+	if (area < Def::FloatZero)
+	{
+		std::swap(x[1], x[2]); std::swap(y[1], y[2]); std::swap(z[1], z[2]);
+		area = -area;
+	}
+	if (area <= std::numeric_limits<float>::epsilon()) return;
+
+	auto tri{ ScreenTriangle{} };
+
+	// edge[i] ͒_ i ̑Ε (i+1  i+2)
+	for (auto i{ Def::UIntZero }; i < 3U; ++i)
+	{
+		const auto a{ (i + 1U) % 3U }, b{ (i + 2U) % 3U };
+		tri.edgeA[i] = y[a] - y[b];
+		tri.edgeB[i] = x[b] - x[a];
+		tri.edgeC[i] = (y[b] - y[a]) * x[a] - (x[b] - x[a]) * y[a];
+	}
+
+	// dSW (edge[i] / area) Ő[xԂ镽
+	const auto invArea{ Def::FloatOne / area };
+	tri.depthA = (tri.edgeA[0] * z[0] + tri.edgeA[1] * z[1] + tri.edgeA[2] * z[2]) * invArea;
+	tri.depthB = (tri.edgeB[0] * z[0] + tri.edgeB[1] * z[1] + tri.edgeB[2] * z[2]) * invArea;
+	tri.depthC = (tri.edgeC[0] * z[0] + tri.edgeC[1] * z[1] + tri.edgeC[2] * z[2]) * invArea;
+
+	tri.minX = static_cast<uint32_t>(minX);
+	tri.minY = static_cast<uint32_t>(minY);
+	tri.maxX = static_cast<uint32_t>(maxX);
+	tri.maxY = static_cast<uint32_t>(maxY);
+
+	m_triangles.push_back(tri);
+}
+
+void FlOcclusionCuller::AddOccludee(const uint32_t id, const DirectX::BoundingBox& worldBox)
+{
+	if (!m_isActive) return;
+
+	m_occludeeIndices[id] = static_cast<uint32_t>(m_occludeeIds.size());
+	m_occludeeIds.push_back(id);
+	m_occludeeBoxes.push_back(worldBox);
+}
+
+void FlOcclusionCuller::Execute()
+{
+	if (!m_isActive) return;
+
+	// rjOiOp`̋`|^C֓o^j
+	for (auto i{ Def::UIntZero }; i < static_cast<uint32_t>(m_triangles.size()); ++i)
+	{
+		const auto& tri{ m_triangles[i] };
+		for (auto ty{ tri.minY / TileHeight }; ty <= (tri.maxY - Def::UIntOne) / TileHeight; ++ty)
+			for (auto tx{ tri.minX / TileWidth }; tx <= (tri.maxX - Def::UIntOne) / TileWidth; ++tx)
+				m_bins[ty * TilesX + tx].push_back(i);
+	}
+
+	// ^Cm͏ݐ悪dȂȂߕɃX^CYł
+	if (!m_triangles.empty())
+		Dispatch(TileCount, Def::UIntOne, [this](const uint32_t begin, const uint32_t end)
+			{
+				for (auto tile{ begin }; tile < end; ++tile) RasterizeTile(tile);
+			});
+
+	m_occludeeVisibility.assign(m_occludeeIds.size(), Visible);
+	if (!m_triangles.empty())
+		Dispatch(static_cast<uint32_t>(m_occludeeIds.size()), MinOccludeeJob, [this](const uint32_t begin, const uint32_t end)
+			{
+				for (auto i{ begin }; i < end; ++i)
+					m_occludeeVisibility[i] = TestBox(m_occludeeBoxes[i]) ? Visible : Hidden;
+			});
+
+	m_culledCount = static_cast<uint32_t>(std::count(m_occludeeVisibility.begin(), m_occludeeVisibility.end(), Hidden));
+
+	m_costMilliseconds = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - m_beginTime).count();
+}
+
+void FlOcclusionCuller::RasterizeTile(const uint32_t tile) noexcept
+{
+	using namespace DirectX;
+
+	const auto tileMinX{ (tile % TilesX) * TileWidth }, tileMinY{ (tile / TilesX) * TileHeight };
+	const auto tileMaxX{ tileMinX + TileWidth }, tileMaxY{ tileMinY + TileHeight };
+
+	const auto laneOffset{ XMVectorSet(0.5f, 1.5f, 2.5f, 3.5f) };
+	const auto zero{ XMVectorZero() };
+
+	for (const auto index : m_bins[tile])
+	{
+		const auto& tri{ m_triangles[index] };
+
+		// 4sNZPʂŏ邽߉4̔{ɑi͈͊Õ[̓GbW֐Œej
+		const auto beginX{ std::max(tri.minX, tileMinX) & ~3U };
+		const auto endX  { std::min((tri.maxX + 3U) & ~3U, tileMaxX) };
+		const auto beginY{ std::max(tri.minY, tileMinY) };
+		const auto endY  { std::min(tri.maxY, tileMaxY) };
+
+		const auto a0{ XMVectorReplicate(tri.edgeA[0]) }, a1{ XMVectorReplicate(tri.edgeA[1]) }, a2{ XMVectorReplicate(tri.edgeA[2]) };
+		const auto depthA{ XMVectorReplicate(tri.depthA) };
+
+		for (auto py{ beginY }; py < endY; ++py)
+		{
+			const auto centerY{ static_cast<float>(py) + 0.5f };
+
+			// sň̍
+			const auto row0{ XMVectorReplicate(tri.edgeB[0] * centerY + tri.edgeC[0]) };
+			const auto row1{ XMVectorReplicate(tri.edgeB[1] * centerY + tri.edgeC[1]) };
+			const auto row2{ XMVectorReplicate(tri.edgeB[2] * centerY + tri.edgeC[2]) };
+			const auto rowZ{ XMVectorReplicate(tri.depthB * centerY + tri.depthC) };
+
+			auto pDepth{ m_depth.data() + py * Width };
+
+			for (auto px{ beginX }; px < endX; px += 4U)
+			{
+				const auto centerX{ XMVectorAdd(XMVectorReplicate(static_cast<float>(px)), laneOffset) };
+
+				const auto w0{ XMVectorMultiplyAdd(a0, centerX, row0) };
+				const auto w1{ XMVectorMultiplyAdd(a1, centerX, row1) };
+				const auto w2{ XMVectorMultiplyAdd(a2, centerX, row2) };
+
+				auto inside{ XMVectorGreaterOrEqual(w0, zero) };
+				inside = XMVectorAndInt(inside, XMVectorGreaterOrEqual(w1, zero));
+				inside = XMVectorAndInt(inside, XMVectorGreaterOrEqual(w2, zero));
+
+				const auto depth  { XMVectorMultiplyAdd(depthA, centerX, rowZ) };
+				const auto current{ XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(pDepth + px)) };
+
+				// O̐[xc
+				XMStoreFloat4(reinterpret_cast<XMFLOAT4*>(pDepth + px),
+					XMVectorSelect(current, XMVectorMin(current, depth), inside));
+			}
+		}
+	}
+}
+
+const bool FlOcclusionCuller::TestBox(const DirectX::BoundingBox& worldBox) const noexcept
+{
+	using namespace DirectX;
+
+	XMFLOAT3 corners[BoundingBox::CORNER_COUNT]{};
+	worldBox.GetCorners(corners);
+
+	const auto mViewProj{ XMLoadFloat4x4(&m_mViewProj) };
+
+	auto minX{ std::numeric_limits<float>::max() }, minY{ std::numeric_limits<float>::max() };
+	auto maxX{ std::numeric_limits<float>::lowest() }, maxY{ std::numeric_limits<float>::lowest() };
+	auto minZ{ std::numeric_limits<float>::max() };
+
+	for (const auto& corner : corners)
+	{
+		const auto clip{ XMVector3Transform(XMLoadFloat3(&corner), mViewProj) };
+		const auto w{ XMVectorGetW(clip) };
+
+		// Jׂ͔łȂ̂ŉ
+		if (w <= NearW) return true;
+
+		const auto invW{ Def::FloatOne / w };
+		const auto x{ (XMVectorGetX(clip) * invW * 0.5f + 0.5f) * Width };
+		const auto y{ (0.5f - XMVectorGetY(clip) * invW * 0.5f) * Height };
+
+		minX = std::min(minX, x); maxX = std::max(maxX, x);
+		minY = std::min(minY, y); maxY = std::max(maxY, y);
+		minZ = std::min(minZ, XMVectorGetZ(clip) * invW);
+	}
+
+	if (minZ <= Def::FloatZero) return true;
+
+	const auto beginX{ static_cast<uint32_t>(std::max(std::floor(minX), Def::FloatZero)) & ~3U };
+	const auto beginY{ static_cast<uint32_t>(std::max(std::floor(minY), Def::FloatZero)) };
+	const auto endX  { std::min((static_cast<uint32_t>(std::max(std::ceil(maxX), Def::FloatZero)) + 3U) & ~3U, Width) };
+	const auto endY  { std::min(static_cast<uint32_t>(std::max(std::ceil(maxY), Def::FloatZero)), Height) };
+
+	// ʊO͎JO̒S
+	if (beginX >= endX || beginY >= endY) return true;
+
+	const auto nearest{ XMVectorReplicate(minZ) };
+
+	for (auto py{ beginY }; py < endY; ++py)
+	{
+		const auto pDepth{ m_depth.data() + py * Width };
+		for (auto px{ beginX }; px < endX; px += 4U)
+		{
+			const auto depth{ XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(pDepth + px)) };
+			if (XMComparisonAnyTrue(XMVector4GreaterOrEqualR(depth, nearest))) return true;
+		}
+	}
+	return false;
+}
+
+void FlOcclusionCuller::Dispatch(const uint32_t count, const uint32_t minPerJob, const std::function<void(uint32_t, uint32_t)>& job)
+{
+	if (count == Def::UIntZero) return;
+
+	const auto jobCount{ static_cast<uint32_t>(m_workerCount + Def::UIntOne) };
+	const auto perJob  { std::max(minPerJob, (count + jobCount - Def::UIntOne) / jobCount) };
+
+	if (perJob >= count || m_workerCount <= Def::UIntOne)
+	{
+		job(Def::UIntZero, count);
+		return;
+	}
+
+	// CXbh1󂯎
+	m_pendingJobs.clear();
+	for (auto begin{ perJob }; begin < count; begin += perJob)
+	{
+		const auto end{ std::min(begin + perJob, count) };
+		m_pendingJobs.push_back(m_upWorkers->Enqueue([&job, begin, end] { job(begin, end); }));
+	}
+	job(Def::UIntZero, perJob);
+
+	for (auto& pending : m_pendingJobs) pending.wait();
+	m_pendingJobs.clear();
+}
+
+const bool FlOcclusionCuller::IsEntityVisible(const uint32_t id) const noexcept
+{
+	if (!m_isActive) return true;
+
+	auto it{ m_occludeeIndices.find(id) };
+	return it == m_occludeeIndices.end() || it->second >= m_occludeeVisibility.size() || m_occludeeVisibility[it->second] != Hidden;
+}
@@ -0,0 +1,137 @@
+#pragma once
+
+/// <summary> =Singleton= </summary>
+class FlOcclusionCuller
+{
+public:
+
+	/// <summary>
+	/// t[JnB[xobt@ŉlŏAOt[̓o^j܂B
+	/// </summary>
+	/// <param name="mView">r[s</param>
+	/// <param name="mProj">ˉes</param>
+	void Begin(const Math::Matrix& mView, const Math::Matrix& mProj) noexcept;
+
+	/// <summary>
+	/// J݂Ȃt[ł͑SĉƂĈ܂B
+	/// </summary>
+	void Skip() noexcept;
+
+	/// <summary>
+	/// ՕƂăf̎Op`XN[Ԃ֕ϊēo^܂BiXLbV͑ΏۊOj
+	/// </summary>
+	/// <param name="model">ff[^</param>
+	/// <param name="mWorld">[hs</param>
+	void AddOccluder(const ModelData& model, const Math::Matrix& mWorld);
+
+	/// <summary>
+	/// Օ̑ΏۂƂăGeBeB̃[hAABBo^܂B
+	/// </summary>
+	/// <param name="id">GeBeBID</param>
+	/// <param name="worldBox">[hԂAABB</param>
+	void AddOccludee(const uint32_t id, const DirectX::BoundingBox& worldBox);
+
+	/// <summary>
+	/// Op`^CփrjOA^CPʂŕɃX^CYAo^ς݂AABB𔻒肵܂B
+	/// </summary>
+	void Execute();
+
+	/// <summary>
+	/// GeBeB̉io^̃GeBeB͉j
+	/// </summary>
+	const bool IsEntityVisible(const uint32_t id) const noexcept;
+
+	/// <summary>
+	/// X^CYς݂̐[xobt@iWidth * Height, 0: 1:j
+	/// </summary>
+	const auto& GetDepthBuffer() const noexcept { return m_depth; }
+
+	inline const auto IsEnable() const noexcept { return m_isEnable; }
+	inline auto& WorkIsEnable() noexcept { return m_isEnable; }
+	inline auto SetIsEnable(const bool is) noexcept { m_isEnable = is; }
+
+	inline const auto GetTriangleCount() const noexcept { return static_cast<uint32_t>(m_triangles.size()); }
+	inline const auto GetTestedCount()   const noexcept { return static_cast<uint32_t>(m_occludeeIds.size()); }
+	inline const auto GetCulledCount()   const noexcept { return m_culledCount; }
+	inline const auto GetCostMilliseconds() const noexcept { return m_costMilliseconds; }
+
+	// [xobt@̉𑜓xiSIMD4A^CTCY̔{j
+	static constexpr uint32_t Width { 256U };
+	static constexpr uint32_t Height{ 128U };
+
+	static auto& Instance() noexcept
+	{
+		static auto instance{ FlOcclusionCuller{} };
+		return instance;
+	}
+
+private:
+
+	FlOcclusionCuller();
+	~FlOcclusionCuller() = default;
+
+	FlOcclusionCuller(const FlOcclusionCuller&) = delete;
+	FlOcclusionCuller& operator=(const FlOcclusionCuller&) = delete;
+
+	// ZbgAbvς݂̎Op`BŐɂȂGbW֐ E(x,y) = a*x + b*y + c Ɛ[xʂێ
+	struct ScreenTriangle
+	{
+		float edgeA[3], edgeB[3], edgeC[3];
+		float depthA, depthB, depthC;
+		uint32_t minX, minY, maxX, maxY;	// sNZ͈ [min, max)
+	};
+
+	/// <summary>
+	/// NbvW̎Op`ZbgAbvēo^܂BjANbvׂ͎̂ՕɎg܂B
+	/// </summary>
+	void SetupTriangle(DirectX::FXMVECTOR clip0, DirectX::FXMVECTOR clip1, DirectX::FXMVECTOR clip2);
+
+	void RasterizeTile(const uint32_t tile) noexcept;
+
+	/// <summary>
+	/// AABB[xobt@O1sNZłoĂΉ
+	/// </summary>
+	const bool TestBox(const DirectX::BoundingBox& worldBox) const noexcept;
+
+	/// <summary>
+	/// [0, count)  minPerJob ȏジɕACXbhƃ[J[ŏ܂B
+	/// </summary>
+	void Dispatch(const uint32_t count, const uint32_t minPerJob, const std::function<void(uint32_t, uint32_t)>& job);
+
+	Math::Matrix m_mViewProj{};
+
+	std::vector<float>			m_depth;
+	std::vector<ScreenTriangle> m_triangles;
+	std::vector<std::vector<uint32_t>> m_bins;	// ^C̎Op`CfbNX
+
+	std::vector<uint32_t>			   m_occludeeIds;
+	std::vector<DirectX::BoundingBox>  m_occludeeBoxes;
+	std::vector<uint8_t>			   m_occludeeVisibility;
+	std::unordered_map<uint32_t, uint32_t> m_occludeeIndices;
+
+	std::unique_ptr<ScopedThreadPool> m_upWorkers;
+	std::vector<std::future<void>>	  m_pendingJobs;
+	size_t m_workerCount = Def::UIntZero;
+
+	std::chrono::steady_clock::time_point m_beginTime;
+
+	uint32_t m_culledCount	    = Def::UIntZero;
+	float	 m_costMilliseconds = Def::FloatZero;
+
+	bool m_isEnable = true;
+	bool m_isActive = false;	// t[ɔs
+
+	static constexpr uint8_t Visible{ 1U };
+	static constexpr uint8_t Hidden { 0U };
+
+	static constexpr uint32_t TileWidth { 32U };
+	static constexpr uint32_t TileHeight{ 32U };
+	static constexpr uint32_t TilesX{ Width / TileWidth };
+	static constexpr uint32_t TilesY{ Height / TileHeight };
+	static constexpr uint32_t TileCount{ TilesX * TilesY };
+
+	// ΏۂꖢȂ烁CXbĥ݂ŏ
+	static constexpr uint32_t MinOccludeeJob{ 256U };
+	// w ȉ̒_̓jANbvʂ̎OƂ݂Ȃ
+	static constexpr float NearW{ 1.0e-4f };
+};
@@ -35,4 +35,8 @@ class GraphicsDevice;
 #include "Animation/Animation.h"
 
 // <Shader:VF[_>
-#include "Shader/Shader.h"
\ No newline at end of file
+#include "Shader/Shader.h"
+
+// <Culling:JO>
+#include "Culling/FlFrustumCuller.h"
+#include "Culling/FlOcclusionCuller.h"
\ No newline at end of file
@@ -84,6 +84,8 @@ bool GraphicsDevice::Init(HWND hWnd, int w, int h)
 
 void GraphicsDevice::PreDraw()
 {
+	FL_PROFILE_FUNCTION();
+
 	GetCBVSRVUAVHeap()->SetHeap();
 
 	GetCBufferAllocater()->ResetCurrentUseNumber();
@@ -177,6 +179,8 @@ void GraphicsDevice::Prepare()
 
 void GraphicsDevice::ScreenFlip()
 {
+	FL_PROFILE_FUNCTION();
+
 	auto bbIdx{ m_pSwapChain->GetCurrentBackBufferIndex() };
 	SetResourceBarrier(m_pSwapchainBuffers[bbIdx].Get(),
 		D3D12_RESOURCE_STATE_RENDER_TARGET, D3D12_RESOURCE_STATE_PRESENT);
@@ -5,6 +5,8 @@ void Mesh::Create(GraphicsDevice* pGraphicsDevice, const MeshVertex& vertices,
 {
 	m_pDevice  = pGraphicsDevice;
 	m_material = material;
+
+	m_trackedBytes.Set(m_positions.capacity() * sizeof(Math::Vector3) + m_faces.capacity() * sizeof(MeshFace));
 	
 	for (auto&& layout : m_semanticsLayout)
 	{
@@ -77,6 +79,8 @@ void Mesh::Create(GraphicsDevice* pGraphicsDevice, const MeshVertex& vertices,
 	m_ibView.SizeInBytes = static_cast<UINT>(resDesc.Width);
 	m_ibView.Format = DXGI_FORMAT_R32_UINT;
 
+	m_trackedBytes.Add(resDesc.Width);
+
 	// CfbNXobt@ɏ
 	MeshFace* ibMap = nullptr;
 	{
@@ -86,6 +90,17 @@ void Mesh::Create(GraphicsDevice* pGraphicsDevice, const MeshVertex& vertices,
 	}
 }
 
+void Mesh::SetOccluderGeometry(std::vector<Math::Vector3>&& positions, std::vector<MeshFace>&& faces) noexcept
+{
+	const auto previousBytes{ m_positions.capacity() * sizeof(Math::Vector3) + m_faces.capacity() * sizeof(MeshFace) };
+
+	m_positions = std::move(positions);
+	m_faces     = std::move(faces);
+
+	m_trackedBytes.Set(m_trackedBytes.GetBytes() - previousBytes
+		+ m_positions.capacity() * sizeof(Math::Vector3) + m_faces.capacity() * sizeof(MeshFace));
+}
+
 void Mesh::DrawInstanced(UINT vertexCount)const
 {
 	m_pDevice->GetCmdList()->IASetVertexBuffers(0, static_cast<UINT>(m_views.size()), m_views.data());
@@ -89,6 +89,23 @@ public:
 	/// <returns>bV̖O\ std::string IuWFNgB</returns>
 	const std::string GetMeshName()const noexcept { return m_name; }
 
+	/// <summary>
+	/// IN[WJOp̒_WƖʏ CPU ɕێ܂BiՕɎgbV̂݁j
+	/// </summary>
+	/// <param name="positions">_W</param>
+	/// <param name="faces">ʏ</param>
+	void SetOccluderGeometry(std::vector<Math::Vector3>&& positions, std::vector<MeshFace>&& faces) noexcept;
+
+	/// <summary>
+	/// CPUɕێ_W擾܂BiՕɎgȂbV͋j
+	/// </summary>
+	const std::vector<Math::Vector3>& GetPositions()const noexcept { return m_positions; }
+
+	/// <summary>
+	/// CPUɕێʏ擾܂B
+	/// </summary>
+	const std::vector<MeshFace>& GetFaces()const noexcept { return m_faces; }
+
 private:
 	template<typename T>
 	void CreateVertexBuffer(const std::vector<T>& data, const UINT stride, 
@@ -127,6 +144,7 @@ private:
 		assert(SUCCEEDED(hr));
 
 		(*outBuffer)->SetName(name.data());
+		m_trackedBytes.Add(bufferSize);
 
 		// 
 		auto mapped{ static_cast<void*>(nullptr) };
@@ -173,6 +191,12 @@ private:
 
 	std::vector<InputLayout> m_semanticsLayout;
 
+	std::vector<Math::Vector3>	m_positions;	// CPU̒_WiՕ̂݁j
+	std::vector<MeshFace>		m_faces;		// CPU̖ʏiՕ̂݁j
+
+	// Abv[hq[ṽobt@ CPU ̎ʂ̍v
+	FlMemoryCharge m_trackedBytes{ FlMemoryTag::Mesh };
+
 	UINT m_instanceCount{};
 	Material m_material{};
 
@@ -12,9 +12,45 @@ bool ModelData::Load(const std::string& filepath)
 		return false;
 	}
 
+	CalcBounds();
+
+	m_filePath			  = filepath;
+	m_hasOccluderGeometry = false;
+
 	return true;
 }
 
+bool ModelData::LoadOccluderGeometry()
+{
+	if (m_hasOccluderGeometry) return true;
+	if (m_filePath.empty() || m_isSkinMesh) return false;
+
+	ModelLoader modelLoader;
+	m_hasOccluderGeometry = modelLoader.LoadOccluderGeometry(m_filePath, *this);
+	return m_hasOccluderGeometry;
+}
+
+void ModelData::CalcBounds() noexcept
+{
+	auto isFirst{ true };
+	for (const auto& meshIdx : m_meshNodeIndices)
+	{
+		const auto& node{ m_nodes[meshIdx] };
+		if (!node.m_hasBounds) continue;
+
+		// DrawModel Ɠm[h̃[JsŃfԂ֕ϊ
+		auto box{ DirectX::BoundingBox{} };
+		node.m_localAABB.Transform(box, node.m_mLocal);
+
+		if (isFirst)
+		{
+			m_bounds = box;
+			isFirst  = false;
+		}
+		else DirectX::BoundingBox::CreateMerged(m_bounds, m_bounds, box);
+	}
+}
+
 const std::shared_ptr<AnimationData> ModelData::GetAnimation(const std::string& animName) const
 {
 	for (auto&& anim : m_spAnimations)
@@ -20,6 +20,9 @@ public:
 
 		std::vector<int32_t>    m_children;
 		int32_t                 m_parentIndex = -Def::IntOne;
+
+		DirectX::BoundingBox	m_localAABB{};		// bV_Zom[h[JAABB
+		bool					m_hasBounds = false;
 	};
 
 	/// <summary>
@@ -29,6 +32,15 @@ public:
 	/// <returns>true</returns>
 	bool Load(const std::string& filepath);
 
+	/// <summary>
+	/// IN[WJO̎ՕpɁAebV̒_WƖʏ CPU ֓ǂݍ݂܂B
+	/// ՕɎw肳ꂽfʂ悤A߂Ďw肳ꂽƂɌt@Cǂݒ܂B
+	/// </summary>
+	/// <returns>ǂݍݍς݁A܂͐true</returns>
+	bool LoadOccluderGeometry();
+
+	inline const auto HasOccluderGeometry() const noexcept { return m_hasOccluderGeometry; }
+
 	/// <summary>
 	/// m[h̎擾
 	/// </summary>
@@ -53,6 +65,17 @@ public:
 
 	inline const auto IsSkinMesh() const noexcept { return m_isSkinMesh; }
 
+	/// <summary>
+	/// SbVm[hރfԂAABBČvZ
+	/// </summary>
+	void CalcBounds() noexcept;
+
+	/// <summary>
+	/// fԂAABB擾
+	/// </summary>
+	/// <returns>fŜAABB</returns>
+	const DirectX::BoundingBox& GetBounds() const noexcept { return m_bounds; }
+
 private:
 
 	std::vector<Node>		m_nodes;
@@ -64,5 +87,12 @@ private:
 	// Sm[hA{[m[ĥ݂Indexz
 	std::vector<int>		m_boneNodeIndices;
 
+	// SbVm[hރfԂAABB
+	DirectX::BoundingBox	m_bounds{};
+
 	bool m_isSkinMesh = false;
+
+	// Օp̒_ǂݒ߂̌t@C
+	std::string m_filePath;
+	bool m_hasOccluderGeometry = false;
 };
\ No newline at end of file
@@ -25,6 +25,18 @@ void ModelLoader::BuildNodeHierarchy(aiNode* aiNode, ModelData& model, int32_t p
 		model.WorkMeshNodeIndices().push_back(node->m_nodeIndex);
 		model.WorkNodes()[node->m_nodeIndex].m_spMesh =
 			Parse(pScene, pMesh, pMaterial, dirPath, model, nodeNameToIndex);
+
+		// m[h[JAABBiJOpj𒸓_Zo
+		if (pMesh->mNumVertices == Def::UIntZero) continue;
+
+		auto box{ DirectX::BoundingBox{} };
+		DirectX::BoundingBox::CreateFromPoints(box, pMesh->mNumVertices,
+			reinterpret_cast<const DirectX::XMFLOAT3*>(pMesh->mVertices), sizeof(aiVector3D));
+
+		auto& dstNode{ model.WorkNodes()[node->m_nodeIndex] };
+		if (dstNode.m_hasBounds) DirectX::BoundingBox::CreateMerged(dstNode.m_localAABB, dstNode.m_localAABB, box);
+		else dstNode.m_localAABB = box;
+		dstNode.m_hasBounds = true;
 	}
 
 	// ċAIɎqm[h
@@ -119,6 +131,53 @@ bool ModelLoader::Load(std::string filepath, ModelData& model)
 	return true;
 }
 
+bool ModelLoader::LoadOccluderGeometry(const std::string& filepath, ModelData& model)
+{
+	// _WɌtO Load ƑiUVEڐ͕svj
+	Assimp::Importer importer;
+	const auto pScene = importer.ReadFile(filepath, aiProcess_Triangulate | aiProcess_MakeLeftHanded);
+	if (!pScene || pScene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !pScene->mRootNode) {
+		return false;
+	}
+
+	auto nodeIndex{ Def::IntZero };
+	return AssignOccluderGeometry(pScene->mRootNode, pScene, model, nodeIndex)
+		&& nodeIndex == static_cast<int32_t>(model.GetNodes().size());
+}
+
+bool ModelLoader::AssignOccluderGeometry(const aiNode* aiNode, const aiScene* pScene, ModelData& model, int32_t& nodeIndex) noexcept
+{
+	if (nodeIndex >= static_cast<int32_t>(model.GetNodes().size())) return false;
+
+	auto& node{ model.WorkNodes()[nodeIndex++] };
+
+	// BuildNodeHierarchy ƓAm[hɎĉ͍ŌɊ蓖ĂbV
+	if (aiNode->mNumMeshes > Def::UIntZero && node.m_spMesh)
+	{
+		const auto pMesh{ pScene->mMeshes[aiNode->mMeshes[aiNode->mNumMeshes - Def::UIntOne]] };
+
+		auto positions(std::vector<Math::Vector3>(pMesh->mNumVertices));
+		for (auto i{ Def::UIntZero }; i < pMesh->mNumVertices; ++i)
+			positions[i] = Math::Vector3(pMesh->mVertices[i].x, pMesh->mVertices[i].y, pMesh->mVertices[i].z);
+
+		// Op`Ŏc_E̖ʂ͎ՕɊ^Ȃ̂ŏ
+		auto faces{ std::vector<MeshFace>{} };
+		faces.reserve(pMesh->mNumFaces);
+		for (auto i{ Def::UIntZero }; i < pMesh->mNumFaces; ++i) {
+			const auto& face{ pMesh->mFaces[i] };
+			if (face.mNumIndices != 3U) continue;
+			faces.push_back({ face.mIndices[0], face.mIndices[1], face.mIndices[2] });
+		}
+
+		node.m_spMesh->SetOccluderGeometry(std::move(positions), std::move(faces));
+	}
+
+	for (auto i{ Def::UIntZero }; i < aiNode->mNumChildren; ++i) {
+		if (!AssignOccluderGeometry(aiNode->mChildren[i], pScene, model, nodeIndex)) return false;
+	}
+	return true;
+}
+
 std::shared_ptr<Mesh> ModelLoader::Parse(const aiScene* pScene, const aiMesh* pMesh, 
 	const aiMaterial* pMaterial, const std::string& dirPath, ModelData& model, 
 	const std::map<std::string, int32_t>& nodeNameToIndex) 
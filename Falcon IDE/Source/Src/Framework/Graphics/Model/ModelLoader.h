@@ -14,6 +14,14 @@ public:
 	/// <returns>true</returns>
 	bool Load(std::string filepath, ModelData& model);
 
+	/// <summary>
+	/// [hς݃f̊ebVցAՕp̒_WƖʏ񂾂ǂݍ
+	/// </summary>
+	/// <param name="filepath">Load Ɠt@CpX</param>
+	/// <param name="model">Load ς݂̃f</param>
+	/// <returns>true</returns>
+	bool LoadOccluderGeometry(const std::string& filepath, ModelData& model);
+
 private:
 
 	/// <summary>
@@ -39,4 +47,10 @@ private:
 	void BuildNodeHierarchy(aiNode* aiNode, ModelData& model, int32_t parentIndex,
 		std::map<std::string, int32_t>& nodeNameToIndex,
 		const aiScene* pScene, const std::string& dirPath) noexcept;
+
+	/// <summary>
+	/// BuildNodeHierarchy ƓŃm[hHAem[h̃bV֎Օp̒_n
+	/// </summary>
+	/// <returns>m[h\ Load ƈvtrue</returns>
+	bool AssignOccluderGeometry(const aiNode* aiNode, const aiScene* pScene, ModelData& model, int32_t& nodeIndex) noexcept;
 };
\ No newline at end of file
@@ -143,7 +143,7 @@ void CalculateNodeWorldMatricesRecursive(
 	const std::vector<ModelData::Node>& nodes,
 	int nodeIndex,
 	const Math::Matrix& parentWorld,
-	std::vector<Math::Matrix>& outWorldMatrices)
+	std::span<Math::Matrix> outWorldMatrices)
 {
 	const auto& node{ nodes[nodeIndex] };
 	auto world{ Def::Mat };
@@ -158,9 +158,8 @@ void CalculateNodeWorldMatricesRecursive(
 void CalculateNodeWorldMatrices(
 	const std::vector<ModelData::Node>& nodes,
 	const size_t nodeSize,
-	std::vector<Math::Matrix>& outWorldMatrices)
+	std::span<Math::Matrix> outWorldMatrices)
 {
-	outWorldMatrices.resize(nodes.size());
 	for (auto idx{ Def::UIntZero }; idx < nodeSize ; ++idx) {
 		if (nodes[idx].m_parentIndex == -Def::IntOne) 
 		{
@@ -170,12 +169,17 @@ void CalculateNodeWorldMatrices(
 	}
 }
 
-void Shader::DrawModel(ModelData& modelData, const Math::Matrix& worldMatrix) 
+void Shader::DrawModel(ModelData& modelData, const Math::Matrix& worldMatrix, const uint8_t* pNodeVisibility) 
 {
+	FL_PROFILE_FUNCTION();
+
 	if (!modelData.IsSkinMesh()) 
 	{
 		// ʏ̕`
 		for (const auto& node : modelData.GetNodes()) {
+			// JOŕsƔ肳ꂽm[h͔΂
+			if (pNodeVisibility && !pNodeVisibility[node.m_nodeIndex]) continue;
+
 			auto world{ node.m_mLocal * worldMatrix };
 
 			m_upIsSkinMesh->isSkin = FALSE;
@@ -187,7 +191,9 @@ void Shader::DrawModel(ModelData& modelData, const Math::Matrix& worldMatrix)
 		return;
 	}
 
-	auto mats{ std::vector<Math::Matrix>{} };
+	// m[h̃[hs͕`̊ԂĝŃXNb`ɒu
+	auto scratch{ FlScratchScope{} };
+	auto mats   { scratch.AllocateSpan<Math::Matrix>(modelData.GetNodes().size()) };
 	CalculateNodeWorldMatrices(modelData.WorkNodes(), modelData.GetNodes().size(), mats);
 
 	for (const auto& node : modelData.WorkNodes()) {
@@ -201,7 +207,7 @@ void Shader::DrawModel(ModelData& modelData, const Math::Matrix& worldMatrix)
 	GraphicsDevice::Instance().GetCBufferAllocater()->BindAndAttachData(3, *m_upIsSkinMesh);
 	GraphicsDevice::Instance().GetCBufferAllocater()->BindAndAttachData(2, *m_upBoneTransforms);
 
-	auto nodes{ modelData.GetNodes() };
+	const auto& nodes{ modelData.GetNodes() };
 	// bV`
 	for (const auto& meshIdx : modelData.GetMeshNodeIndices()) {
 		auto world{ mats[meshIdx] * worldMatrix };
@@ -215,6 +221,8 @@ void Shader::DrawModel(ModelData& modelData, const Math::Matrix& worldMatrix)
 
 void Shader::DrawModel(ModelData& modelData, const Math::Matrix& worldMatrix, ComPtr<ID3D12GraphicsCommandList6>& cmdList)
 {
+	FL_PROFILE_FUNCTION();
+
 	// ʏ̕`
 	for (const auto& node : modelData.GetNodes()) {
 		auto world{ node.m_mLocal * worldMatrix };
@@ -78,7 +78,8 @@ public:
 	/// f̕`
 	/// </summary>
 	/// <param name="modelData">ff[^</param>
-	void DrawModel(ModelData& modelData, const Math::Matrix& worldMatrix);
+	/// <param name="pNodeVisibility">m[hPʂ̉tOinullptrȂSm[h`j</param>
+	void DrawModel(ModelData& modelData, const Math::Matrix& worldMatrix, const uint8_t* pNodeVisibility = nullptr);
 	void DrawModel(ModelData& modelData, const Math::Matrix& worldMatrix, ComPtr<ID3D12GraphicsCommandList6>& cmdList);
 
 	/// <summary>
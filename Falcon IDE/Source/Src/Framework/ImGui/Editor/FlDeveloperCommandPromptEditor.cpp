@@ -3,9 +3,10 @@
 FlDeveloperCommandPromptEditor::FlDeveloperCommandPromptEditor(const std::filesystem::path& slnPath, FlTerminalEditor& terminal)
     : m_parser(slnPath)
     , m_terminal(terminal)
-    , m_upTicker(std::make_unique<FlChronus::Ticker>(FlChronus::ms(500)))
+    , m_upSystemMonitor(std::make_unique<FlSystemMonitor>())
 {
     m_log.push_back("> Loaded Solution: " + slnPath.string());
+    m_upSystemMonitor->Start();
 }
 
 void FlDeveloperCommandPromptEditor::Render(const std::string& title, bool* p_open, ImGuiWindowFlags flags)
@@ -49,171 +50,99 @@ void FlDeveloperCommandPromptEditor::Render(const std::string& title, bool* p_op
     ImGui::End();
 }
 
-void FlDeveloperCommandPromptEditor::InitSystemMonitor() noexcept
+void FlDeveloperCommandPromptEditor::RenderSystemMonitor()
 {
-    if (!m_cpuInitialized)
+    auto isSampling{ m_upSystemMonitor->IsRunning() };
+    if (ImGui::Checkbox("Sampling", &isSampling))
     {
-        PdhOpenQuery(nullptr, NULL, &m_cpuQuery);
-        PdhAddCounter(m_cpuQuery, L"\\Processor(_Total)\\% Processor Time", NULL, &m_cpuTotal);
-        PdhCollectQueryData(m_cpuQuery);
-        m_cpuInitialized = true;
+        if (isSampling) m_upSystemMonitor->Start();
+        else            m_upSystemMonitor->Stop();
     }
-}
-
-const double FlDeveloperCommandPromptEditor::GetCpuUsage() noexcept
-{
-    if (!m_cpuInitialized) InitSystemMonitor();
-
-    PDH_FMT_COUNTERVALUE counterVal;
-    PdhCollectQueryData(m_cpuQuery);
-    PdhGetFormattedCounterValue(m_cpuTotal, PDH_FMT_DOUBLE, nullptr, &counterVal);
-    return counterVal.doubleValue;
-}
+    ImGui::SameLine();
+    auto intervalMs{ static_cast<int>(m_upSystemMonitor->GetInterval().count()) };
+    if (ImGui::SliderInt("Interval (ms)", &intervalMs, 50, 2000))
+        m_upSystemMonitor->SetInterval(std::chrono::milliseconds{ intervalMs });
 
-void FlDeveloperCommandPromptEditor::GetMemoryUsage(SIZE_T& workingSet, SIZE_T& peakWorkingSet) noexcept
-{
-    PROCESS_MEMORY_COUNTERS pmc;
-    if (GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)))
+    const auto& snapshot{ m_upSystemMonitor->Acquire() };
+    if (snapshot.sequence == Def::ULongLongZero)
     {
-        workingSet = pmc.WorkingSetSize;
-        peakWorkingSet = pmc.PeakWorkingSetSize;
+        ImGui::TextDisabled("Sampling...");
+        return;
     }
-}
 
-DWORD FlDeveloperCommandPromptEditor::GetThreadCount() noexcept
-{
-    DWORD currentPID = GetCurrentProcessId();
-    DWORD threadCount = 0;
+    ImGui::Text("PID: %u  (%u Cores, Sample Cost %.2fms)", snapshot.processId, snapshot.processorCount, snapshot.sampleCostMs);
 
-    HANDLE hSnapshot = CreateToolhelp32Snapshot(TH32CS_SNAPPROCESS, 0);
-    if (hSnapshot != INVALID_HANDLE_VALUE)
-    {
-        PROCESSENTRY32 pe32{};
-        pe32.dwSize = sizeof(PROCESSENTRY32);
-
-        if (Process32First(hSnapshot, &pe32))
+    const auto plotSize{ ImVec2{ -FLT_MIN, ImGui::GetTextLineHeight() * 3.0f } };
+    const auto plot{ [&](const char* label, const FlSystemMonitor::History& history, const float max)
         {
-            do
-            {
-                if (pe32.th32ProcessID == currentPID)
-                {
-                    threadCount = pe32.cntThreads;
-                    break;
-                }
-            } while (Process32Next(hSnapshot, &pe32));
-        }
-        CloseHandle(hSnapshot);
-    }
-
-    return threadCount;
-}
-
-void FlDeveloperCommandPromptEditor::RenderSystemMonitor()
-{
-    InitSystemMonitor();
+            ImGui::PlotLines(label, history.GetData(), history.GetCount(), history.GetOffset(), nullptr, Def::FloatZero, max, plotSize);
+        } };
 
-    m_cpuUsage = GetCpuUsage();
-    GetMemoryUsage(m_workingSet, m_peakWorkingSet);
-
-    if (m_upTicker->tick())
-    {
-        m_cpuUsageTick = m_cpuUsage;
-        m_threadList = GetThreadList();
-    }
-
-    ImGui::Text("PID: %d", m_currentPID);
+    ImGui::Separator();
+    ImGui::Text("System CPU: %.1f%%", snapshot.systemCpu.GetLatest());
+    plot("##SystemCpu", snapshot.systemCpu, 100.0f);
 
-    ImGui::Text("CPU Usage: %.2f%%", m_cpuUsageTick);
-    ImGui::ProgressBar(static_cast<float>(m_cpuUsageTick / 100.0), ImVec2(0.0f, 0.0f));
+    ImGui::Text("Process CPU: %.1f%%", snapshot.processCpu.GetLatest());
+    plot("##ProcessCpu", snapshot.processCpu, 100.0f);
 
     ImGui::Separator();
-    ImGui::Text("Memory Usage: %.2f MB", m_workingSet / (1024.0 * 1024.0));
-    ImGui::Text("Peak Memory: %.2f MB", m_peakWorkingSet / (1024.0 * 1024.0));
+    const auto peakMB{ static_cast<float>(snapshot.peakWorkingSet / (1024.0 * 1024.0)) };
+    ImGui::Text("Memory Usage: %.2f MB", snapshot.workingSet.GetLatest());
+    ImGui::Text("Peak Memory: %.2f MB", peakMB);
+    plot("##Memory", snapshot.workingSet, std::max(peakMB, 1.0f));
 
-    ImGui::Text("Total Threads: %d", static_cast<int>(m_threadList.size()));
+    ImGui::Text("Total Threads: %d", static_cast<int>(snapshot.threads.size()));
     ImGui::Separator();
 
-    if (ImGui::BeginTable("ThreadTable", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+    const auto tableFlags{ ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY };
+    if (ImGui::BeginTable("ThreadTable", 7, tableFlags, ImVec2{ 0.0f, ImGui::GetTextLineHeightWithSpacing() * 16.0f }))
     {
+        ImGui::TableSetupScrollFreeze(0, 1);
         ImGui::TableSetupColumn("Thread ID");
         ImGui::TableSetupColumn("Priority");
+        ImGui::TableSetupColumn("CPU (%)");
+        ImGui::TableSetupColumn("History", ImGuiTableColumnFlags_WidthStretch);
         ImGui::TableSetupColumn("User Time (s)");
         ImGui::TableSetupColumn("Kernel Time (s)");
         ImGui::TableSetupColumn("CPU Total (s)");
         ImGui::TableHeadersRow();
 
-        for (auto& t : m_threadList)
+        auto clipper{ ImGuiListClipper{} };
+        clipper.Begin(static_cast<int>(snapshot.threads.size()));
+        while (clipper.Step())
         {
-            ImGui::TableNextRow();
-            ImGui::TableSetColumnIndex(0);
-            ImGui::Text("%lu", t.threadId);
+            for (auto i{ clipper.DisplayStart }; i < clipper.DisplayEnd; ++i)
+            {
+                const auto& t{ snapshot.threads[i] };
+                ImGui::PushID(static_cast<int>(t.threadId));
+                ImGui::TableNextRow();
 
-            ImGui::TableSetColumnIndex(1);
-            ImGui::Text("%d", t.priority);
+                ImGui::TableSetColumnIndex(0);
+                ImGui::Text("%u", t.threadId);
 
-            ImGui::TableSetColumnIndex(2);
-            ImGui::Text("%.2f", t.cpuUserTimeSec);
+                ImGui::TableSetColumnIndex(1);
+                ImGui::Text("%d", t.priority);
 
-            ImGui::TableSetColumnIndex(3);
-            ImGui::Text("%.2f", t.cpuKernelTimeSec);
+                ImGui::TableSetColumnIndex(2);
+                ImGui::Text("%.1f", t.cpuPercent);
 
-            ImGui::TableSetColumnIndex(4);
-            ImGui::Text("%.2f", t.cpuUserTimeSec + t.cpuKernelTimeSec);
-        }
+                ImGui::TableSetColumnIndex(3);
+                ImGui::PlotLines("##History", t.cpuHistory.GetData(), t.cpuHistory.GetCount(), t.cpuHistory.GetOffset(),
+                    nullptr, Def::FloatZero, 100.0f, ImVec2{ -FLT_MIN, ImGui::GetTextLineHeight() });
 
-        ImGui::EndTable();
-    }
-}
+                ImGui::TableSetColumnIndex(4);
+                ImGui::Text("%.2f", t.userSec);
 
-std::vector<FlDeveloperCommandPromptEditor::ThreadInfo> FlDeveloperCommandPromptEditor::GetThreadList()
-{
-    std::vector<ThreadInfo> threads;
-    m_currentPID = GetCurrentProcessId();
+                ImGui::TableSetColumnIndex(5);
+                ImGui::Text("%.2f", t.kernelSec);
 
-    HANDLE hSnapshot = CreateToolhelp32Snapshot(TH32CS_SNAPTHREAD, 0);
-    if (hSnapshot == INVALID_HANDLE_VALUE)
-        return threads;
-
-    THREADENTRY32 te32{};
-    te32.dwSize = sizeof(te32);
-
-    if (Thread32First(hSnapshot, &te32))
-    {
-        do
-        {
-            if (te32.th32OwnerProcessID == m_currentPID)
-            {
-                ThreadInfo info{};
-                info.threadId = te32.th32ThreadID;
-                info.ownerProcessId = te32.th32OwnerProcessID;
-
-                HANDLE hThread = OpenThread(THREAD_QUERY_INFORMATION, FALSE, te32.th32ThreadID);
-                if (hThread)
-                {
-                    FILETIME createTime, exitTime, kernelTime, userTime;
-                    if (GetThreadTimes(hThread, &createTime, &exitTime, &kernelTime, &userTime))
-                    {
-                        ULARGE_INTEGER k, u;
-                        k.LowPart = kernelTime.dwLowDateTime;
-                        k.HighPart = kernelTime.dwHighDateTime;
-                        u.LowPart = userTime.dwLowDateTime;
-                        u.HighPart = userTime.dwHighDateTime;
-
-                        info.cpuKernelTimeSec = (double)k.QuadPart / 10000000.0;
-                        info.cpuUserTimeSec = (double)u.QuadPart / 10000000.0;
-                    }
-
-                    info.priority = GetThreadPriority(hThread);
-                    CloseHandle(hThread);
-                }
-
-                threads.push_back(info);
+                ImGui::TableSetColumnIndex(6);
+                ImGui::Text("%.2f", t.userSec + t.kernelSec);
+                ImGui::PopID();
             }
-        } while (Thread32Next(hSnapshot, &te32));
+        }
+        ImGui::EndTable();
     }
-
-    CloseHandle(hSnapshot);
-    return threads;
 }
 
 void FlDeveloperCommandPromptEditor::ExecuteBuild()
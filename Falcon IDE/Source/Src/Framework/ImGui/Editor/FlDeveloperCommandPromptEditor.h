@@ -1,13 +1,6 @@
 #pragma once
 #include "../../System/SolutionParser/FlSolutionParser.h"
 
-#pragma comment(lib, "pdh.lib")
-#pragma comment(lib, "psapi.lib")
-#include <psapi.h>
-#include <pdh.h>
-#include <pdhmsg.h>
-#include <tlhelp32.h>
-
 class FlDeveloperCommandPromptEditor
 {
 public:
@@ -18,32 +11,9 @@ public:
 private:
     void ExecuteBuild();
 
-    // 
-    void InitSystemMonitor() noexcept;
-
-    // CPUgp擾
-    const double GetCpuUsage() noexcept;
-
-    // 擾
-    void GetMemoryUsage(SIZE_T& workingSet, SIZE_T& peakWorkingSet) noexcept;
-
-    // Xbh擾
-    DWORD GetThreadCount() noexcept;
-
-    // ImGuiEBhE`
+    // ImGuiEBhE`iv FlSystemMonitor ̐pXbhsj
     void RenderSystemMonitor();
 
-    struct ThreadInfo
-    {
-        DWORD threadId;
-        DWORD ownerProcessId;
-        int priority;
-        double cpuUserTimeSec;
-        double cpuKernelTimeSec;
-    };
-
-    std::vector<ThreadInfo> GetThreadList();
-
     FlSolutionParser m_parser{};
 
     int m_selectedProject = -1;
@@ -56,18 +26,5 @@ private:
 
     FlTerminalEditor& m_terminal;
 
-    PDH_HQUERY m_cpuQuery{};
-    PDH_HCOUNTER m_cpuTotal{};
-    bool m_cpuInitialized{ false };
-
-    std::unique_ptr<FlChronus::Ticker> m_upTicker;
-
-    std::vector<ThreadInfo> m_threadList;
-
-    double m_cpuUsage = 0.0;
-    double m_cpuUsageTick = 0.0;
-    SIZE_T m_workingSet = 0;
-    SIZE_T m_peakWorkingSet = 0;
-
-    DWORD m_currentPID{};
+    std::unique_ptr<FlSystemMonitor> m_upSystemMonitor;
 };
@@ -1,5 +1,7 @@
 #include "FlECSInspectorAndHierarchy.h"
 #include "../../Core/FlEntityComponentSystemKernel.h"
+#include "../../Core/FlPrefabCache.h"
+#include "../../Core/FlSceneEditHistory.h"
 
 #include "../../Framework/Module/FlRuntimeModuleGroup.hpp"
 
@@ -16,28 +18,30 @@ void FlECSInspectorAndHierarchy::Render(const char* hierarchyTitle, const char*
 
 void FlECSInspectorAndHierarchy::RefreshEntityList()
 {
-    m_entityList.clear();
-    auto ids = FlEntityComponentSystemKernel::Instance().GetAllEntityIds();
-    // Sort for stable order
-    std::sort(ids.begin(), ids.end());
-    m_entityList = std::move(ids);
+    auto& kernel = FlEntityComponentSystemKernel::Instance();
+    if (m_transformQuery == InvalidQueryId)
+        m_transformQuery = kernel.RegisterQuery(std::array{ std::string{ "Transform" } });
+
+    kernel.SyncQuery(m_transformQuery, m_transformView);
 }
 
 std::vector<uint32_t> FlECSInspectorAndHierarchy::GetRootEntities()
 {
+    // e̕tւ͈ꗗςȂ̂ŁAê͖
+    RefreshEntityList();
+
     std::vector<uint32_t> roots;
 
-    for (auto id : m_entityList)
+    for (auto i{ size_t{} }; i < m_transformView.size(); ++i)
     {
-        auto tc{ static_cast<TransformComponent*>(
-            FlEntityComponentSystemKernel::Instance().GetComponent("Transform", id)
-            ) };
-
-        if (!tc) continue;
+        auto tc{ static_cast<TransformComponent*>(m_transformView.Get(i, Def::UIntZero)) };
 
         if (tc->m_parent == UINT32_MAX)
-            roots.push_back(id);
+            roots.push_back(m_transformView.entities[i]);
     }
+
+    // Sort for stable order
+    std::ranges::sort(roots);
     return roots;
 }
 
@@ -65,22 +69,24 @@ void FlECSInspectorAndHierarchy::RenderHierarchyWindow(const char* title, bool*
         return;
     }
 
+    HandleHistoryShortcuts();
+
     if (ImGui::Button("Save Scene"))
     {
         std::string filepath{ "Assets/Scene/" };
-        if (SaveFileDialog(filepath, "Save Scene", "Scene Files (*.flscene)\0*.flscene\0All Files (*.*)\0*.*\0", "flscene"))
-            FlJsonUtility::Serialize(FlEntityComponentSystemKernel::Instance().SerializeScene(), filepath);
+        if (SaveFileDialog(filepath, "Save Scene", "Scene Files (*.flscene)\0*.flscene\0Binary Scene Files (*.flsceneb)\0*.flsceneb\0All Files (*.*)\0*.*\0", "flscene"))
+            FlEntityComponentSystemKernel::Instance().SaveScene(filepath);
     }
     ImGui::SameLine();
     if (ImGui::Button("Load Scene"))
     {
         std::string filepath{ "Assets/Scene/" };
-        if (OpenFileDialog(filepath, "Load Scene", "Scene Files (*.flscene)\0*.flscene\0All Files (*.*)\0*.*\0"))
+        if (OpenFileDialog(filepath, "Load Scene", "Scene Files (*.flscene;*.flsceneb)\0*.flscene;*.flsceneb\0All Files (*.*)\0*.*\0"))
         {
-            auto j{ nlohmann::json{} };
-            if (FlJsonUtility::Deserialize(j, filepath))
+            if (FlEntityComponentSystemKernel::Instance().LoadScene(filepath))
             {
-                FlEntityComponentSystemKernel::Instance().DeserializeScene(j);
+                // ǂݍޑÕV[ւ̋L^͓ĂȂ
+                FlSceneEditHistory::Instance().Clear();
                 RefreshEntityList();
             }
             else
@@ -94,10 +100,16 @@ void FlECSInspectorAndHierarchy::RenderHierarchyWindow(const char* title, bool*
     ImGui::SameLine();
     if (ImGui::Button("Create Entity"))
     {
-        FlEntityComponentSystemKernel::Instance().CreateEntity();
+        auto& history{ FlSceneEditHistory::Instance() };
+        history.BeginEdit("Create Entity");
+        if (const auto id{ FlEntityComponentSystemKernel::Instance().CreateEntity() }; id != InvalidEntityId)
+            history.CaptureCreatedEntity(id);
+        history.EndEdit();
         RefreshEntityList();
     }
 
+    RenderHistoryButtons();
+
     ImGui::Separator();
 
     // ---- ROOT m[h` ----
@@ -124,6 +136,48 @@ void FlECSInspectorAndHierarchy::RenderHierarchyWindow(const char* title, bool*
     ImGui::End();
 }
 
+void FlECSInspectorAndHierarchy::RenderHistoryButtons()
+{
+    auto& history{ FlSceneEditHistory::Instance() };
+
+    ImGui::SameLine();
+    ImGui::BeginDisabled(!history.CanUndo());
+    if (ImGui::Button("Undo")) ApplyHistory(false);
+    ImGui::EndDisabled();
+    if (history.CanUndo() && ImGui::IsItemHovered(ImGuiHoveredFlags_AllowWhenDisabled))
+        ImGui::SetTooltip("Undo %s (Ctrl+Z)", std::string{ history.GetUndoLabel() }.c_str());
+
+    ImGui::SameLine();
+    ImGui::BeginDisabled(!history.CanRedo());
+    if (ImGui::Button("Redo")) ApplyHistory(true);
+    ImGui::EndDisabled();
+    if (history.CanRedo() && ImGui::IsItemHovered(ImGuiHoveredFlags_AllowWhenDisabled))
+        ImGui::SetTooltip("Redo %s (Ctrl+Y)", std::string{ history.GetRedoLabel() }.c_str());
+}
+
+void FlECSInspectorAndHierarchy::HandleHistoryShortcuts()
+{
+    // ͒ InputText ̌ɖ߂ɔC
+    if (ImGui::GetIO().WantTextInput || !ImGui::IsWindowFocused(ImGuiFocusedFlags_RootAndChildWindows)) return;
+
+    if (ImGui::IsKeyChordPressed(ImGuiMod_Ctrl | ImGuiKey_Z))
+        ApplyHistory(false);
+    else if (ImGui::IsKeyChordPressed(ImGuiMod_Ctrl | ImGuiKey_Y) || ImGui::IsKeyChordPressed(ImGuiMod_Ctrl | ImGuiMod_Shift | ImGuiKey_Z))
+        ApplyHistory(true);
+}
+
+void FlECSInspectorAndHierarchy::ApplyHistory(const bool isRedo)
+{
+    auto& history{ FlSceneEditHistory::Instance() };
+    if (!(isRedo ? history.Redo() : history.Undo())) return;
+
+    // ҏW߂ƑI𒆂邱Ƃ
+    if (!FlEntityComponentSystemKernel::Instance().IsActive(m_selectedEntityId))
+        m_selectedEntityId = UINT32_MAX;
+
+    RefreshEntityList();
+}
+
 // ---------- Inspector ----------
 void FlECSInspectorAndHierarchy::RenderInspectorWindow(const char* title, bool* p_open)
 {
@@ -133,6 +187,8 @@ void FlECSInspectorAndHierarchy::RenderInspectorWindow(const char* title, bool*
 		return;
 	}
 
+	HandleHistoryShortcuts();
+
 	if (m_selectedEntityId == UINT32_MAX) {
 		ImGui::TextUnformatted("No entity selected.");
 		if (ImGui::Button("Refresh Entities")) RefreshEntityList();
@@ -154,15 +210,34 @@ void FlECSInspectorAndHierarchy::RenderInspectorWindow(const char* title, bool*
 		// Collapsing header per component type
 		if (ImGui::CollapsingHeader(typeName.c_str()))
 		{
+			// ҏWꂽςނ̂ŁA`ȌԂʂĂiłς܂ł͑O̎ʂg񂷁j
+			const auto version = FlEntityComponentSystemKernel::Instance().GetComponentVersion(typeName, id);
+			auto& snapshot = m_componentSnapshots[typeName];
+			if (snapshot.id != id || snapshot.version != version) {
+				snapshot.id      = id;
+				snapshot.version = version;
+				snapshot.state   = FlSceneEditHistory::Snapshot(id, typeName);
+			}
+
 			// Try to call kernel's RenderComponentEditor which will call reflection.RenderEditor
 			bool rendered = FlEntityComponentSystemKernel::Instance().RenderComponentEditor(typeName, id);
 			if (!rendered) {
 				ImGui::TextDisabled("No editor for this component (or missing reflection).");
 			}
+			else if (ImGui::IsItemEdited()) {
+				// R|[lgւ̃hbO1̕ҏWɂ܂Ƃ߂
+				const auto mergeKey = ((static_cast<uint64_t>(id) << 32U) ^ std::hash<std::string>{}(typeName)) | Def::ULongLongOne;
+				FlSceneEditHistory::Instance().PushComponentEdit("Edit " + typeName, id, typeName, std::move(snapshot.state), mergeKey);
+				snapshot.id = UINT32_MAX;
+			}
 
 			if (typeName == "Transform") continue;
 			if (ImGui::Button((std::string("Remove##") + typeName).c_str())) {
+				auto& history = FlSceneEditHistory::Instance();
+				history.BeginEdit("Remove " + typeName);
+				history.Capture(id, typeName);
 				FlEntityComponentSystemKernel::Instance().RemoveComponent(typeName, id);
+				history.EndEdit();
 				FlEditorAdministrator::Instance().GetLogger()->AddLog("Removed component %s from %u", typeName.c_str(), id);
 				compTypes = FlEntityComponentSystemKernel::Instance().GetEntityComponentTypes(id);
 			}
@@ -225,12 +300,17 @@ void FlECSInspectorAndHierarchy::RenderInspectorWindow(const char* title, bool*
 		//  Attach {^
 		if (ImGui::Button("Attach"))
 		{
+			auto& history = FlSceneEditHistory::Instance();
+			const std::string typeName = attachableTypes[selectedIndex];
+			history.BeginEdit("Attach " + typeName);
+			history.Capture(id, typeName);
 			try {
-				FlEntityComponentSystemKernel::Instance().AddComponent(attachableTypes[selectedIndex], id);
+				FlEntityComponentSystemKernel::Instance().AddComponent(typeName, id);
 			}
 			catch (...) {
 
 			}
+			history.EndEdit();
 		}
 	}
 
@@ -325,16 +405,19 @@ void FlECSInspectorAndHierarchy::RenderEntityNode(uint32_t id)
     }
 }
 
-void FlECSInspectorAndHierarchy::DeleteEntityRecursive(uint32_t id)
+static void DestroyEntitiesRecursive(FlEntityComponentSystemKernel& kernel, uint32_t id)
 {
-    auto& kernel = FlEntityComponentSystemKernel::Instance();
+    // qg m_children OɎc
+    auto& history = FlSceneEditHistory::Instance();
+    history.CaptureEntity(id);
+
     auto* tc = static_cast<TransformComponent*>(kernel.GetComponent("Transform", id));
 
     if (tc)
     {
-        // q珇Ԃɍ폜
-        for (uint32_t child : tc->m_children)
-            DeleteEntityRecursive(child);
+        // q珇Ԃɍ폜iqg m_children ÔŎʂ񂷁j
+        for (uint32_t child : std::vector<uint32_t>{ tc->m_children })
+            DestroyEntitiesRecursive(kernel, child);
 
         // e玩g菜
         if (tc->m_parent != UINT32_MAX)
@@ -344,22 +427,34 @@ void FlECSInspectorAndHierarchy::DeleteEntityRecursive(uint32_t id)
 
             if (parentTC)
             {
+                history.Capture(tc->m_parent, "Transform");
                 parentTC->m_children.erase(
                     std::remove(parentTC->m_children.begin(), parentTC->m_children.end(), id),
                     parentTC->m_children.end()
                 );
+                kernel.MarkComponentChanged("Transform", tc->m_parent);
             }
         }
     }
 
     // ۂ̃GeBeB폜
     kernel.DestroyEntity(id);
+}
+
+void FlECSInspectorAndHierarchy::DeleteEntityRecursive(uint32_t id)
+{
+    auto& kernel = FlEntityComponentSystemKernel::Instance();
 
-    // I𒆂NA
-    if (m_selectedEntityId == id)
+    auto& history = FlSceneEditHistory::Instance();
+    history.BeginEdit("Delete Entity");
+    DestroyEntitiesRecursive(kernel, id);
+    history.EndEdit();
+
+    // I𒆂ĂNA
+    if (!kernel.IsActive(m_selectedEntityId))
         m_selectedEntityId = UINT32_MAX;
 
-    // Hierarchy ĕ`p
+    // Hierarchy ĕ`piqƂł͂ȂŌ1j
     RefreshEntityList();
 
     FlEditorAdministrator::Instance().GetLogger()->AddLog(
@@ -381,6 +476,12 @@ void FlECSInspectorAndHierarchy::SetParent(uint32_t childId, uint32_t newParentI
     // Ȑeqth~
     if (childId == newParentId) return;
 
+    auto& history = FlSceneEditHistory::Instance();
+    history.BeginEdit("Set Parent");
+    history.Capture(childId, "Transform");
+    if (childTC->m_parent != UINT32_MAX) history.Capture(childTC->m_parent, "Transform");
+    if (parentTC) history.Capture(newParentId, "Transform");
+
     // --- ݂̐e폜 ---
     if (childTC->m_parent != UINT32_MAX)
     {
@@ -392,14 +493,20 @@ void FlECSInspectorAndHierarchy::SetParent(uint32_t childId, uint32_t newParentI
                 std::remove(children.begin(), children.end(), childId),
                 children.end()
             );
+            kernel.MarkComponentChanged("Transform", childTC->m_parent);
         }
     }
 
     if (parentTC)
+    {
         parentTC->m_children.push_back(childId);
+        kernel.MarkComponentChanged("Transform", newParentId);
+    }
 
     // eIDXV (UINT32_MAX ܂͐VeID)
     childTC->m_parent = newParentId;
+    kernel.MarkComponentChanged("Transform", childId);
+    history.EndEdit();
 
     // Log
     FlEditorAdministrator::Instance().GetLogger()->AddLog(
@@ -433,20 +540,24 @@ void FlECSInspectorAndHierarchy::CreatePrefab(uint32_t root)
 
 void FlECSInspectorAndHierarchy::InstantiatePrefab(const std::string& path)
 {
-	nlohmann::json prefab;
-	if (!FlJsonUtility::Deserialize(prefab, path)) return;
+	auto& kernel  = FlEntityComponentSystemKernel::Instance();
+	auto& history = FlSceneEditHistory::Instance();
+	history.BeginEdit("Instantiate Prefab");
 
-	std::unordered_map<uint32_t, uint32_t> remap;
-	FlEntityComponentSystemKernel::Instance()
-		.DeserializeScene(prefab, &remap);
+	// ͍ς݂̐`畡i[g͐eŒuj
+	const auto roots = FlPrefabCache::Instance().Instantiate(path);
 
-	uint32_t newRoot = remap[prefab["Root"].get<uint32_t>()];
+	std::vector<uint32_t> entities;
+	for (auto root : roots)
+		CollectEntitiesRecursive(kernel, root, entities);
+	for (auto id : entities)
+		history.CaptureCreatedEntity(id);
+	history.EndEdit();
 
-	// [g
-	if (auto tc = static_cast<TransformComponent*>(
-		FlEntityComponentSystemKernel::Instance().GetComponent("Transform", newRoot)))
+	if (roots.empty())
 	{
-		tc->m_parent = UINT32_MAX;
+		FlEditorAdministrator::Instance().GetLogger()->AddErrorLog("Failed to instantiate prefab: %s", path.c_str());
+		return;
 	}
 
 	RefreshEntityList();
@@ -1,4 +1,5 @@
 #pragma once
+#include "../../Module/FlRunTimeAndDLLsCommon.h++"
 
 class FlECSInspectorAndHierarchy
 {
@@ -15,6 +16,11 @@ private:
     void RenderHierarchyWindow(const char* title, bool* p_open);
     //void RenderEntityNode(entityId id);
 
+    // ɖ߂E蒼iFlSceneEditHistoryj
+    void RenderHistoryButtons();
+    void HandleHistoryShortcuts();
+    void ApplyHistory(const bool isRedo);
+
     // Inspector 
     void RenderInspectorWindow(const char* title, bool* p_open);
     void RenderEntityNode(uint32_t id);
@@ -34,8 +40,18 @@ private:
     // I
     uint32_t m_selectedEntityId{ UINT32_MAX };
 
-    // LbViꗗAXV RefreshEntityListj
-    std::vector<uint32_t> m_entityList;
+    // Transform GeBeB̃NGitOʂj
+    uint32_t       m_transformQuery{ InvalidQueryId };
+    FlEcsQueryView m_transformView;
+
+    // JĂR|[lg̕ҏWȌԁiGetComponentVersion ς蒼j
+    struct ComponentSnapshot
+    {
+        uint32_t             id{ UINT32_MAX };
+        uint64_t             version{ Def::ULongLongZero };
+        std::vector<uint8_t> state;
+    };
+    std::unordered_map<std::string, ComponentSnapshot> m_componentSnapshots;
 
     // Add component UI
     int m_selectedRegisteredTypeIndex = 0;
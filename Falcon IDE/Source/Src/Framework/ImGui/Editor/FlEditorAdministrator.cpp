@@ -70,6 +70,8 @@ bool FlEditorAdministrator::Initialize(const HWND hwnd, const int32_t windowW, c
 	m_upScriptModuleEditor			= std::make_unique<FlScriptModuleEditor>(*m_upTerminalEditor);
 	m_upPythonMacroEditor			= std::make_unique<FlPythonMacroEditor>(*m_upTerminalEditor);
 	m_upDevCmdEditor				= std::make_unique<FlDeveloperCommandPromptEditor>("FlProject-DX12.sln", *m_upTerminalEditor);
+	m_upProfilerEditor				= std::make_unique<FlProfilerEditor>();
+	m_upMemoryEditor				= std::make_unique<FlMemoryEditor>();
 	m_upECSInspectorAndHierarchyEditor = std::make_unique<FlECSInspectorAndHierarchy>();
 	m_upEditorCamera				= std::make_unique<FlEditorCamera>(windowW, windowH);
 
@@ -138,6 +140,8 @@ void FlEditorAdministrator::Begin() noexcept
 
 void FlEditorAdministrator::Update() noexcept
 {
+	FL_PROFILE_FUNCTION();
+
 	Begin();
 
 	if (ImGui::Begin("FramesPerSecond"))
@@ -147,6 +151,11 @@ void FlEditorAdministrator::Update() noexcept
 			ImGui::Text("FPS : %f", spFrameRateController->GetCurrentFPS());
 			ImGui::Text("DeltaTime : %f", spFrameRateController->GetDeltaTime());
 
+			const auto& stats{ spFrameRateController->GetFrameStatistics() };
+			ImGui::Text("FrameTime (%zu frames) [ms]", stats.count);
+			ImGui::Text("Min : %.2f  Max : %.2f  Mean : %.2f  StdDev : %.2f", stats.minMs, stats.maxMs, stats.meanMs, stats.stdDevMs);
+			ImGui::Text("P50 : %.2f  P95 : %.2f  P99 : %.2f", stats.p50Ms, stats.p95Ms, stats.p99Ms);
+
 			if (ImGui::Checkbox("VSync", &spFrameRateController->WorkIsVsync()))
 			{
 				spFrameRateController->SetIsVsync(spFrameRateController->GetIsVsync());
@@ -166,6 +175,45 @@ void FlEditorAdministrator::Update() noexcept
 
 				spFrameRateController->SetDesiredFPS(static_cast<float>(m_targetFrameRate));
 			}
+
+			auto isHybrid{ spFrameRateController->GetPacingMode() == FlFrameRateController::PacingMode::Hybrid };
+			if (ImGui::Checkbox("HybridPacing", &isHybrid))
+			{
+				spFrameRateController->SetPacingMode(isHybrid ? FlFrameRateController::PacingMode::Hybrid : FlFrameRateController::PacingMode::Sleep);
+
+				m_upLogEditor->AddLog("HybridPacing: %s", isHybrid ? "Enabled" : "Disabled");
+			}
+			if (isHybrid)
+			{
+				auto& pacer{ spFrameRateController->WorkPacer() };
+				ImGui::SameLine();
+				ImGui::Checkbox("LowLatency", &pacer.WorkSettings().isLowLatency);
+
+				const auto pacing{ pacer.GetStatistics() };
+				ImGui::Text("PacingError [ms] Mean : %.3f  P99 : %.3f  Max : %.3f", pacing.error.meanMs, pacing.error.p99Ms, pacing.error.maxMs);
+				ImGui::Text("Late : %llu  Dropped : %llu  Margin : %.3f ms", pacing.late, pacing.dropped, pacing.marginMs);
+			}
+		}
+
+		auto& culler{ FlFrustumCuller::Instance() };
+		ImGui::Checkbox("Frustum Culling", &culler.WorkIsEnable());
+		ImGui::Text("Culled : %u / %u", culler.GetCulledCount(), culler.GetTestedCount());
+
+		auto& occlusion{ FlOcclusionCuller::Instance() };
+		ImGui::Checkbox("Occlusion Culling", &occlusion.WorkIsEnable());
+		ImGui::Text("Occluded : %u / %u (Tris %u, %.3f ms)", occlusion.GetCulledCount(), occlusion.GetTestedCount(),
+			occlusion.GetTriangleCount(), occlusion.GetCostMilliseconds());
+
+		// 一時メモリの使用量（溢れて塊を足した回数が増え続けるなら初期容量が足りていない）
+		if (ImGui::TreeNode("Frame Memory"))
+		{
+			constexpr auto KiloByte{ 1024.0 };
+			FlFrameMemory::Instance().ForEachStatistics([&](const char* name, const FlLinearArena::Statistics& stats)
+			{
+				ImGui::Text("%s : Peak %.1f KB  HighWater %.1f KB  Capacity %.1f KB  Allocs %llu  Overflows %llu", name,
+					stats.lastPeak / KiloByte, stats.highWater / KiloByte, stats.capacity / KiloByte, stats.allocations, stats.overflows);
+			});
+			ImGui::TreePop();
 		}
 	}
 	ImGui::End();
@@ -222,19 +270,23 @@ void FlEditorAdministrator::Update() noexcept
 	}
 	ImGui::End();
 	
-	m_upLogEditor->RenderLog("Log Editor");
-	m_upFileEditor->ShowAssetBrowser("Asset Browser");
-	m_upTerminalEditor->RenderTerminal("Terminal");
+	{ FL_PROFILE_SCOPE("Editor::Log");			m_upLogEditor->RenderLog("Log Editor"); }
+	{ FL_PROFILE_SCOPE("Editor::AssetBrowser");	m_upFileEditor->ShowAssetBrowser("Asset Browser"); }
+	{ FL_PROFILE_SCOPE("Editor::Terminal");		m_upTerminalEditor->RenderTerminal("Terminal"); }
+
+	{ FL_PROFILE_SCOPE("Editor::AssetsGuid");	m_upListingEditor->RenderListingViewer("Assets Guid"); }
 
-	m_upListingEditor->RenderListingViewer("Assets Guid");
 
+	{ FL_PROFILE_SCOPE("Editor::ECS");			m_upECSInspectorAndHierarchyEditor->Render("ECSHierarchy", "ECSInspector" ,nullptr, nullptr); }
 
-	m_upECSInspectorAndHierarchyEditor->Render("ECSHierarchy", "ECSInspector" ,nullptr, nullptr);
+	{ FL_PROFILE_SCOPE("Editor::ScriptModule");	m_upScriptModuleEditor->Render("ScriptModule"); }
+	{ FL_PROFILE_SCOPE("Editor::Plugin");		m_upPythonMacroEditor->RenderEditor("Plugin"); }
 
-	m_upScriptModuleEditor->Render("ScriptModule");
-	m_upPythonMacroEditor->RenderEditor("Plugin");
+	{ FL_PROFILE_SCOPE("Editor::DevCmdPrp");		m_upDevCmdEditor->Render("DevCmdPrp"); }
 
-	m_upDevCmdEditor->Render("DevCmdPrp");
+	{ FL_PROFILE_SCOPE("Editor::Profiler");		m_upProfilerEditor->Render("Profiler"); }
+
+	{ FL_PROFILE_SCOPE("Editor::Memory");		m_upMemoryEditor->Render("Memory"); }
 
 	m_upEditorCamera->RenderCameraParameter("Camera");
 
@@ -258,6 +310,8 @@ void FlEditorAdministrator::End() noexcept
 		D3D12_RESOURCE_STATE_COPY_DEST);
 	cmdList->ResourceBarrier(1, &barrier);
 
+	FL_PROFILE_SCOPE("ImGui::Render");
+
 	ImGui::Render();
 	ImGui_ImplDX12_RenderDrawData(ImGui::GetDrawData(), GraphicsDevice::Instance().GetCmdList());
 }
@@ -278,6 +332,8 @@ void FlEditorAdministrator::SetupDockLayout() const noexcept
 	ImGui::DockBuilderDockWindow("Log Editor", right);
 	ImGui::DockBuilderDockWindow("Asset Browser", bottom);
 	ImGui::DockBuilderDockWindow("Terminal", bottom);
+	ImGui::DockBuilderDockWindow("Profiler", bottom);
+	ImGui::DockBuilderDockWindow("Memory", bottom);
 
 	ImGui::DockBuilderFinish(m_dockspaceID);
 }
@@ -24,6 +24,10 @@
 // <DeveloperCommandPrompt:rhc[>
 #include "FlDeveloperCommandPromptEditor.h"
 
+// <Profiler:v>
+#include "FlProfilerEditor.h"
+#include "FlMemoryEditor.h"
+
 // <Camera:J>
 #include "FlEditorCamera.h"
 
@@ -90,6 +94,12 @@ public:
 	/// <returns>bool^ŃJtĂtrue</returns>
 	const auto GetEditorCameraIsEnable() const noexcept { return m_upEditorCamera->IsEnable(); }
 
+	/// <summary>
+	/// #Getter GfB^J
+	/// </summary>
+	/// <returns>GfB^Jւ̒萔Q</returns>
+	const auto& GetEditorCamera() const noexcept { return m_upEditorCamera; }
+
 	/// <summary>
 	/// HierarchyEntityListXV
 	/// </summary>
@@ -139,6 +149,8 @@ private:
 	std::unique_ptr<FlScriptModuleEditor>		   m_upScriptModuleEditor;			// XNvgW[GfB^̃CX^X
 	std::unique_ptr<FlPythonMacroEditor>		   m_upPythonMacroEditor;			// pC\}NGfB^̃CX^X
 	std::unique_ptr<FlDeveloperCommandPromptEditor>m_upDevCmdEditor;				// MSVS2022fxpCmd̃CX^X
+	std::unique_ptr<FlProfilerEditor>			   m_upProfilerEditor;				// vt@C̃CX^X
+	std::unique_ptr<FlMemoryEditor>				   m_upMemoryEditor;				// gpʃGfB^̃CX^X
 	std::unique_ptr<FlECSInspectorAndHierarchy>    m_upECSInspectorAndHierarchyEditor; // CXyN^[ƃqGL[GfB^̃CX^X
 	std::unique_ptr<FlEditorCamera>				   m_upEditorCamera;				// GfB^pJ̃CX^X
 
@@ -11,6 +11,8 @@ public:
 	void Update();
 
 	const auto IsEnable() const noexcept { return m_isEnable; }
+
+	const auto& GetCameraData() const noexcept { return m_cameraData; }
 private:
 
 	CBufferData::Camera m_cameraData;
@@ -3,6 +3,9 @@
 FlFileEditor::FlFileEditor() noexcept
 {
     m_upFPM = std::make_unique<FlFilePathManager>();
+
+    m_upDirectoryModel = std::make_unique<FlDirectoryModel>(m_basePath, std::chrono::seconds(1));
+    m_upDirectoryModel->Start();
 }
 
 void FlFileEditor::ShowAssetBrowser(const std::string& title, bool* p_open, ImGuiWindowFlags flags) noexcept
@@ -23,9 +26,10 @@ void FlFileEditor::ShowAssetBrowser(const std::string& title, bool* p_open, ImGu
             // <Begin:Tab>
             if (ImGui::BeginTabItem("Tree"))
             {
-                auto root{ FileEntry{} };
-
-                BuildFileTree(m_basePath, root);
+                auto root{ FlDirectoryModel::Entry{} };
+                root.path        = m_basePath;
+                root.name        = m_basePath.filename().string();
+                root.isDirectory = true;
 
                 RenderFileEntry(root);
 
@@ -54,6 +58,8 @@ void FlFileEditor::ShowAssetBrowser(const std::string& title, bool* p_open, ImGu
             // ログ出力
             if (m_fileWatcher.Copy(m_doppedPath, dst))
             {
+                InvalidateParent(dst);
+
                 auto dopp{ m_upFPM->GetRelative(m_doppedPath) };
                 FlEditorAdministrator::Instance().GetLogger()->AddChangeLog("Dropped External File: %s to %s", dopp.string().c_str(), dst.string().c_str());
             }
@@ -112,7 +118,10 @@ void FlFileEditor::ShowAssetBrowser(const std::string& title, bool* p_open, ImGu
                     }
 
                     if (m_fileWatcher.Copy(src, dst))
+                    {
+                        InvalidateParent(dst);
                         FlEditorAdministrator::Instance().GetLogger()->AddLog("Paste: %s to %s", src.string().c_str(), dst.string().c_str());
+                    }
                     else
                         FlEditorAdministrator::Instance().GetLogger()->AddErrorLog("Error: Paste %s to %s", src.string().c_str(), dst.string().c_str());
                 }
@@ -125,32 +134,18 @@ void FlFileEditor::ShowAssetBrowser(const std::string& title, bool* p_open, ImGu
     ImGui::End();
 }
 
-void FlFileEditor::BuildFileTree(const std::filesystem::path& root, FileEntry& entry) noexcept
-{
-    entry.path = root;
-    entry.isDirectory = std::filesystem::is_directory(root);
-
-    if (entry.isDirectory) 
-    {
-        entry.children.clear();
-        for (auto& p : std::filesystem::directory_iterator(root)) {
-            auto child{ FileEntry{} };
-            BuildFileTree(p, child);
-            entry.children.push_back(child);
-        }
-    }
-    else entry.children.clear();
-}
-
-void FlFileEditor::RenderFileEntry(FileEntry& entry) noexcept
+void FlFileEditor::RenderFileEntry(const FlDirectoryModel::Entry& entry) noexcept
 {
     auto flags{ ImGuiTreeNodeFlags{entry.isDirectory ? ImGuiTreeNodeFlags_DrawLinesToNodes : ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_DrawLinesToNodes} };
 
-    auto label{ entry.path.filename().string() };
+    auto label{ entry.name };
     if (label.empty()) label = "##Unnamed_" + entry.path.string();
 
+    // 開いたディレクトリだけを走査するので、既定で開くのはルートのみ
+    if (entry.path == m_basePath) flags |= ImGuiTreeNodeFlags_DefaultOpen;
+
     auto open{ false };
-    if (entry.isDirectory) open = ImGui::TreeNodeEx(label.c_str(), flags | ImGuiTreeNodeFlags_DefaultOpen);
+    if (entry.isDirectory) open = ImGui::TreeNodeEx(label.c_str(), flags);
     else ImGui::TreeNodeEx(label.c_str(), flags | ImGuiTreeNodeFlags_NoTreePushOnOpen);
 
     // 右クリックで操作メニュー
@@ -207,7 +202,7 @@ void FlFileEditor::RenderFileEntry(FileEntry& entry) noexcept
                     entry.path.string().c_str());
             else
             {
-                ImGui::SetClipboardText(guid.value().c_str());
+                ImGui::SetClipboardText(guid.value().ToString().c_str());
 
                 // ログ出力
                 FlEditorAdministrator::Instance().GetLogger()->AddLog("Copy Guid by %s",
@@ -263,8 +258,11 @@ void FlFileEditor::RenderFileEntry(FileEntry& entry) noexcept
 
                     // ログ出力
                     if (m_fileWatcher.Copy(src, dst))
+                    {
+                        InvalidateParent(dst);
                         FlEditorAdministrator::Instance().GetLogger()->AddLog("Paste: %s to %s",
                             src.string().c_str(), dst.string().c_str());
+                    }
                     else
                         FlEditorAdministrator::Instance().GetLogger()->AddErrorLog("Error: Paste %s to %s",
                             src.string().c_str(), dst.string().c_str());
@@ -313,6 +311,8 @@ void FlFileEditor::RenderFileEntry(FileEntry& entry) noexcept
                     }
 
                     FlResourceAdministrator::Instance().GetMetaFileManager()->OnAssetRenamedOrMoved(srcPath, dstPath);
+                    InvalidateParent(srcPath);
+                    InvalidateParent(dstPath);
 
                     // ログ出力
 					FlEditorAdministrator::Instance().GetLogger()->AddLog("Moved: %s to %s", 
@@ -323,12 +323,28 @@ void FlFileEditor::RenderFileEntry(FileEntry& entry) noexcept
         ImGui::EndDragDropTarget();
     }
 
-    // 再帰描画
+    // 再帰描画（子はキャッシュから取得し、ファイルは見えている行だけ描画）
     if (entry.isDirectory && open) 
     {
-        for (auto& child : entry.children) {
-            RenderFileEntry(child);
+        if (const auto spListing{ m_upDirectoryModel->Acquire(entry.path) })
+        {
+            const auto& children{ spListing->entries };
+            for (auto i{ Def::ULongLongZero }; i < spListing->directoryCount; ++i) {
+                RenderFileEntry(children[i]);
+            }
+
+            auto clipper{ ImGuiListClipper{} };
+            clipper.Begin(static_cast<int>(children.size() - spListing->directoryCount));
+            while (clipper.Step())
+            {
+                for (auto row{ clipper.DisplayStart }; row < clipper.DisplayEnd; ++row) {
+                    RenderFileEntry(children[spListing->directoryCount + row]);
+                }
+            }
+            clipper.End();
         }
+        else ImGui::TextDisabled("Scanning...");
+
         ImGui::TreePop();
     }
 
@@ -368,6 +384,7 @@ void FlFileEditor::RenderPopup() noexcept
         {
             auto newPath{ path.parent_path() / state.renameName };
             m_fileWatcher.RenameFile(path, newPath);
+            InvalidateParent(newPath);
             state.renameName.clear();
             ImGui::CloseCurrentPopup();
             m_pendingPopup.reset();
@@ -408,6 +425,7 @@ void FlFileEditor::RenderPopup() noexcept
                 m_fileWatcher.AddDirectory(newPath);
             else
                 m_fileWatcher.AddFile(newPath, "");
+            InvalidateParent(newPath);
             state.newName.clear();
             ImGui::CloseCurrentPopup();
             m_pendingPopup.reset();
@@ -439,6 +457,7 @@ void FlFileEditor::RenderPopup() noexcept
 
             if (std::filesystem::is_directory(path))  m_fileWatcher.RemDirectory(path);
             else m_fileWatcher.RemFile(path);
+            InvalidateParent(path);
 
             ImGui::CloseCurrentPopup();
             m_pendingPopup.reset();
@@ -454,16 +473,16 @@ void FlFileEditor::RenderPopup() noexcept
     // <End:DeletePopup>
 }
 
-void FlFileEditor::RenderFileItem(const std::filesystem::directory_entry& entry) noexcept
+void FlFileEditor::RenderFileItem(const FlDirectoryModel::Entry& entry) noexcept
 {
-    const auto& path{ entry.path() };
-    auto label      { path.filename().string() };
+    const auto& path{ entry.path };
+    auto label      { entry.name };
 
     if (label.empty()) label = "Unnamed";
 
     auto id{ label + "##" + path.string() };
 
-    const auto isDir{ entry.is_directory() };
+    const auto isDir{ entry.isDirectory };
 
     auto displayLabel{ isDir ? "[Directory] " + label : "[File]" + label };
     if (ImGui::Selectable(displayLabel.c_str(), false, ImGuiSelectableFlags_AllowDoubleClick))
@@ -504,6 +523,8 @@ void FlFileEditor::RenderFileItem(const std::filesystem::directory_entry& entry)
                 if (m_fileWatcher.Move(srcPath, dst)) 
                 {
                     FlResourceAdministrator::Instance().GetMetaFileManager()->OnAssetRenamedOrMoved(srcPath, dst);
+                    InvalidateParent(srcPath);
+                    InvalidateParent(dst);
                     // ログ出力
                     FlEditorAdministrator::Instance().GetLogger()->AddLog("Dropped: %s to %s",
                         srcPath.string().c_str(), dst.string().c_str());
@@ -561,7 +582,7 @@ void FlFileEditor::RenderFileItem(const std::filesystem::directory_entry& entry)
                     path.string().c_str());
             else
             {
-                ImGui::SetClipboardText(guid.value().c_str());
+                ImGui::SetClipboardText(guid.value().ToString().c_str());
 
                 // ログ出力
                 FlEditorAdministrator::Instance().GetLogger()->AddLog("Copy Guid by %s",
@@ -625,8 +646,11 @@ void FlFileEditor::RenderFileItem(const std::filesystem::directory_entry& entry)
 
                     // ログ出力
                     if (m_fileWatcher.Copy(src, dst))
+                    {
+                        InvalidateParent(dst);
                         FlEditorAdministrator::Instance().GetLogger()->AddLog("Paste: %s to %s",
                             src.string().c_str(), dst.string().c_str());
+                    }
                     else
                         FlEditorAdministrator::Instance().GetLogger()->AddErrorLog("Error: Paste %s to %s",
                             src.string().c_str(), pasteTargetDir.string().c_str());
@@ -685,6 +709,8 @@ void FlFileEditor::RenderCurrentItem()
                 if (m_fileWatcher.Move(srcPath, dst))
                 {
                     FlResourceAdministrator::Instance().GetMetaFileManager()->OnAssetRenamedOrMoved(srcPath, dst);
+                    InvalidateParent(srcPath);
+                    InvalidateParent(dst);
                     FlEditorAdministrator::Instance().GetLogger()->AddLog("Dropped: %s to %s",
                         srcPath.string().c_str(), dst.string().c_str());
                 }
@@ -701,16 +727,47 @@ void FlFileEditor::RenderCurrentItem()
     ImGui::Separator();
     ImGui::PopID();
 
+    // --- 並び替え・絞り込み ---
+    static constexpr const char* SortKeyNames[]{ "Name", "Size", "Time" };
+
+    auto sortKey{ static_cast<int>(m_sortKey) };
+    ImGui::SetNextItemWidth(100.0f);
+    if (ImGui::Combo("Sort", &sortKey, SortKeyNames, IM_ARRAYSIZE(SortKeyNames)))
+        m_sortKey = static_cast<FlDirectoryModel::View::SortKey>(sortKey);
+    ImGui::SameLine();
+    ImGui::Checkbox("Ascending", &m_isAscending);
+    ImGui::SameLine();
+    ImGui::SetNextItemWidth(200.0f);
+    ImGui::InputText("Filter", &m_filterText);
+
     // --- 現在のディレクトリの中身を描画 ---
-    try
+    const auto spListing{ m_upDirectoryModel->Acquire(m_currentPath) };
+    if (!spListing)
     {
-        for (const auto& entry : std::filesystem::directory_iterator(m_currentPath)) {
-            RenderFileItem(entry);
-        }
+        ImGui::TextDisabled("Scanning...");
+        return;
     }
-    catch (const std::exception& e)
+
+    // スナップショット・条件が変わったときだけ並び直す
+    m_currentView.Update(spListing, m_filterText, m_sortKey, m_isAscending);
+
+    ImGui::TextDisabled("%llu / %llu items", static_cast<unsigned long long>(m_currentView.GetSize()),
+        static_cast<unsigned long long>(spListing->entries.size()));
+
+    // 見えている行だけ描画する
+    auto clipper{ ImGuiListClipper{} };
+    clipper.Begin(static_cast<int>(m_currentView.GetSize()));
+    while (clipper.Step())
     {
-        FlEditorAdministrator::Instance().GetLogger()->AddErrorLog("Error: %s", e.what());
+        for (auto row{ clipper.DisplayStart }; row < clipper.DisplayEnd; ++row) {
+            RenderFileItem(m_currentView.GetEntry(static_cast<size_t>(row)));
+        }
     }
+    clipper.End();
+}
+
+void FlFileEditor::InvalidateParent(const std::filesystem::path& path) noexcept
+{
+    m_upDirectoryModel->Invalidate(path.parent_path());
 }
 
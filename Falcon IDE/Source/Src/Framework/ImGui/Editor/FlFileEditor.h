@@ -20,14 +20,6 @@ public:
     /// <param name="path">ݒ肷t@C̃pXB</param>
     auto SetDroppedFile(const std::filesystem::path& path) noexcept { m_doppedPath = path; }
 private:
-    struct FileEntry
-    {
-        std::filesystem::path path;
-        bool isDirectory = false;
-        bool isOpen      = false; // ImGuĩc[
-        std::vector<FileEntry> children;
-    };
-
     struct FileEntryUIState 
     {
         std::string newName;
@@ -44,13 +36,17 @@ private:
         enum class Type { None, Rename, Create, Delete } type = Type::None;
     };
 
-    void BuildFileTree(const std::filesystem::path& root, FileEntry& entry) noexcept;
-    void RenderFileEntry(FileEntry& entry) noexcept;
+    void RenderFileEntry(const FlDirectoryModel::Entry& entry) noexcept;
 	void RenderPopup() noexcept;
-    void RenderFileItem(const std::filesystem::directory_entry& entry) noexcept;
+    void RenderFileItem(const FlDirectoryModel::Entry& entry) noexcept;
 
     void RenderCurrentItem();
 
+    /// <summary>
+    /// 삵pX̐efBNgđ܂BiĎ̎҂ɔfj
+    /// </summary>
+    void InvalidateParent(const std::filesystem::path& path) noexcept;
+
 	FlFileWatcher m_fileWatcher; // t@CĎp
     std::unordered_map<std::filesystem::path, FileEntryUIState> m_uiStates;
 	std::optional<PopupRequest> m_pendingPopup; // |bvAbvv
@@ -61,4 +57,11 @@ private:
     std::filesystem::path m_currentPath = m_basePath;
 
     std::unique_ptr<FlFilePathManager> m_upFPM;
+
+    // \̓LbVς݂̃XibvVbgsAt[̃fBXN͂Ȃ
+    std::unique_ptr<FlDirectoryModel> m_upDirectoryModel;
+    FlDirectoryModel::View            m_currentView;
+    FlDirectoryModel::View::SortKey   m_sortKey     = FlDirectoryModel::View::SortKey::Name;
+    std::string                       m_filterText;
+    bool                              m_isAscending = true;
 };
\ No newline at end of file
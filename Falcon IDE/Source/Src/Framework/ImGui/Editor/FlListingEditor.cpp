@@ -43,70 +43,66 @@ void FlListingEditor::RenderListingViewer(const std::string& title, bool* p_open
 
 void FlListingEditor::ListingGuidAssets(bool isAssetsAndGuid, bool isGuidOnly, bool isAssetsOnly)
 {
-    auto guidMap{ FlResourceAdministrator::Instance().GetMetaFileManager()->GetGuidMap() };
+    auto* pMeta{ FlResourceAdministrator::Instance().GetMetaFileManager().get() };
 
-    // e[uƂĕ\
-    if (isAssetsAndGuid)
-    {
-        if (ImGui::BeginTable("MapTable", 2, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_Resizable))
-        {
-            ImGui::TableSetupColumn("Key");
-            ImGui::TableSetupColumn("Value");
-            ImGui::TableHeadersRow();
-
-            for (const auto& [key, value] : guidMap) {
-                // tB^ɈvȂꍇ̓XLbv
-                std::string combined = key + " " + value;
-                if (!m_filter.PassFilter(combined.c_str())) continue;
+    // 蒼IĂ΍ւ
+    if (m_pendingIndex.valid() && m_pendingIndex.wait_for(std::chrono::seconds::zero()) == std::future_status::ready)
+        m_upIndex = m_pendingIndex.get();
 
-                ImGui::TableNextRow();
-                ImGui::TableSetColumnIndex(0);
-                ImGui::TextUnformatted(key.c_str());
-
-                ImGui::TableSetColumnIndex(1);
-                ImGui::TextUnformatted(value.c_str());
-            }
-
-            ImGui::EndTable();
-        }
-    }
-
-    else if (isGuidOnly)
+    // ^̕ύXʂƍ蒼i10ŐS ms ̂ŕ`Xbhł͍sȂj
+    if (!m_pendingIndex.valid() && pMeta->GetGuidMapVersion() != m_upIndex->GetVersion() && m_rebuildTicker.tick())
     {
-        if (ImGui::BeginTable("MapTable", 1, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_Resizable))
-        {
+        m_pendingIndex = std::async(std::launch::async, [pMeta]
+            {
+                const auto version{ pMeta->GetGuidMapVersion() };
+                auto upIndex{ std::make_unique<FlGuidSearchIndex>() };
+                upIndex->Build(pMeta->SnapshotGuidMap(), version);
+                return upIndex;
+            });
+    }
 
-            ImGui::TableSetupColumn("Key");
-            ImGui::TableHeadersRow();
+    const auto field{ isAssetsAndGuid ? FlGuidSearchIndex::Field::Both :
+                      isGuidOnly      ? FlGuidSearchIndex::Field::Guid : FlGuidSearchIndex::Field::Path };
+    if (!isAssetsAndGuid && !isGuidOnly && !isAssetsOnly) return;
 
-            for (const auto& pair : guidMap) {
-                if (!m_filter.PassFilter(pair.first.c_str())) continue;
+    auto& index{ *m_upIndex };
+    const auto& rows{ index.Query(m_filter.InputBuf, field) };
+    ImGui::Text("%zu / %zu", rows.size(), index.GetSize());
 
-                ImGui::TableNextRow();
-                ImGui::TableSetColumnIndex(0);
-                ImGui::TextUnformatted(pair.first.c_str());
-            }
-
-            ImGui::EndTable();
-        }
-    }
+    const auto isGuidColumn { field != FlGuidSearchIndex::Field::Path };
+    const auto isAssetColumn{ field != FlGuidSearchIndex::Field::Guid };
 
-    else if (isAssetsOnly)
+    // e[uƂĕ\iĂs`悷j
+    if (ImGui::BeginTable("MapTable", isGuidColumn && isAssetColumn ? 2 : 1,
+        ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_Resizable | ImGuiTableFlags_ScrollY))
     {
-        if (ImGui::BeginTable("MapTable", 1, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_Resizable))
+        ImGui::TableSetupScrollFreeze(0, 1);
+        if (isGuidColumn)  ImGui::TableSetupColumn("Key");
+        if (isAssetColumn) ImGui::TableSetupColumn("Value");
+        ImGui::TableHeadersRow();
+
+        auto clipper{ ImGuiListClipper{} };
+        clipper.Begin(static_cast<int>(rows.size()));
+        while (clipper.Step())
         {
-            ImGui::TableSetupColumn("Value");
-            ImGui::TableHeadersRow();
-
-            for (const auto& pair : guidMap) {
-                if (!m_filter.PassFilter(pair.second.c_str())) continue;
-
+            for (auto i{ clipper.DisplayStart }; i < clipper.DisplayEnd; ++i)
+            {
+                const auto row{ rows[i] };
                 ImGui::TableNextRow();
-                ImGui::TableSetColumnIndex(0);
-                ImGui::TextUnformatted(pair.second.c_str());
+                if (isGuidColumn)
+                {
+                    ImGui::TableNextColumn();
+                    ImGui::TextUnformatted(index.GetGuidString(row).c_str());
+                }
+                if (isAssetColumn)
+                {
+                    ImGui::TableNextColumn();
+                    ImGui::TextUnformatted(index.GetPath(row).c_str());
+                }
             }
-
-            ImGui::EndTable();
         }
+        clipper.End();
+
+        ImGui::EndTable();
     }
 }
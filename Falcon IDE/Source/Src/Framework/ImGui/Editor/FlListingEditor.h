@@ -9,6 +9,11 @@ private:
 
     ImGuiTextFilter m_filter;
 
+    // GUID}bv̎ʂƍBłςō蒼iŒZł 250ms jAł獷ւ
+    std::unique_ptr<FlGuidSearchIndex>              m_upIndex{ std::make_unique<FlGuidSearchIndex>() };
+    std::future<std::unique_ptr<FlGuidSearchIndex>> m_pendingIndex;
+    FlChronus::Ticker                               m_rebuildTicker{ FlChronus::ms(250) };
+
     bool m_isOption{ false };
 
     enum ListingType : uint32_t
@@ -2,6 +2,8 @@
 
 void FlLogEditor::RenderLog(const std::string& title, bool* p_opened, ImGuiWindowFlags flags)
 {
+	Drain();
+
 	ImGui::Begin(title.c_str(), p_opened, flags);
 
 	if (ImGui::Button("Clear")) Clear();
@@ -14,6 +16,35 @@ void FlLogEditor::RenderLog(const std::string& title, bool* p_opened, ImGuiWindo
 
     ImGui::Separator();
 
+    // dvxEtB^iύX̂ݍ蒼j
+    auto isFilterChanged{ false };
+    for (auto i{ Def::UIntZero }; i < static_cast<uint32_t>(Severity::Count); ++i)
+    {
+        auto isShow{ (m_severityMask & (Def::UIntOne << i)) != Def::UIntZero };
+        const auto& color{ SeverityColors[i] };
+
+        // t[郉x̓X^bNɏ
+        char label[64];
+        sprintf_s(label, "%s (%llu)##Severity%u", SeverityNames[i], m_severityCounts[i], i);
+
+        ImGui::PushStyleColor(ImGuiCol_Text, ImVec4{ color.R(), color.G(), color.B(), color.A() });
+        if (ImGui::Checkbox(label, &isShow))
+        {
+            m_severityMask ^= (Def::UIntOne << i);
+            isFilterChanged = true;
+        }
+        ImGui::PopStyleColor();
+        ImGui::SameLine();
+    }
+    if (m_textFilter.Draw("Filter", 200.0f)) isFilterChanged = true;
+
+    if (isFilterChanged) RebuildFilterIndex();
+
+    if (const auto dropped{ GetDroppedCount() }; dropped > Def::ULongLongZero)
+        ImGui::TextColored(ImVec4{ Def::FloatOne, Def::Half, Def::FloatZero, Def::FloatOne }, "Dropped: %llu", static_cast<unsigned long long>(dropped));
+
+    ImGui::Separator();
+
     ImGui::Text("Font Size:");
     ImGui::SameLine();
     if (ImGui::Button("-##FontDown") && m_fontScale > m_minFontScale) m_fontScale = std::max(m_fontScale - 0.1f, m_minFontScale);
@@ -38,14 +69,25 @@ void FlLogEditor::RenderLog(const std::string& title, bool* p_opened, ImGuiWindo
 
     ImGui::BeginChild("LogScroll", ImVec2(Def::Vec2.x, Def::Vec2.y), false, ImGuiWindowFlags_HorizontalScrollbar);
 
-    for (const auto& entry : m_logEntries)
+    const auto isFiltering{ IsFiltering() };
+    const auto rowCount   { isFiltering ? m_filteredSeqs.size() : static_cast<size_t>(m_nextSeq - m_firstSeq) };
+
+    // ĂsE`悷
+    auto clipper{ ImGuiListClipper{} };
+    clipper.Begin(static_cast<int>(rowCount));
+    while (clipper.Step())
     {
-        const auto imCol{ ImVec4{entry.color.R(), entry.color.G(), entry.color.B(), entry.color.A()} };
+        for (auto row{ clipper.DisplayStart }; row < clipper.DisplayEnd; ++row)
+        {
+            auto& record{ GetRecord(isFiltering ? m_filteredSeqs[row] : m_firstSeq + row) };
+            const auto imCol{ ImVec4{record.color.R(), record.color.G(), record.color.B(), record.color.A()} };
 
-        ImGui::PushStyleColor(ImGuiCol_Text, imCol);
-        ImGui::TextUnformatted(entry.text.c_str());
-        ImGui::PopStyleColor();
+            ImGui::PushStyleColor(ImGuiCol_Text, imCol);
+            ImGui::TextUnformatted(GetText(record).c_str());
+            ImGui::PopStyleColor();
+        }
     }
+    clipper.End();
 
     if (m_scrollToBottom) ImGui::SetScrollHereY(Def::FloatOne);
     m_scrollToBottom   = false;
@@ -58,16 +100,129 @@ void FlLogEditor::RenderLog(const std::string& title, bool* p_opened, ImGuiWindo
     ImGui::End();
 }
 
+void FlLogEditor::PushText(const Severity severity, const Math::Color& color, std::string&& text)
+{
+	auto record{ LogRecord{} };
+	record.time		= FlChronus::System::now();
+	record.color	= color;
+	record.severity = severity;
+	record.text		= FlChronus::to_iso8601(record.time) + " | " + std::move(text);
+
+	m_inbox.TryPush(std::move(record));
+}
+
+const std::string* FlLogEditor::InternFormat(const std::string& fmt)
+{
+	// eXbhňx̓bNŕԂ
+	thread_local auto cache{ std::unordered_map<std::string, const std::string*>{} };
+	if (auto it{ cache.find(fmt) }; it != cache.end()) return it->second;
+
+	static auto mutex  { std::mutex{} };
+	static auto formats{ std::unordered_set<std::string>{} };
+
+	auto pFormat{ static_cast<const std::string*>(nullptr) };
+	{
+		auto lock{ std::lock_guard{ mutex } };
+
+		if (auto it{ formats.find(fmt) }; it != formats.end()) pFormat = &(*it);
+		else if (formats.size() < MaxInternedFormats)		   pFormat = &(*formats.insert(fmt).first);
+	}
+
+	if (pFormat) cache.emplace(fmt, pFormat);
+	return pFormat;
+}
+
+void FlLogEditor::Drain()
+{
+	if (m_history.empty()) m_history.reserve(InboxCapacity);
+
+	const auto isFiltering{ IsFiltering() };
+
+	auto record{ LogRecord{} };
+	while (m_inbox.TryPop(record))
+	{
+		const auto seq{ m_nextSeq++ };
+
+		if (m_history.size() < HistoryCapacity) m_history.push_back(std::move(record));
+		else
+		{
+			// tȂŌÂ㏑
+			--m_severityCounts[static_cast<size_t>(GetRecord(m_firstSeq).severity)];
+			++m_firstSeq;
+			GetRecord(seq) = std::move(record);
+		}
+
+		auto& stored{ GetRecord(seq) };
+		++m_severityCounts[static_cast<size_t>(stored.severity)];
+
+		if (isFiltering && PassFilter(stored)) m_filteredSeqs.push_back(seq);
+
+		m_scrollToBottom = true;
+	}
+
+	while (!m_filteredSeqs.empty() && m_filteredSeqs.front() < m_firstSeq) m_filteredSeqs.pop_front();
+}
+
+const std::string& FlLogEditor::GetText(LogRecord& record)
+{
+	if (record.text.empty() && record.pFormat)
+	{
+		record.text = FlChronus::to_iso8601(record.time) + " | " +
+			(record.upArgs ? record.upArgs->Format(record.pFormat->c_str()) : Str::FormatString(record.pFormat->c_str()));
+		record.upArgs.reset();
+	}
+	return record.text;
+}
+
+const bool FlLogEditor::PassFilter(LogRecord& record)
+{
+	if (!(m_severityMask & (Def::UIntOne << static_cast<uint32_t>(record.severity)))) return false;
+	if (!m_textFilter.IsActive()) return true;
+
+	const auto& text{ GetText(record) };
+	return m_textFilter.PassFilter(text.c_str(), text.c_str() + text.size());
+}
+
+const bool FlLogEditor::IsFiltering() const noexcept
+{
+	const auto allMask{ (Def::UIntOne << static_cast<uint32_t>(Severity::Count)) - Def::UIntOne };
+	return m_severityMask != allMask || m_textFilter.IsActive();
+}
+
+void FlLogEditor::RebuildFilterIndex()
+{
+	m_filteredSeqs.clear();
+	if (!IsFiltering()) return;
+
+	for (auto seq{ m_firstSeq }; seq < m_nextSeq; ++seq)
+		if (PassFilter(GetRecord(seq))) m_filteredSeqs.push_back(seq);
+}
+
+void FlLogEditor::Clear()
+{
+	m_history.clear();
+	m_filteredSeqs.clear();
+	m_severityCounts.fill(Def::ULongLongZero);
+	m_firstSeq = m_nextSeq = Def::ULongLongZero;
+}
+
 void FlLogEditor::Copy()
 {
-	ImGui::LogToClipboard();
+	// \itB^Kpj̃O܂Ƃ߂ăRs[
+	auto text{ std::string{} };
+	auto append{ [this, &text](const uint64_t seq) { text += GetText(GetRecord(seq)); text += '\n'; } };
+
+	if (IsFiltering()) for (const auto seq : m_filteredSeqs) append(seq);
+	else for (auto seq{ m_firstSeq }; seq < m_nextSeq; ++seq) append(seq);
+
+	ImGui::SetClipboardText(text.c_str());
 
 	AddLog("Copy: Log to Clipboard");
 }
 
 void FlLogEditor::ExportLog()
 {
-	if (m_logEntries.empty()) 
+	if (m_firstSeq == m_nextSeq)
 	{
 		AddWarningLog("Warning: Log is empty: Nothing to export");
 		return;
@@ -81,15 +236,21 @@ void FlLogEditor::ExportLog()
 	auto path{ m_exportPath + ".log" };
 
 	auto upDebLogger{ std::make_unique<DebugLogger>(path) };
+	if (!upDebLogger->IsOpen())
+	{
+		AddErrorLog("Error: Could not open log file %s", path.c_str());
+		return;
+	}
 
-	for (const auto& logText : m_logEntries) {
-		DEBUG_LOG(upDebLogger, logText.text.c_str());
+	for (auto seq{ m_firstSeq }; seq < m_nextSeq; ++seq) {
+		DEBUG_LOG(upDebLogger, GetText(GetRecord(seq)).c_str());
 	}
 
 	DEBUG_LOG(upDebLogger, "-------------------------------------------");
 
-	if (!upDebLogger->IsOpen()) 
-		AddErrorLog("Error: Could not open log file %s", path.c_str());
-	else 
+	// oIăt@Cʂŕ񍐂iGNX|[g͖ς蓾̂ŊJ܂܂ɂȂj
+	if (upDebLogger->Close())
 		AddSuccessLog("Export successful: Path %s", path.c_str());
-}
\ No newline at end of file
+	else
+		AddErrorLog("Error: Could not write log file %s", path.c_str());
+}
@@ -24,142 +24,111 @@ public:
 	template<class... Args>
 	void AddLog(const std::string& fmt, Args... args)
 	{
-		Math::Color color{ Def::Half, Def::Half, Def::Half, Def::FloatOne };
-
-		AddLog(color, fmt, args...);
+		Push(Severity::Log, SeverityColors[static_cast<size_t>(Severity::Log)], fmt, args...);
 	}
 
 	template<class... Args>
 	void AddWarningLog(const std::string& fmt, Args... args)
 	{
-		Math::Color color{ Def::Half, Def::Half, Def::FloatZero, Def::FloatOne };
-
-		AddLog(color, fmt, args...);
+		Push(Severity::Warning, SeverityColors[static_cast<size_t>(Severity::Warning)], fmt, args...);
 	}
 
 	template<class... Args>
 	void AddChangeLog(const std::string& fmt, Args... args)
 	{
-		Math::Color color{ Def::Half, Def::FloatZero, Def::FloatOne, Def::FloatOne };
-
-		AddLog(color, fmt, args...);
+		Push(Severity::Change, SeverityColors[static_cast<size_t>(Severity::Change)], fmt, args...);
 	}
 
 	template<class... Args>
 	void AddErrorLog(const std::string& fmt, Args... args)
 	{
-		Math::Color color{ Def::FloatOne, Def::FloatZero, Def::FloatZero, Def::FloatOne };
-
-		AddLog(color, fmt, args...);
+		Push(Severity::Error, SeverityColors[static_cast<size_t>(Severity::Error)], fmt, args...);
 	}
 
 	template<class... Args>
 	void AddSuccessLog(const std::string& fmt, Args... args)
 	{
-		Math::Color color{ Def::FloatZero, Def::FloatOne, Def::Half, Def::FloatOne };
-
-		AddLog(color, fmt, args...);
+		Push(Severity::Success, SeverityColors[static_cast<size_t>(Severity::Success)], fmt, args...);
 	}
 
 	template<class... Args>
 	void AddLog(const Math::Color& color, const std::string& fmt, Args... args)
 	{
-		auto buffer{ FlChronus::now_iso8601() + " | " + Str::FormatString(fmt.c_str(),args...)};
-
-		m_logEntries.push_back({ buffer, color });
-		m_scrollToBottom = true;
+		Push(Severity::Log, color, fmt, args...);
 	}
 
-	// std::wstringΉ̃\bhQ
+	// std::wstringΉ̃\bhQi̕ƂċL^j
 	template<class... Args>
 	void AddLogW(const std::wstring& fmt, Args... args)
 	{
-		Math::Color color{ Def::Half, Def::Half, Def::Half, Def::FloatOne };
-		AddLogW(color, fmt, args...);
+		PushText(Severity::Log, SeverityColors[static_cast<size_t>(Severity::Log)], wide_to_ansi(Str::FormatStringW(fmt.c_str(), args...)));
 	}
 
 	template<class... Args>
 	void AddWarningLogW(const std::wstring& fmt, Args... args)
 	{
-		Math::Color color{ Def::Half, Def::Half, Def::FloatZero, Def::FloatOne };
-		AddLogW(color, fmt, args...);
+		PushText(Severity::Warning, SeverityColors[static_cast<size_t>(Severity::Warning)], wide_to_ansi(Str::FormatStringW(fmt.c_str(), args...)));
 	}
 
 	template<class... Args>
 	void AddChangeLogW(const std::wstring& fmt, Args... args)
 	{
-		Math::Color color{ Def::Half, Def::FloatZero, Def::FloatOne, Def::FloatOne };
-		AddLogW(color, fmt, args...);
+		PushText(Severity::Change, SeverityColors[static_cast<size_t>(Severity::Change)], wide_to_ansi(Str::FormatStringW(fmt.c_str(), args...)));
 	}
 
 	template<class... Args>
 	void AddErrorLogW(const std::wstring& fmt, Args... args)
 	{
-		Math::Color color{ Def::FloatOne, Def::FloatZero, Def::FloatZero, Def::FloatOne };
-		AddLogW(color, fmt, args...);
+		PushText(Severity::Error, SeverityColors[static_cast<size_t>(Severity::Error)], wide_to_ansi(Str::FormatStringW(fmt.c_str(), args...)));
 	}
 
 	template<class... Args>
 	void AddSuccessLogW(const std::wstring& fmt, Args... args)
 	{
-		Math::Color color{ Def::FloatZero, Def::FloatOne, Def::Half, Def::FloatOne };
-		AddLogW(color, fmt, args...);
+		PushText(Severity::Success, SeverityColors[static_cast<size_t>(Severity::Success)], wide_to_ansi(Str::FormatStringW(fmt.c_str(), args...)));
 	}
 
 	template<class... Args>
 	void AddLogW(const Math::Color& color, const std::wstring& fmt, Args... args)
 	{
-		auto wbuffer{ Str::FormatStringW(fmt.c_str(), args...) };
-		auto buffer{ FlChronus::now_iso8601() + " | " + wide_to_ansi(wbuffer) };
-
-		m_logEntries.push_back({ buffer, color });
-		m_scrollToBottom = true;
+		PushText(Severity::Log, color, wide_to_ansi(Str::FormatStringW(fmt.c_str(), args...)));
 	}
 
 	// std::u8stringΉ̃\bhQ
 	template<class... Args>
 	void AddLogU8(const std::u8string& fmt, Args... args)
 	{
-		Math::Color color{ Def::Half, Def::Half, Def::Half, Def::FloatOne };
-		AddLogU8(color, fmt, args...);
+		PushText(Severity::Log, SeverityColors[static_cast<size_t>(Severity::Log)], Str::U8StringToStringSafe(Str::FormatStringU8(fmt.c_str(), args...)));
 	}
 
 	template<class... Args>
 	void AddWarningLogU8(const std::u8string& fmt, Args... args)
 	{
-		Math::Color color{ Def::Half, Def::Half, Def::FloatZero, Def::FloatOne };
-		AddLogU8(color, fmt, args...);
+		PushText(Severity::Warning, SeverityColors[static_cast<size_t>(Severity::Warning)], Str::U8StringToStringSafe(Str::FormatStringU8(fmt.c_str(), args...)));
 	}
 
 	template<class... Args>
 	void AddChangeLogU8(const std::u8string& fmt, Args... args)
 	{
-		Math::Color color{ Def::Half, Def::FloatZero, Def::FloatOne, Def::FloatOne };
-		AddLogU8(color, fmt, args...);
+		PushText(Severity::Change, SeverityColors[static_cast<size_t>(Severity::Change)], Str::U8StringToStringSafe(Str::FormatStringU8(fmt.c_str(), args...)));
 	}
 
 	template<class... Args>
 	void AddErrorLogU8(const std::u8string& fmt, Args... args)
 	{
-		Math::Color color{ Def::FloatOne, Def::FloatZero, Def::FloatZero, Def::FloatOne };
-		AddLogU8(color, fmt, args...);
+		PushText(Severity::Error, SeverityColors[static_cast<size_t>(Severity::Error)], Str::U8StringToStringSafe(Str::FormatStringU8(fmt.c_str(), args...)));
 	}
 
 	template<class... Args>
 	void AddSuccessLogU8(const std::u8string& fmt, Args... args)
 	{
-		Math::Color color{ Def::FloatZero, Def::FloatOne, Def::Half, Def::FloatOne };
-		AddLogU8(color, fmt, args...);
+		PushText(Severity::Success, SeverityColors[static_cast<size_t>(Severity::Success)], Str::U8StringToStringSafe(Str::FormatStringU8(fmt.c_str(), args...)));
 	}
 
 	template<class... Args>
 	void AddLogU8(const Math::Color& color, const std::u8string& fmt, Args... args)
 	{
-		auto u8buffer{ Str::FormatStringU8(fmt.c_str(), args...) };
-		auto buffer{ FlChronus::now_iso8601() + " | " + Str::U8StringToStringSafe(u8buffer) };
-
-		m_logEntries.push_back({ buffer, color });
-		m_scrollToBottom = true;
+		PushText(Severity::Log, color, Str::U8StringToStringSafe(Str::FormatStringU8(fmt.c_str(), args...)));
 	}
 
 	void RenderLog(const std::string& title, bool* p_open = NULL, ImGuiWindowFlags flags = ImGuiWindowFlags_None);
@@ -169,19 +138,150 @@ public:
 
 	const auto GetFontScale() const { return m_fontScale; }
 
+	/// <summary>
+	/// Mobt@tŔjO̐
+	/// </summary>
+	const auto GetDroppedCount() const noexcept { return m_inbox.GetDroppedCount(); }
+
 private:
 
-	struct LogEntry
+	enum class Severity : uint8_t
 	{
-		std::string text;
-		Math::Color color;
+		Log,
+		Warning,
+		Change,
+		Error,
+		Success,
+		Count
+	};
+
+	inline static const std::array<Math::Color, static_cast<size_t>(Severity::Count)> SeverityColors{
+		Math::Color{ Def::Half,      Def::Half,      Def::Half,      Def::FloatOne },
+		Math::Color{ Def::Half,      Def::Half,      Def::FloatZero, Def::FloatOne },
+		Math::Color{ Def::Half,      Def::FloatZero, Def::FloatOne,  Def::FloatOne },
+		Math::Color{ Def::FloatOne,  Def::FloatZero, Def::FloatZero, Def::FloatOne },
+		Math::Color{ Def::FloatZero, Def::FloatOne,  Def::Half,      Def::FloatOne }
+	};
+
+	static constexpr std::array<const char*, static_cast<size_t>(Severity::Count)> SeverityNames{
+		"Log", "Warning", "Change", "Error", "Success"
 	};
 
-	void Clear() { m_logEntries.clear(); }
+	/// <summary>
+	/// \܂Œx
+	/// </summary>
+	class LogArguments
+	{
+	public:
+		virtual ~LogArguments() = default;
+		virtual std::string Format(const char* fmt) const = 0;
+	};
+
+	// |C^͌Ăяo̎Ɉˑ邽ߕĕێ
+	template<class T>
+	using Captured = std::conditional_t<std::is_same_v<std::decay_t<T>, const char*> || std::is_same_v<std::decay_t<T>, char*>, std::string,
+		std::conditional_t<std::is_same_v<std::decay_t<T>, const wchar_t*> || std::is_same_v<std::decay_t<T>, wchar_t*>, std::wstring,
+		std::decay_t<T>>>;
+
+	template<class T>
+	static auto Capture(const T& arg)
+	{
+		if constexpr (std::is_same_v<Captured<T>, std::string>)		  return std::string{ arg ? arg : "(null)" };
+		else if constexpr (std::is_same_v<Captured<T>, std::wstring>) return std::wstring{ arg ? arg : L"(null)" };
+		else return arg;
+	}
+
+	static const char*	  Pass(const std::string& arg)  noexcept { return arg.c_str(); }
+	static const wchar_t* Pass(const std::wstring& arg) noexcept { return arg.c_str(); }
+	template<class T>
+	static const T& Pass(const T& arg) noexcept { return arg; }
+
+	template<class... Args>
+	class LogArgumentsT final : public LogArguments
+	{
+	public:
+		explicit LogArgumentsT(const Args&... args) : m_args{ Capture(args)... } {}
+
+		std::string Format(const char* fmt) const override
+		{
+			return std::apply([fmt](const auto&... args) { return Str::FormatString(fmt, Pass(args)...); }, m_args);
+		}
+
+	private:
+		std::tuple<Captured<Args>...> m_args;
+	};
+
+	struct LogRecord
+	{
+		const std::string*			  pFormat = nullptr;	// o^ς݂̏inullptr Ȃ text mς݁j
+		std::unique_ptr<LogArguments> upArgs;				// x
+		std::string					  text;					// \p1si\Ɋmj
+		FlChronus::System::time_point time;
+		Math::Color					  color;
+		Severity					  severity = Severity::Log;
+	};
+
+	template<class... Args>
+	void Push(const Severity severity, const Math::Color& color, const std::string& fmt, Args... args)
+	{
+		auto record{ LogRecord{} };
+		record.time		= FlChronus::System::now();
+		record.color	= color;
+		record.severity = severity;
+		record.pFormat	= InternFormat(fmt);
+
+		if (!record.pFormat)
+		{
+			// o^𒴂iIɑgݗĂȂǁj͂̏Ŋm
+			record.text = FlChronus::to_iso8601(record.time) + " | " + Str::FormatString(fmt.c_str(), args...);
+		}
+		else if constexpr (sizeof...(Args) > 0) record.upArgs = std::make_unique<LogArgumentsT<Args...>>(args...);
+
+		m_inbox.TryPush(std::move(record));
+	}
+
+	void PushText(const Severity severity, const Math::Color& color, std::string&& text);
+
+	/// <summary>
+	/// o^AvZXsς̃|C^Ԃ܂Bi𒴂ꍇ nullptrj
+	/// </summary>
+	static const std::string* InternFormat(const std::string& fmt);
+
+	/// <summary>
+	/// Mobt@痚ֈڂAtB^̍XV܂BiUIXbhj
+	/// </summary>
+	void Drain();
+
+	const std::string& GetText(LogRecord& record);
+	const bool PassFilter(LogRecord& record);
+	const bool IsFiltering() const noexcept;
+	void RebuildFilterIndex();
+
+	LogRecord& GetRecord(const uint64_t seq) noexcept { return m_history[seq & HistoryMask]; }
+
+	void Clear();
 	void Copy();
 	void ExportLog();
 
-	std::list<LogEntry> m_logEntries;
+	static constexpr size_t	  InboxCapacity	 { 1U << 14 };
+	static constexpr uint64_t HistoryCapacity{ 1U << 17 };
+	static constexpr uint64_t HistoryMask	 { HistoryCapacity - 1U };
+	static constexpr size_t	  MaxInternedFormats{ 4096U };
+
+	FlLockFreeRingBuffer<LogRecord, InboxCapacity> m_inbox;
+	FlMemoryCharge m_inboxCharge{ FlMemoryTag::Log, sizeof(decltype(m_inbox)) };
+
+	// Œ蒷̗iseq & HistoryMask ̈ʒuɊi[AÂ̂㏑j
+	FlTrackedVector<LogRecord, FlMemoryTag::Log> m_history;
+	uint64_t			   m_firstSeq{};
+	uint64_t			   m_nextSeq{};
+
+	// tB^Kp̂ݎgAYO seq ̍
+	std::deque<uint64_t>   m_filteredSeqs;
+	ImGuiTextFilter		   m_textFilter;
+	uint32_t			   m_severityMask{ (Def::UIntOne << static_cast<uint32_t>(Severity::Count)) - Def::UIntOne };
+	std::array<uint64_t, static_cast<size_t>(Severity::Count)> m_severityCounts{};
+
 	bool                m_scrollToBottom{ false };
 
 	std::string			m_exportPath{"Assets/Data/Log/Framework"};
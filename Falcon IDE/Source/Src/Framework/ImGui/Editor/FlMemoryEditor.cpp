@@ -0,0 +1,155 @@
+#include "FlMemoryEditor.h"
+
+void FlMemoryEditor::Render(const std::string& title, bool* p_open, ImGuiWindowFlags flags)
+{
+    CheckBudgets();
+
+    if (ImGui::Begin(title.c_str(), p_open, flags))
+    {
+        auto& tracker{ FlMemoryTracker::Instance() };
+
+#if !FL_MEMORY_TRACKING_ENABLED
+        ImGui::TextDisabled("Memory tracking is compiled out (FL_MEMORY_TRACKING_ENABLED = 0).");
+#endif // !FL_MEMORY_TRACKING_ENABLED
+
+        if (ImGui::Button("Reset Peaks")) tracker.ResetPeaks();
+        ImGui::SameLine();
+        if (ImGui::Button("Dump JSON")) Dump();
+        ImGui::SameLine();
+        ImGui::Checkbox("With Allocations", &m_isDumpAllocations);
+
+        RenderTable();
+        ImGui::Separator();
+        RenderLiveAllocations();
+    }
+    ImGui::End();
+}
+
+void FlMemoryEditor::CheckBudgets()
+{
+    const auto& tracker{ FlMemoryTracker::Instance() };
+    for (auto i{ size_t{} }; i < FlMemoryTracker::TagCount; ++i)
+    {
+        const auto stats{ tracker.GetStatistics(static_cast<FlMemoryTag>(i)) };
+        const auto isOver{ stats.IsOverBudget() };
+        if (isOver == m_isOverBudget[i]) continue;
+
+        m_isOverBudget[i] = isOver;
+        if (isOver)
+            FlEditorAdministrator::Instance().GetLogger()->AddWarningLog("Memory budget exceeded: %s %s / %s",
+                FlMemoryTracker::TagNames[i], FormatBytes(stats.current).c_str(), FormatBytes(stats.budget).c_str());
+        else
+            FlEditorAdministrator::Instance().GetLogger()->AddLog("Memory back within budget: %s", FlMemoryTracker::TagNames[i]);
+    }
+}
+
+void FlMemoryEditor::RenderTable()
+{
+    auto& tracker{ FlMemoryTracker::Instance() };
+
+    constexpr auto TableFlags{ ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp };
+    if (!ImGui::BeginTable("##MemoryTags", 7, TableFlags)) return;
+
+    ImGui::TableSetupColumn("Subsystem");
+    ImGui::TableSetupColumn("Current");
+    ImGui::TableSetupColumn("Peak");
+    ImGui::TableSetupColumn("Allocs");
+    ImGui::TableSetupColumn("Frees");
+    ImGui::TableSetupColumn("Budget [MB]");
+    ImGui::TableSetupColumn("Usage");
+    ImGui::TableHeadersRow();
+
+    for (auto i{ size_t{} }; i < FlMemoryTracker::TagCount; ++i)
+    {
+        const auto tag  { static_cast<FlMemoryTag>(i) };
+        const auto stats{ tracker.GetStatistics(tag) };
+
+        ImGui::PushID(static_cast<int>(i));
+        ImGui::TableNextRow();
+
+        ImGui::TableNextColumn();
+        if (stats.IsOverBudget()) ImGui::TextColored(ImVec4{ 1.0f, 0.35f, 0.35f, 1.0f }, "%s", FlMemoryTracker::TagNames[i]);
+        else ImGui::TextUnformatted(FlMemoryTracker::TagNames[i]);
+
+        ImGui::TableNextColumn(); ImGui::TextUnformatted(FormatBytes(stats.current).c_str());
+        ImGui::TableNextColumn(); ImGui::TextUnformatted(FormatBytes(stats.peak).c_str());
+        ImGui::TableNextColumn(); ImGui::Text("%llu", stats.allocations);
+        ImGui::TableNextColumn(); ImGui::Text("%llu", stats.frees);
+
+        // 0 ͖
+        ImGui::TableNextColumn();
+        ImGui::SetNextItemWidth(-FLT_MIN);
+        if (ImGui::InputFloat("##Budget", &m_budgetMegaBytes[i], Def::FloatZero, Def::FloatZero, "%.1f"))
+        {
+            m_budgetMegaBytes[i] = std::max(m_budgetMegaBytes[i], Def::FloatZero);
+            tracker.SetBudget(tag, static_cast<size_t>(static_cast<double>(m_budgetMegaBytes[i]) * 1024.0 * 1024.0));
+        }
+
+        ImGui::TableNextColumn();
+        if (stats.budget)
+        {
+            const auto ratio{ static_cast<float>(static_cast<double>(stats.current) / static_cast<double>(stats.budget)) };
+            ImGui::ProgressBar(std::min(ratio, Def::FloatOne), ImVec2{ -FLT_MIN, Def::FloatZero }, std::format("{:.0f}%", ratio * 100.0f).c_str());
+        }
+        else ImGui::TextDisabled("-");
+
+        ImGui::PopID();
+    }
+    ImGui::EndTable();
+}
+
+void FlMemoryEditor::RenderLiveAllocations()
+{
+    auto& tracker{ FlMemoryTracker::Instance() };
+
+    auto isCapturing{ tracker.IsCapturingCallstacks() };
+    if (ImGui::Checkbox("Capture Callstacks", &isCapturing)) tracker.SetCaptureCallstacks(isCapturing);
+    ImGui::SameLine();
+    if (ImGui::Button("Collect Live Allocations")) m_liveGroups = tracker.CollectLiveAllocations();
+    ImGui::SameLine();
+    ImGui::TextDisabled("(%zu groups)", m_liveGroups.size());
+
+    if (!ImGui::BeginChild("##LiveAllocations", ImVec2{ Def::FloatZero, Def::FloatZero }, ImGuiChildFlags_Borders))
+    {
+        ImGui::EndChild();
+        return;
+    }
+
+    for (auto i{ size_t{} }; i < m_liveGroups.size(); ++i)
+    {
+        const auto& group{ m_liveGroups[i] };
+
+        ImGui::PushID(static_cast<int>(i));
+        const auto isOpen{ ImGui::TreeNode("##Group", "[%s] %s in %zu allocations", FlMemoryTracker::TagNames[static_cast<size_t>(group.tag)],
+            FormatBytes(group.bytes).c_str(), group.count) };
+        if (isOpen)
+        {
+            for (const auto& frame : group.frames) ImGui::TextUnformatted(frame.c_str());
+            ImGui::TreePop();
+        }
+        ImGui::PopID();
+    }
+    ImGui::EndChild();
+}
+
+void FlMemoryEditor::Dump() const
+{
+    const auto now { std::chrono::zoned_time{ std::chrono::current_zone(), std::chrono::floor<std::chrono::seconds>(std::chrono::system_clock::now()) } };
+    const auto path{ std::filesystem::path{ std::format("Profiles/FlMemory_{:%Y%m%d_%H%M%S}.json", now) } };
+
+    if (FlMemoryTracker::Instance().DumpJson(path, m_isDumpAllocations))
+        FlEditorAdministrator::Instance().GetLogger()->AddSuccessLog("Exported memory report to %s", path.string().c_str());
+    else
+        FlEditorAdministrator::Instance().GetLogger()->AddErrorLog("Failed to export memory report: %s", path.string().c_str());
+}
+
+std::string FlMemoryEditor::FormatBytes(const size_t bytes)
+{
+    constexpr auto KiloByte{ 1024.0 };
+    constexpr auto MegaByte{ KiloByte * 1024.0 };
+
+    const auto value{ static_cast<double>(bytes) };
+    if (value >= MegaByte) return std::format("{:.2f} MB", value / MegaByte);
+    if (value >= KiloByte) return std::format("{:.1f} KB", value / KiloByte);
+    return std::format("{} B", bytes);
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+/// <summary>
+/// FlMemoryTracker ̃TuVXeƂ̎gpʁEs[NE\Z\GfB^łB
+/// \Z𒴂ɌxOoÅmۂ̌ĂяoƂ̈ꗗ JSON ւ̏os܂B
+/// </summary>
+class FlMemoryEditor
+{
+public:
+    void Render(const std::string& title, bool* p_open = nullptr, ImGuiWindowFlags flags = ImGuiWindowFlags_None);
+
+private:
+
+    // \Z𒴂E߂^C~OŃOoiEBhEĂĂsj
+    void CheckBudgets();
+
+    void RenderTable();
+
+    void RenderLiveAllocations();
+
+    void Dump() const;
+
+    static std::string FormatBytes(size_t bytes);
+
+    std::array<float, FlMemoryTracker::TagCount> m_budgetMegaBytes{};
+    std::array<bool,  FlMemoryTracker::TagCount> m_isOverBudget{};
+
+    std::vector<FlMemoryTracker::LiveAllocationGroup> m_liveGroups;
+
+    bool m_isDumpAllocations = false;
+};
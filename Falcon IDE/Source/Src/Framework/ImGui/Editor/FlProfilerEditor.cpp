@@ -0,0 +1,236 @@
+#include "FlProfilerEditor.h"
+
+void FlProfilerEditor::Render(const std::string& title, bool* p_open, ImGuiWindowFlags flags)
+{
+    if (ImGui::Begin(title.c_str(), p_open, flags))
+    {
+        auto& profiler{ FlProfiler::Instance() };
+
+        auto isEnabled{ profiler.IsEnabled() };
+        if (ImGui::Checkbox("Enabled", &isEnabled)) profiler.SetEnabled(isEnabled);
+        ImGui::SameLine();
+        ImGui::Checkbox("Pause", &m_isPaused);
+        ImGui::SameLine();
+        ImGui::SetNextItemWidth(120.0f);
+        ImGui::SliderInt("##ExportFrames", &m_exportFrames, 1, static_cast<int>(FlProfiler::FrameCapacity - 2U), "%d Frames");
+        ImGui::SameLine();
+        if (ImGui::Button("Export Chrome Trace")) ExportTrace();
+
+        // ~߂ĂȂ΍ŐV̊t[ǂiEi񂾎oj
+        if (!m_isPaused) m_view.SelectLatest(profiler);
+
+        RenderFrameStrip();
+        ImGui::Separator();
+
+        const auto& capture{ m_view.GetCapture() };
+        if (capture.threads.empty()) ImGui::TextDisabled("No zones recorded.");
+        else
+        {
+            const auto frameMs{ capture.ToMs(capture.end - capture.begin) };
+            ImGui::Text("Frame %.3f ms  Threads %zu", frameMs, capture.threads.size());
+            if (capture.lost)
+            {
+                ImGui::SameLine();
+                ImGui::TextDisabled("(%llu zones overwritten)", capture.lost);
+            }
+            RenderFlameGraph();
+            RenderSummary();
+        }
+    }
+    ImGui::End();
+}
+
+void FlProfilerEditor::RenderFrameStrip()
+{
+    const auto& frameMarks{ m_view.GetFrameMarks() };
+    const auto count{ frameMarks.size() < 2U ? Def::ULongLongZero : frameMarks.size() - 1U };
+
+    const auto size  { ImVec2{ ImGui::GetContentRegionAvail().x, 60.0f } };
+    const auto origin{ ImGui::GetCursorScreenPos() };
+    ImGui::InvisibleButton("##FrameStrip", ImVec2{ std::max(size.x, 1.0f), size.y });
+    if (!count) return;
+
+    const auto ticksPerMs{ m_view.GetCapture().ticksPerMs };
+    auto maxMs{ 1000.0 / 60.0 };
+    for (auto i{ size_t{ 1U } }; i <= count; ++i)
+        maxMs = std::max(maxMs, static_cast<double>(frameMarks[i] - frameMarks[i - 1U]) / ticksPerMs);
+
+    auto* pDrawList{ ImGui::GetWindowDrawList() };
+    const auto barWidth{ size.x / static_cast<float>(StripFrames) };
+
+    auto hovered{ Def::ULongLongZero };
+    for (auto i{ size_t{ 1U } }; i <= count; ++i)
+    {
+        const auto ms{ static_cast<double>(frameMarks[i] - frameMarks[i - 1U]) / ticksPerMs };
+        const auto x { origin.x + static_cast<float>(StripFrames - count + i - 1U) * barWidth };
+        const auto h { static_cast<float>(ms / maxMs) * size.y };
+
+        const auto isHovered { ImGui::IsItemHovered() && ImGui::GetMousePos().x >= x && ImGui::GetMousePos().x < x + barWidth };
+        const auto isSelected{ i == m_view.GetSelectedEnd() };
+        if (isHovered) hovered = i;
+
+        const auto color{ isSelected ? IM_COL32(255, 200, 60, 255) : isHovered ? IM_COL32(120, 200, 255, 255)
+            : ms > 1000.0 / 30.0 ? IM_COL32(220, 80, 80, 255) : ms > 1000.0 / 60.0 ? IM_COL32(220, 180, 80, 255) : IM_COL32(90, 170, 110, 255) };
+        pDrawList->AddRectFilled(ImVec2{ x, origin.y + size.y - h }, ImVec2{ x + std::max(barWidth - 1.0f, 1.0f), origin.y + size.y }, color);
+    }
+
+    // 60fps ̖ڈ
+    const auto budgetY{ origin.y + size.y - static_cast<float>(1000.0 / 60.0 / maxMs) * size.y };
+    pDrawList->AddLine(ImVec2{ origin.x, budgetY }, ImVec2{ origin.x + size.x, budgetY }, IM_COL32(255, 255, 255, 80));
+
+    if (hovered)
+    {
+        ImGui::SetTooltip("%.3f ms", static_cast<double>(frameMarks[hovered] - frameMarks[hovered - 1U]) / ticksPerMs);
+        if (ImGui::IsItemClicked())
+        {
+            m_isPaused = true;
+            m_view.Select(FlProfiler::Instance(), hovered);
+        }
+    }
+}
+
+void FlProfilerEditor::RenderFlameGraph()
+{
+    constexpr auto RowHeight{ 18.0f };
+
+    const auto& capture{ m_view.GetCapture() };
+    const auto& style{ ImGui::GetStyle() };
+    auto height{ Def::FloatZero };
+    for (const auto& thread : capture.threads)
+        height += ImGui::GetTextLineHeightWithSpacing() + (thread.maxDepth + 1U) * RowHeight + style.ItemSpacing.y;
+
+    const auto childHeight{ std::min(height + style.ScrollbarSize + style.WindowPadding.y * 2.0f, ImGui::GetContentRegionAvail().y * 0.6f) };
+    if (!ImGui::BeginChild("##FlameGraph", ImVec2{ Def::FloatZero, std::max(childHeight, 80.0f) }, ImGuiChildFlags_Borders, ImGuiWindowFlags_HorizontalScrollbar))
+    {
+        ImGui::EndChild();
+        return;
+    }
+
+    const auto viewWidth{ ImGui::GetContentRegionAvail().x };
+
+    // Ctrl + zC[Ń}EXʒu𒆐SɊg
+    if (ImGui::IsWindowHovered() && ImGui::GetIO().KeyCtrl && ImGui::GetIO().MouseWheel != Def::FloatZero)
+    {
+        const auto mouseX{ ImGui::GetMousePos().x - ImGui::GetWindowPos().x - style.WindowPadding.x };
+        const auto focus { (ImGui::GetScrollX() + mouseX) / (viewWidth * m_zoom) };
+        m_zoom = std::clamp(m_zoom * (ImGui::GetIO().MouseWheel > Def::FloatZero ? 1.25f : 0.8f), Def::FloatOne, 1000.0f);
+        ImGui::SetScrollX(focus * viewWidth * m_zoom - mouseX);
+    }
+
+    const auto width  { viewWidth * m_zoom };
+    const auto range  { static_cast<double>(capture.end - capture.begin) };
+    const auto toX    { [&](const FlProfiler::Ticks ticks)
+        {
+            const auto offset{ ticks < capture.begin ? Def::DoubleZero : static_cast<double>(ticks - capture.begin) };
+            return static_cast<float>(std::min(offset, range) / range) * width;
+        } };
+
+    auto* pDrawList{ ImGui::GetWindowDrawList() };
+    const auto clipMin{ ImGui::GetWindowPos().x };
+    const auto clipMax{ clipMin + ImGui::GetWindowWidth() };
+
+    for (const auto& thread : capture.threads)
+    {
+        ImGui::TextUnformatted(thread.name.c_str());
+
+        const auto origin{ ImGui::GetCursorScreenPos() };
+        const auto lanes { ImVec2{ std::max(width, 1.0f), (thread.maxDepth + 1U) * RowHeight } };
+        ImGui::InvisibleButton(thread.name.c_str(), lanes);
+        const auto isLaneHovered{ ImGui::IsItemHovered() };
+
+        for (const auto& zone : thread.zones)
+        {
+            const auto x0{ origin.x + toX(zone.start) };
+            const auto x1{ std::max(origin.x + toX(zone.end), x0 + 1.0f) };
+            if (x1 < clipMin || x0 > clipMax) continue;
+
+            const auto name{ std::string_view{ zone.name ? zone.name : "?" } };
+            const auto min { ImVec2{ x0, origin.y + zone.depth * RowHeight } };
+            const auto max { ImVec2{ x1, min.y + RowHeight - 1.0f } };
+            pDrawList->AddRectFilled(min, max, ZoneColor(name));
+
+            // Oł镝Ȃgɐ؂ĕ`
+            if (x1 - x0 > 24.0f)
+            {
+                const auto textMin{ ImVec2{ std::max(x0, clipMin) + 3.0f, min.y + 2.0f } };
+                pDrawList->PushClipRect(ImVec2{ std::max(x0, clipMin), min.y }, ImVec2{ std::min(x1, clipMax), max.y }, true);
+                pDrawList->AddText(textMin, IM_COL32(20, 20, 20, 255), name.data(), name.data() + name.size());
+                pDrawList->PopClipRect();
+            }
+
+            if (isLaneHovered && ImGui::IsMouseHoveringRect(min, max))
+            {
+                ImGui::BeginTooltip();
+                ImGui::TextUnformatted(name.data(), name.data() + name.size());
+                ImGui::Text("%.4f ms  (Depth %u)", capture.ToMs(zone.end - zone.start), zone.depth);
+                ImGui::EndTooltip();
+            }
+        }
+    }
+
+    ImGui::EndChild();
+}
+
+void FlProfilerEditor::RenderSummary()
+{
+    if (!ImGui::CollapsingHeader("Summary")) return;
+
+    const auto flags{ ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY };
+    if (!ImGui::BeginTable("ZoneSummary", 4, flags, ImVec2{ Def::FloatZero, ImGui::GetTextLineHeightWithSpacing() * 12.0f })) return;
+
+    ImGui::TableSetupScrollFreeze(0, 1);
+    ImGui::TableSetupColumn("Zone", ImGuiTableColumnFlags_WidthStretch);
+    ImGui::TableSetupColumn("Calls");
+    ImGui::TableSetupColumn("Self (ms)");
+    ImGui::TableSetupColumn("Total (ms)");
+    ImGui::TableHeadersRow();
+
+    const auto& summary{ m_view.GetSummary() };
+    auto clipper{ ImGuiListClipper{} };
+    clipper.Begin(static_cast<int>(summary.size()));
+    while (clipper.Step())
+    {
+        for (auto i{ clipper.DisplayStart }; i < clipper.DisplayEnd; ++i)
+        {
+            const auto& row{ summary[i] };
+            ImGui::TableNextRow();
+
+            ImGui::TableSetColumnIndex(0);
+            ImGui::TextUnformatted(row.name.data(), row.name.data() + row.name.size());
+
+            ImGui::TableSetColumnIndex(1);
+            ImGui::Text("%u", row.calls);
+
+            ImGui::TableSetColumnIndex(2);
+            ImGui::Text("%.3f", row.selfMs);
+
+            ImGui::TableSetColumnIndex(3);
+            ImGui::Text("%.3f", row.totalMs);
+        }
+    }
+    ImGui::EndTable();
+}
+
+void FlProfilerEditor::ExportTrace() const
+{
+    const auto& profiler{ FlProfiler::Instance() };
+    const auto capture{ profiler.CaptureFrames(static_cast<size_t>(m_exportFrames)) };
+
+    const auto now { std::chrono::zoned_time{ std::chrono::current_zone(), std::chrono::floor<std::chrono::seconds>(std::chrono::system_clock::now()) } };
+    const auto path{ std::filesystem::path{ std::format("Profiles/FlProfile_{:%Y%m%d_%H%M%S}.json", now) } };
+
+    if (profiler.ExportChromeTrace(capture, path))
+        FlEditorAdministrator::Instance().GetLogger()->AddSuccessLog("Exported %zu frames to %s (open in chrome://tracing or Perfetto)",
+            capture.frames.size() ? capture.frames.size() - 1U : Def::ULongLongZero, path.string().c_str());
+    else
+        FlEditorAdministrator::Instance().GetLogger()->AddErrorLog("Failed to export trace: %s", path.string().c_str());
+}
+
+ImU32 FlProfilerEditor::ZoneColor(const std::string_view name) noexcept
+{
+    // O͏ɓF
+    auto hash{ uint32_t{ 2166136261U } };
+    for (const auto c : name) hash = (hash ^ static_cast<uint8_t>(c)) * 16777619U;
+
+    return ImColor::HSV(static_cast<float>(hash % 360U) / 360.0f, 0.45f, 0.9f);
+}
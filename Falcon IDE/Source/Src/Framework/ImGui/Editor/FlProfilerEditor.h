@@ -0,0 +1,34 @@
+#pragma once
+
+/// <summary>
+/// FlProfiler ̋L^t[Pʂŕ\GfB^łB
+/// ߃t[̏vԂ̖_OtEI񂾃t[̃t[OtEOƂ̏WvƁA
+/// Chrome ̃g[X`ւ̏os܂B
+/// </summary>
+class FlProfilerEditor
+{
+public:
+    void Render(const std::string& title, bool* p_open = nullptr, ImGuiWindowFlags flags = ImGuiWindowFlags_None);
+
+private:
+
+    // ߃t[̏vԂׁANbNt[I
+    void RenderFrameStrip();
+
+    // I񂾃t[̃][XbhƂɐ[Œiς݂ĕ`iCtrl + zC[Ŋgj
+    void RenderFlameGraph();
+
+    void RenderSummary();
+
+    void ExportTrace() const;
+
+    static ImU32 ZoneColor(std::string_view name) noexcept;
+
+    static constexpr size_t StripFrames{ 120U };
+
+    FlProfilerFrameView m_view{ StripFrames }; // ËꗗEI񂾃t[̋L^ƏWv
+
+    bool  m_isPaused     = false;
+    float m_zoom         = Def::FloatOne;
+    int   m_exportFrames = 120;
+};
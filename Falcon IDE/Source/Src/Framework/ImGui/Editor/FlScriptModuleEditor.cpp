@@ -4,15 +4,26 @@
 FlScriptModuleEditor::FlScriptModuleEditor(FlTerminalEditor& terminal)
     : m_manager{ std::make_unique<FlVisualStudioProjectManager>("FlProject-DX12.sln")}
     , m_meta{ std::make_unique<FlMetaFileManager>() }
-    , m_upTicker{ std::make_unique<FlChronus::Ticker>(FlChronus::sec(Def::UIntOne)) }
+    , m_upTicker{ std::make_unique<FlChronus::Ticker>(FlChronus::ms(100)) }
     , m_terminal{ terminal }
 {
+    m_upBuildScheduler = std::make_unique<FlModuleBuildScheduler>(FlModuleBuildScheduler::Runner{
+        [this](const std::string& module, const std::vector<std::string>& sources) { return StartBuild(module, sources); },
+        [this](uint64_t ticket) { m_terminal.CancelCommand(ticket); },
+        [this](uint64_t ticket)
+        {
+            auto result{ m_terminal.TakeCommandResult(ticket) };
+            if (!result) return FlModuleBuildScheduler::BuildState::Running;
+            return *result ? FlModuleBuildScheduler::BuildState::Succeeded : FlModuleBuildScheduler::BuildState::Failed;
+        } });
+
     m_meta->StartMonitoring("ScriptModule");
     m_codeFiles = m_meta->GetAllFilePaths();
 }
 
 FlScriptModuleEditor::~FlScriptModuleEditor()
 {
+    m_upBuildScheduler->CancelAll();
     m_meta->StopMonitoring();
 }
 
@@ -35,7 +46,7 @@ void FlScriptModuleEditor::Render(const std::string& title, bool* p_open, ImGuiW
         {
             ImGui::PushID(id++);
 
-            auto isChanged = m_meta->IsAssetChanged(path);
+            auto isChanged = m_meta->GetChangeJournal()->IsPending(path);
 
             auto filename = std::filesystem::path(path).filename().string();
             auto folder = std::filesystem::path(path).parent_path().filename().string();
@@ -90,12 +101,24 @@ void FlScriptModuleEditor::Render(const std::string& title, bool* p_open, ImGuiW
 
 void FlScriptModuleEditor::ChangedFilesRefresh() noexcept
 {
-    m_codeFiles = m_meta->GetAllFilePaths();
-    m_changerdCodeFiles.clear();
+    auto* pJournal{ m_meta->GetChangeJournal() };
+    const auto sequence{ pJournal->GetSequence() };
+    if (sequence == m_journalSequence) return;
+
+    auto isStructureChanged{ false };
+    for (const auto& entry : pJournal->Collect(m_journalSequence))
+    {
+        if (entry.kind != FlChangeJournal::Kind::Modified) isStructureChanged = true;
+        if (entry.kind == FlChangeJournal::Kind::Erased) continue;
 
-    for (auto& path : m_codeFiles)
-        if(m_meta->IsAssetChanged(path))
-            m_changerdCodeFiles.push_back(path);
+        auto module{ std::filesystem::path(entry.path).parent_path().filename().string() };
+        m_scheduledSequences[entry.path] = entry.sequence;
+        m_upBuildScheduler->Enqueue(module, entry.path);
+    }
+    m_journalSequence = sequence;
+
+    // t@C̑ꗗ蒼
+    if (isStructureChanged) m_codeFiles = m_meta->GetAllFilePaths();
 }
 
 void FlScriptModuleEditor::Update() noexcept
@@ -103,33 +126,47 @@ void FlScriptModuleEditor::Update() noexcept
     if (!m_upTicker->tick()) return;
     ChangedFilesRefresh();
 
-    for (auto& file : m_changerdCodeFiles)
+    for (auto& completed : m_upBuildScheduler->Update())
     {
-        auto projName{ std::filesystem::path(file).parent_path().filename() };
-        m_manager->FormingModule(
-            m_targetDir / projName,
-            file);
- 
-        std::string solutionDir = std::filesystem::absolute(std::filesystem::current_path()).string() + "\\\\";
- 
-        auto projPath{ m_targetDir / projName / (projName.string() + ".vcxproj") };
- 
-        // vcvarsall.bat Ăяoărh
-        std::string command =
-            "call \"C:\\Program Files\\Microsoft Visual Studio\\18\\Community\\VC\\Auxiliary\\Build\\vcvarsall.bat\" x64 && msbuild \"" +
-            std::filesystem::absolute(projPath).lexically_normal().string() +
-            "\" /p:Configuration=Release"
-            " /p:Platform=x64" +
-            " /p:SolutionDir=\"" + solutionDir + "\"" +
-            " /t:Build";
- 
-        m_isDirty = true;
- 
-        m_terminal.ExecuteCommand(command.c_str());
-        //FlScene::Instance().GetScriptModuleLoader()->ScanModule(std::filesystem::path(file).parent_path().filename());
-        m_meta->ResetAssetChangeFlag(file);
+        if (!completed.isSucceeded) continue;
+
+        // \[Xς݂ɂiŝ͎̕ύXňꏏɃrhj
+        for (auto& source : completed.sources)
+        {
+            auto it{ m_scheduledSequences.find(source) };
+            if (it == m_scheduledSequences.end()) continue;
+
+            m_meta->GetChangeJournal()->Acknowledge(source, it->second);
+            m_meta->ResetAssetChangeFlag(source);
+            m_scheduledSequences.erase(it);
+        }
     }
- 
+
+    m_meta->GetChangeJournal()->Flush();
+}
+
+uint64_t FlScriptModuleEditor::StartBuild(const std::string& module, const std::vector<std::string>& sources)
+{
+    for (auto& source : sources)
+        m_manager->FormingModule(m_targetDir / module, source);
+
+    std::string solutionDir = std::filesystem::absolute(std::filesystem::current_path()).string() + "\\\\";
+
+    auto projPath{ m_targetDir / module / (module + ".vcxproj") };
+
+    // vcvarsall.bat Ăяoărh
+    std::string command =
+        "call \"C:\\Program Files\\Microsoft Visual Studio\\18\\Community\\VC\\Auxiliary\\Build\\vcvarsall.bat\" x64 && msbuild \"" +
+        std::filesystem::absolute(projPath).lexically_normal().string() +
+        "\" /p:Configuration=Release"
+        " /p:Platform=x64" +
+        " /p:SolutionDir=\"" + solutionDir + "\"" +
+        " /t:Build";
+
+    m_isDirty = true;
+
+    FlEditorAdministrator::Instance().GetLogger()->AddLog("Build %s (%zu files)", module.c_str(), sources.size());
+    return m_terminal.ExecuteCommand(command.c_str(), true);
 }
 
 void FlScriptModuleEditor::RenderPopup()
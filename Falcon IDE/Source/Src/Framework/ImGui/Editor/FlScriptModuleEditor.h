@@ -1,5 +1,6 @@
 #pragma once
 #include "../System/VisualStudioManager/FlVisualStudioManager.h"
+#include "../System/VisualStudioManager/FlModuleBuildScheduler.h"
 
 class FlScriptModuleLoader;
 
@@ -12,10 +13,14 @@ public:
     void Render(const std::string& title, bool* p_open = NULL, ImGuiWindowFlags flags = ImGuiWindowFlags_None);
 
 private:
+    // ύXW[i̐Vrh\ɉ񂷁iVύXΉȂj
     void ChangedFilesRefresh() noexcept;
 
     void Update() noexcept;
 
+    // W[̃\[X𐮌`Amsbuild 1񂾂ς
+    uint64_t StartBuild(const std::string& module, const std::vector<std::string>& sources);
+
     void RenderPopup();
 
     std::unique_ptr<FlVisualStudioProjectManager> m_manager;
@@ -36,7 +41,10 @@ private:
     FlTerminalEditor& m_terminal;
 
     std::list<std::string> m_codeFiles;
-    std::list<std::string> m_changerdCodeFiles;
+
+    std::unique_ptr<FlModuleBuildScheduler> m_upBuildScheduler;
+    uint64_t m_journalSequence{ Def::ULongLongZero };                // rh\ɉ񂵏Iʂԍ
+    std::unordered_map<std::string, uint64_t> m_scheduledSequences;  // \[X  \񂵂̒ʂԍirh Acknowledge pj
 
     // ͓e
     std::string m_newProjectName;
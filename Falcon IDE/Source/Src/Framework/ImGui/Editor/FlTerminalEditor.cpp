@@ -30,14 +30,51 @@ void FlTerminalEditor::RenderTerminal(const std::string& title, bool* p_open, Im
     ImGui::End();
 }
 
-void FlTerminalEditor::ExecuteCommand(const char* cmd)
+uint64_t FlTerminalEditor::ExecuteCommand(const char* cmd, bool isTracked)
 {
-    if (!cmd || cmd[Def::UIntZero] == '\0') return;
+    if (!cmd || cmd[Def::UIntZero] == '\0') return Def::ULongLongZero;
+    auto ticket{ Def::ULongLongZero };
     {
         std::lock_guard<std::mutex> lock(m_queueMutex);
-        m_commandQueue.push(cmd);
+        ticket = m_nextTicket++;
+        m_commandQueue.emplace_back(ticket, cmd);
+        if (isTracked) m_trackedResults.emplace(ticket, std::nullopt);
     }
     m_cv.notify_one();
+    return ticket;
+}
+
+void FlTerminalEditor::CancelCommand(uint64_t ticket)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        m_trackedResults.erase(ticket);
+        if (std::erase_if(m_commandQueue, [ticket](const auto& command) { return command.first == ticket; }) > 0) return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_processMutex);
+    if (m_currentTicket == ticket && m_hCurrentJob)
+    {
+        TerminateJobObject(m_hCurrentJob, Def::UIntOne);
+        AddLog("> Process Cancelled.");
+    }
+}
+
+std::optional<bool> FlTerminalEditor::TakeCommandResult(uint64_t ticket)
+{
+    std::lock_guard<std::mutex> lock(m_queueMutex);
+    auto it{ m_trackedResults.find(ticket) };
+    if (it == m_trackedResults.end() || !it->second) return std::nullopt;
+
+    auto result{ it->second };
+    m_trackedResults.erase(it);
+    return result;
+}
+
+void FlTerminalEditor::FinishCommand(uint64_t ticket, bool isSucceeded)
+{
+    std::lock_guard<std::mutex> lock(m_queueMutex);
+    if (auto it{ m_trackedResults.find(ticket) }; it != m_trackedResults.end()) it->second = isSucceeded;
 }
 
 void FlTerminalEditor::WorkerThread()
@@ -45,13 +82,15 @@ void FlTerminalEditor::WorkerThread()
     while (m_running)
     {
         std::string command;
+        auto ticket{ Def::ULongLongZero };
         {
             std::unique_lock<std::mutex> lock(m_queueMutex);
             m_cv.wait(lock, [&] { return !m_running || !m_commandQueue.empty(); });
             if (!m_running) break;
             if (!m_commandQueue.empty()) {
-                command = m_commandQueue.front();
-                m_commandQueue.pop();
+                ticket  = m_commandQueue.front().first;
+                command = std::move(m_commandQueue.front().second);
+                m_commandQueue.pop_front();
             }
         }
 
@@ -76,6 +115,7 @@ void FlTerminalEditor::WorkerThread()
             catch (const std::exception& e) {
                 AddLog("> Directory change failed: " + std::string(e.what()));
             }
+            FinishCommand(ticket, true);
             continue;
         }
         if (command == "cls")
@@ -85,6 +125,7 @@ void FlTerminalEditor::WorkerThread()
                 m_log.clear();
             }
             AddLog("> Terminal Current Directory: " + m_currentDir.string());
+            FinishCommand(ticket, true);
             continue;
         }
 
@@ -104,13 +145,28 @@ void FlTerminalEditor::WorkerThread()
         auto fullCmd = "chcp 65001 > nul && cd /d \"" + m_currentDir.string() + "\" && " + command;
         auto wcmd = L"cmd.exe /c " + ansi_to_wide(fullCmd);
 
+        // Ɏqimsbuild jƏIł悤ANɎ~߂ăWu֓
         if (!CreateProcess(nullptr, wcmd.data(), nullptr, nullptr, TRUE,
-            CREATE_NO_WINDOW, nullptr, nullptr, &si, &pi))
+            CREATE_NO_WINDOW | CREATE_SUSPENDED, nullptr, nullptr, &si, &pi))
         {
             AddLog("> Failed to execute command: " + command);
+            CloseHandle(hRead);
+            CloseHandle(hWrite);
+            m_isRunningCommand = false;
+            FinishCommand(ticket, false);
             continue;
         }
 
+        {
+            std::lock_guard<std::mutex> lock(m_processMutex);
+            m_hCurrentJob = CreateJobObjectW(nullptr, nullptr);
+            if (m_hCurrentJob) AssignProcessToJobObject(m_hCurrentJob, pi.hProcess);
+            m_currentPI         = pi;
+            m_currentTicket     = ticket;
+            m_hasRunningProcess = true;
+        }
+        ResumeThread(pi.hThread);
+
         CloseHandle(hWrite);
 
         AddLog("> " + m_currentDir.string() + " " + command);
@@ -158,8 +214,19 @@ void FlTerminalEditor::WorkerThread()
 
         WaitForSingleObject(pi.hProcess, INFINITE);
 
+        {
+            std::lock_guard<std::mutex> lock(m_processMutex);
+            if (m_hCurrentJob) CloseHandle(m_hCurrentJob);
+            m_hCurrentJob       = nullptr;
+            m_currentPI         = {};
+            m_currentTicket     = Def::ULongLongZero;
+            m_hasRunningProcess = false;
+        }
+
         DWORD exitCode{ Def::ULongZero };
-        if (GetExitCodeProcess(pi.hProcess, &exitCode))
+        auto hasExitCode{ GetExitCodeProcess(pi.hProcess, &exitCode) != FALSE };
+        FinishCommand(ticket, hasExitCode && exitCode == Def::ULongZero);
+        if (hasExitCode)
         {
             if (exitCode == Def::ULongZero)
             {
@@ -197,16 +264,16 @@ void FlTerminalEditor::AddLog(const std::string& log)
     std::stringstream ss(processedLog);
     std::string line;
 
-    auto deb{ std::make_unique<DebugLogger>("Assets/Data/Log/Command.log") };
-
     std::lock_guard<std::mutex> lock(m_logMutex);
+
+    if (!m_upCommandLogger) m_upCommandLogger = std::make_unique<DebugLogger>("Assets/Data/Log/Command.log");
     while (std::getline(ss, line, '\n')) {
         if (Str::IsLikelyUtf8(line))
             m_log.push_back(line);
         else
             m_log.push_back(sjis_to_utf8(line));
 
-        DEBUG_LOG(deb, line);
+        DEBUG_LOG(m_upCommandLogger, line);
     }
     m_scrollToBottom = true;
 }
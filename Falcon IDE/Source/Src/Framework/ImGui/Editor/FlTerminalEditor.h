@@ -39,19 +39,41 @@ private:
     // 񓯊p
     std::thread m_worker;
     std::atomic<bool> m_running{ false };
-    std::queue<std::string> m_commandQueue;
+    std::deque<std::pair<uint64_t, std::string>> m_commandQueue; // <ʔԍ, R}h>
     std::mutex m_queueMutex;
     std::condition_variable m_cv;
     std::atomic<bool> m_isRunningCommand{ false };
+    uint64_t m_nextTicket{ Def::ULongLongOne };
+    std::unordered_map<uint64_t, std::optional<bool>> m_trackedResults; // ʂ҂ĂR}him_queueMutex ŕیj
 
     std::mutex m_processMutex;
     PROCESS_INFORMATION m_currentPI{}; // current child process info (zeroed when none)
     HANDLE m_hChildStdin_Wr = nullptr; // eޑiqstdinj
     std::atomic<bool> m_hasRunningProcess{ false };
+    HANDLE m_hCurrentJob = nullptr;             // s̃R}hƎq̃vZXipj
+    uint64_t m_currentTicket{ Def::ULongLongZero };
 
     std::mutex m_logMutex;
+    std::unique_ptr<DebugLogger> m_upCommandLogger; // Command.logi AddLog Őj
 
-    void ExecuteCommand(const char* cmd);
+    /// <summary>
+    /// R}hs҂ɐς݂܂B
+    /// </summary>
+    /// <param name="isTracked">true ȂIʂ TakeCommandResult Ŏ󂯎</param>
+    /// <returns>ʔԍĩR}h 0j</returns>
+    uint64_t ExecuteCommand(const char* cmd, bool isTracked = false);
+
+    /// <summary>
+    /// s҂ȂOAsȂq̃vZXƏI܂BR}ȟʂ͕Ԃ܂B
+    /// </summary>
+    void CancelCommand(uint64_t ticket);
+
+    /// <summary>
+    /// ǐՂĂR}ȟʁiIR[h 0 Ȃ truejB܂IĂȂ nulloptB󂯎ʂ͏܂B
+    /// </summary>
+    std::optional<bool> TakeCommandResult(uint64_t ticket);
+
+    void FinishCommand(uint64_t ticket, bool isSucceeded);
     void AddLog(const std::string& log);
     void WorkerThread();
 
@@ -6,6 +6,14 @@ public:
     FlTransform() = default;
     ~FlTransform() { OnDestroy(); }
 
+    // ̓[J̕ϊʂAeq͎Ȃi̎qDȂBECS ł Update  ID tj
+    FlTransform(const FlTransform& other) noexcept
+        : enable_shared_from_this{}
+        , m_localPosition{ other.m_localPosition }
+        , m_localRotation{ other.m_localRotation }
+        , m_localScale{ other.m_localScale }
+    {}
+
     // ----------- Getter -----------
     const Math::Vector3& GetLocalPosition() const noexcept { return m_localPosition; }
     const Math::Quaternion& GetLocalRotation() const noexcept { return m_localRotation; }
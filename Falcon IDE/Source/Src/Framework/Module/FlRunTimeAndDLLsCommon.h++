@@ -8,6 +8,22 @@
 
 using entityId = uint32_t;
 using priority = uint32_t;
+using queryId  = uint32_t;
+
+// entityId = (12bit) | Xbgԍ(20bit)
+// jXbgėpƐオiނ߁AÂIDʂ̃GeBeBwƂ͂Ȃ
+constexpr uint32_t EntityIndexBits      = 20u;
+constexpr uint32_t EntityIndexMask      = (1u << EntityIndexBits) - 1u;
+constexpr uint32_t EntityGenerationMask = UINT32_MAX >> EntityIndexBits;
+constexpr entityId InvalidEntityId      = UINT32_MAX;
+constexpr queryId  InvalidQueryId       = UINT32_MAX;
+
+constexpr uint32_t GetEntityIndex(const entityId id) noexcept { return id & EntityIndexMask; }
+constexpr uint32_t GetEntityGeneration(const entityId id) noexcept { return id >> EntityIndexBits; }
+constexpr entityId MakeEntityId(const uint32_t index, const uint32_t generation) noexcept
+{
+    return ((generation & EntityGenerationMask) << EntityIndexBits) | (index & EntityIndexMask);
+}
 
 using CreateFn       = void* (*)();
 using DestroyFn      = void  (*)(void*);
@@ -28,6 +44,21 @@ struct ComponentReflection
     UpdateFn       Update       = nullptr;
 };
 
+/// <summary>
+/// NG̈ꗗ̎ʂBversion ςʂiJ[l SyncQueryADLL  FlSyncQueryj
+/// ̂̃|C^͎ version ς܂ŗLłB
+/// </summary>
+struct FlEcsQueryView
+{
+    uint64_t              version = 0;
+    uint32_t              width   = 0; // 1s̎̂̐iK{^̐j
+    std::vector<entityId> entities;
+    std::vector<void*>    components;  // entities[s] ̕K{^[] ̎̂ components[s * width + ]
+
+    size_t size() const noexcept { return entities.size(); }
+    void*  Get(const size_t row, const uint32_t column) const noexcept { return components[row * width + column]; }
+};
+
 #if __cplusplus
 extern "C" 
 #endif // __cplusplus
@@ -61,9 +92,64 @@ extern "C"
         // --- ToLog Oo ---
         void (*ToLogInfo) (const char* fmt, ...);
         void (*ToLogError)(const char* fmt, ...);
+
+        // --- Entity ؁iÂDLLƌ݊ۂߖɒǉj ---
+        bool (*IsEntityAlive)(uint32_t entity); // jς݁EėpꂽIDȂ false
+
+        // --- NGiK{^SĎAO^1ȂGeBeB̈ꗗBǉE폜ōXVj ---
+        // Ȃ瓯IDԂBK{^Eꍇ InvalidQueryId
+        uint32_t (*RegisterQuery)(const char* const* requiredTypes, uint32_t requiredCount, const char* const* excludedTypes, uint32_t excludedCount);
+        // ꗗς邽тɑiςĂȂΎʂȂĂ悢j
+        uint64_t (*GetQueryVersion)(uint32_t query);
+        // sԂBcapacity ȉ̎ outEntities[s]  outComponents[s * K{^̐ + ] Ɏʂ
+        uint32_t (*CopyQuery)(uint32_t query, uint64_t* outVersion, uint32_t* outWidth, uint32_t* outEntities, void** outComponents, uint32_t capacity);
+
+        // --- ύX̔ŁiǉEWorkComponentEMarkComponentChanged ŐiށBSĂ̌^Œʂ̔ԍA0 ͕ύXȂj ---
+        // GetComponent ƓAނ̂ƂĔłi߂
+        void*    (*WorkComponent)(const char* typeName, uint32_t entity);
+        // GetComponent ̃|C^ŏɒm点
+        void     (*MarkComponentChanged)(const char* typeName, uint32_t entity);
+        uint64_t (*GetChangeVersion)();
+        uint64_t (*GetComponentVersion)(const char* typeName, uint32_t entity);
+        // Update ̒ŌĂԂƁǍ^̑O Update ̊Jn̔ŁiV̂O񂩂ςj
+        uint64_t (*GetLastUpdateVersion)();
+        // since ɕK{^̂ǂꂩςs̐ԂBcapacity ȉ̎ outEntities Ɏʂ
+        uint32_t (*CopyChangedRows)(uint32_t query, uint64_t since, uint32_t* outEntities, uint32_t capacity);
     };
 
     // --- DLL GNX|[g֐ ---
     typedef FlResult (*SetRuntimeAPIFn)(FlRuntimeAPI* api, void* ctx);
 
-} // extern "C"
\ No newline at end of file
+} // extern "C"
+
+/// <summary>
+/// DLL ŃNG̎ʂŐVɂ܂BiςĂȂΉȂj
+/// </summary>
+/// <returns>ʂ true</returns>
+inline bool FlSyncQuery(const FlRuntimeAPI& api, const uint32_t query, FlEcsQueryView& view)
+{
+    if (!api.GetQueryVersion || !api.CopyQuery) return false;
+    if (api.GetQueryVersion(query) == view.version) return false;
+
+    auto version{ uint64_t{} };
+    auto width  { uint32_t{} };
+    auto count  { api.CopyQuery(query, &version, &width, nullptr, nullptr, 0) };
+
+    // s𕷂ĂʂiԂɑĂLĂ蒼j
+    for (;;)
+    {
+        view.entities.resize(count);
+        view.components.resize(static_cast<size_t>(count) * width);
+
+        const auto copied{ api.CopyQuery(query, &version, &width, view.entities.data(), view.components.data(), count) };
+        if (copied <= count)
+        {
+            view.entities.resize(copied);
+            view.components.resize(static_cast<size_t>(copied) * width);
+            view.version = version;
+            view.width   = width;
+            return true;
+        }
+        count = copied;
+    }
+}
\ No newline at end of file
@@ -183,17 +183,19 @@ ResistCollision::ResistCollision()
 
                 c->m_isHit = false;
 
-                for (auto& entList : FlEntityComponentSystemKernel::Instance().GetAllEntityIds())
+                // Collision GeBeB̈ꗗitOʂj
+                static const auto collisionQuery{ FlEntityComponentSystemKernel::Instance().RegisterQuery(std::array{ std::string{ "Collision" } }) };
+                static auto collisionView{ FlEcsQueryView{} };
+                FlEntityComponentSystemKernel::Instance().SyncQuery(collisionQuery, collisionView);
+
+                for (auto i{ size_t{} }; i < collisionView.size(); ++i)
                 {
-                    if (FlEntityComponentSystemKernel::Instance().HasComponent("Collision", entList))
+                    if (id == collisionView.entities[i]) continue;
+                    auto cc{ static_cast<CollisionComponent*>(collisionView.Get(i, Def::UIntZero)) };
+                    if (c->m_collision.Intersects(cc->m_collision))
                     {
-                        if (id == entList) continue;
-                        auto cc{ static_cast<CollisionComponent*>(FlEntityComponentSystemKernel::Instance().GetComponent("Collision", entList)) };
-                        if (c->m_collision.Intersects(cc->m_collision))
-                        {
-                            c->m_isHit = true;
-                            break;
-                        }
+                        c->m_isHit = true;
+                        break;
                     }
                 }
 
@@ -4,6 +4,16 @@
 
 #include "Transform.h"
 
+// ՕɎw肳ꂽfɂAIN[WJOp CPU _
+static void PrepareOccluder(const ModelRenderComponent* c) {
+    if (!c->m_isOccluder || !c->m_spModel || c->m_spModel->HasOccluderGeometry()) return;
+
+    if (c->m_spModel->IsSkinMesh())
+        FlEditorAdministrator::Instance().GetLogger()->AddWarningLog("Skin mesh is not used as occluder %s", c->m_path.c_str());
+    else if (!c->m_spModel->LoadOccluderGeometry())
+        FlEditorAdministrator::Instance().GetLogger()->AddWarningLog("Failed Load Occluder Geometry %s", c->m_path.c_str());
+}
+
 static void DrawNodeRecursive(const std::vector<ModelData::Node>& nodes, int32_t nodeIndex) {
     if (nodeIndex == -Def::IntOne) return;
 
@@ -106,6 +116,7 @@ ResistModelRender::ResistModelRender()
                 auto c{ static_cast<ModelRenderComponent*>(component) };
                 
                 json["Model"] = c->m_path;
+                json["Occluder"] = c->m_isOccluder;
             }
             catch (...) {
                 FlEditorAdministrator::Instance().GetLogger()->AddErrorLog("Serialize: Throw to serialize logic(%s).", "ModelRender");
@@ -123,6 +134,7 @@ ResistModelRender::ResistModelRender()
                 auto c{ static_cast<ModelRenderComponent*>(component) };
 
                 FlJsonUtility::GetValue(json, "Model", &c->m_path);
+                FlJsonUtility::GetValue(json, "Occluder", &c->m_isOccluder);
 
                 if (c->m_path.empty()) return;
 
@@ -131,6 +143,8 @@ ResistModelRender::ResistModelRender()
                 else if (auto sp{ FlResourceAdministrator::Instance().GetByGuid<ModelData>(c->m_path) })
                     c->m_spModel = sp;
                 else FlEditorAdministrator::Instance().GetLogger()->AddWarningLog("Failed Load Model %s", c->m_path.c_str());
+
+                PrepareOccluder(c);
             }
             catch (...) {
                 FlEditorAdministrator::Instance().GetLogger()->AddErrorLog("Deserialize: Throw to deserialize logic(%s).", "ModelRender");
@@ -156,11 +170,15 @@ ResistModelRender::ResistModelRender()
                     else if (auto sp{ FlResourceAdministrator::Instance().GetByGuid<ModelData>(c->m_path) })
                         c->m_spModel = sp;
                     else FlEditorAdministrator::Instance().GetLogger()->AddWarningLog("Failed Load Model %s", c->m_path.c_str());
+
+                    PrepareOccluder(c);
                 }
 
+                if (ImGui::Checkbox("Occluder", &c->m_isOccluder)) PrepareOccluder(c);
+
                 if (c->m_spModel)
                 {
-                    auto kNodes{ c->m_spModel->GetNodes() };
+                    const auto& kNodes{ c->m_spModel->GetNodes() };
                     if (kNodes.empty()) return;
 
                     for (int32_t i = 0; i < kNodes.size(); ++i) {
@@ -194,8 +212,12 @@ ResistModelRender::ResistModelRender()
 
                 if (c->m_path.empty() || !c->m_spModel) return;
 
+                // FlScene Ŕς݂̎EIN[WJO
+                const auto& culler{ FlFrustumCuller::Instance() };
+                if (!culler.IsEntityVisible(id) || !FlOcclusionCuller::Instance().IsEntityVisible(id)) return;
+
                 Shader::Instance().DrawModel(*c->m_spModel,
-                    tcp->m_transform->GetWorldMatrix());
+                    tcp->m_transform->GetWorldMatrix(), culler.GetNodeVisibility(id));
             }
             catch (...) {
                 FlEditorAdministrator::Instance().GetLogger()->AddErrorLog("Update: Throw to update logic(%s).", "ModelRender");
@@ -4,4 +4,5 @@ struct ModelRenderComponent
 {
 	std::string m_path;
 	std::shared_ptr<ModelData> m_spModel;
+	bool m_isOccluder{ false };	// IN[WJO̎ՕƂĎg
 };
\ No newline at end of file
@@ -45,7 +45,11 @@ ResistTransform::ResistTransform()
                     return nullptr;
                 }
                 auto c{ static_cast<TransformComponent*>(component) };
-                return new TransformComponent(*c);
+
+                // m_transform LƕЕ𓮂ɂЕ̂Œgƕ
+                auto copy{ new TransformComponent(*c) };
+                if (c->m_transform) copy->m_transform = std::make_shared<FlTransform>(*c->m_transform);
+                return copy;
             }
             catch (...) {
                 FlEditorAdministrator::Instance().GetLogger()->AddErrorLog("Copy: Throw to copy component(%s).", "TransformComponent");
@@ -218,6 +222,34 @@ ResistTransform::ResistTransform()
 
                 auto& ecs{ FlEntityComponentSystemKernel::Instance() };
 
+                // O Update 珑 Transformiłi񂾎Wߒj
+                static auto changedSince  { UINT64_MAX };
+                static auto changedVersion{ Def::ULongLongZero };
+                static auto isRemoved     { false };
+                static auto changed       { std::vector<entityId>{} };
+
+                const auto since         { FlEntityComponentSystemKernel::GetLastUpdateVersion() };
+                const auto storageVersion{ ecs.GetStorageVersion("Transform") };
+                if (since != Def::ULongLongZero && storageVersion > since && (since != changedSince || storageVersion != changedVersion))
+                {
+                    changed.clear();
+                    isRemoved = !ecs.CollectChangedEntities("Transform", since, changed) || ecs.GetRemovedVersion("Transform") > since;
+                    std::ranges::sort(changed);
+                    changedSince   = since;
+                    changedVersion = storageVersion;
+                }
+
+                // gEeς炸AOꂽ Transform ΐeq͕tȂ
+                // itƖt[q̃[hs񂪍蒼ɂȂj
+                const auto isChanged{ [&](entityId e) { return std::ranges::binary_search(changed, e); } };
+                const auto isUnchanged{ since != Def::ULongLongZero && (storageVersion <= since ||
+                    (!isRemoved && !isChanged(id) && (c->m_parent == UINT32_MAX || !isChanged(c->m_parent)))) };
+                if (isUnchanged)
+                {
+                    tf->GetWorldMatrix();
+                    return;
+                }
+
                 // --- eݒ ---
                 if (c->m_parent != UINT32_MAX)
                 {
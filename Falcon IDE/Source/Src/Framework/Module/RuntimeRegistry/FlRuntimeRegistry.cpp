@@ -1,10 +1,10 @@
 #include "FlRuntimeRegistry.h"
 
-// L[
+// L[iDLLER|[lg͓o^ɔԍ֒uj
 struct RegKey {
-    std::string dll;
+    uint32_t dll;
     uint32_t entityId;
-    std::string comp;
+    uint32_t comp;
     bool operator==(RegKey const& o) const noexcept {
         return dll == o.dll && entityId == o.entityId && comp == o.comp;
     }
@@ -13,13 +13,9 @@ struct RegKey {
 // <functionoid:functor> Custom Hash for RegKey
 struct RegKeyHash {
     std::size_t operator()(RegKey const& k) const noexcept {
-        std::size_t h1 = std::hash<std::string>{}(k.dll);
-        std::size_t h2 = std::hash<uint32_t>{}(k.entityId);
-        std::size_t h3 = std::hash<std::string>{}(k.comp);
-
-        std::size_t seed = h1;
-        seed ^= h2 + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
-        seed ^= h3 + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+        std::size_t seed = std::hash<uint32_t>{}(k.entityId);
+        seed ^= std::hash<uint32_t>{}(k.dll)  + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+        seed ^= std::hash<uint32_t>{}(k.comp) + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
         return seed;
     }
 };
@@ -36,68 +32,186 @@ struct SystemEntry {
     SystemLogics* funcs;   // DLL擾֐|C^Q
 };
 
-// }bv: RegKey -> void* (|C^ DLL Ǘ)
+// O̔ԍixo^O͉ړȂ̂ c_str() ͂ƗLj
+// O͌Œ蒷̉ɒǋL邾Ȃ̂ŁAԍ疼O Name ̓bNȂ
+class NameTable {
+public:
+    static constexpr auto Invalid{ UINT32_MAX };
+
+    // o^ł閼Os Invalid
+    uint32_t Intern(const char* name) {
+        const auto view{ std::string_view{ name } };
+        {
+            std::shared_lock lk(m_mutex);
+            if (auto it = m_ids.find(view); it != m_ids.end()) return it->second;
+        }
+        std::unique_lock lk(m_mutex);
+        if (auto it = m_ids.find(view); it != m_ids.end()) return it->second;
+
+        const auto id{ m_count };
+        if (id >= ChunkCount * ChunkSize) return Invalid;
+
+        auto& upChunk = m_chunks[id / ChunkSize];
+        if (!upChunk) upChunk = std::make_unique<std::string[]>(ChunkSize);
+
+        auto& stored = upChunk[id % ChunkSize];
+        stored.assign(view);
+        m_ids.emplace(stored, id);
+        ++m_count;
+        return id;
+    }
+
+    // o^Ȃ Invalidiŕ\𑝂₳Ȃj
+    uint32_t Find(const char* name) const {
+        std::shared_lock lk(m_mutex);
+        auto it = m_ids.find(std::string_view{ name });
+        return it == m_ids.end() ? Invalid : it->second;
+    }
+
+    // id  Intern Ԃ́Bo^\̃V[h̃bNʂĎ󂯎̂ŁA݂͌Ă
+    const char* Name(uint32_t id) const noexcept {
+        return m_chunks[id / ChunkSize][id % ChunkSize].c_str();
+    }
+
+private:
+    static constexpr uint32_t ChunkSize { 256U };
+    static constexpr uint32_t ChunkCount{ 256U };
+
+    mutable std::shared_mutex m_mutex;
+    std::array<std::unique_ptr<std::string[]>, ChunkCount> m_chunks; // mۂ͓Ȃ
+    std::unordered_map<std::string_view, uint32_t> m_ids;
+    uint32_t m_count = 0U;
+};
+
+// GeBeBIDŕo^\B񋓁EDLLPʂ͍̉猋ʂ̕H
+struct RegistryShard {
+    std::shared_mutex mutex;
+    std::unordered_map<RegKey, void*, RegKeyHash> components;
+    std::unordered_map<uint32_t, std::vector<RegKey>> byEntity;                      // entityId  o^
+    std::unordered_map<uint32_t, std::unordered_set<RegKey, RegKeyHash>> byDll;      // dll  o^
+};
+
+static constexpr auto RegistryShardBits { 4U };
+static constexpr auto RegistryShardCount{ 1U << RegistryShardBits };
+
 static std::unordered_map<std::string, ComponentFuncs> g_loadedDllFuncs;
-static std::unordered_map<RegKey, void*, RegKeyHash> g_registry;
-static std::mutex g_registryMutex;
+static NameTable g_dllNames;
+static NameTable g_componentNames;
+static std::array<RegistryShard, RegistryShardCount> g_registry;
 
+static std::mutex g_systemMutex;
 static std::unordered_map<std::string, SystemEntry> g_systems;
 
+// 񋓒̃XbhLbNĂV[hiR[obN̍ē𔻒肷j
+static thread_local const RegistryShard* t_enumeratingShard{ nullptr };
+
+struct EnumerationScope {
+    explicit EnumerationScope(const RegistryShard& shard) noexcept { t_enumeratingShard = &shard; }
+    ~EnumerationScope() noexcept { t_enumeratingShard = nullptr; }
+};
+
 // wp[
-static RegKey MakeKey(const char* dllName, uint32_t entityId, const char* compName) {
-    return RegKey{ dllName ? dllName : "", entityId, compName ? compName : "" };
+static RegistryShard& ShardOf(uint32_t entityId) {
+    // AԂIDł΂Ȃ悤ZnbV̏ʃrbgőI
+    return g_registry[(entityId * 0x9e3779b1U) >> (32U - RegistryShardBits)];
+}
+
+static void EraseFromIndices(RegistryShard& shard, RegKey const& k) {
+    if (auto it = shard.byEntity.find(k.entityId); it != shard.byEntity.end()) {
+        auto& keys = it->second;
+        if (auto found = std::find(keys.begin(), keys.end(), k); found != keys.end()) {
+            *found = keys.back();
+            keys.pop_back();
+        }
+        if (keys.empty()) shard.byEntity.erase(it);
+    }
+    if (auto it = shard.byDll.find(k.dll); it != shard.byDll.end()) {
+        it->second.erase(k);
+        if (it->second.empty()) shard.byDll.erase(it);
+    }
 }
 
 extern "C" {
 
     int Runtime_RegisterComponent(const char* dllName, uint32_t entityId, const char* componentName, void* ptr) {
         if (!dllName || !componentName || !ptr) return -1;
-        std::lock_guard<std::mutex> lk(g_registryMutex);
-        RegKey k = MakeKey(dllName, entityId, componentName);
+        if (t_enumeratingShard) return -3;
+        RegKey k{ g_dllNames.Intern(dllName), entityId, g_componentNames.Intern(componentName) };
+        if (k.dll == NameTable::Invalid || k.comp == NameTable::Invalid) return -1;
+
+        auto& shard = ShardOf(entityId);
+        std::unique_lock lk(shard.mutex);
         // ㏑֎~iɓo^ς݂ȂG[ɂjBKvłΏ㏑j
-        if (g_registry.find(k) != g_registry.end()) return -2;
-        g_registry.emplace(std::move(k), ptr);
+        if (!shard.components.try_emplace(k, ptr).second) return -2;
+        shard.byEntity[entityId].push_back(k);
+        shard.byDll[k.dll].insert(k);
         return 0;
     }
 
     int Runtime_UnregisterComponent(const char* dllName, uint32_t entityId, const char* componentName) {
         if (!dllName || !componentName) return -1;
-        std::lock_guard<std::mutex> lk(g_registryMutex);
-        RegKey k = MakeKey(dllName, entityId, componentName);
-        auto it = g_registry.find(k);
-        if (it == g_registry.end()) return -2;
-        g_registry.erase(it);
+        if (t_enumeratingShard) return -3;
+        RegKey k{ g_dllNames.Find(dllName), entityId, g_componentNames.Find(componentName) };
+        if (k.dll == NameTable::Invalid || k.comp == NameTable::Invalid) return -2;
+
+        auto& shard = ShardOf(entityId);
+        std::unique_lock lk(shard.mutex);
+        auto it = shard.components.find(k);
+        if (it == shard.components.end()) return -2;
+        shard.components.erase(it);
+        EraseFromIndices(shard, k);
         return 0;
     }
 
     void* Runtime_GetComponent(const char* dllName, uint32_t entityId, const char* componentName) {
         if (!dllName || !componentName) return nullptr;
-        std::lock_guard<std::mutex> lk(g_registryMutex);
-        RegKey k = MakeKey(dllName, entityId, componentName);
-        auto it = g_registry.find(k);
-        if (it == g_registry.end()) return nullptr;
+        RegKey k{ g_dllNames.Find(dllName), entityId, g_componentNames.Find(componentName) };
+        if (k.dll == NameTable::Invalid || k.comp == NameTable::Invalid) return nullptr;
+
+        auto& shard = ShardOf(entityId);
+        // 񋓒̓V[h͊ɋLbNς݁iċAIȋLbN͏ݑ҂Ǝ~܂j
+        std::shared_lock lk(shard.mutex, std::defer_lock);
+        if (t_enumeratingShard != &shard) lk.lock();
+        auto it = shard.components.find(k);
+        if (it == shard.components.end()) return nullptr;
         return it->second;
     }
 
     int Runtime_UnregisterAllForDll(const char* dllName) {
         if (!dllName) return -1;
-        std::lock_guard<std::mutex> lk(g_registryMutex);
-        std::vector<RegKey> toErase;
-        toErase.reserve(32);
-        for (auto& p : g_registry) {
-            if (p.first.dll == dllName) toErase.push_back(p.first);
+        if (t_enumeratingShard) return -3;
+        const auto dll = g_dllNames.Find(dllName);
+        if (dll == NameTable::Invalid) return 0;
+
+        for (auto& shard : g_registry) {
+            std::unique_lock lk(shard.mutex);
+            auto it = shard.byDll.find(dll);
+            if (it == shard.byDll.end()) continue;
+
+            // ƎoĂiEraseFromIndices  byDll G邽߁j
+            auto keys = std::move(it->second);
+            shard.byDll.erase(it);
+            for (auto& k : keys) {
+                shard.components.erase(k);
+                EraseFromIndices(shard, k);
+            }
         }
-        for (auto& k : toErase) g_registry.erase(k);
         return 0;
     }
 
     int Runtime_EnumerateComponentsForEntity(uint32_t entityId, RuntimeEnumCallback cb, void* user) {
         if (!cb) return -1;
-        std::lock_guard<std::mutex> lk(g_registryMutex);
-        for (auto& p : g_registry) {
-            if (p.first.entityId == entityId) {
-                cb(p.first.dll.c_str(), p.first.comp.c_str(), p.second, user);
-            }
+        if (t_enumeratingShard) return -3;
+
+        // 񋓂I܂ŋLbNAn|C^rŉEjȂ悤ɂ
+        auto& shard = ShardOf(entityId);
+        std::shared_lock lk(shard.mutex);
+        auto it = shard.byEntity.find(entityId);
+        if (it == shard.byEntity.end()) return 0;
+
+        EnumerationScope scope(shard);
+        for (auto& k : it->second) {
+            cb(g_dllNames.Name(k.dll), g_componentNames.Name(k.comp), shard.components.find(k)->second, user);
         }
         return 0;
     }
@@ -150,7 +264,11 @@ extern "C" {
         void* ptr = f.create(entityId);
         if (!ptr) return nullptr;
 
-        Runtime_RegisterComponent(dllName, entityId, componentName, ptr);
+        // o^łȂ΁i񋓒Eo^ς݁ĵԂȂ
+        if (Runtime_RegisterComponent(dllName, entityId, componentName, ptr) != 0) {
+            if (f.del) f.del(entityId, ptr);
+            return nullptr;
+        }
         return ptr;
     }
 
@@ -164,8 +282,8 @@ extern "C" {
         void* ptr = Runtime_GetComponent(dllName, entityId, componentName);
         if (!ptr) return -3;
 
-        // registry O
-        Runtime_UnregisterComponent(dllName, entityId, componentName);
+        // registry Oi񋓒ŊOȂΔjȂj
+        if (Runtime_UnregisterComponent(dllName, entityId, componentName) != 0) return -5;
 
         auto& f = it->second;
         if (!f.del) return -4;
@@ -178,7 +296,7 @@ extern "C" {
     {
         if (!dllName || !instance || !funcs) return -1;
 
-        std::lock_guard<std::mutex> lk(g_registryMutex);
+        std::lock_guard<std::mutex> lk(g_systemMutex);
 
         auto it = g_systems.find(dllName);
         if (it != g_systems.end()) {
@@ -198,7 +316,7 @@ extern "C" {
     {
         if (!dllName) return -1;
 
-        std::lock_guard<std::mutex> lk(g_registryMutex);
+        std::lock_guard<std::mutex> lk(g_systemMutex);
 
         auto it = g_systems.find(dllName);
         if (it == g_systems.end()) return -2;
@@ -218,7 +336,7 @@ extern "C" {
     {
         if (!dllName) return nullptr;
 
-        std::lock_guard<std::mutex> lk(g_registryMutex);
+        std::lock_guard<std::mutex> lk(g_systemMutex);
 
         auto it = g_systems.find(dllName);
         if (it == g_systems.end()) return nullptr;
@@ -35,6 +35,8 @@ extern "C" {
 	 EnumerateComponentsForEntity:
 	  - entityId ɕRÂo^ꗗ񋓂邽߂̃R[obNB
 	  - callback  (const char* dllName, const char* compName, void* ptr, void* user)
+	  - 񋓒͓o^\bNĂAptr  callback 𔲂܂ŉEjȂB
+	  - callback ł Runtime_GetComponent ĂׂBo^EEq̗񋓂 -3 ԂB
 	  - ߂: 񋓂ɐ 0
 	*/
 	using RuntimeEnumCallback = void(*)(const char*, const char*, void*, void*);
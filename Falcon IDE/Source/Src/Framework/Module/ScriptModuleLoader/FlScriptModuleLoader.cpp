@@ -1,5 +1,6 @@
 #include "FlScriptModuleLoader.h"
 #include "../../Core/FlEntityComponentSystemKernel.h"
+#include "../../Core/FlPrefabCache.h"
 
 #include "../../Application/Application.h"
 
@@ -48,13 +49,32 @@ static FlRuntimeAPI* CreateRuntimeAPI() noexcept // Wrap
             auto reflection{ static_cast<ComponentReflection*>(ref) };
             FlEntityComponentSystemKernel::Instance().RegisterModule(name, *reflection);
         };
-    api.AddComponent = [](const char* name, uint32_t e)
+    api.CreateEntity = []()
         {
+            return FlEntityComponentSystemKernel::Instance().CreateEntity();
+        };
+    api.DestroyEntity = [](uint32_t e)
+        {
+            // jς݂IDōėp̃GeBeBȂ
+            if (!FlEntityComponentSystemKernel::Instance().IsActive(e)) return;
+
+            // Update ̒ UpdateAll ̍Ō̔f܂Œx点i̎̂󂳂Ȃj
+            if (FlEntityComponentSystemKernel::IsUpdating()) FlEntityComponentSystemKernel::WorkCommandBuffer().DestroyEntity(e);
+            else                                             FlEntityComponentSystemKernel::Instance().DestroyEntity(e);
+        };
+    api.IsEntityAlive = [](uint32_t e)
+        {
+            return FlEntityComponentSystemKernel::Instance().IsActive(e);
+        };
+    api.AddComponent = [](const char* name, uint32_t e) -> void*
+        {
+            if (!FlEntityComponentSystemKernel::Instance().IsActive(e)) return nullptr;
             return FlEntityComponentSystemKernel::Instance().AddComponent(name, e);
         };
     api.RemoveComponent = [](const char* name, uint32_t e)
         {
-            FlEntityComponentSystemKernel::Instance().RemoveComponent(name, e);
+            if (FlEntityComponentSystemKernel::IsUpdating()) FlEntityComponentSystemKernel::WorkCommandBuffer().RemoveComponent(e, name);
+            else                                             FlEntityComponentSystemKernel::Instance().RemoveComponent(name, e);
         };
     api.GetComponent = [](const char* name, uint32_t e)
         {
@@ -64,6 +84,47 @@ static FlRuntimeAPI* CreateRuntimeAPI() noexcept // Wrap
         {
             return FlEntityComponentSystemKernel::Instance().HasComponent(name, e);
         };
+    api.RegisterQuery = [](const char* const* required, uint32_t requiredCount, const char* const* excluded, uint32_t excludedCount)
+        {
+            if (!required && requiredCount) return InvalidQueryId;
+            if (!excluded && excludedCount) return InvalidQueryId;
+
+            auto requiredTypes{ std::vector<std::string>{ required, required + requiredCount } };
+            auto excludedTypes{ std::vector<std::string>{ excluded, excluded + excludedCount } };
+            return FlEntityComponentSystemKernel::Instance().RegisterQuery(requiredTypes, excludedTypes);
+        };
+    api.GetQueryVersion = [](uint32_t query)
+        {
+            return FlEntityComponentSystemKernel::Instance().GetQueryVersion(query);
+        };
+    api.CopyQuery = [](uint32_t query, uint64_t* outVersion, uint32_t* outWidth, uint32_t* outEntities, void** outComponents, uint32_t capacity)
+        {
+            return FlEntityComponentSystemKernel::Instance().CopyQuery(query, outVersion, outWidth, outEntities, outComponents, capacity);
+        };
+    api.WorkComponent = [](const char* name, uint32_t e)
+        {
+            return FlEntityComponentSystemKernel::Instance().WorkComponent(name, e);
+        };
+    api.MarkComponentChanged = [](const char* name, uint32_t e)
+        {
+            FlEntityComponentSystemKernel::Instance().MarkComponentChanged(name, e);
+        };
+    api.GetChangeVersion = []()
+        {
+            return FlEntityComponentSystemKernel::Instance().GetChangeVersion();
+        };
+    api.GetComponentVersion = [](const char* name, uint32_t e)
+        {
+            return FlEntityComponentSystemKernel::Instance().GetComponentVersion(name, e);
+        };
+    api.GetLastUpdateVersion = []()
+        {
+            return FlEntityComponentSystemKernel::GetLastUpdateVersion();
+        };
+    api.CopyChangedRows = [](uint32_t query, uint64_t since, uint32_t* outEntities, uint32_t capacity)
+        {
+            return FlEntityComponentSystemKernel::Instance().CopyChangedRows(query, since, outEntities, capacity);
+        };
     api.ToLogInfo = [](const char* fmt, ...)
         {
             auto args{ va_list{} };
@@ -283,6 +344,9 @@ void FlScriptModuleLoader::Unload(ScriptModule& m) noexcept
 
 void FlScriptModuleLoader::UnloadAll() noexcept
 {
+    // vnu̐` DLL  Destroy ĝŐɔj
+    FlPrefabCache::Instance().Clear();
+
     for (auto& m : m_modules)
         Unload(m);
 }
@@ -291,8 +355,8 @@ void FlScriptModuleLoader::HotReload(ScriptModule& m) noexcept
 {
     FlEditorAdministrator::Instance().GetLogger()->AddLog("HotReload: %s", m.moduleName.c_str());
 
-    // V[VACYăf[^ێ
-    auto temp{ FlEntityComponentSystemKernel::Instance().SerializeScene() };
+    // V[VACYăf[^ێiゾȂ̂Ŗk̃oCij
+    auto temp{ FlEntityComponentSystemKernel::Instance().SerializeSceneBinary(false) };
 
     // V DLL VhERs[ĐɃ[h
     if (!std::filesystem::exists(m.originalDllPath)) {
@@ -390,7 +454,7 @@ void FlScriptModuleLoader::HotReload(ScriptModule& m) noexcept
         }
     }
 
-    FlEntityComponentSystemKernel::Instance().DeserializeScene(temp);
+    FlEntityComponentSystemKernel::Instance().DeserializeSceneBinary(temp);
 }
 
 bool FlScriptModuleLoader::GetLastWriteTime(const std::filesystem::path& p, FILETIME& out) noexcept
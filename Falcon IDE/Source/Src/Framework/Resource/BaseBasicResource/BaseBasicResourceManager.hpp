@@ -9,7 +9,7 @@ public:
 
     virtual const bool Load(const std::string& path)PURE;
 
-   const std::shared_ptr<T> Get(const std::string& path, const std::string& guid) noexcept
+   const std::shared_ptr<T> Get(const std::string& path, const FlGuid& guid) noexcept
    {
        // }bvpX
        auto it{ m_resources.find(guid) };
@@ -26,6 +26,6 @@ public:
 
    void Clear() { m_resources.clear(); }
 protected:
-    // t@CpXL[ɁA\[X̋L|C^Ǘ}bv
-    std::unordered_map<std::string, std::shared_ptr<T>> m_resources;
+    // GUIDL[ɁA\[X̋L|C^Ǘ}bv
+    FlTrackedUnorderedMap<FlGuid, std::shared_ptr<T>, FlMemoryTag::Resource> m_resources;
 };
\ No newline at end of file
@@ -18,7 +18,7 @@ public:
 	{
 		{
 			auto it{ m_dataCache.find(filename) };
-			if (it != m_dataCache.end()) return std::static_pointer_cast<std::vector<T>>(it->second);
+			if (it != m_dataCache.end()) return std::static_pointer_cast<std::vector<T>>(it->second.spData);
 		}
 
 		auto newData{ std::make_shared<std::vector<T>>() };
@@ -26,7 +26,7 @@ public:
 
 		if (m_accessor.Load(filename, *newData, elementsNum)) 
 		{
-			m_dataCache[filename] = newData;
+			Cache(filename, newData);
 			return newData;
 		}
 		return nullptr;
@@ -44,7 +44,7 @@ public:
 	{
 		if (m_accessor.Save(filename, data)) 
 		{
-			m_dataCache[filename] = std::make_shared<std::vector<_T>>(data);
+			Cache(filename, std::make_shared<std::vector<_T>>(data));
 			return true;
 		}
 		return false;
@@ -73,6 +73,21 @@ private:
 	FlBinaryManager(const FlBinaryManager&)			   = delete;
 	FlBinaryManager& operator=(const FlBinaryManager&) = delete;
 
+	// LbVĂԂvf̗̈ BinaryCache ֐
+	struct CacheEntry
+	{
+		std::shared_ptr<void> spData;
+		FlMemoryCharge		  charge{ FlMemoryTag::BinaryCache };
+	};
+
+	template <typename T>
+	void Cache(const std::string& filename, const std::shared_ptr<std::vector<T>>& spData)
+	{
+		auto& entry{ m_dataCache[filename] };
+		entry.spData = spData;
+		entry.charge.Set(spData->capacity() * sizeof(T));
+	}
+
 	FlBinaryAccessor m_accessor;
-	std::unordered_map<std::string, std::shared_ptr<void>> m_dataCache;
+	FlTrackedUnorderedMap<std::string, CacheEntry, FlMemoryTag::BinaryCache> m_dataCache;
 };
@@ -0,0 +1,167 @@
+#pragma once
+
+/// <summary>
+/// LZ4 ubN`̃oCg񈳏k
+/// g[N(4bit:e / 4bit:v-4) + e + 16bit ̌JԂŁA
+/// WJ̓Rs[Ȃ̂œǂݍ݂x܂B
+/// </summary>
+class FlBlockCompressor
+{
+public:
+
+	/// <summary>
+	/// k܂BkĂȂȂꍇʂ͕Ԃ܂BiĂяoŃTCYrj
+	/// </summary>
+	static std::vector<uint8_t> Compress(const uint8_t* src, const size_t size)
+	{
+		auto dst{ std::vector<uint8_t>{} };
+		dst.reserve(size + size / 255 + 16);
+
+		auto table{ std::vector<uint32_t>(HashTableSize, UINT32_MAX) };
+
+		auto anchor{ size_t{} };
+		auto pos   { size_t{} };
+
+		//  LastLiterals oCg͕KeAv͏I[ MatchSafeDistance O܂
+		const auto matchLimit{ size > MatchSafeDistance ? size - MatchSafeDistance : size_t{} };
+		while (pos < matchLimit)
+		{
+			const auto sequence{ Read32(src + pos) };
+			const auto hash    { Hash(sequence) };
+			const auto candidate{ table[hash] };
+			table[hash] = static_cast<uint32_t>(pos);
+
+			if (candidate == UINT32_MAX || pos - candidate > MaxDistance || Read32(src + candidate) != sequence)
+			{
+				++pos;
+				continue;
+			}
+
+			// vL΂
+			auto matchLength{ MinMatch };
+			const auto maxLength{ size - LastLiterals - pos };
+			while (matchLength < maxLength && src[candidate + matchLength] == src[pos + matchLength]) ++matchLength;
+
+			WriteSequence(dst, src + anchor, pos - anchor, static_cast<uint16_t>(pos - candidate), matchLength);
+
+			pos	  += matchLength;
+			anchor = pos;
+		}
+
+		// c̓ê
+		WriteLiterals(dst, src + anchor, size - anchor);
+		return dst;
+	}
+
+	/// <summary>
+	/// WJ܂BWJ̃TCY rawSize ƈvȂEĂꍇ false
+	/// irawSize  size WJ傫𒴂ꍇAmۂ falsej
+	/// </summary>
+	static bool Decompress(const uint8_t* src, const size_t size, std::vector<uint8_t>& out, const size_t rawSize)
+	{
+		if (rawSize > GetMaxRawSize(size)) return false;
+		out.resize(rawSize);
+
+		auto ip{ size_t{} };
+		auto op{ size_t{} };
+		while (ip < size)
+		{
+			const auto token{ src[ip++] };
+
+			// e
+			auto literalLength{ static_cast<size_t>(token >> 4) };
+			if (literalLength == 15 && !ReadLength(src, size, ip, literalLength)) return false;
+			if (ip + literalLength > size || op + literalLength > rawSize) return false;
+
+			if (literalLength != 0) std::memcpy(out.data() + op, src + ip, literalLength);
+			ip += literalLength;
+			op += literalLength;
+
+			// Ō̃V[PX̓e
+			if (ip == size) break;
+
+			// v
+			if (ip + 2 > size) return false;
+			const auto distance{ static_cast<size_t>(src[ip] | (src[ip + 1] << 8)) };
+			ip += 2;
+			if (distance == 0 || distance > op) return false;
+
+			auto matchLength{ static_cast<size_t>(token & 0x0F) };
+			if (matchLength == 15 && !ReadLength(src, size, ip, matchLength)) return false;
+			matchLength += MinMatch;
+			if (op + matchLength > rawSize) return false;
+
+			// dȂ肪̂őO1oCgi\Ȃ܂Ƃ߂āj
+			auto* pOut{ out.data() };
+			if (distance >= matchLength) std::memcpy(pOut + op, pOut + op - distance, matchLength);
+			else for (auto i{ size_t{} }; i < matchLength; ++i) pOut[op + i] = pOut[op - distance + i];
+			op += matchLength;
+		}
+		return op == rawSize;
+	}
+
+private:
+
+	static constexpr size_t   MinMatch          = 4;
+	static constexpr size_t   LastLiterals      = 5;
+	static constexpr size_t   MatchSafeDistance = 12;
+	static constexpr size_t   MaxDistance       = 65535;
+	static constexpr uint32_t HashBits          = 16;
+	static constexpr size_t   HashTableSize     = size_t{ 1 } << HashBits;
+
+	// 1oCg\v͍X 255 Ȃ̂ŁAWJ͂𒴂Ȃ
+	static constexpr size_t GetMaxRawSize(const size_t size) noexcept
+	{
+		return size > SIZE_MAX / 256 ? SIZE_MAX : size * 256;
+	}
+
+	static uint32_t Read32(const uint8_t* p) noexcept
+	{
+		auto value{ uint32_t{} };
+		std::memcpy(&value, p, sizeof(value));
+		return value;
+	}
+
+	static uint32_t Hash(const uint32_t sequence) noexcept
+	{
+		return (sequence * 2654435761U) >> (32 - HashBits);
+	}
+
+	static void WriteLength(std::vector<uint8_t>& dst, size_t length)
+	{
+		for (; length >= 255; length -= 255) dst.push_back(255);
+		dst.push_back(static_cast<uint8_t>(length));
+	}
+
+	static bool ReadLength(const uint8_t* src, const size_t size, size_t& ip, size_t& length) noexcept
+	{
+		for (;;)
+		{
+			if (ip >= size) return false;
+			const auto b{ src[ip++] };
+			length += b;
+			if (b != 255) return true;
+		}
+	}
+
+	static void WriteSequence(std::vector<uint8_t>& dst, const uint8_t* literals, const size_t literalLength, const uint16_t distance, const size_t matchLength)
+	{
+		const auto matchCode{ matchLength - MinMatch };
+		dst.push_back(static_cast<uint8_t>((std::min<size_t>(literalLength, 15) << 4) | std::min<size_t>(matchCode, 15)));
+
+		if (literalLength >= 15) WriteLength(dst, literalLength - 15);
+		dst.insert(dst.end(), literals, literals + literalLength);
+
+		dst.push_back(static_cast<uint8_t>(distance & 0xFF));
+		dst.push_back(static_cast<uint8_t>(distance >> 8));
+
+		if (matchCode >= 15) WriteLength(dst, matchCode - 15);
+	}
+
+	static void WriteLiterals(std::vector<uint8_t>& dst, const uint8_t* literals, const size_t literalLength)
+	{
+		dst.push_back(static_cast<uint8_t>(std::min<size_t>(literalLength, 15) << 4));
+		if (literalLength >= 15) WriteLength(dst, literalLength - 15);
+		dst.insert(dst.end(), literals, literals + literalLength);
+	}
+};
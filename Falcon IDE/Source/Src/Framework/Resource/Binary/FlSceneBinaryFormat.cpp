@@ -0,0 +1,350 @@
+#include "FlSceneBinaryFormat.h"
+
+namespace
+{
+	constexpr uint32_t MakeTag(const char a, const char b, const char c, const char d) noexcept
+	{
+		return static_cast<uint32_t>(a) | (static_cast<uint32_t>(b) << 8) | (static_cast<uint32_t>(c) << 16) | (static_cast<uint32_t>(d) << 24);
+	}
+
+	constexpr auto TagStrings	 { MakeTag('S', 'T', 'R', 'S') };
+	constexpr auto TagEntities	 { MakeTag('E', 'N', 'T', 'S') };
+	constexpr auto TagTypes		 { MakeTag('T', 'Y', 'P', 'S') };
+	constexpr auto TagComponents { MakeTag('C', 'O', 'M', 'P') };
+	constexpr auto TagPrefabs	 { MakeTag('P', 'R', 'F', 'B') };
+
+	constexpr auto ChunkCompressed{ Def::UIntOne };
+
+	// 擪̌Œ蕔iłオđ headerSize œǂݔ΂j
+	struct FileHeader
+	{
+		uint32_t magic;
+		uint16_t versionMajor;
+		uint16_t versionMinor;
+		uint32_t headerSize;
+		uint32_t flags;
+		uint32_t chunkCount;
+		uint32_t entityCount;
+	};
+
+	struct ChunkHeader
+	{
+		uint32_t tag;
+		uint32_t flags;
+		uint32_t storedSize;
+		uint32_t rawSize;
+	};
+
+	class ByteWriter
+	{
+	public:
+		template<typename T>
+		void Write(const T& value)
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+			const auto* p{ reinterpret_cast<const uint8_t*>(&value) };
+			m_bytes.insert(m_bytes.end(), p, p + sizeof(T));
+		}
+
+		template<typename T>
+		void WriteArray(const std::vector<T>& values)
+		{
+			const auto* p{ reinterpret_cast<const uint8_t*>(values.data()) };
+			m_bytes.insert(m_bytes.end(), p, p + values.size() * sizeof(T));
+		}
+
+		void WriteBytes(const uint8_t* p, const size_t size) { m_bytes.insert(m_bytes.end(), p, p + size); }
+
+		auto& GetBytes() noexcept { return m_bytes; }
+
+	private:
+		std::vector<uint8_t> m_bytes;
+	};
+
+	class ByteReader
+	{
+	public:
+		explicit ByteReader(std::span<const uint8_t> bytes) : m_bytes{ bytes } {}
+
+		template<typename T>
+		bool Read(T& value) noexcept
+		{
+			if (m_pos + sizeof(T) > m_bytes.size()) return false;
+			std::memcpy(&value, m_bytes.data() + m_pos, sizeof(T));
+			m_pos += sizeof(T);
+			return true;
+		}
+
+		template<typename T>
+		bool ReadArray(std::vector<T>& values, const size_t count)
+		{
+			if (count > GetRemaining() / sizeof(T)) return false;
+			values.resize(count);
+			if (count != 0) std::memcpy(values.data(), m_bytes.data() + m_pos, count * sizeof(T));
+			m_pos += count * sizeof(T);
+			return true;
+		}
+
+		bool ReadSpan(std::span<const uint8_t>& out, const size_t size) noexcept
+		{
+			if (size > m_bytes.size() - m_pos) return false;
+			out = m_bytes.subspan(m_pos, size);
+			m_pos += size;
+			return true;
+		}
+
+		bool Skip(const size_t size) noexcept
+		{
+			if (size > m_bytes.size() - m_pos) return false;
+			m_pos += size;
+			return true;
+		}
+
+		// c̃oCgiMĊmۂOɏm߂j
+		const auto GetRemaining() const noexcept { return m_bytes.size() - m_pos; }
+
+	private:
+		std::span<const uint8_t> m_bytes;
+		size_t					 m_pos = Def::ULongLongZero;
+	};
+
+	void AppendChunk(ByteWriter& file, const uint32_t tag, std::vector<uint8_t>&& body, const bool isCompress)
+	{
+		auto header{ ChunkHeader{ tag, Def::UIntZero, static_cast<uint32_t>(body.size()), static_cast<uint32_t>(body.size()) } };
+
+		if (isCompress && !body.empty())
+		{
+			auto compressed{ FlBlockCompressor::Compress(body.data(), body.size()) };
+			if (compressed.size() < body.size())
+			{
+				header.flags	  |= ChunkCompressed;
+				header.storedSize  = static_cast<uint32_t>(compressed.size());
+				body			   = std::move(compressed);
+			}
+		}
+
+		file.Write(header);
+		file.WriteBytes(body.data(), body.size());
+	}
+}
+
+uint32_t FlSceneBinaryFormat::Writer::AddType(const std::string& typeName)
+{
+	auto [it, isInserted] { m_typeIndices.try_emplace(typeName, static_cast<uint32_t>(m_scene.blocks.size())) };
+	if (isInserted) m_scene.blocks.emplace_back().typeName = typeName;
+	return it->second;
+}
+
+void FlSceneBinaryFormat::Writer::AddComponent(const uint32_t typeIndex, const entityId id, const std::vector<uint8_t>& data)
+{
+	auto& block{ m_scene.blocks[typeIndex] };
+	block.entities.push_back(id);
+	block.payload.insert(block.payload.end(), data.begin(), data.end());
+	block.offsets.push_back(static_cast<uint32_t>(block.payload.size()));
+}
+
+std::vector<uint8_t> FlSceneBinaryFormat::Writer::Finish(const bool isCompress) const
+{
+	auto file{ ByteWriter{} };
+
+	auto header{ FileHeader{} };
+	header.magic		= Magic;
+	header.versionMajor = VersionMajor;
+	header.versionMinor = VersionMinor;
+	header.headerSize	= sizeof(FileHeader);
+	header.flags		= isCompress ? ChunkCompressed : Def::UIntZero;
+	header.chunkCount	= static_cast<uint32_t>(3 + m_scene.blocks.size() + (m_scene.prefabs.empty() ? 0 : 1));
+	header.entityCount	= static_cast<uint32_t>(m_scene.entities.size());
+	file.Write(header);
+
+	// STRSi͌^Aԍ͌^ԍƓj
+	{
+		auto body{ ByteWriter{} };
+		body.Write(static_cast<uint32_t>(m_scene.blocks.size()));
+		for (const auto& block : m_scene.blocks)
+		{
+			body.Write(static_cast<uint32_t>(block.typeName.size()));
+			body.WriteBytes(reinterpret_cast<const uint8_t*>(block.typeName.data()), block.typeName.size());
+		}
+		AppendChunk(file, TagStrings, std::move(body.GetBytes()), isCompress);
+	}
+
+	// ENTS
+	{
+		auto body{ ByteWriter{} };
+		body.Write(static_cast<uint32_t>(m_scene.entities.size()));
+		body.WriteArray(m_scene.entities);
+		AppendChunk(file, TagEntities, std::move(body.GetBytes()), isCompress);
+	}
+
+	// TYPS
+	{
+		auto body{ ByteWriter{} };
+		body.Write(static_cast<uint32_t>(m_scene.blocks.size()));
+		for (auto i{ Def::UIntZero }; i < static_cast<uint32_t>(m_scene.blocks.size()); ++i)
+		{
+			body.Write(i);
+			body.Write(static_cast<uint32_t>(m_scene.blocks[i].entities.size()));
+		}
+		AppendChunk(file, TagTypes, std::move(body.GetBytes()), isCompress);
+	}
+
+	// COMPi^Ɓj
+	for (auto i{ Def::UIntZero }; i < static_cast<uint32_t>(m_scene.blocks.size()); ++i)
+	{
+		const auto& block{ m_scene.blocks[i] };
+
+		auto body{ ByteWriter{} };
+		body.Write(i);
+		body.Write(static_cast<uint32_t>(block.entities.size()));
+		body.WriteArray(block.entities);
+		body.WriteArray(block.offsets);
+		body.WriteArray(block.payload);
+		AppendChunk(file, TagComponents, std::move(body.GetBytes()), isCompress);
+	}
+
+	// PRFBig͉߂ɂ̂܂܎j
+	if (!m_scene.prefabs.empty())
+		AppendChunk(file, TagPrefabs, std::vector<uint8_t>{ m_scene.prefabs }, isCompress);
+
+	return std::move(file.GetBytes());
+}
+
+bool FlSceneBinaryFormat::IsBinaryScene(std::span<const uint8_t> bytes) noexcept
+{
+	auto magic{ uint32_t{} };
+	return ByteReader{ bytes }.Read(magic) && magic == Magic;
+}
+
+bool FlSceneBinaryFormat::Read(std::span<const uint8_t> bytes, SceneData& out)
+{
+	out = SceneData{};
+
+	auto file  { ByteReader{ bytes } };
+	auto header{ FileHeader{} };
+	if (!file.Read(header) || header.magic != Magic) return false;
+	if (header.versionMajor != VersionMajor)
+	{
+		FlEditorAdministrator::Instance().GetLogger()->AddErrorLog("Scene: Unsupported binary version %u.%u", header.versionMajor, header.versionMinor);
+		return false;
+	}
+	if (header.headerSize < sizeof(FileHeader) || !file.Skip(header.headerSize - sizeof(FileHeader))) return false;
+
+	auto strings	  { std::vector<std::string>{} };
+	auto typeStrings  { std::vector<uint32_t>{} };
+	auto compChunks	  { std::vector<std::vector<uint8_t>>{} };
+
+	auto raw{ std::vector<uint8_t>{} };
+	for (auto c{ Def::UIntZero }; c < header.chunkCount; ++c)
+	{
+		auto chunk{ ChunkHeader{} };
+		auto stored{ std::span<const uint8_t>{} };
+		if (!file.Read(chunk) || !file.ReadSpan(stored, chunk.storedSize)) return false;
+
+		// mȂ`N͓WJɔ΂
+		if (chunk.tag != TagStrings && chunk.tag != TagEntities && chunk.tag != TagTypes && chunk.tag != TagComponents && chunk.tag != TagPrefabs) continue;
+
+		auto body{ stored };
+		if (chunk.flags & ChunkCompressed)
+		{
+			if (!FlBlockCompressor::Decompress(stored.data(), stored.size(), raw, chunk.rawSize)) return false;
+			body = raw;
+		}
+
+		// ^\OɗĂǂ悤ACOMP ͌ł܂Ƃ߂đgݗĂ
+		if (chunk.tag == TagComponents)
+		{
+			compChunks.emplace_back(body.begin(), body.end());
+			continue;
+		}
+		if (chunk.tag == TagPrefabs)
+		{
+			out.prefabs.assign(body.begin(), body.end());
+			continue;
+		}
+
+		auto reader{ ByteReader{ body } };
+		auto count { uint32_t{} };
+		if (!reader.Read(count)) return false;
+
+		switch (chunk.tag)
+		{
+		case TagStrings:
+			// 1ɒ 4 oCg͗v̂ŁAc葽͉Ă
+			if (count > reader.GetRemaining() / sizeof(uint32_t)) return false;
+			strings.resize(count);
+			for (auto& str : strings)
+			{
+				auto length{ uint32_t{} };
+				auto span  { std::span<const uint8_t>{} };
+				if (!reader.Read(length) || !reader.ReadSpan(span, length)) return false;
+				str.assign(reinterpret_cast<const char*>(span.data()), span.size());
+			}
+			break;
+
+		case TagEntities:
+			if (!reader.ReadArray(out.entities, count)) return false;
+			break;
+
+		case TagTypes:
+			if (count > reader.GetRemaining() / (sizeof(uint32_t) * 2)) return false;
+			typeStrings.resize(count);
+			for (auto& stringIndex : typeStrings)
+			{
+				auto componentCount{ uint32_t{} };
+				if (!reader.Read(stringIndex) || !reader.Read(componentCount)) return false;
+			}
+			break;
+		}
+	}
+
+	out.blocks.resize(typeStrings.size());
+	for (auto i{ size_t{} }; i < typeStrings.size(); ++i)
+	{
+		if (typeStrings[i] >= strings.size()) return false;
+		out.blocks[i].typeName = strings[typeStrings[i]];
+	}
+
+	for (const auto& body : compChunks)
+	{
+		auto reader   { ByteReader{ body } };
+		auto typeIndex{ uint32_t{} };
+		auto count	  { uint32_t{} };
+		if (!reader.Read(typeIndex) || !reader.Read(count) || typeIndex >= out.blocks.size()) return false;
+
+		auto& block{ out.blocks[typeIndex] };
+		if (!reader.ReadArray(block.entities, count) || !reader.ReadArray(block.offsets, static_cast<size_t>(count) + Def::ULongLongOne)) return false;
+
+		// ItZbg͒P payload Ɏ܂邱ƁiɑmȂf[^͕ł̒ǉƂēǂݔ΂j
+		if (block.offsets.front() != Def::UIntZero || !std::is_sorted(block.offsets.begin(), block.offsets.end())) return false;
+		if (!reader.ReadArray(block.payload, block.offsets.back())) return false;
+	}
+	return true;
+}
+
+bool FlSceneBinaryFormat::SaveFile(const std::filesystem::path& path, const std::vector<uint8_t>& bytes) noexcept
+{
+	auto file{ std::ofstream{ path, std::ios::binary | std::ios::trunc } };
+	if (!file) return false;
+
+	file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+	file.close();
+	return !file.fail();
+}
+
+bool FlSceneBinaryFormat::LoadFile(const std::filesystem::path& path, std::vector<uint8_t>& bytes) noexcept
+{
+	try {
+		auto file{ std::ifstream{ path, std::ios::binary | std::ios::ate } };
+		if (!file) return false;
+
+		const auto size{ static_cast<size_t>(file.tellg()) };
+		file.seekg(0, std::ios::beg);
+
+		bytes.resize(size);
+		return static_cast<bool>(file.read(reinterpret_cast<char*>(bytes.data()), static_cast<std::streamsize>(size)));
+	}
+	catch (...) {
+		return false;
+	}
+}
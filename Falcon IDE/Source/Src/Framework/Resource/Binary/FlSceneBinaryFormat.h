@@ -0,0 +1,88 @@
+#pragma once
+
+#include "FlBlockCompressor.hpp"
+
+/// <summary>
+/// oCiV[` (.flsceneb)
+///
+/// [Header] 'FLSB' / (E) / tO / `N / GeBeB
+/// [Chunk]  ^O / tO(k) / i[TCY / WJTCY / { ̌JԂ
+///   STRS: \        ENTS: GeBeBID
+///   TYPS: R|[lg^\ (^̕ԍE)
+///   COMP: ^Ƃ̗ubN (^ԍEEIDEItZbgEMessagePack {)
+///   PRFB: vnũCX^X\ (MessagePackB 1 AΏȂ)
+///
+/// łႤt@C͓ǂ݂܂Bł̒ǉmȂ^Õ`N͓ǂݔ΂̂ŁA
+/// ÂǂݎłVt@Ci͈͂Łjǂ߂܂B
+/// </summary>
+namespace FlSceneBinaryFormat
+{
+	inline constexpr uint32_t Magic		   = 0x42534C46; // "FLSB"
+	inline constexpr uint16_t VersionMajor = 1;
+	inline constexpr uint16_t VersionMinor = 1;
+
+	/// <summary>
+	/// R|[lg^1̗
+	/// </summary>
+	struct ComponentBlock
+	{
+		std::string				typeName;
+		std::vector<entityId>	entities;
+		std::vector<uint32_t>	offsets{ Def::UIntZero }; // payload ̋؂i + 1j
+		std::vector<uint8_t>	payload;
+
+		/// <summary>
+		/// i Ԗڂ̃R|[lg MessagePack Ԃ܂B
+		/// </summary>
+		std::span<const uint8_t> GetData(const size_t i) const noexcept
+		{
+			return { payload.data() + offsets[i], offsets[i + 1] - offsets[i] };
+		}
+	};
+
+	/// <summary>
+	/// ǂݏV[̒g
+	/// </summary>
+	struct SceneData
+	{
+		std::vector<entityId>		entities;
+		std::vector<ComponentBlock> blocks;
+		std::vector<uint8_t>		prefabs; // FlPrefabCache::SerializeInstances  MessagePackiȂ疳j
+	};
+
+	class Writer
+	{
+	public:
+
+		void SetEntities(std::vector<entityId> entities) { m_scene.entities = std::move(entities); }
+
+		void SetPrefabs(std::vector<uint8_t> prefabs) { m_scene.prefabs = std::move(prefabs); }
+
+		/// <returns>^̔ԍiOȂ瓯ԍj</returns>
+		uint32_t AddType(const std::string& typeName);
+
+		void AddComponent(uint32_t typeIndex, entityId id, const std::vector<uint8_t>& data);
+
+		/// <summary>
+		/// oCgɂ܂BisCompress Ȃ珬Ȃ`Nk܂B
+		/// </summary>
+		std::vector<uint8_t> Finish(bool isCompress) const;
+
+	private:
+		SceneData m_scene;
+		std::unordered_map<std::string, uint32_t> m_typeIndices;
+	};
+
+	/// <summary>
+	/// 擪oCiV[`ǂ
+	/// </summary>
+	bool IsBinaryScene(std::span<const uint8_t> bytes) noexcept;
+
+	/// <summary>
+	/// ͂܂Bł̕svEj falseiout ͖`j
+	/// </summary>
+	bool Read(std::span<const uint8_t> bytes, SceneData& out);
+
+	bool SaveFile(const std::filesystem::path& path, const std::vector<uint8_t>& bytes) noexcept;
+	bool LoadFile(const std::filesystem::path& path, std::vector<uint8_t>& bytes) noexcept;
+}
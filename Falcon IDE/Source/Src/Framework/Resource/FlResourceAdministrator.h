@@ -53,8 +53,17 @@ public:
 		}
 	}
 
+	// GUIDiR|[lgɕۑꂽȂǁj
 	template<typename T>
-	const std::shared_ptr<T> GetByGuid(const std::string& guid)
+	const std::shared_ptr<T> GetByGuid(const std::string& strGuid)
+	{
+		auto guid{ FlGuid::Parse(strGuid) };
+		if (!guid.has_value()) return nullptr;
+		return GetByGuid<T>(guid.value());
+	}
+
+	template<typename T>
+	const std::shared_ptr<T> GetByGuid(const FlGuid& guid)
 	{
 		auto fullPath{ m_meta->FindAssetByGuid(guid) };
 		if (!fullPath.has_value()) return nullptr;
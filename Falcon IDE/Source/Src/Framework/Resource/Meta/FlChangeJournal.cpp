@@ -0,0 +1,135 @@
+#include "FlChangeJournal.h"
+
+namespace
+{
+	constexpr auto JournalVersion{ 1 };
+}
+
+FlChangeJournal::FlChangeJournal(std::filesystem::path journalPath)
+	: m_journalPath{ std::move(journalPath) }
+{
+	if (!m_journalPath.empty() && std::filesystem::exists(m_journalPath) && !Load())
+		FlEditorAdministrator::Instance().GetLogger()->AddWarningLog("Failed to Load ChangeJournal %s", m_journalPath.string().c_str());
+}
+
+void FlChangeJournal::Record(const std::filesystem::path& path, const Kind kind)
+{
+	auto key{ ToKey(path) };
+
+	std::lock_guard lock{ m_mutex };
+	const auto sequence{ m_sequence.load(std::memory_order_relaxed) + Def::ULongLongOne };
+
+	auto it{ m_entries.find(key) };
+	if (it == m_entries.end())
+	{
+		m_entries.emplace(key, Entry{ key, kind, sequence });
+	}
+	else
+	{
+		auto& entry{ it->second };
+		if (entry.kind == Kind::Created && kind == Kind::Erased)
+		{
+			// ďȂ牽Ƃɂ
+			m_entries.erase(it);
+		}
+		else
+		{
+			if (entry.kind == Kind::Erased && kind == Kind::Created) entry.kind = Kind::Modified;
+			else if (!(entry.kind == Kind::Created && kind == Kind::Modified)) entry.kind = kind;
+			entry.sequence = sequence;
+		}
+	}
+
+	m_isDirty = true;
+	m_sequence.store(sequence, std::memory_order_release);
+}
+
+std::vector<FlChangeJournal::Entry> FlChangeJournal::Collect(const uint64_t afterSequence) const
+{
+	auto entries{ std::vector<Entry>{} };
+	{
+		std::lock_guard lock{ m_mutex };
+		for (const auto& [key, entry] : m_entries)
+			if (entry.sequence > afterSequence) entries.push_back(entry);
+	}
+	std::ranges::sort(entries, {}, &Entry::sequence);
+	return entries;
+}
+
+bool FlChangeJournal::IsPending(const std::filesystem::path& path) const
+{
+	auto key{ ToKey(path) };
+
+	std::lock_guard lock{ m_mutex };
+	auto it{ m_entries.find(key) };
+	return it != m_entries.end() && it->second.kind != Kind::Erased;
+}
+
+void FlChangeJournal::Acknowledge(const std::filesystem::path& path, const uint64_t upToSequence)
+{
+	auto key{ ToKey(path) };
+
+	std::lock_guard lock{ m_mutex };
+	auto it{ m_entries.find(key) };
+	if (it == m_entries.end() || it->second.sequence > upToSequence) return;
+
+	m_entries.erase(it);
+	m_isDirty = true;
+}
+
+size_t FlChangeJournal::GetPendingCount() const
+{
+	std::lock_guard lock{ m_mutex };
+	return m_entries.size();
+}
+
+bool FlChangeJournal::Flush()
+{
+	if (m_journalPath.empty()) return true;
+
+	nlohmann::json json = nlohmann::json::object();
+	{
+		std::lock_guard lock{ m_mutex };
+		if (!m_isDirty) return true;
+
+		json["version"]  = JournalVersion;
+		json["sequence"] = m_sequence.load(std::memory_order_relaxed);
+		auto& entries{ json["entries"] = nlohmann::json::array() };
+		for (const auto& [key, entry] : m_entries)
+			entries.push_back({ { "path", entry.path }, { "kind", static_cast<uint32_t>(entry.kind) }, { "sequence", entry.sequence } });
+
+		m_isDirty = false;
+	}
+
+	if (FlJsonUtility::Serialize(json, m_journalPath)) return true;
+
+	FlEditorAdministrator::Instance().GetLogger()->AddErrorLog("Failed to Serialize ChangeJournal %s", m_journalPath.string().c_str());
+	std::lock_guard lock{ m_mutex };
+	m_isDirty = true;
+	return false;
+}
+
+bool FlChangeJournal::Load()
+{
+	nlohmann::json json = nlohmann::json::object();
+	if (!FlJsonUtility::Deserialize(json, m_journalPath)) return false;
+	if (json.value("version", Def::IntZero) != JournalVersion) return false;
+
+	std::lock_guard lock{ m_mutex };
+	m_entries.clear();
+	for (const auto& item : json.value("entries", nlohmann::json::array()))
+	{
+		auto entry{ Entry{} };
+		entry.path     = item.value("path", std::string{});
+		entry.kind     = static_cast<Kind>(item.value("kind", static_cast<uint32_t>(Kind::Modified)));
+		entry.sequence = item.value("sequence", Def::ULongLongZero);
+		if (entry.path.empty() || entry.kind > Kind::Erased) continue;
+
+		// ĂԂɏt@C̕ύX͎̂Ă
+		if (entry.kind != Kind::Erased && !std::filesystem::exists(entry.path)) continue;
+
+		m_entries.emplace(entry.path, std::move(entry));
+	}
+	m_sequence.store(json.value("sequence", Def::ULongLongZero), std::memory_order_release);
+	return true;
+}
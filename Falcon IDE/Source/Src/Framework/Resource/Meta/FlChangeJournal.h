@@ -0,0 +1,74 @@
+#pragma once
+
+/// <summary>
+/// t@CĎ̃Cxg𗭂߂ĂύXW[iłB
+/// pX̕ύX1ɂ܂Ƃ߁A Acknowledge ܂Ŏc܂B
+/// Flush Ńt@CɏôŁAGfB^Ă̕ύX͎Ɏz܂B
+/// Record ͊ĎXbhAȊO̓CXbhĂ΂OŃbNĂ܂B
+/// </summary>
+class FlChangeJournal
+{
+public:
+	enum class Kind : uint8_t
+	{
+		Created,
+		Modified,
+		Erased,
+	};
+
+	struct Entry
+	{
+		std::string path;
+		Kind        kind     = Kind::Modified;
+		uint64_t    sequence = Def::ULongLongZero; // ŌɋL^ꂽ̒ʂԍ
+	};
+
+	/// <param name="journalPath">ۑiȂۑȂj</param>
+	explicit FlChangeJournal(std::filesystem::path journalPath = {});
+	~FlChangeJournal() { Flush(); }
+
+	/// <summary>
+	/// ύXL^܂B
+	/// Created  Modified  Created ̂܂܁ACreated  Erased ͎AErased  Created  Modified ɂ܂Ƃ߂܂B
+	/// </summary>
+	void Record(const std::filesystem::path& path, Kind kind);
+
+	/// <summary>
+	/// ŌɋL^ʂԍBOƓȂVύX͖ibNœǂ߂܂j
+	/// </summary>
+	uint64_t GetSequence() const noexcept { return m_sequence.load(std::memory_order_acquire); }
+
+	/// <summary>
+	/// afterSequence ɋL^ꂽ̕ύXԂ܂Biʂԍj
+	/// </summary>
+	std::vector<Entry> Collect(uint64_t afterSequence = Def::ULongLongZero) const;
+
+	/// <summary>
+	/// ̕ύX邩iErased ͊܂݂܂j
+	/// </summary>
+	bool IsPending(const std::filesystem::path& path) const;
+
+	/// <summary>
+	/// ς݂ɂ܂BupToSequence ɋL^ꂽύX͎c܂B
+	/// </summary>
+	void Acknowledge(const std::filesystem::path& path, uint64_t upToSequence);
+
+	/// <summary>
+	/// ύX΃t@Cɏo܂B
+	/// </summary>
+	bool Flush();
+
+	size_t GetPendingCount() const;
+
+	static std::string ToKey(const std::filesystem::path& path) { return path.lexically_normal().generic_string(); }
+
+private:
+	bool Load();
+
+	std::filesystem::path m_journalPath;
+
+	mutable std::mutex                     m_mutex;
+	std::unordered_map<std::string, Entry> m_entries;
+	std::atomic<uint64_t>                  m_sequence{ Def::ULongLongZero };
+	bool                                   m_isDirty = false;
+};
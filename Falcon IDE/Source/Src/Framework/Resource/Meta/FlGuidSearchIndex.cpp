@@ -0,0 +1,203 @@
+#include "FlGuidSearchIndex.h"
+
+namespace
+{
+	std::string ToLower(std::string_view text)
+	{
+		auto lower{ std::string(text) };
+		for (auto& c : lower)
+			if (c >= 'A' && c <= 'Z') c = static_cast<char>(c - 'A' + 'a');
+		return lower;
+	}
+
+	std::string_view Trim(std::string_view text) noexcept
+	{
+		while (!text.empty() && text.front() == ' ') text.remove_prefix(1);
+		while (!text.empty() && text.back()  == ' ') text.remove_suffix(1);
+		return text;
+	}
+}
+
+void FlGuidSearchIndex::Build(std::vector<std::pair<FlGuid, std::string>> entries, const uint64_t version)
+{
+	std::ranges::sort(entries, [](const auto& a, const auto& b) {
+		return a.second != b.second ? a.second < b.second : a.first < b.first;
+		});
+
+	m_rows.clear();
+	m_rows.reserve(entries.size());
+	for (auto& [guid, path] : entries)
+	{
+		auto& added{ m_rows.emplace_back(Row{ guid.ToString(), std::move(path), {} }) };
+		added.lowerPath = ToLower(added.path);
+	}
+
+	BuildPostings(m_guidGrams, [](const Row& row) -> std::string_view { return row.guid; });
+	BuildPostings(m_pathGrams, [](const Row& row) -> std::string_view { return row.lowerPath; });
+
+	m_version   = version;
+	m_hasResult = false;
+}
+
+const std::array<uint8_t, 256> FlGuidSearchIndex::FoldTable{ [] {
+	auto table{ std::array<uint8_t, 256>{} };
+	table.fill(static_cast<uint8_t>((1u << CharBits) - 1));
+	for (auto c{ 'a' }; c <= 'z'; ++c) table[static_cast<uint8_t>(c)] = static_cast<uint8_t>(c - 'a');
+	for (auto c{ '0' }; c <= '9'; ++c) table[static_cast<uint8_t>(c)] = static_cast<uint8_t>(c - '0' + 26);
+	auto code{ uint8_t{ 36 } };
+	for (const auto c : { '.', '/', '\\', '_', '-', ' ', ':' }) table[static_cast<uint8_t>(c)] = code++;
+	return table;
+}() };
+
+template<class TextOf>
+void FlGuidSearchIndex::BuildPostings(Postings& postings, TextOf textOf) const
+{
+	// sœgxoĂ1Ɛ邽߁AŌɐsoĂ
+	auto lastRow{ std::vector<uint32_t>(GramCount, UINT32_MAX) };
+
+	postings.offsets.assign(GramCount + 1, Def::UIntZero);
+	for (auto row{ uint32_t{} }; row < m_rows.size(); ++row)
+	{
+		ForEachGram(textOf(m_rows[row]), [&](const uint32_t key) {
+			if (lastRow[key] == row) return;
+			lastRow[key] = row;
+			++postings.offsets[key + 1];
+			});
+	}
+	std::partial_sum(postings.offsets.begin(), postings.offsets.end(), postings.offsets.begin());
+
+	postings.rows.resize(postings.offsets.back());
+	auto cursor{ std::vector<uint32_t>(postings.offsets.begin(), postings.offsets.end() - 1) };
+	std::ranges::fill(lastRow, UINT32_MAX);
+	for (auto row{ uint32_t{} }; row < m_rows.size(); ++row)
+	{
+		ForEachGram(textOf(m_rows[row]), [&](const uint32_t key) {
+			if (lastRow[key] == row) return;
+			lastRow[key] = row;
+			postings.rows[cursor[key]++] = row;
+			});
+	}
+}
+
+const std::vector<uint32_t>& FlGuidSearchIndex::Query(std::string_view filter, const Field field)
+{
+	if (m_hasResult && m_lastVersion == m_version && m_lastField == field && m_lastFilter == filter) return m_result;
+
+	m_lastFilter  = filter;
+	m_lastField   = field;
+	m_lastVersion = m_version;
+	m_hasResult   = true;
+	m_result.clear();
+
+	const auto lowerFilter{ ToLower(filter) };
+	auto includes{ std::vector<std::string_view>{} };
+	auto excludes{ std::vector<std::string_view>{} };
+	for (auto rest{ std::string_view{ lowerFilter } }; ;)
+	{
+		const auto comma{ rest.find(',') };
+		auto term{ Trim(rest.substr(Def::ULongLongZero, comma)) };
+		if (!term.empty())
+		{
+			if (term.front() == '-')
+			{
+				term.remove_prefix(1);
+				if (!term.empty()) excludes.push_back(term);
+			}
+			else includes.push_back(term);
+		}
+		if (comma == std::string_view::npos) break;
+		rest.remove_prefix(comma + 1);
+	}
+
+	if (includes.empty())
+	{
+		m_result.resize(m_rows.size());
+		std::iota(m_result.begin(), m_result.end(), Def::UIntZero);
+	}
+	else
+	{
+		for (const auto& term : includes)
+			Match(term, field, m_result);
+
+		if (includes.size() > 1)
+		{
+			std::ranges::sort(m_result);
+			m_result.erase(std::unique(m_result.begin(), m_result.end()), m_result.end());
+		}
+	}
+
+	if (!excludes.empty())
+	{
+		std::erase_if(m_result, [&](const uint32_t row) {
+			return std::ranges::any_of(excludes, [&](const auto term) { return Contains(row, term, field); });
+			});
+	}
+
+	return m_result;
+}
+
+void FlGuidSearchIndex::Match(std::string_view term, const Field field, std::vector<uint32_t>& out) const
+{
+	const auto isGuid{ (static_cast<uint8_t>(field) & static_cast<uint8_t>(Field::Guid)) != 0 };
+	const auto isPath{ (static_cast<uint8_t>(field) & static_cast<uint8_t>(Field::Path)) != 0 };
+
+	if (isGuid && isPath)
+	{
+		auto matched{ std::vector<uint32_t>{} };
+		MatchField(term, m_guidGrams, true,  matched);
+		const auto guidCount{ matched.size() };
+		MatchField(term, m_pathGrams, false, matched);
+		std::inplace_merge(matched.begin(), matched.begin() + guidCount, matched.end());
+		matched.erase(std::unique(matched.begin(), matched.end()), matched.end());
+		out.insert(out.end(), matched.begin(), matched.end());
+	}
+	else if (isGuid) MatchField(term, m_guidGrams, true,  out);
+	else if (isPath) MatchField(term, m_pathGrams, false, out);
+}
+
+void FlGuidSearchIndex::MatchField(std::string_view term, const Postings& postings, const bool isGuid, std::vector<uint32_t>& out) const
+{
+	const auto text{ [&](const uint32_t row) -> std::string_view { return isGuid ? m_rows[row].guid : m_rows[row].lowerPath; } };
+
+	if (m_rows.empty()) return;
+
+	// Ȃ͑Ss𒲂ׂ
+	if (term.size() < GramLength)
+	{
+		for (auto row{ uint32_t{} }; row < m_rows.size(); ++row)
+			if (text(row).find(term) != std::string_view::npos) out.push_back(row);
+		return;
+	}
+
+	// ܂܂ 3g̍s̐ςAZɎĂ
+	auto lists{ std::vector<std::span<const uint32_t>>{} };
+	for (auto i{ size_t{} }; i + GramLength <= term.size(); ++i)
+	{
+		const auto list{ postings.Find(Gram(term.data() + i)) };
+		if (list.empty()) return;
+		lists.push_back(list);
+	}
+	std::ranges::sort(lists, {}, [](const auto& list) { return list.size(); });
+
+	auto candidates{ std::vector<uint32_t>(lists.front().begin(), lists.front().end()) };
+	auto next      { std::vector<uint32_t>{} };
+	for (auto i{ size_t{ 1 } }; i < lists.size() && !candidates.empty(); ++i)
+	{
+		if (lists[i].data() == lists[i - 1].data()) continue;
+		next.clear();
+		std::ranges::set_intersection(candidates, lists[i], std::back_inserter(next));
+		candidates.swap(next);
+	}
+
+	// gSĊ܂܂ĂсE񂾕ႤƂ̂Ŋm߂
+	for (const auto row : candidates)
+		if (text(row).find(term) != std::string_view::npos) out.push_back(row);
+}
+
+bool FlGuidSearchIndex::Contains(const uint32_t row, std::string_view term, const Field field) const noexcept
+{
+	const auto& target{ m_rows[row] };
+	if ((static_cast<uint8_t>(field) & static_cast<uint8_t>(Field::Guid)) && target.guid.find(term) != std::string::npos) return true;
+	if ((static_cast<uint8_t>(field) & static_cast<uint8_t>(Field::Path)) && target.lowerPath.find(term) != std::string::npos) return true;
+	return false;
+}
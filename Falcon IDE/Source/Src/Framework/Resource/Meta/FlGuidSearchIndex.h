@@ -0,0 +1,103 @@
+#pragma once
+
+/// <summary>
+/// GUID}bv̎ʂƁAvp 3gitrigramjłB
+/// ʂ GUID}bv̔łς蒼Aʂ͏ςvZ܂B
+/// ̏ ImGuiTextFilter Ɠi',' ؂͂ꂩA擪 '-' ͏OA啶͋ʂȂj
+/// </summary>
+class FlGuidSearchIndex
+{
+public:
+	enum class Field : uint8_t
+	{
+		Guid = Def::BitMaskPos1,
+		Path = Def::BitMaskPos2,
+		Both = Guid | Path,
+	};
+
+	/// <summary>
+	/// 蒼܂Bs̓pXɕт܂B
+	/// </summary>
+	/// <param name="version">FlMetaFileManager::GetGuidMapVersion ̒l</param>
+	void Build(std::vector<std::pair<FlGuid, std::string>> entries, uint64_t version);
+
+	/// <summary>
+	/// ɍsԍijBEłȂǑʂԂ܂B
+	/// </summary>
+	const std::vector<uint32_t>& Query(std::string_view filter, Field field);
+
+	const std::string& GetGuidString(const uint32_t row) const noexcept { return m_rows[row].guid; }
+	const std::string& GetPath      (const uint32_t row) const noexcept { return m_rows[row].path; }
+
+	auto GetVersion() const noexcept { return m_version; }
+	auto GetSize()    const noexcept { return m_rows.size(); }
+
+private:
+	struct Row
+	{
+		std::string guid;      // ̕\
+		std::string path;
+		std::string lowerPath;
+	};
+
+	// 3g  sԍijBoffsets[key]  offsets[key + 1] ܂ł key ̍s
+	struct Postings
+	{
+		std::vector<uint32_t> offsets;
+		std::vector<uint32_t> rows;
+
+		std::span<const uint32_t> Find(const uint32_t key) const noexcept
+		{
+			return { rows.data() + offsets[key], offsets[key + 1] - offsets[key] };
+		}
+	};
+
+	static constexpr size_t   GramLength = 3;
+	static constexpr uint32_t CharBits   = 6;
+	static constexpr uint32_t GramCount  = 1u << (CharBits * GramLength);
+
+	// 1 6bit ɏށipƋ؂L͋ʂAȊO͓lBႢ͏ƍŊm߂j
+	static const std::array<uint8_t, 256> FoldTable;
+
+	static uint32_t Fold(const char c) noexcept { return FoldTable[static_cast<uint8_t>(c)]; }
+
+	static uint32_t Gram(const char* p) noexcept
+	{
+		return (Fold(p[0]) << (CharBits * 2)) | (Fold(p[1]) << CharBits) | Fold(p[2]);
+	}
+
+	// text  3g visit ֓ni1炵ȂgݗĂj
+	template<class Visit>
+	static void ForEachGram(std::string_view text, Visit visit)
+	{
+		if (text.size() < GramLength) return;
+		auto key{ (Fold(text[0]) << CharBits) | Fold(text[1]) };
+		for (auto i{ GramLength - 1 }; i < text.size(); ++i)
+		{
+			key = ((key << CharBits) | Fold(text[i])) & (GramCount - 1);
+			visit(key);
+		}
+	}
+
+	// Ss 3g2񑖍ŐĂl߂
+	template<class TextOf>
+	void BuildPostings(Postings& postings, TextOf textOf) const;
+
+	// termij܂ލs out ɑ
+	void Match(std::string_view term, Field field, std::vector<uint32_t>& out) const;
+	void MatchField(std::string_view term, const Postings& postings, bool isGuid, std::vector<uint32_t>& out) const;
+
+	bool Contains(uint32_t row, std::string_view term, Field field) const noexcept;
+
+	std::vector<Row> m_rows;
+	Postings         m_guidGrams;
+	Postings         m_pathGrams;
+	uint64_t         m_version = Def::ULongLongZero;
+
+	// Ǒ
+	std::string           m_lastFilter;
+	Field                 m_lastField   = Field::Both;
+	uint64_t              m_lastVersion = Def::ULongLongZero;
+	bool                  m_hasResult   = false;
+	std::vector<uint32_t> m_result;
+};
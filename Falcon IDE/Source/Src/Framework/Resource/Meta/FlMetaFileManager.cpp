@@ -15,6 +15,10 @@ void FlMetaFileManager::StartMonitoring(const std::string& rootPath, int interva
 	m_rootPath = std::filesystem::path(rootPath);
 	std::filesystem::create_directories(m_rootPath);
 
+	// O܂łɏȂύXp
+	ExistsMetaFolder(GetMetaFolderPath(m_rootPath));
+	m_upJournal = std::make_unique<FlChangeJournal>(GetMetaFolderPath(m_rootPath) / "ChangeJournal.json");
+
 	// XL: ̃t@C/fBNgɃ^t@C쐬܂͍XV
 	for (const auto& entry : std::filesystem::recursive_directory_iterator(m_rootPath)) {
 		if (!IsInsideFlMeta(entry.path())) CreateOrUpdateFlMetaFile(entry.path());
@@ -63,7 +67,7 @@ void FlMetaFileManager::OnAssetRenamedOrMoved(const std::filesystem::path& oldPa
 	// GUID}bvXV
 	auto guid{ GetGuidFromMetaFile(newMetaFile.string()) };
 	if (guid.has_value())
-		m_guidMap[guid.value()] = newPath.string();
+		SetGuidPath(guid.value(), newPath.string());
 
 	// AZbgpXXV
 	auto metaJson{ nlohmann::json{} };
@@ -97,14 +101,15 @@ void FlMetaFileManager::IncrementLoadFlag(const std::string& assetPath)
 		FlEditorAdministrator::Instance().GetLogger()->AddErrorLog("Failed Serialize loadFlag %s", metaPath.string().c_str());
 }
 
-const std::optional<std::string> FlMetaFileManager::FindAssetByGuid(const std::string& guid) const
+const std::optional<std::string> FlMetaFileManager::FindAssetByGuid(const FlGuid& guid) const
 {
+	std::shared_lock lock{ m_guidMutex };
 	auto it{ m_guidMap.find(guid) };
 	if (it != m_guidMap.end()) return it->second;
 	else return std::nullopt;
 }
 
-const std::optional<std::string> FlMetaFileManager::FindGuidByAsset(const std::filesystem::path& path) const
+const std::optional<FlGuid> FlMetaFileManager::FindGuidByAsset(const std::filesystem::path& path) const
 {
 	auto metaFolder{ GetMetaFolderPath(path) };
 	auto metaFileName{ path.filename().string() + m_metaFileExtension };
@@ -190,13 +195,32 @@ void FlMetaFileManager::ResetAssetChangeFlag(const std::filesystem::path& assetP
 	else FlEditorAdministrator::Instance().GetLogger()->AddErrorLog("Failed to Deserialize isChanged %s", metaPath.string().c_str());
 }
 
+std::vector<std::pair<FlGuid, std::string>> FlMetaFileManager::SnapshotGuidMap() const
+{
+	std::shared_lock lock{ m_guidMutex };
+	auto snapshot{ std::vector<std::pair<FlGuid, std::string>>{} };
+	snapshot.reserve(m_guidMap.size());
+	for (const auto& [guid, path] : m_guidMap)
+		if (!path.empty()) snapshot.emplace_back(guid, path);
+	return snapshot;
+}
+
+void FlMetaFileManager::SetGuidPath(const FlGuid& guid, std::string path)
+{
+	std::unique_lock lock{ m_guidMutex };
+	auto& current{ m_guidMap[guid] };
+	if (current == path) return;
+	current = std::move(path);
+	m_guidMapVersion.fetch_add(Def::ULongLongOne, std::memory_order_release);
+}
+
 std::filesystem::path FlMetaFileManager::GetMetaFolderPath(const std::filesystem::path& assetPath) const
 {
 	if (assetPath == m_rootPath) return assetPath / ".FlMeta";
 	return assetPath.parent_path() / ".FlMeta";
 }
 
-const std::optional<std::string> FlMetaFileManager::GetGuidFromMetaFile(const std::string& metaPath) const
+const std::optional<FlGuid> FlMetaFileManager::GetGuidFromMetaFile(const std::string& metaPath) const
 {
 	auto metaJson{ nlohmann::json{} };
 	auto metaExists{ std::filesystem::exists(metaPath) };
@@ -208,7 +232,7 @@ const std::optional<std::string> FlMetaFileManager::GetGuidFromMetaFile(const st
 		else FlEditorAdministrator::Instance().GetLogger()->AddErrorLog("Failed to Deserialize Guid %s", metaPath.c_str());
 	}
 
-	if (!existingGuid.empty()) return existingGuid;
+	if (!existingGuid.empty()) return FlGuid::Parse(existingGuid);
 	else return std::nullopt;
 }
 
@@ -254,36 +278,26 @@ void FlMetaFileManager::CreateOrUpdateFlMetaFile(const std::filesystem::path& as
 	auto metaPath{ metaFolder / metaFileName };
 	// ̃^t@Cǂݍ
 	auto metaJson{ nlohmann::json{} };
-	auto existingGuid{ std::string{} };
+	auto existingGuid{ std::optional<FlGuid>{} };
 	auto metaExists{ std::filesystem::exists(metaPath) };
 	if (metaExists)
 	{
 		if (FlJsonUtility::Deserialize(metaJson, metaPath)) {
-			FlJsonUtility::GetValue(metaJson, "Guid", &existingGuid);
+			auto strGuid{ std::string{} };
+			FlJsonUtility::GetValue(metaJson, "Guid", &strGuid);
+			existingGuid = FlGuid::Parse(strGuid);
 			// ύXȂꍇXLbv
-			if (!IsAssetModified(assetPath, metaJson)) {
-				m_guidMap[existingGuid] = assetPath.string();
+			if (existingGuid && !IsAssetModified(assetPath, metaJson)) {
+				SetGuidPath(*existingGuid, assetPath.string());
 				return;
 			}
 		}
 		else FlEditorAdministrator::Instance().GetLogger()->AddErrorLog("Failed to Deserialize Guid %s", metaPath.string().c_str());
 	}
 	// GUIDݒî̂ێAȂΐVKj
-	if (existingGuid.empty())
-	{
-		auto guid{ FlGuid{} };
-		guid.NewGuid();
-
-		auto strGuid{ guid.ToString() };
-		metaJson["Guid"] = strGuid;
-
-		m_guidMap[strGuid] = assetPath.string();
-	}
-	else
-	{
-		metaJson["Guid"] = existingGuid;
-		m_guidMap[existingGuid] = assetPath.string();
-	}
+	const auto guid{ existingGuid ? *existingGuid : FlGuid{} };
+	metaJson["Guid"] = guid.ToString();
+	SetGuidPath(guid, assetPath.string());
 
 	// {ݒ
 	metaJson["assetPath"] = assetPath.u8string();
@@ -320,6 +334,9 @@ void FlMetaFileManager::CreateOrUpdateFlMetaFile(const std::filesystem::path& as
 	metaJson["loadFlag"] = false;
 	metaJson["isChanged"] = true;
 
+	if (m_upJournal && std::filesystem::is_regular_file(assetPath))
+		m_upJournal->Record(assetPath, metaExists ? FlChangeJournal::Kind::Modified : FlChangeJournal::Kind::Created);
+
 	// ^t@C
 	if(FlJsonUtility::Serialize(metaJson, metaPath))FlEditorAdministrator::Instance().GetLogger()->AddChangeLogU8(u8"Create/Update Meta: %s", metaPath.u8string().c_str());
 	else FlEditorAdministrator::Instance().GetLogger()->AddErrorLogU8(u8"Failed to Create/Update Meta: %s", metaPath.u8string().c_str());
@@ -341,11 +358,12 @@ void FlMetaFileManager::OnFileEvent(const std::filesystem::path& path, FlFileWat
 		if (std::filesystem::is_regular_file(path)) CreateOrUpdateFlMetaFile(path);
 		break;
 	case FlFileWatcher::FileStatus::Erased:
+		if (m_upJournal) m_upJournal->Record(path, FlChangeJournal::Kind::Erased);
 		{
 			auto metaPath{ GetMetaFolderPath(path) / (path.filename().string() + m_metaFileExtension) };
 
-			if(GetGuidFromMetaFile(metaPath.string()).has_value())
-				m_guidMap[GetGuidFromMetaFile(metaPath.string()).value()].clear();
+			if (auto guid{ GetGuidFromMetaFile(metaPath.string()) })
+				SetGuidPath(*guid, {});
 			else
 			{
 				auto isPathValid{ [](const std::string& p) {
@@ -361,9 +379,10 @@ void FlMetaFileManager::OnFileEvent(const std::filesystem::path& path, FlFileWat
 					} 
 				};
 
-				std::erase_if(m_guidMap, [isPathValid](const auto& pair) {
+				std::unique_lock lock{ m_guidMutex };
+				if (std::erase_if(m_guidMap, [isPathValid](const auto& pair) {
 					return !isPathValid(pair.second);
-				});
+				}) > 0) m_guidMapVersion.fetch_add(Def::ULongLongOne, std::memory_order_release);
 			}
 
 			if (std::filesystem::exists(metaPath)) m_fileWatcher.RemFile(metaPath);
@@ -1,4 +1,6 @@
 #pragma once
+#include "FlChangeJournal.h"
+#include "FlGuidSearchIndex.h"
 
 class FlMetaFileManager
 {
@@ -17,7 +19,11 @@ public:
 	/// <summary>
 	/// Ď~
 	/// </summary>
-	void StopMonitoring() { m_fileWatcher.Stop(); }
+	void StopMonitoring()
+	{
+		m_fileWatcher.Stop();
+		if (m_upJournal) m_upJournal->Flush();
+	}
 
 	/// <summary>
 	/// AZbgpXɑΉ.metat@C݂ȂꍇAVKɍ쐬
@@ -44,14 +50,14 @@ public:
 	/// </summary>
 	/// <param name="guid">GUID
 	/// <return>}b`pXiȂꍇ󕶎j</return>
-	const std::optional<std::string> FindAssetByGuid(const std::string& guid) const;
+	const std::optional<std::string> FindAssetByGuid(const FlGuid& guid) const;
 
 	/// <summary>
 	/// AZbgpXGUID
 	/// </summary>
 	/// <param name="path">AZbgpX
 	/// <return>GUIDiȂꍇ󕶎j</return>
-	const std::optional<std::string> FindGuidByAsset(const std::filesystem::path& path) const;
+	const std::optional<FlGuid> FindGuidByAsset(const std::filesystem::path& path) const;
 
 	/// <summary>
 	/// ĎΏۂ̃t@C̑SpXifBNgA^t@Cj
@@ -73,10 +79,21 @@ public:
 	void ResetAssetChangeFlag(const std::filesystem::path& assetPath);
 
 	/// <summary>
-	/// GUID}bv̎QƂ
+	/// GUID}bv̎ʂi폜ς݂ŋ̃pX͏j
 	/// </summary>
-	/// <returns>GUID}bv̎Q</returns>
-	const auto& GetGuidMap() const noexcept { return m_guidMap; }
+	/// <returns>GUIDƃpX̑gisj</returns>
+	std::vector<std::pair<FlGuid, std::string>> SnapshotGuidMap() const;
+
+	/// <summary>
+	/// GUID}bv̔ŁB}bvς邽тɑ̂ŁAʂ蒼̔Ɏg
+	/// </summary>
+	uint64_t GetGuidMapVersion() const noexcept { return m_guidMapVersion.load(std::memory_order_acquire); }
+
+	/// <summary>
+	/// Ď̃t@C̕ύXW[iiStartMonitoring O nullptrj
+	/// </summary>
+	/// <returns>[g .FlMeta ɕۑύXW[i</returns>
+	FlChangeJournal* GetChangeJournal() const noexcept { return m_upJournal.get(); }
 
 private:
 	/// <summary>
@@ -92,7 +109,7 @@ private:
 	/// <summary>
 	/// ^t@CGUID𒊏o
 	/// </summary>
-	const std::optional<std::string> GetGuidFromMetaFile(const std::string& metaPath) const;
+	const std::optional<FlGuid> GetGuidFromMetaFile(const std::string& metaPath) const;
 
 	/// <summary>
 	/// t@C܂̓fBNg̃^t@C쐬܂͍XV
@@ -115,10 +132,20 @@ private:
 	/// </summary>
 	void OnFileEvent(const std::filesystem::path& path, FlFileWatcher::FileStatus status);
 
+	/// <summary>
+	/// GUID}bvXVilςłi߂j
+	/// </summary>
+	void SetGuidPath(const FlGuid& guid, std::string path);
+
 	FlFileWatcher m_fileWatcher;
 	std::string m_metaFileExtension = ".flmeta";
 	std::filesystem::path m_rootPath;
 
-	// <K:GUID V:Path>
-	std::unordered_map<std::string, std::string> m_guidMap;
+	std::unique_ptr<FlChangeJournal> m_upJournal; // ^t@CXVt@CL^iĎ̂݁j
+
+	// <K:GUID V:Path> L[ 16oCg̒li񉻂̓^t@Cƕ\̎j
+	// ĎXbhAGfB^ǂނ̂ m_guidMutex ŕی삷
+	FlTrackedUnorderedMap<FlGuid, std::string, FlMemoryTag::Guid> m_guidMap;
+	mutable std::shared_mutex               m_guidMutex;
+	std::atomic<uint64_t>                   m_guidMapVersion{ Def::ULongLongZero };
 };
\ No newline at end of file
@@ -1,169 +1,730 @@
 #include "FlCppParser.h"
 
-bool FlSimpleCppParser::ParseFile(const std::string& path) noexcept
+std::shared_ptr<const CppFileIndex> FlCppDeclarationIndexer::IndexFile(const std::filesystem::path& path) noexcept
 {
-    std::ifstream ifs(path);
-    if (!ifs) return false;
+    try {
+        auto ec{ std::error_code{} };
+        const auto writeTime{ std::filesystem::last_write_time(path, ec) };
+        if (ec) return nullptr;
+        const auto size{ std::filesystem::file_size(path, ec) };
+        if (ec) return nullptr;
 
-    m_lines.clear();
+        // XVETCYȂǂݍ݂Ȃ
+        auto spCached{ std::shared_ptr<const CppFileIndex>{} };
+        {
+            auto lock{ std::lock_guard{ m_cacheMutex } };
+            if (auto it{ m_cache.find(path) }; it != m_cache.end())
+            {
+                if (it->second.writeTime == writeTime && it->second.size == size)
+                {
+                    m_cacheHitCount.fetch_add(Def::ULongLongOne, std::memory_order_relaxed);
+                    return it->second.spIndex;
+                }
+                spCached = it->second.spIndex;
+            }
+        }
 
-    std::string line;
-    while (std::getline(ifs, line)) {
-        m_lines.push_back(line);
-    }
+        auto ifs{ std::ifstream{ path, std::ios::binary } };
+        if (!ifs) return nullptr;
+        const auto source{ std::string{ std::istreambuf_iterator<char>{ ifs }, std::istreambuf_iterator<char>{} } };
 
-    Parse();
-    return true;
+        // ۑœeȂ͂Ȃ
+        const auto hash{ static_cast<uint64_t>(Str::StringToNumber(source)) };
+        auto spIndex{ std::shared_ptr<const CppFileIndex>{} };
+        if (spCached && spCached->contentHash == hash)
+        {
+            m_cacheHitCount.fetch_add(Def::ULongLongOne, std::memory_order_relaxed);
+            spIndex = spCached;
+        }
+        else spIndex = IndexSource(source);
+
+        auto lock{ std::lock_guard{ m_cacheMutex } };
+        m_cache[path] = CacheEntry{ writeTime, size, spIndex };
+        if (spIndex != spCached) m_parseCount.fetch_add(Def::ULongLongOne, std::memory_order_relaxed);
+        return spIndex;
+    }
+    catch (const std::exception& e) {
+        FlEditorAdministrator::Instance().GetLogger()->AddErrorLog("Error: Index C++ File %s  Path: %s", e.what(), path.string().c_str());
+        return nullptr;
+    }
 }
 
-void FlSimpleCppParser::Parse() noexcept
+std::shared_ptr<CppFileIndex> FlCppDeclarationIndexer::IndexSource(const std::string& source)
 {
-    m_structs.clear();
-    m_functions.clear();
+    auto spIndex{ std::make_shared<CppFileIndex>() };
+    spIndex->contentHash = static_cast<uint64_t>(Str::StringToNumber(source));
 
-    auto scope{ Def::IntZero };
-    for (auto i{ Def::ULongLongZero }; i < m_lines.size(); ++i)
+    // s͉sR[hĕێi{̂̍s؂o߁j
+    auto begin{ size_t{} };
+    while (begin <= source.size())
     {
-        const auto& l{ m_lines[i] };
+        auto end{ source.find('\n', begin) };
+        if (end == std::string::npos) end = source.size();
+
+        auto line{ source.substr(begin, end - begin) };
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        spIndex->lines.push_back(std::move(line));
+
+        begin = end + Def::ULongLongOne;
+    }
+
+    CollectDeclarations(source, Tokenize(source), *spIndex);
+    BuildModuleInfos(*spIndex);
+    return spIndex;
+}
+
+void FlCppDeclarationIndexer::Forget(const std::filesystem::path& path) noexcept
+{
+    auto lock{ std::lock_guard{ m_cacheMutex } };
+    m_cache.erase(path);
+}
+
+void FlCppDeclarationIndexer::ClearCache() noexcept
+{
+    auto lock{ std::lock_guard{ m_cacheMutex } };
+    m_cache.clear();
+}
+
+std::vector<FlCppDeclarationIndexer::Token> FlCppDeclarationIndexer::Tokenize(const std::string& source)
+{
+    auto tokens{ std::vector<Token>{} };
+    tokens.reserve(source.size() / 4U);
+
+    const auto size{ source.size() };
+    auto i		   { size_t{} };
+    auto line	   { Def::UIntZero };
+    auto lineStart { size_t{} };
+    auto isLineTop { true };	// s󔒂i# fBNeBuƂ݂Ȃj
+
+    // UTF-8 BOM
+    if (source.compare(0, 3, "\xEF\xBB\xBF") == 0) i = lineStart = 3;
 
-        // --- XR[vOiscope==0ĵƂɍ\̂֐o ---
-        if (scope == Def::IntZero)
+    const auto at{ [&source, size](const size_t pos) { return pos < size ? source[pos] : '\0'; } };
+    const auto newLine{ [&](const size_t next) { ++line; lineStart = next; } };
+
+    const auto isIdentChar{ [](const char c)
+        {
+            const auto u{ static_cast<unsigned char>(c) };
+            return std::isalnum(u) || c == '_' || u >= 0x80U;
+        } };
+
+    // spi\ + sjȂǂݔ΂ʒuԂ
+    const auto skipContinuation{ [&](size_t pos) -> size_t
         {
-            // struct / class / enum ̌o
+            if (at(pos) != '\\') return pos;
+            auto next{ pos + 1U };
+            if (at(next) == '\r') ++next;
+            if (at(next) != '\n') return pos;
+            newLine(next + 1U);
+            return next + 1U;
+        } };
+
+    const auto skipBlockComment{ [&](size_t pos)
+        {
+            pos += 2U;
+            while (pos < size && !(source[pos] == '*' && at(pos + 1U) == '/'))
             {
-                const std::regex re(R"REGEX((struct|class|enum)\s+([A-Za-z_]\w*))REGEX");
+                if (source[pos] == '\n') newLine(pos + 1U);
+                ++pos;
+            }
+            return std::min(pos + 2U, size);
+        } };
 
-                std::smatch m;
-                if (std::regex_search(l, m, re))
+    const auto skipLineComment{ [&](size_t pos)
+        {
+            while (pos < size && source[pos] != '\n')
+            {
+                if (const auto next{ skipContinuation(pos) }; next != pos) pos = next;
+                else ++pos;
+            }
+            return pos;
+        } };
+
+    // "..." / '...'iGXP[vlAsőł؂j
+    const auto skipQuoted{ [&](size_t pos, const char quote)
+        {
+            ++pos;
+            while (pos < size && source[pos] != quote && source[pos] != '\n')
+            {
+                if (source[pos] == '\\')
                 {
-                    //  "{" T
-                    size_t braceLine;
-                    size_t bracePos;
-                    if (FindNextBrace(i, braceLine, bracePos))
-                    {
-                        CppStructInfo info;
-                        info.name = m[2].str();
-                        ExtractScopeBlock(braceLine, bracePos, info.contentLines);
-                        m_structs.push_back(info);
-                    }
+                    if (const auto next{ skipContinuation(pos) }; next != pos) { pos = next; continue; }
+                    ++pos;
                 }
+                ++pos;
             }
+            return std::min(pos + 1U, size);
+        } };
 
-            // ֐`̌o
-            FindFunction(l, i);
-        }
+    // R"delim( ... )delim"
+    const auto skipRawString{ [&](size_t pos)
+        {
+            const auto open{ source.find('(', pos + 1U) };
+            if (open == std::string::npos) return size;
 
-        // --- XR[v̕ϓ ---
-        scope += Str::CountChar(l, '{');
-        scope -= Str::CountChar(l, '}');
-    }
-}
+            const auto terminator{ ")" + source.substr(pos + 1U, open - pos - 1U) + '"' };
+            auto close{ source.find(terminator, open + 1U) };
+            close = (close == std::string::npos) ? size : close + terminator.size();
 
-bool FlSimpleCppParser::FindNextBrace(size_t startLine, size_t& outLine, size_t& outPos) noexcept
-{
-    for (auto i{ startLine }; i < m_lines.size(); ++i)
+            for (auto p{ open }; p < close; ++p)
+                if (source[p] == '\n') newLine(p + 1U);
+            return close;
+        } };
+
+    const auto push{ [&](const TokenKind kind, const size_t begin, const size_t end, const char punct)
+        {
+            tokens.push_back(Token{ kind, punct, static_cast<uint32_t>(begin), static_cast<uint32_t>(end - begin),
+                line, static_cast<uint32_t>(begin - lineStart) });
+        } };
+
+    while (i < size)
     {
-        auto pos{ m_lines[i].find("{") };
-        if (pos != std::string::npos) {
-            outLine = i;
-            outPos = pos;
-            return true;
+        const auto c{ source[i] };
+
+        if (c == '\n') { newLine(++i); isLineTop = true; continue; }
+        if (std::isspace(static_cast<unsigned char>(c))) { ++i; continue; }
+        if (c == '\\') { if (const auto next{ skipContinuation(i) }; next != i) { i = next; continue; } }
+
+        if (c == '/' && at(i + 1U) == '/') { i = skipLineComment(i); continue; }
+        if (c == '/' && at(i + 1U) == '*') { i = skipBlockComment(i); continue; }
+
+        // vvZbTs͌psERg܂߂ĊۂƓǂݔ΂
+        if (c == '#' && isLineTop)
+        {
+            while (i < size && source[i] != '\n')
+            {
+                if (const auto next{ skipContinuation(i) }; next != i) { i = next; continue; }
+
+                if (source[i] == '/' && at(i + 1U) == '*') i = skipBlockComment(i);
+                else if (source[i] == '/' && at(i + 1U) == '/') i = skipLineComment(i);
+                else if (source[i] == '"' || source[i] == '\'') i = skipQuoted(i, source[i]);
+                else ++i;
+            }
+            continue;
         }
-    }
-    return false;
-}
 
-static std::string ExtractFunctionName(const std::string& line)
-{
-    // "(" ̈ʒu
-    size_t posParen = line.find("(");
-    if (posParen == std::string::npos) return "";
-
-    // "(" O̕𒊏o
-    std::string beforeParen = line.substr(0, posParen);
-
-    // sE̋󔒏
-    auto trim = [](std::string& s) {
-        s.erase(0, s.find_first_not_of(" \t\r\n"));
-        s.erase(s.find_last_not_of(" \t\r\n") + 1);
-        };
-    trim(beforeParen);
-
-    // Ō̋󔒂T  ̌낪֐
-    size_t lastSpace = beforeParen.find_last_of(" \t");
-    if (lastSpace == std::string::npos)
-    {
-        // 󔒂  ̂܂܊֐H
-        return beforeParen;
+        isLineTop = false;
+        const auto begin{ i };
+
+        if (isIdentChar(c) && !std::isdigit(static_cast<unsigned char>(c)))
+        {
+            while (i < size && isIdentChar(source[i])) ++i;
+
+            // 񃊃e̐ړiR / u8R / LR ... / u8 / L ...j
+            const auto prefix{ std::string_view{ source }.substr(begin, i - begin) };
+            if (at(i) == '"' && prefix.ends_with('R') &&
+                (prefix == "R" || prefix == "u8R" || prefix == "uR" || prefix == "UR" || prefix == "LR"))
+            {
+                i = skipRawString(i);
+                push(TokenKind::String, begin, i, '\0');
+                continue;
+            }
+            if ((at(i) == '"' || at(i) == '\'') && (prefix == "u8" || prefix == "u" || prefix == "U" || prefix == "L"))
+            {
+                const auto quote{ at(i) };
+                i = skipQuoted(i, quote);
+                push(quote == '"' ? TokenKind::String : TokenKind::Char, begin, i, '\0');
+                continue;
+            }
+
+            push(TokenKind::Identifier, begin, i, '\0');
+            continue;
+        }
+
+        if (std::isdigit(static_cast<unsigned char>(c)) || (c == '.' && std::isdigit(static_cast<unsigned char>(at(i + 1U)))))
+        {
+            // ؂i1'000jƎw̕܂߂
+            while (i < size)
+            {
+                const auto d{ source[i] };
+                if (isIdentChar(d) || d == '.') ++i;
+                else if (d == '\'' && isIdentChar(at(i + 1U))) ++i;
+                else if ((d == '+' || d == '-') && (std::tolower(static_cast<unsigned char>(source[i - 1U])) == 'e' ||
+                    std::tolower(static_cast<unsigned char>(source[i - 1U])) == 'p')) ++i;
+                else break;
+            }
+            push(TokenKind::Number, begin, i, '\0');
+            continue;
+        }
+
+        if (c == '"')  { i = skipQuoted(i, c); push(TokenKind::String, begin, i, '\0'); continue; }
+        if (c == '\'') { i = skipQuoted(i, c); push(TokenKind::Char,   begin, i, '\0'); continue; }
+
+        push(TokenKind::Punct, begin, ++i, c);
     }
 
-    return beforeParen.substr(lastSpace + 1);
+    return tokens;
 }
 
-void FlSimpleCppParser::FindFunction(const std::string& line, const size_t index) noexcept
+void FlCppDeclarationIndexer::CollectDeclarations(const std::string& source, const std::vector<Token>& tokens, CppFileIndex& index)
 {
-    if (line.find("(") != std::string::npos &&
-        line.find(")") != std::string::npos &&
-        line.find(";") == std::string::npos)
+    enum class ScopeKind : uint8_t
     {
-        std::string signature = line;
+        File,
+        Namespace,
+        Linkage,	// extern "C" { }
+        Class,
+        Enum,
+        Function,
+        Block,		// ֐̃ubN
+        Init,		// gʏqE_i̓rj
+    };
+
+    struct Scope
+    {
+        ScopeKind kind;
+        int32_t	  decl;
+        size_t	  outerStatement;	// Init Ƃɖ߂̊Jnʒu
+        bool	  isFunctionTry = false;	// ֐ try ubN̖{́Enh
+    };
+
+    const auto text{ [&source, &tokens](const size_t t) { return std::string_view{ source }.substr(tokens[t].offset, tokens[t].length); } };
+    const auto isPunct{ [&tokens](const size_t t, const char c) { return tokens[t].kind == TokenKind::Punct && tokens[t].punct == c; } };
+    const auto isWord{ [&tokens, &text](const size_t t, const std::string_view word)
+        {
+            return tokens[t].kind == TokenKind::Identifier && text(t) == word;
+        } };
+
+    // "::" ł͂ȂPƂ ':'
+    const auto isSingleColon{ [&](const size_t t, const size_t begin, const size_t end)
+        {
+            return isPunct(t, ':') && !(t > begin && isPunct(t - 1U, ':')) && !(t + 1U < end && isPunct(t + 1U, ':'));
+        } };
+
+    // g[NԂɋ󔒁ERg1̋󔒂ɂĘA
+    const auto joinTokens{ [&](const size_t begin, const size_t end)
+        {
+            auto result{ std::string{} };
+            for (auto t{ begin }; t < end; ++t)
+            {
+                if (t > begin && tokens[t].offset > tokens[t - 1U].offset + tokens[t - 1U].length) result += ' ';
+                result += text(t);
+            }
+            return result;
+        } };
+
+    // Etemplate<...>ECqȂǂ̑Ouǂݔ΂
+    const auto skipPrologue{ [&](size_t t, const size_t end)
+        {
+            while (t < end)
+            {
+                if (isPunct(t, '[') && t + 1U < end && isPunct(t + 1U, '['))
+                {
+                    auto depth{ Def::IntZero };
+                    for (; t < end; ++t)
+                    {
+                        if (isPunct(t, '[')) ++depth;
+                        else if (isPunct(t, ']') && --depth == Def::IntZero) { ++t; break; }
+                    }
+                }
+                else if (isWord(t, "template") && t + 1U < end && isPunct(t + 1U, '<'))
+                {
+                    auto depth{ Def::IntZero };
+                    for (++t; t < end; ++t)
+                    {
+                        if (isPunct(t, '<')) ++depth;
+                        else if (isPunct(t, '>') && --depth == Def::IntZero) { ++t; break; }
+                    }
+                }
+                else if (isWord(t, "export") || isWord(t, "inline") || isWord(t, "typedef")) ++t;
+                else break;
+            }
+            return t;
+        } };
+
+    // pʁEۊʂ̊Oɂŏ '('  '='
+    struct TopLevel { size_t paren; size_t assign; };
+    const auto findTopLevel{ [&](const size_t begin, const size_t end)
+        {
+            auto result	   { TopLevel{ end, end } };
+            auto angleDepth{ Def::IntZero };
+            auto parenDepth{ Def::IntZero };
+            for (auto t{ begin }; t < end; ++t)
+            {
+                if (tokens[t].kind != TokenKind::Punct) continue;
+                switch (tokens[t].punct)
+                {
+                case '<':
+                    // ev[giʎq > ̒ĵݐ
+                    if (t > begin && (tokens[t - 1U].kind == TokenKind::Identifier || isPunct(t - 1U, '>'))) ++angleDepth;
+                    break;
+                case '>':
+                    if (angleDepth > Def::IntZero && !(t > begin && isPunct(t - 1U, '-'))) --angleDepth;
+                    break;
+                case '(':
+                    if (parenDepth == Def::IntZero && angleDepth == Def::IntZero && result.paren == end) result.paren = t;
+                    ++parenDepth;
+                    break;
+                case ')':
+                    if (parenDepth > Def::IntZero) --parenDepth;
+                    break;
+                case '=':
+                    if (parenDepth == Def::IntZero && angleDepth == Def::IntZero && result.assign == end &&
+                        !(t + 1U < end && isPunct(t + 1U, '=')) && !(t > begin && (isPunct(t - 1U, '=') || isPunct(t - 1U, '!') ||
+                            isPunct(t - 1U, '<') || isPunct(t - 1U, '>'))))
+                        result.assign = t;
+                    break;
+                }
+            }
+            return result;
+        } };
 
-        // ---  "{" T ---
-        size_t braceLine;
-        size_t bracePos;
-        if (FindNextBrace(index, braceLine, bracePos))
+    const auto findCloseParen{ [&](size_t t, const size_t end)
         {
-            // u)vɁu{v or sɂꍇ̂݊֐m
-            if (braceLine == index)
+            auto depth{ Def::IntZero };
+            for (; t < end; ++t)
+            {
+                if (isPunct(t, '(')) ++depth;
+                else if (isPunct(t, ')') && --depth == Def::IntZero) return t;
+            }
+            return end;
+        } };
+
+    // ֐i'(' ̒OjBoperator / fXgN^ / CɑΉ
+    struct FunctionName { std::string name; std::string qualifier; size_t params; };
+    const auto readFunctionName{ [&](const size_t begin, size_t paren, const size_t end)
+        {
+            auto result{ FunctionName{ {}, {}, paren } };
+
+            // operator() ͍ŏ () Öꕔ
+            if (paren > begin && isWord(paren - 1U, "operator") && paren + 2U < end && isPunct(paren + 1U, ')'))
+            {
+                result.params = paren + 2U;
+                paren		  = paren + 2U;
+            }
+
+            auto nameBegin{ paren };
+            for (auto t{ paren }; t > begin && paren - t < 4U; --t)
+                if (isWord(t - 1U, "operator")) { nameBegin = t - 1U; break; }
+
+            if (nameBegin == paren && paren > begin)
+            {
+                nameBegin = paren - 1U;
+                if (nameBegin > begin && isPunct(nameBegin - 1U, '~')) --nameBegin;
+            }
+            result.name = joinTokens(nameBegin, paren);
+
+            // A::B<T>::
+            auto t{ nameBegin };
+            while (t >= begin + 2U && isPunct(t - 1U, ':') && isPunct(t - 2U, ':'))
             {
-                // s { 
-                if (bracePos > line.find(")"))
+                t -= 2U;
+                if (t > begin && isPunct(t - 1U, '>'))
                 {
-                    CppFunctionInfo info;
-                    info.name = ExtractFunctionName(signature);
-                    info.signature = signature;
-                    ExtractScopeBlock(braceLine, bracePos, info.contentLines);
-                    m_functions.push_back(info);
+                    auto depth{ Def::IntZero };
+                    while (t > begin)
+                    {
+                        --t;
+                        if (isPunct(t, '>')) ++depth;
+                        else if (isPunct(t, '<') && --depth == Def::IntZero) break;
+                    }
                 }
+                if (t > begin && tokens[t - 1U].kind == TokenKind::Identifier) --t;
+                else break;
+            }
+            if (t < nameBegin) result.qualifier = joinTokens(t, nameBegin - 2U);
+            return result;
+        } };
+
+    auto& declarations{ index.declarations };
+    auto  scopes	  { std::vector<Scope>{ Scope{ ScopeKind::File, -1, Def::ULongLongZero } } };
+    auto  statement	  { size_t{} };
+    auto  pendingType { -1 };	// ^錾i ';' ܂Ŕ͈͂L΂j
+    auto  tryFunction { -1 };	// {̂֐ try ubNi catch nh{̂Ɋ܂߂j
+
+    const auto setPosition{ [&tokens](const size_t t, uint32_t& line, uint32_t& column, const bool isEnd)
+        {
+            line   = tokens[t].line;
+            column = tokens[t].column + (isEnd ? tokens[t].length - Def::UIntOne : Def::UIntZero);
+        } };
+
+    const auto addDeclaration{ [&](const CppDeclarationKind kind, std::string name, const std::string& qualifier,
+        const size_t begin, const size_t end, const size_t signatureEnd)
+        {
+            auto decl{ CppDeclaration{} };
+            decl.kind	   = kind;
+            decl.name	   = std::move(name);
+            decl.signature = joinTokens(begin, signatureEnd);
+            decl.parent	   = scopes.back().decl;
+
+            auto prefix{ decl.parent >= 0 ? declarations[decl.parent].qualifiedName + "::" : std::string{} };
+            if (!qualifier.empty()) prefix += qualifier + "::";
+            decl.qualifiedName = prefix + decl.name;
+
+            setPosition(begin, decl.range.beginLine, decl.range.beginColumn, false);
+            setPosition(end - 1U, decl.range.endLine, decl.range.endColumn, true);
+
+            declarations.push_back(std::move(decl));
+            return static_cast<int32_t>(declarations.size() - 1U);
+        } };
+
+    // 񋓎qi"A = 1" ̐擪̎ʎqj
+    const auto addEnumerator{ [&](const size_t begin, const size_t end)
+        {
+            if (begin < end && tokens[begin].kind == TokenKind::Identifier)
+                addDeclaration(CppDeclarationKind::Member, std::string{ text(begin) }, {}, begin, begin + 1U, begin + 1U);
+        } };
+
+    // ';' ŏIioϐE֐錾j
+    const auto addStatement{ [&](const size_t begin, const size_t end)
+        {
+            auto t{ skipPrologue(begin, end) };
+            if (t >= end) return;
+
+            for (const auto word : { "using", "typedef", "friend", "static_assert", "namespace", "return",
+                "class", "struct", "union", "enum", "extern" })
+                if (isWord(t, word)) return;
+
+            const auto top{ findTopLevel(t, end) };
+            if (top.paren < end && top.paren < top.assign)
+            {
+                auto fn{ readFunctionName(t, top.paren, end) };
+                if (!fn.name.empty()) addDeclaration(CppDeclarationKind::Function, std::move(fn.name), fn.qualifier, begin, end + 1U, end);
+                return;
+            }
+
+            // OԒ̕ϐ͑ΏۊO
+            if (scopes.back().kind != ScopeKind::Class) return;
+
+            // 錾qƂɁiint a = 0, b[4], c : 3;j
+            auto declaratorBegin{ t };
+            auto depth			{ Def::IntZero };
+            for (auto p{ t }; p <= end; ++p)
+            {
+                const auto isEnd{ p == end };
+                if (!isEnd && tokens[p].kind == TokenKind::Punct)
+                {
+                    const auto c{ tokens[p].punct };
+                    if (c == '(' || c == '[' || c == '{' || c == '<') ++depth;
+                    else if ((c == ')' || c == ']' || c == '}' || c == '>') && depth > Def::IntZero) --depth;
+                }
+                if (!isEnd && !(depth == Def::IntZero && isPunct(p, ','))) continue;
+
+                // qEzErbgtB[h̎O̍Ō̎ʎq
+                auto nameToken{ end };
+                auto innerDepth{ Def::IntZero };
+                for (auto q{ declaratorBegin }; q < p; ++q)
+                {
+                    if (isPunct(q, '(') || isPunct(q, '[') || isPunct(q, '{') || isPunct(q, '<')) ++innerDepth;
+                    else if (isPunct(q, ')') || isPunct(q, ']') || isPunct(q, '}') || isPunct(q, '>')) innerDepth = std::max(innerDepth - 1, Def::IntZero);
+
+                    if (innerDepth == Def::IntZero && tokens[q].kind == TokenKind::Identifier) nameToken = q;
+                    if (innerDepth == Def::IntZero && (isPunct(q, '=') || isSingleColon(q, declaratorBegin, p))) break;
+                    if (isPunct(q, '[') || isPunct(q, '{')) break;
+                }
+                if (nameToken < end)
+                    addDeclaration(CppDeclarationKind::Member, std::string{ text(nameToken) }, {}, begin, end + 1U, end);
+
+                declaratorBegin = p + 1U;
+            }
+        } };
+
+    // '{' ̎O̕𕪗ނăXR[vς
+    const auto openScope{ [&](const size_t begin, const size_t brace)
+        {
+            auto t{ skipPrologue(begin, brace) };
+
+            const auto push{ [&](const ScopeKind kind, const int32_t decl)
+                {
+                    if (decl >= 0)
+                    {
+                        auto& d{ declarations[decl] };
+                        d.hasBody = true;
+                        setPosition(brace, d.body.beginLine, d.body.beginColumn, false);
+                    }
+                    scopes.push_back(Scope{ kind, decl, begin });
+                    statement = brace + 1U;
+                } };
+
+            if (t < brace && isWord(t, "namespace"))
+            {
+                const auto name{ joinTokens(t + 1U, brace) };
+                push(ScopeKind::Namespace, addDeclaration(CppDeclarationKind::Namespace, name, {}, begin, brace + 1U, brace));
+                return;
+            }
+            if (t + 1U < brace && isWord(t, "extern") && tokens[t + 1U].kind == TokenKind::String)
+            {
+                push(ScopeKind::Linkage, -1);
+                return;
+            }
+            if (t < brace && isWord(t, "enum"))
+            {
+                auto p{ t + 1U };
+                if (p < brace && (isWord(p, "class") || isWord(p, "struct"))) ++p;
+                p = skipPrologue(p, brace);
+
+                auto name{ std::string{} };
+                if (p < brace && tokens[p].kind == TokenKind::Identifier) name = text(p);
+                push(ScopeKind::Enum, addDeclaration(CppDeclarationKind::Enum, std::move(name), {}, begin, brace + 1U, brace));
+                return;
+            }
+
+            const auto top{ findTopLevel(t, brace) };
+
+            if (t < brace && (isWord(t, "class") || isWord(t, "struct") || isWord(t, "union")))
+            {
+                // O͊w ':' ̎O̍Ō̎ʎqialignas(...) / __declspec(...) / final ͏j
+                auto nameToken{ brace };
+                auto depth	  { Def::IntZero };
+                for (auto p{ t + 1U }; p < brace; ++p)
+                {
+                    if (isPunct(p, '(') || isPunct(p, '<') || isPunct(p, '[')) { ++depth; continue; }
+                    if (isPunct(p, ')') || isPunct(p, '>') || isPunct(p, ']')) { if (depth > Def::IntZero) --depth; continue; }
+                    if (depth > Def::IntZero) continue;
+                    if (isSingleColon(p, t, brace)) break;
+                    if (tokens[p].kind == TokenKind::Identifier && !isWord(p, "final") && !(p + 1U < brace && isPunct(p + 1U, '(')))
+                        nameToken = p;
+                }
+
+                const auto kind{ isWord(t, "class") ? CppDeclarationKind::Class :
+                    isWord(t, "struct") ? CppDeclarationKind::Struct : CppDeclarationKind::Union };
+                auto name{ nameToken < brace ? std::string{ text(nameToken) } : std::string{} };
+                push(ScopeKind::Class, addDeclaration(kind, std::move(name), {}, begin, brace + 1U, brace));
+                return;
+            }
+
+            // ʂE'=' igʏq⃉_j
+            if (top.paren == brace || top.assign < top.paren)
+            {
+                scopes.push_back(Scope{ ScopeKind::Init, -1, statement });
+                return;
+            }
+
+            // RXgN^q ": a{ 1 }"  '{' ͖{̂ł͂Ȃ
+            const auto close{ findCloseParen(top.paren, brace) };
+            for (auto p{ close }; p < brace; ++p)
+            {
+                if (!isSingleColon(p, close, brace)) continue;
+                if (tokens[brace - 1U].kind == TokenKind::Identifier || isPunct(brace - 1U, '>'))
+                {
+                    scopes.push_back(Scope{ ScopeKind::Init, -1, statement });
+                    return;
+                }
+                break;
+            }
+
+            // ֐ try ubNi"void f() try {" / "A() try : a{ 1 } {"j try ͐錾Ɋ܂߂Ȃ
+            auto tryToken{ brace };
+            for (auto p{ close }; p < brace && !isSingleColon(p, close, brace); ++p)
+                if (isWord(p, "try")) { tryToken = p; break; }
+
+            auto fn{ readFunctionName(t, top.paren, brace) };
+            push(ScopeKind::Function, addDeclaration(CppDeclarationKind::Function, std::move(fn.name), fn.qualifier, begin, brace + 1U, tryToken));
+            scopes.back().isFunctionTry = tryToken < brace;
+        } };
+
+    for (auto i{ size_t{} }; i < tokens.size(); ++i)
+    {
+        if (tokens[i].kind != TokenKind::Punct) continue;
+
+        const auto kind{ scopes.back().kind };
+        switch (tokens[i].punct)
+        {
+        case '{':
+            if (kind == ScopeKind::Function || kind == ScopeKind::Block)
+                scopes.push_back(Scope{ ScopeKind::Block, -1, statement });
+            else if (kind == ScopeKind::Init || kind == ScopeKind::Enum)
+                scopes.push_back(Scope{ ScopeKind::Init, -1, statement });
+            else if (tryFunction >= 0 && statement < i && isWord(statement, "catch"))
+            {
+                // ֐ try ubÑnh͓֐̖{̂̑
+                scopes.push_back(Scope{ ScopeKind::Function, tryFunction, statement, true });
+                statement = i + 1U;
             }
             else
             {
-                // { ̍sȍ~ɂiOKj
-                CppFunctionInfo info;
-                info.name = ExtractFunctionName(signature);
-                info.signature = signature;
-                ExtractScopeBlock(braceLine, bracePos, info.contentLines);
-                m_functions.push_back(info);
+                pendingType = -1;
+                tryFunction = -1;
+                openScope(statement, i);
             }
+            break;
+
+        case '}':
+        {
+            if (scopes.size() <= 1U) break;	// ΉȂ '}' ͖
+
+            if (kind == ScopeKind::Enum) addEnumerator(statement, i);
+
+            const auto scope{ scopes.back() };
+            scopes.pop_back();
+            tryFunction = scope.isFunctionTry ? scope.decl : -1;
+
+            if (scope.decl >= 0)
+            {
+                auto& d{ declarations[scope.decl] };
+                setPosition(i, d.body.endLine, d.body.endColumn, true);
+                setPosition(i, d.range.endLine, d.range.endColumn, true);
+
+                const auto declKind{ d.kind };
+                if (declKind == CppDeclarationKind::Class || declKind == CppDeclarationKind::Struct ||
+                    declKind == CppDeclarationKind::Union || declKind == CppDeclarationKind::Enum) pendingType = scope.decl;
+            }
+
+            statement = (scope.kind == ScopeKind::Init || scope.kind == ScopeKind::Block) ? scope.outerStatement : i + 1U;
+            break;
         }
-    }
-}
 
-void FlSimpleCppParser::ExtractScopeBlock(size_t braceLine, size_t bracePos, std::vector<std::string>& out) noexcept
-{
-    auto scope{ Def::IntZero };
-    auto started{ false };
+        case ';':
+            if (kind == ScopeKind::File || kind == ScopeKind::Namespace || kind == ScopeKind::Linkage || kind == ScopeKind::Class)
+            {
+                if (pendingType >= 0)
+                {
+                    setPosition(i, declarations[pendingType].range.endLine, declarations[pendingType].range.endColumn, true);
+                    pendingType = -1;
+                }
+                tryFunction = -1;
+                addStatement(statement, i);
+                statement = i + 1U;
+            }
+            break;
 
-    for (auto i{ braceLine }; i < m_lines.size(); ++i) {
-        const auto& l{ m_lines[i] };
+        case ':':
+            // ANZXwq
+            if (kind == ScopeKind::Class && i == statement + 1U &&
+                (isWord(statement, "public") || isWord(statement, "private") || isWord(statement, "protected")))
+                statement = i + 1U;
+            break;
 
-        // X^[gn_
-        if (!started)
-        {
-            if (i == braceLine) 
+        case ',':
+            if (kind == ScopeKind::Enum)
             {
-                scope += Def::IntOne; // ŏ "{"
-                started = true;
+                addEnumerator(statement, i);
+                statement = i + 1U;
             }
-            continue;
+            break;
         }
+    }
+}
 
-        // ubNJn̏
-        scope += Str::CountChar(l, '{');
-        scope -= Str::CountChar(l, '}');
+void FlCppDeclarationIndexer::BuildModuleInfos(CppFileIndex& index)
+{
+    const auto bodyLines{ [&index](const CppDeclaration& decl)
+        {
+            // "{" ̎̍s "}" ̍s܂Łi]̐؂oƓj
+            auto lines{ std::vector<std::string>{} };
+            for (auto l{ decl.body.beginLine + Def::UIntOne }; l <= decl.body.endLine && l < index.lines.size(); ++l)
+                lines.push_back(index.lines[l]);
+            return lines;
+        } };
 
-        out.push_back(l);
+    for (const auto& decl : index.declarations)
+    {
+        if (!decl.hasBody) continue;
+        if (decl.parent >= 0 && index.declarations[decl.parent].kind != CppDeclarationKind::Namespace) continue;
 
-        if (scope == Def::IntZero) return;
+        switch (decl.kind)
+        {
+        case CppDeclarationKind::Class:
+        case CppDeclarationKind::Struct:
+        case CppDeclarationKind::Union:
+        case CppDeclarationKind::Enum:
+            index.structs.push_back(CppStructInfo{ decl.name, bodyLines(decl) });
+            break;
+        case CppDeclarationKind::Function:
+            index.functions.push_back(CppFunctionInfo{ decl.name, decl.signature, bodyLines(decl) });
+            break;
+        default:
+            break;
+        }
     }
 }
@@ -1,5 +1,4 @@
 #pragma once
-#include <regex>
 
 struct CppStructInfo {
     std::string name;
@@ -12,29 +11,116 @@ struct CppFunctionInfo {
     std::vector<std::string> contentLines;
 };
 
-class FlSimpleCppParser
+// sE0n܂Aend ͍Ō̕܂ވʒu
+struct CppSourceRange {
+    uint32_t beginLine   = Def::UIntZero;
+    uint32_t beginColumn = Def::UIntZero;
+    uint32_t endLine     = Def::UIntZero;
+    uint32_t endColumn   = Def::UIntZero;
+};
+
+enum class CppDeclarationKind : uint32_t
+{
+    Namespace,
+    Class,
+    Struct,
+    Union,
+    Enum,
+    Function,   // `i{̂jƐ錾̗
+    Member,     // f[^oE񋓎q
+};
+
+struct CppDeclaration {
+    CppDeclarationKind kind = CppDeclarationKind::Member;
+    std::string name;
+    std::string qualifiedName;  // O̖OԁENX܂ޖO
+    std::string signature;      // 錾i{̂ "{" ̎O܂Łj
+    CppSourceRange range;       // 錾S
+    CppSourceRange body;        // "{" ` "}"ihasBody ̂Ƃ̂ݗLj
+    int32_t parent = -1;        // O̐錾̃CfbNX
+    bool hasBody = false;
+};
+
+// 1t@C̉͌ʁisρELbVPʁj
+struct CppFileIndex {
+    uint64_t contentHash = Def::ULongLongZero;
+    std::vector<std::string> lines;
+    std::vector<CppDeclaration> declarations;
+
+    // OԒ̌^E֐`iW[pj
+    std::vector<CppStructInfo> structs;
+    std::vector<CppFunctionInfo> functions;
+};
+
+/// <summary>
+/// ̓x[XC++錾CfNT
+/// RgEiraw܂ށjEvvZbTsǂݔ΂A1pXŐ錾W܂B
+/// t@Čʂ͓ẽnbVŕێAύXꂽt@C͂܂B
+/// </summary>
+class FlCppDeclarationIndexer
 {
 public:
-    bool ParseFile(const std::string& path) noexcept;
 
-    const std::vector<CppStructInfo>& GetStructs() const noexcept { return m_structs; }
-    const std::vector<CppFunctionInfo>& GetFunctions() const noexcept { return m_functions; }
+    /// <summary>
+    /// t@C͂܂BXVETCYEeOƓȂLbVԂ܂B
+    /// </summary>
+    /// <returns>ǂݍ߂Ȃꍇ nullptr</returns>
+    std::shared_ptr<const CppFileIndex> IndexFile(const std::filesystem::path& path) noexcept;
+
+    /// <summary>
+    /// \[X͂܂BiLbV܂j
+    /// </summary>
+    static std::shared_ptr<CppFileIndex> IndexSource(const std::string& source);
+
+    void Forget(const std::filesystem::path& path) noexcept;
+    void ClearCache() noexcept;
+
+    inline const auto GetParseCount()    const noexcept { return m_parseCount.load(std::memory_order_relaxed); }
+    inline const auto GetCacheHitCount() const noexcept { return m_cacheHitCount.load(std::memory_order_relaxed); }
 
 private:
-    void Parse() noexcept;
 
-    //  "{" Tisƈʒuj
-    bool FindNextBrace(size_t startLine, size_t& outLine, size_t& outPos) noexcept;
+    enum class TokenKind : uint8_t
+    {
+        Identifier,
+        Number,
+        String,
+        Char,
+        Punct,
+    };
+
+    struct Token
+    {
+        TokenKind kind;
+        char      punct;    // Punct ̂Ƃ̕i"::"  ':' 2j
+        uint32_t  offset;
+        uint32_t  length;
+        uint32_t  line;
+        uint32_t  column;
+    };
+
+    struct CacheEntry
+    {
+        std::filesystem::file_time_type     writeTime;
+        uintmax_t                           size = Def::ULongLongZero;
+        std::shared_ptr<const CppFileIndex> spIndex;
+    };
+
+    /// <summary>
+    /// RgEvvZbTsg[N܂B
+    /// </summary>
+    static std::vector<Token> Tokenize(const std::string& source);
 
-    // ֐`̌o
-    void FindFunction(const std::string& line,const size_t index) noexcept;
+    /// <summary>
+    /// XR[vX^bNȂg[N1xĐ錾W܂B
+    /// </summary>
+    static void CollectDeclarations(const std::string& source, const std::vector<Token>& tokens, CppFileIndex& index);
 
-    // `{` ̈ʒuΉ `}` ܂ł̃ubNo
-    void ExtractScopeBlock(size_t braceLine, size_t bracePos, std::vector<std::string>& out) noexcept;
+    static void BuildModuleInfos(CppFileIndex& index);
 
-    std::vector<std::string> m_lines;
+    std::mutex m_cacheMutex;
+    std::unordered_map<std::filesystem::path, CacheEntry> m_cache;
 
-    // 
-    std::vector<CppStructInfo> m_structs;
-    std::vector<CppFunctionInfo> m_functions;
+    std::atomic<uint64_t> m_parseCount{};
+    std::atomic<uint64_t> m_cacheHitCount{};
 };
@@ -0,0 +1,239 @@
+#include "FlAsyncLogBackend.h"
+
+FlAsyncLogBackend::FlAsyncLogBackend()
+{
+	m_writer = std::thread{ [this] { WriterLoop(); } };
+}
+
+FlAsyncLogBackend::~FlAsyncLogBackend()
+{
+	{
+		auto lock{ std::lock_guard{ m_wakeMutex } };
+		m_isRunning = false;
+	}
+	m_wake.notify_one();
+
+	// IOɎcoĂ~܂
+	if (m_writer.joinable()) m_writer.join();
+}
+
+FlAsyncLogBackend::FileId FlAsyncLogBackend::Open(const std::string_view& path)
+{
+	auto lock{ std::lock_guard{ m_filesMutex } };
+
+	const auto key{ std::string{ path } };
+	if (auto it{ m_fileIds.find(key) }; it != m_fileIds.end()) return it->second;
+
+	auto upFile{ std::make_unique<FileState>() };
+	upFile->path = std::filesystem::path{ key };
+	upFile->stream.open(upFile->path, std::ios::out | std::ios::app);
+	if (!upFile->stream) return InvalidFile;
+
+	auto ec{ std::error_code{} };
+	const auto size{ std::filesystem::file_size(upFile->path, ec) };
+	upFile->size = ec ? Def::ULongLongZero : static_cast<size_t>(size);
+
+	const auto id{ static_cast<FileId>(m_files.size()) };
+	m_files.push_back(std::move(upFile));
+	m_fileIds.emplace(key, id);
+	return id;
+}
+
+FlAsyncLogBackend::Staging& FlAsyncLogBackend::GetStaging()
+{
+	// XbhIɃobt@ic͏oXbhj
+	struct Holder
+	{
+		std::shared_ptr<Staging> spStaging;
+		~Holder() { if (spStaging) spStaging->isOrphaned.store(true, std::memory_order_release); }
+	};
+	thread_local auto holder{ Holder{} };
+
+	if (!holder.spStaging)
+	{
+		holder.spStaging = std::make_shared<Staging>();
+
+		auto lock{ std::lock_guard{ m_stagingMutex } };
+		m_stagings.push_back(holder.spStaging);
+	}
+	return *holder.spStaging;
+}
+
+void FlAsyncLogBackend::Write(const FileId id, std::string&& text)
+{
+	if (id == InvalidFile) return;
+
+	const auto bytes{ text.size() };
+	auto& staging{ GetStaging() };
+	{
+		auto lock{ std::lock_guard{ staging.mutex } };
+		staging.entries.emplace_back(id, std::move(text));
+	}
+
+	if (m_stagedBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes >= FlushBytes) m_wake.notify_one();
+}
+
+void FlAsyncLogBackend::Flush()
+{
+	auto lock{ std::unique_lock{ m_wakeMutex } };
+	if (!m_isRunning) return;
+
+	const auto generation{ ++m_requestedGeneration };
+	m_wake.notify_one();
+	m_flushed.wait(lock, [this, generation] { return m_completedGeneration >= generation || !m_isRunning; });
+}
+
+bool FlAsyncLogBackend::Close(const FileId id)
+{
+	if (id == InvalidFile) return false;
+	{
+		auto lock{ std::lock_guard{ m_filesMutex } };
+		if (id >= m_files.size() || !m_files[id]) return false;
+
+		// pXēx Open ꍇ͐VIDŊJ
+		std::erase_if(m_fileIds, [id](const auto& pair) { return pair.second == id; });
+		m_closeRequests.push_back(id);
+	}
+
+	// oXbhcĕ܂ő҂
+	Flush();
+
+	auto lock{ std::lock_guard{ m_filesMutex } };
+	const auto it{ m_closeResults.find(id) };
+	if (it == m_closeResults.end()) return false;
+
+	const auto isSucceeded{ it->second };
+	m_closeResults.erase(it);
+	return isSucceeded;
+}
+
+void FlAsyncLogBackend::WriterLoop()
+{
+	for (;;)
+	{
+		auto lock{ std::unique_lock{ m_wakeMutex } };
+		m_wake.wait_for(lock, FlushInterval, [this]
+			{
+				return !m_isRunning || m_requestedGeneration != m_completedGeneration ||
+					m_stagedBytes.load(std::memory_order_relaxed) >= FlushBytes;
+			});
+
+		const auto generation{ m_requestedGeneration };
+		const auto isRunning { m_isRunning };
+		lock.unlock();
+
+		// v͉̑OɎ󂯎ivOɐς܂ꂽsIĂj
+		auto closeRequests{ std::vector<FileId>{} };
+		{
+			auto filesLock{ std::lock_guard{ m_filesMutex } };
+			closeRequests.swap(m_closeRequests);
+		}
+
+		DrainAndWrite();
+		CloseFiles(closeRequests);
+
+		lock.lock();
+		m_completedGeneration = generation;
+		lock.unlock();
+		m_flushed.notify_all();
+
+		if (!isRunning) break;
+	}
+}
+
+void FlAsyncLogBackend::DrainAndWrite()
+{
+	auto stagings{ std::vector<std::shared_ptr<Staging>>{} };
+	{
+		auto lock{ std::lock_guard{ m_stagingMutex } };
+		stagings = m_stagings;
+
+		// 傪Iobt@͂̉ŉēo^O
+		std::erase_if(m_stagings, [](const std::shared_ptr<Staging>& sp) { return sp->isOrphaned.load(std::memory_order_acquire); });
+	}
+
+	auto entries{ std::vector<std::pair<FileId, std::string>>{} };
+	for (auto& spStaging : stagings)
+	{
+		auto taken{ std::vector<std::pair<FileId, std::string>>{} };
+		{
+			auto lock{ std::lock_guard{ spStaging->mutex } };
+			taken.swap(spStaging->entries);
+		}
+		std::move(taken.begin(), taken.end(), std::back_inserter(entries));
+	}
+	if (entries.empty()) return;
+
+	// t@C1݂̏ɂ܂Ƃ߂iXbh͕̏ێj
+	auto batches{ std::unordered_map<FileId, std::string>{} };
+	auto drained{ Def::ULongLongZero };
+	for (auto& [id, text] : entries)
+	{
+		drained += text.size();
+		batches[id] += text;
+	}
+	m_stagedBytes.fetch_sub(drained, std::memory_order_relaxed);
+
+	for (auto& [id, batch] : batches)
+	{
+		auto pFile{ static_cast<FileState*>(nullptr) };
+		{
+			auto lock{ std::lock_guard{ m_filesMutex } };
+			if (id < m_files.size()) pFile = m_files[id].get();
+		}
+		if (!pFile || !pFile->stream) continue;
+
+		pFile->stream.write(batch.data(), static_cast<std::streamsize>(batch.size()));
+		pFile->stream.flush();
+		pFile->size += batch.size();
+		if (!pFile->stream) pFile->isFailed = true;
+
+		if (pFile->size >= m_maxFileBytes.load(std::memory_order_relaxed)) Rotate(*pFile);
+	}
+}
+
+void FlAsyncLogBackend::CloseFiles(const std::vector<FileId>& ids)
+{
+	for (const auto id : ids)
+	{
+		// t@C̎̂ɐĜ͏oXbhȂ̂ŁAŎĂȂ
+		auto upFile{ std::unique_ptr<FileState>{} };
+		{
+			auto lock{ std::lock_guard{ m_filesMutex } };
+			upFile = std::move(m_files[id]);
+		}
+		if (!upFile) continue;
+
+		upFile->stream.close();
+		const auto isSucceeded{ !upFile->isFailed && !upFile->stream.fail() };
+
+		auto lock{ std::lock_guard{ m_filesMutex } };
+		m_closeResults[id] = isSucceeded;
+	}
+}
+
+void FlAsyncLogBackend::Rotate(FileState& file)
+{
+	const auto maxFiles{ m_maxFiles.load(std::memory_order_relaxed) };
+	file.stream.close();
+
+	auto ec{ std::error_code{} };
+	auto numbered{ [&file](const uint32_t index)
+		{
+			auto path{ file.path };
+			path += "." + std::to_string(index);
+			return path;
+		} };
+
+	// path.(n-1)  path.n ... path  path.1iłÂ̂͏j
+	if (maxFiles > Def::UIntZero)
+	{
+		std::filesystem::remove(numbered(maxFiles), ec);
+		for (auto i{ maxFiles - Def::UIntOne }; i > Def::UIntZero; --i)
+			std::filesystem::rename(numbered(i), numbered(i + Def::UIntOne), ec);
+		std::filesystem::rename(file.path, numbered(Def::UIntOne), ec);
+	}
+
+	file.stream.open(file.path, std::ios::out | std::ios::trunc);
+	file.size = Def::ULongLongZero;
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+// Ot@Cւ݂̏obNOEhXbh֓obNGh
+// eXbh͎p̃Xe[WOobt@֒ǋL邾ŁAfBXNI/O҂܂B
+// o FlushIntervali200msj FlushBytes ܂̂߁AُI͍őł̍̕s܂B
+// ȂsiG[Ȃǁj Write ̌ Flush ĂłB
+/// <summary> =Singleton= </summary>
+class FlAsyncLogBackend
+{
+public:
+
+	using FileId = uint32_t;
+
+	static constexpr FileId InvalidFile{ UINT32_MAX };
+
+	/// <summary>
+	/// Ot@CJ܂BpX͓IDԂ܂B
+	/// </summary>
+	/// <param name="path">Ot@C̃pXiǋLj</param>
+	/// <returns>JȂꍇ InvalidFile</returns>
+	FileId Open(const std::string_view& path);
+
+	/// <summary>
+	/// 1sis݁jXe[WOobt@֐ς݂܂BXbhZ[t
+	/// </summary>
+	void Write(const FileId id, std::string&& text);
+
+	/// <summary>
+	/// ܂łɐς܂ꂽOo܂őҋ@܂B
+	/// </summary>
+	void Flush();
+
+	/// <summary>
+	/// ܂łɐς܂ꂽOoĂt@C܂Bȍ~IDւ݂͎̏̂Ă܂B
+	/// ꎞIȃt@CiGNX|[gȂǁjJ܂܂ɂȂ߂Ɏg܂B
+	/// </summary>
+	/// <returns>Sď߂Đɕꂽ true</returns>
+	bool Close(const FileId id);
+
+	/// <summary>
+	/// [e[VݒimaxBytes 𒴂 path.1, path.2 ... ւ炷j
+	/// </summary>
+	void SetRotation(const size_t maxBytes, const uint32_t maxFiles) noexcept
+	{
+		m_maxFileBytes.store(maxBytes, std::memory_order_relaxed);
+		m_maxFiles.store(maxFiles, std::memory_order_relaxed);
+	}
+
+	static auto& Instance() noexcept
+	{
+		static FlAsyncLogBackend instance;
+		return instance;
+	}
+
+private:
+
+	FlAsyncLogBackend();
+	~FlAsyncLogBackend();
+
+	FlAsyncLogBackend(const FlAsyncLogBackend&) = delete;
+	FlAsyncLogBackend& operator=(const FlAsyncLogBackend&) = delete;
+
+	// Xbh̃Xe[WOobt@ibN͏oXbhƂ̌̂݋j
+	struct Staging
+	{
+		std::mutex								   mutex;
+		std::vector<std::pair<FileId, std::string>> entries;
+		std::atomic<bool>						   isOrphaned{ false };	// ̃XbhIς
+	};
+
+	struct FileState
+	{
+		std::filesystem::path path;
+		std::ofstream		  stream;
+		size_t				  size = Def::ULongLongZero;
+		bool				  isFailed = false;	// ݂Ɉxłs
+	};
+
+	Staging& GetStaging();
+
+	void WriterLoop();
+
+	/// <summary>
+	/// SXe[WOobt@At@Cɂ܂Ƃ߂ď݂܂BioXbhj
+	/// </summary>
+	void DrainAndWrite();
+
+	/// <summary>
+	/// Close ŗvꂽt@CAʂc܂BioXbhj
+	/// </summary>
+	void CloseFiles(const std::vector<FileId>& ids);
+
+	void Rotate(FileState& file);
+
+	std::mutex							  m_stagingMutex;
+	std::vector<std::shared_ptr<Staging>> m_stagings;
+
+	std::mutex								m_filesMutex;
+	std::vector<std::unique_ptr<FileState>> m_files;
+	std::unordered_map<std::string, FileId> m_fileIds;
+	std::vector<FileId>						m_closeRequests;
+	std::unordered_map<FileId, bool>		m_closeResults;
+
+	// oXbh̋NEtbVʒm
+	std::mutex				m_wakeMutex;
+	std::condition_variable m_wake;
+	std::condition_variable m_flushed;
+	uint64_t				m_requestedGeneration{};
+	uint64_t				m_completedGeneration{};
+	bool					m_isRunning{ true };
+
+	std::atomic<size_t>		m_stagedBytes{};
+	std::atomic<size_t>		m_maxFileBytes{ 8U * 1024U * 1024U };
+	std::atomic<uint32_t>	m_maxFiles{ 3U };
+
+	std::thread m_writer;
+
+	// ȏ㗭܂Ԋu҂ɏo
+	static constexpr size_t FlushBytes{ 64U * 1024U };
+	// ܂ĂȂĂ̊Ԋuŏo
+	static constexpr auto	FlushInterval{ std::chrono::milliseconds{ 200 } };
+};
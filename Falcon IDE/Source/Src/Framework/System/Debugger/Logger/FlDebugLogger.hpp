@@ -2,6 +2,8 @@
 
 /// <summary>
 /// fobOOt@Cɏނ߂̃NXB
+/// ݂ FlAsyncLogBackend ̏oXbhōsAĂяo̓fBXNI/O҂܂B
+/// ̂߈ُI͒߁iő200msj̍s܂Bcšł Flush ĂłB
 /// </summary>
 class DebugLogger
 {
@@ -11,16 +13,15 @@ public:
     /// </summary>
     /// <param name="filename">Ot@C̃pXBftHg "Assets/Data/Log/DebugLog.log"B</param>
     explicit DebugLogger(const std::string_view& filename = "Assets/Data/Log/DebugLog.log")
+        : m_fileId{ FlAsyncLogBackend::Instance().Open(filename) }
     {
-        m_logFile.open(filename, std::ios::out | std::ios::app);
-        m_upFPM = std::make_unique<FlFilePathManager>();
-        if (!m_logFile) _ASSERT_EXPR(false, L"Ot@C܂");
+        if (!IsOpen()) _ASSERT_EXPR(false, L"Ot@C܂");
     }
 
     /// <summary>
-    /// fXgN^BOt@C܂B
+    /// fXgN^Bt@C̓obNGhێ܂BiꎞIȃt@C Close ŕj
     /// </summary>
-    ~DebugLogger() { if (m_logFile.is_open()) m_logFile.close(); }
+    ~DebugLogger() = default;
 
     /// <summary>
     /// fobObZ[WOt@Cɏ݂܂B
@@ -30,54 +31,97 @@ public:
     /// <param name="line">bZ[WsԍB</param>
     void LogDebug(const std::string& message, const char* file, int line)
     {
-        if (m_logFile.is_open())
-        {
-            auto refl{ m_upFPM->GetRelative(file).generic_string() };
+        if (!IsOpen()) return;
 
-            m_logFile << GetCurrentDateTime() << std::endl
-                << "[File: " << refl << "] "
-                << "[Line: " << line << "] "
-                << message << std::endl;
-        }
+        auto text{ GetCurrentDateTime() };
+        text.reserve(text.size() + message.size() + 64U);
+        text += '\n';
+        text += "[File: ";
+        text += GetRelativePath(file);
+        text += "] [Line: ";
+        text += std::to_string(line);
+        text += "] ";
+        text += message;
+        text += '\n';
+
+        FlAsyncLogBackend::Instance().Write(m_fileId, std::move(text));
     }
 
     /// <summary>
     /// Ot@CJĂ邩ǂ𔻒肵܂B
     /// </summary>
     /// <returns>Ot@CJĂ trueAłȂ false Ԃ܂B</returns>
-    const auto IsOpen() const noexcept { return m_logFile.is_open(); }
+    const auto IsOpen() const noexcept { return m_fileId != FlAsyncLogBackend::InvalidFile; }
+
+    /// <summary>
+    /// ܂ł̃Ot@C֏o܂őҋ@܂B
+    /// </summary>
+    void Flush() { FlAsyncLogBackend::Instance().Flush(); }
+
+    /// <summary>
+    /// ܂ł̃OoĂt@C܂Bȍ~݂͍̏s܂B
+    /// </summary>
+    /// <returns>Sď߂ true</returns>
+    bool Close()
+    {
+        if (!IsOpen()) return false;
+        return FlAsyncLogBackend::Instance().Close(std::exchange(m_fileId, FlAsyncLogBackend::InvalidFile));
+    }
 
 private:
     /// <summary>
-    /// Ot@C̃Xg[B
+    /// ݐ̃t@CIDB
     /// </summary>
-    std::ofstream m_logFile;
+    FlAsyncLogBackend::FileId m_fileId;
+
+    /// <summary>
+    /// __FILE__ ̑΃pXiXbhɃLbVj
+    /// </summary>
+    static const std::string& GetRelativePath(const char* file)
+    {
+        thread_local auto upFPM{ std::make_unique<FlFilePathManager>() };
+        thread_local auto cache{ std::unordered_map<const char*, std::string>{} };
 
-    std::unique_ptr<FlFilePathManager> m_upFPM;
+        auto it{ cache.find(file) };
+        if (it == cache.end()) it = cache.emplace(file, upFPM->GetRelative(file).generic_string()).first;
+        return it->second;
+    }
 
     /// <summary>
-    /// ݂̓擾܂B
+    /// ݂̓擾܂Bb܂ł̓̕XbhɃLbVAbς`܂B
     /// </summary>
     /// <returns>݂̓\B</returns>
-    std::string GetCurrentDateTime()
+    static std::string GetCurrentDateTime()
     {
-        auto now        { std::chrono::high_resolution_clock::now() };
-        auto now_time_t { std::chrono::system_clock::to_time_t(std::chrono::system_clock::now()) };
-        auto duration   { now.time_since_epoch() };
+        thread_local auto cachedSecond{ std::chrono::sys_seconds{} };
+        thread_local auto cachedPrefix{ std::string{} };
 
-        auto seconds    { std::chrono::duration_cast<std::chrono::seconds>(duration) };
-        auto nanoseconds{ std::chrono::duration_cast<std::chrono::nanoseconds>(duration - seconds) };
+        const auto now    { std::chrono::system_clock::now() };
+        const auto seconds{ std::chrono::floor<std::chrono::seconds>(now) };
 
-        auto localTime  { std::tm{} };
+        if (seconds != cachedSecond || cachedPrefix.empty())
+        {
+            auto now_time_t{ std::chrono::system_clock::to_time_t(seconds) };
+            auto localTime { std::tm{} };
 #ifdef _WIN32
-        localtime_s(&localTime, &now_time_t);
+            localtime_s(&localTime, &now_time_t);
 #else  // !_WIN32
-        localtime_r(&now_time_t, &localTime);
+            localtime_r(&now_time_t, &localTime);
 #endif
-        auto oss        { std::ostringstream{} };
-        oss << std::put_time(&localTime, "%Y-%m-%d %H:%M:%S") << "."
-            << std::setfill('0') << std::setw(9) << nanoseconds.count();
-        return oss.str();
+            auto oss{ std::ostringstream{} };
+            oss << std::put_time(&localTime, "%Y-%m-%d %H:%M:%S") << ".";
+            cachedPrefix = oss.str();
+            cachedSecond = seconds;
+        }
+
+        // iimb9jt
+        const auto nanoseconds{ std::chrono::duration_cast<std::chrono::nanoseconds>(now - seconds).count() };
+        auto fraction{ std::to_string(nanoseconds) };
+
+        auto result{ cachedPrefix };
+        result.append(9U - std::min<size_t>(fraction.size(), 9U), '0');
+        result += fraction;
+        return result;
     }
 };
 
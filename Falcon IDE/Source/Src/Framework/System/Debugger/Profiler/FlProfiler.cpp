@@ -0,0 +1,219 @@
+#include "FlProfiler.h"
+
+FlProfiler::FlProfiler()
+    : m_originTicks{ Now() }
+    , m_originTime { std::chrono::steady_clock::now() }
+{}
+
+FlProfiler::ThreadBuffer& FlProfiler::RegisterThread()
+{
+    // Xbh̏IŃobt@ig͎ɓo^Xbh㏑܂œǂ߂j
+    struct Holder
+    {
+        ThreadBuffer* pBuffer = nullptr;
+        ~Holder() { if (pBuffer) pBuffer->isOrphaned.store(true, std::memory_order_release); }
+    };
+    thread_local auto holder{ Holder{} };
+
+    auto& profiler{ Instance() };
+    auto lock{ std::lock_guard{ profiler.m_registryMutex } };
+
+    auto pBuffer{ static_cast<ThreadBuffer*>(nullptr) };
+    for (const auto& upBuffer : profiler.m_buffers)
+    {
+        auto isOrphaned{ true };
+        if (upBuffer->isOrphaned.compare_exchange_strong(isOrphaned, false, std::memory_order_acq_rel))
+        {
+            pBuffer = upBuffer.get();
+            break;
+        }
+    }
+    if (!pBuffer) pBuffer = profiler.m_buffers.emplace_back(std::make_unique<ThreadBuffer>()).get();
+
+    pBuffer->depth = Def::UIntZero;
+    pBuffer->index = profiler.m_nextThreadIndex++;
+    pBuffer->name  = std::format("Thread {}", pBuffer->index);
+
+    holder.pBuffer = pBuffer;
+    s_pThreadBuffer = pBuffer;
+    return *pBuffer;
+}
+
+void FlProfiler::MarkFrame() noexcept
+{
+    const auto count{ m_frameCount.load(std::memory_order_relaxed) };
+    m_frames[count % FrameCapacity].store(Now(), std::memory_order_relaxed);
+    m_frameCount.store(count + 1U, std::memory_order_release);
+}
+
+void FlProfiler::SetThreadName(const std::string_view name)
+{
+    auto& buffer{ s_pThreadBuffer ? *s_pThreadBuffer : RegisterThread() };
+
+    auto lock{ std::lock_guard{ m_registryMutex } };
+    buffer.name = name;
+}
+
+const char* FlProfiler::Intern(const std::string_view name)
+{
+    auto lock{ std::lock_guard{ m_internMutex } };
+    return m_interned.emplace(name).first->c_str();
+}
+
+std::vector<FlProfiler::Ticks> FlProfiler::GetFrameMarks(const size_t count) const
+{
+    // ݒ1͔
+    const auto frameCount{ m_frameCount.load(std::memory_order_acquire) };
+    const auto size{ std::min({ static_cast<uint64_t>(count), frameCount, static_cast<uint64_t>(FrameCapacity - 1U) }) };
+
+    auto marks{ std::vector<Ticks>{} };
+    marks.reserve(static_cast<size_t>(size));
+    for (auto i{ frameCount - size }; i < frameCount; ++i)
+        marks.push_back(m_frames[i % FrameCapacity].load(std::memory_order_relaxed));
+    return marks;
+}
+
+FlProfiler::Capture FlProfiler::CaptureRange(const Ticks begin, const Ticks end) const
+{
+    auto capture{ Capture{} };
+    capture.begin      = begin;
+    capture.end        = end;
+    capture.ticksPerMs = GetTicksPerMs();
+
+    auto indices{ std::vector<uint64_t>{} };
+
+    auto lock{ std::lock_guard{ m_registryMutex } };
+    for (const auto& upBuffer : m_buffers)
+    {
+        const auto& buffer{ *upBuffer };
+
+        auto thread{ ThreadCapture{} };
+        thread.index = buffer.index;
+        thread.name  = buffer.name;
+        indices.clear();
+
+        // Iɕł̂ŁAV͈͂̎O܂ők
+        const auto published{ buffer.published.load(std::memory_order_acquire) };
+        const auto oldest   { published > ThreadCapacity ? published - ThreadCapacity : Def::ULongLongZero };
+        for (auto i{ published }; i-- > oldest; )
+        {
+            const auto& slot{ buffer.upSlots[i & (ThreadCapacity - 1U)] };
+
+            auto zone{ Zone{} };
+            zone.end = slot.end.load(std::memory_order_relaxed);
+            if (zone.end < begin) break;
+
+            zone.start = slot.start.load(std::memory_order_relaxed);
+            if (zone.start > end) continue;
+
+            zone.name  = slot.name .load(std::memory_order_relaxed);
+            zone.depth = slot.depth.load(std::memory_order_relaxed);
+            thread.zones.push_back(zone);
+            indices.push_back(i);
+        }
+
+        // ǂłԂɏ㏑꓾iÂĵĂ
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const auto claimed{ buffer.claimed.load(std::memory_order_relaxed) };
+        const auto valid  { claimed > ThreadCapacity ? claimed - ThreadCapacity : Def::ULongLongZero };
+        while (!indices.empty() && indices.back() < valid)
+        {
+            indices.pop_back();
+            thread.zones.pop_back();
+            ++capture.lost;
+        }
+
+        if (thread.zones.empty()) continue;
+
+        std::ranges::sort(thread.zones, [](const Zone& a, const Zone& b)
+            { return a.start != b.start ? a.start < b.start : a.depth < b.depth; });
+        thread.maxDepth = std::ranges::max(thread.zones, {}, &Zone::depth).depth;
+        capture.threads.push_back(std::move(thread));
+    }
+
+    std::ranges::sort(capture.threads, {}, &ThreadCapture::index);
+
+    for (const auto mark : GetFrameMarks(FrameCapacity))
+        if (mark >= begin && mark <= end) capture.frames.push_back(mark);
+
+    return capture;
+}
+
+FlProfiler::Capture FlProfiler::CaptureFrames(const size_t frames) const
+{
+    const auto marks{ GetFrameMarks(frames + 1U) };
+    if (marks.size() < 2U)
+    {
+        auto capture{ Capture{} };
+        capture.ticksPerMs = GetTicksPerMs();
+        return capture;
+    }
+    return CaptureRange(marks.front(), marks.back());
+}
+
+nlohmann::json FlProfiler::ToChromeTrace(const Capture& capture)
+{
+    // ͈͂OɎn܂][Ă ts ɂȂȂ悤ł_ɂ
+    auto origin{ capture.begin };
+    for (const auto& thread : capture.threads)
+        if (!thread.zones.empty()) origin = std::min(origin, thread.zones.front().start);
+
+    const auto toMicroseconds{ [&](const Ticks ticks) { return capture.ToMs(ticks) * 1000.0; } };
+
+    nlohmann::json events = nlohmann::json::array();
+    for (const auto& thread : capture.threads)
+    {
+        events.push_back({
+            { "name", "thread_name" }, { "ph", "M" }, { "pid", Def::UIntOne }, { "tid", thread.index },
+            { "args", { { "name", thread.name } } } });
+
+        for (const auto& zone : thread.zones)
+        {
+            events.push_back({
+                { "name", zone.name ? zone.name : "?" }, { "cat", "cpu" }, { "ph", "X" },
+                { "ts", toMicroseconds(zone.start - origin) }, { "dur", toMicroseconds(zone.end - zone.start) },
+                { "pid", Def::UIntOne }, { "tid", thread.index } });
+        }
+    }
+
+    const auto mainThread{ capture.threads.empty() ? Def::UIntZero : capture.threads.front().index };
+    for (const auto mark : capture.frames)
+    {
+        events.push_back({
+            { "name", "Frame" }, { "ph", "i" }, { "s", "g" },
+            { "ts", toMicroseconds(mark - origin) }, { "pid", Def::UIntOne }, { "tid", mainThread } });
+    }
+
+    nlohmann::json trace = nlohmann::json::object();
+    trace["traceEvents"]     = std::move(events);
+    trace["displayTimeUnit"] = "ms";
+    trace["otherData"]       = { { "lostZones", capture.lost } };
+    return trace;
+}
+
+bool FlProfiler::ExportChromeTrace(const Capture& capture, const std::filesystem::path& path) const
+{
+    auto ec{ std::error_code{} };
+    if (path.has_parent_path()) std::filesystem::create_directories(path.parent_path(), ec);
+
+    auto ofs{ std::ofstream{ path, std::ios::binary | std::ios::trunc } };
+    if (!ofs) return false;
+
+    ofs << ToChromeTrace(capture).dump();
+    return static_cast<bool>(ofs);
+}
+
+double FlProfiler::GetTicksPerMs() const noexcept
+{
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+    // N͔䂪êōŒ̊Ԋu󂯂
+    constexpr auto MinElapsed{ std::chrono::milliseconds{ 20 } };
+    while (std::chrono::steady_clock::now() - m_originTime < MinElapsed) std::this_thread::yield();
+
+    const auto ticks  { Now() };
+    const auto elapsed{ std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_originTime).count() };
+    return static_cast<double>(ticks - m_originTicks) / elapsed;
+#else
+    return 1e6;
+#endif
+}
@@ -0,0 +1,256 @@
+#pragma once
+
+// 0 `đŜrhƃ}NƏ܂ivR[hEL^̈Ƃj
+#ifndef FL_PROFILER_ENABLED
+#define FL_PROFILER_ENABLED 1
+#endif // !FL_PROFILER_ENABLED
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/// <summary> =Singleton= </summary>
+/// ԁi][j̊JnEIXbhƂ̃Oobt@֋L^Kwvt@CłB
+/// L^͎̃XbhAbNq[vmۂ܂Bi1][ = 1j
+/// ǂݏo͏݂ƕsĒ߂͈̔͂oA㏑ꂽ͎̂Ă܂B
+/// ][͐ÓIȕ Intern œ̂nĂB
+class FlProfiler
+{
+public:
+
+    using Ticks = uint64_t;
+
+    static constexpr size_t ThreadCapacity{ 1U << 15 }; // XbhƂɕێ][i2̗ݏj
+    static constexpr size_t FrameCapacity { 512U };     // ێt[E̐
+
+    struct Zone
+    {
+        const char* name  = nullptr;
+        Ticks       start = Def::ULongLongZero;
+        Ticks       end   = Def::ULongLongZero;
+        uint32_t    depth = Def::UIntZero;
+    };
+
+    struct ThreadCapture
+    {
+        uint32_t          index = Def::UIntZero; // o^iChrome trace  tidj
+        std::string       name;
+        std::vector<Zone> zones;                 // JniȂ󂢕j
+        uint32_t          maxDepth = Def::UIntZero;
+    };
+
+    struct Capture
+    {
+        Ticks  begin = Def::ULongLongZero;
+        Ticks  end   = Def::ULongLongZero;
+        double ticksPerMs = 1e6;
+
+        std::vector<ThreadCapture> threads;
+        std::vector<Ticks>         frames;                     // ͈͓̃t[E
+        uint64_t                   lost = Def::ULongLongZero; // ǂޑOɏ㏑ꂽ][
+
+        double ToMs(const Ticks ticks) const noexcept { return static_cast<double>(ticks) / ticksPerMs; }
+    };
+
+    /// <summary>
+    /// Ԃ1][ƂċL^܂BiFL_PROFILE_SCOPE gj
+    /// </summary>
+    class Scope;
+
+    /// <summary>
+    /// ݎix86 ł TSCBPʂ Capture::ticksPerMs ŊZj
+    /// </summary>
+    static Ticks Now() noexcept
+    {
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        return static_cast<Ticks>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+
+    /// <summary>
+    /// t[̋؂L^܂BiCXbh1t[1j
+    /// </summary>
+    void MarkFrame() noexcept;
+
+    /// <summary>
+    /// ĂяoXbh̕\ݒ肵܂B
+    /// </summary>
+    void SetThreadName(std::string_view name);
+
+    /// <summary>
+    /// IȖȎɂ܂BiO͓|C^B][Ă΂ʂێĂj
+    /// </summary>
+    const char* Intern(std::string_view name);
+
+    void SetEnabled(const bool isEnabled) noexcept { s_isEnabled.store(isEnabled, std::memory_order_relaxed); }
+    bool IsEnabled() const noexcept { return s_isEnabled.load(std::memory_order_relaxed); }
+
+    uint64_t GetFrameCount() const noexcept { return m_frameCount.load(std::memory_order_acquire); }
+
+    /// <summary>
+    /// ߂̃t[EÂɍő count Ԃ܂B
+    /// </summary>
+    std::vector<Ticks> GetFrameMarks(size_t count) const;
+
+    /// <summary>
+    /// [begin, end] Ɋ|][SXbho܂B
+    /// </summary>
+    Capture CaptureRange(Ticks begin, Ticks end) const;
+
+    /// <summary>
+    /// ߂̊ frames t[o܂B
+    /// </summary>
+    Capture CaptureFrames(size_t frames) const;
+
+    /// <summary>
+    /// Chrome ̃g[X`ichrome://tracing / Perfetto ŊJ JSONjɂ܂B
+    /// </summary>
+    static nlohmann::json ToChromeTrace(const Capture& capture);
+
+    bool ExportChromeTrace(const Capture& capture, const std::filesystem::path& path) const;
+
+    /// <summary>
+    /// Ticks  ms ɊZWBiŇo߂ TSC  steady_clock ɍ킹j
+    /// </summary>
+    double GetTicksPerMs() const noexcept;
+
+    static auto& Instance() noexcept
+    {
+        static auto instance{ FlProfiler{} };
+        return instance;
+    }
+
+private:
+
+    FlProfiler();
+    ~FlProfiler() = default;
+
+    struct Slot
+    {
+        std::atomic<Ticks>       start;
+        std::atomic<Ticks>       end;
+        std::atomic<const char*> name;
+        std::atomic<uint32_t>    depth;
+    };
+
+    // ͎̂̃XbhBclaimed  g  published ̏ɐi߁A
+    // ǂޑ published ܂łǂ݁AǂݏI_ claimed ㏑𔻒肷
+    struct ThreadBuffer
+    {
+        void Push(const char* zoneName, const Ticks zoneStart, const Ticks zoneEnd, const uint32_t zoneDepth) noexcept
+        {
+            const auto index{ written };
+            claimed.store(index + 1U, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+
+            auto& slot{ upSlots[index & (ThreadCapacity - 1U)] };
+            slot.start.store(zoneStart, std::memory_order_relaxed);
+            slot.end  .store(zoneEnd,   std::memory_order_relaxed);
+            slot.name .store(zoneName,  std::memory_order_relaxed);
+            slot.depth.store(zoneDepth, std::memory_order_relaxed);
+
+            written = index + 1U;
+            published.store(written, std::memory_order_release);
+        }
+
+        std::unique_ptr<Slot[]> upSlots{ std::make_unique<Slot[]>(ThreadCapacity) };
+        uint64_t                written = Def::ULongLongZero; // p
+        uint32_t                depth   = Def::UIntZero;      // p
+
+        std::atomic<uint64_t> claimed  {};
+        std::atomic<uint64_t> published{};
+
+        uint32_t          index = Def::UIntZero;
+        std::string       name;       // m_registryMutex ŕی
+        std::atomic<bool> isOrphaned{ false };
+    };
+
+    // ̃][ŌĂ΂BIς݃Xbh̃obt@Ύg
+    static ThreadBuffer& RegisterThread();
+
+    static inline std::atomic<bool> s_isEnabled{ true };
+    static inline thread_local ThreadBuffer* s_pThreadBuffer{ nullptr };
+
+    mutable std::mutex                         m_registryMutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> m_buffers;
+    uint32_t                                   m_nextThreadIndex = Def::UIntZero;
+
+    std::array<std::atomic<Ticks>, FrameCapacity> m_frames{};
+    std::atomic<uint64_t>                         m_frameCount{};
+
+    std::mutex                      m_internMutex;
+    std::unordered_set<std::string> m_interned;
+
+    // TSC  steady_clock ̑ΉiZpj
+    Ticks                                 m_originTicks;
+    std::chrono::steady_clock::time_point m_originTime;
+};
+
+class FlProfiler::Scope
+{
+public:
+    explicit Scope(const char* name) noexcept
+    {
+        if (!s_isEnabled.load(std::memory_order_relaxed)) return;
+
+        m_pBuffer = s_pThreadBuffer ? s_pThreadBuffer : &RegisterThread();
+        m_name    = name;
+        m_depth   = m_pBuffer->depth++;
+        m_start   = Now();
+    }
+
+    ~Scope()
+    {
+        if (!m_pBuffer) return;
+
+        m_pBuffer->Push(m_name, m_start, Now(), m_depth);
+        --m_pBuffer->depth;
+    }
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+private:
+    ThreadBuffer* m_pBuffer = nullptr;
+    const char*   m_name    = nullptr;
+    Ticks         m_start   = Def::ULongLongZero;
+    uint32_t      m_depth   = Def::UIntZero;
+};
+
+#if FL_PROFILER_ENABLED
+
+#define FL_PROFILE_CONCAT_IMPL(a, b) a##b
+#define FL_PROFILE_CONCAT(a, b) FL_PROFILE_CONCAT_IMPL(a, b)
+
+/// <summary>
+/// ubN̏I܂ł name ̃][ƂċL^}NB
+/// </summary>
+#define FL_PROFILE_SCOPE(name) const FlProfiler::Scope FL_PROFILE_CONCAT(flProfileScope, __LINE__){ name }
+
+/// <summary>
+/// ֐Ŝ֐̃][ƂċL^}NB
+/// </summary>
+#define FL_PROFILE_FUNCTION() FL_PROFILE_SCOPE(__FUNCTION__)
+
+/// <summary>
+/// t[̋؂L^}NB
+/// </summary>
+#define FL_PROFILE_FRAME() FlProfiler::Instance().MarkFrame()
+
+/// <summary>
+/// ĂяoXbhɕ\t}NB
+/// </summary>
+#define FL_PROFILE_THREAD(name) FlProfiler::Instance().SetThreadName(name)
+
+#else // FL_PROFILER_ENABLED
+
+#define FL_PROFILE_SCOPE(name)  ((void)0)
+#define FL_PROFILE_FUNCTION()   ((void)0)
+#define FL_PROFILE_FRAME()      ((void)0)
+#define FL_PROFILE_THREAD(name) ((void)0)
+
+#endif // FL_PROFILER_ENABLED
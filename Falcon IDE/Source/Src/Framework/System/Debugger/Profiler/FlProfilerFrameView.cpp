@@ -0,0 +1,73 @@
+#include "FlProfilerFrameView.h"
+
+bool FlProfilerFrameView::RefreshFrameMarks(const FlProfiler& profiler)
+{
+    const auto frameCount{ profiler.GetFrameCount() };
+    if (frameCount == m_markedFrameCount) return false;
+
+    m_frameMarks       = profiler.GetFrameMarks(m_stripFrames + 1U);
+    m_markedFrameCount = frameCount;
+    return true;
+}
+
+bool FlProfilerFrameView::SelectLatest(const FlProfiler& profiler)
+{
+    RefreshFrameMarks(profiler);
+    if (m_frameMarks.size() < 2U) return false;
+    return Select(profiler, m_frameMarks.size() - 1U);
+}
+
+bool FlProfilerFrameView::Select(const FlProfiler& profiler, const size_t frameEnd)
+{
+    if (frameEnd == Def::ULongLongZero || frameEnd >= m_frameMarks.size()) return false;
+
+    const auto begin{ m_frameMarks[frameEnd - 1U] };
+    const auto end  { m_frameMarks[frameEnd] };
+    m_selectedEnd = frameEnd;
+
+    // EĂt[ȂoȂ
+    if (m_captureCount != Def::ULongLongZero && m_capture.begin == begin && m_capture.end == end) return false;
+
+    m_capture = profiler.CaptureRange(begin, end);
+    ++m_captureCount;
+    Summarize();
+    return true;
+}
+
+void FlProfilerFrameView::Summarize()
+{
+    // JnE[ɕł̂ŁAJĂ][̐ςݏグe߂Ďq̕
+    m_rowIndices.clear();
+    m_summary.clear();
+
+    for (const auto& thread : m_capture.threads)
+    {
+        m_open.clear();
+        m_selfMs.assign(thread.zones.size(), Def::DoubleZero);
+
+        for (auto i{ size_t{} }; i < thread.zones.size(); ++i)
+        {
+            const auto& zone{ thread.zones[i] };
+            const auto  ms  { m_capture.ToMs(zone.end - zone.start) };
+            m_selfMs[i] = ms;
+
+            while (!m_open.empty() && m_open.back().first >= zone.depth) m_open.pop_back();
+            if (!m_open.empty()) m_selfMs[m_open.back().second] -= ms;
+            m_open.emplace_back(zone.depth, i);
+        }
+
+        for (auto i{ size_t{} }; i < thread.zones.size(); ++i)
+        {
+            const auto name{ std::string_view{ thread.zones[i].name ? thread.zones[i].name : "?" } };
+            const auto [it, isNew] { m_rowIndices.try_emplace(name, m_summary.size()) };
+            if (isNew) m_summary.push_back({ name });
+
+            auto& row{ m_summary[it->second] };
+            ++row.calls;
+            row.totalMs += m_capture.ToMs(thread.zones[i].end - thread.zones[i].start);
+            row.selfMs  += std::max(m_selfMs[i], Def::DoubleZero);
+        }
+    }
+
+    std::ranges::sort(m_summary, std::greater{}, &SummaryRow::selfMs);
+}
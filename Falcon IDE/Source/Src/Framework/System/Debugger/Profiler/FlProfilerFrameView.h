@@ -0,0 +1,69 @@
+#pragma once
+
+/// <summary>
+/// FlProfiler ̃t[ËꗗƁAI1t[̋L^EOƂ̏Wv\p̃fłB
+/// oƏWv̓t[Ei񂾎EIԃt[ςsAȊÕt[ł͉܂B
+/// ImGui Ɉ˂Ȃ̂ŁA`Ȃœm߂܂B
+/// </summary>
+class FlProfilerFrameView
+{
+public:
+
+    struct SummaryRow
+    {
+        std::string_view name;
+        uint32_t         calls   = Def::UIntZero;
+        double           totalMs = Def::DoubleZero; // q܂
+        double           selfMs  = Def::DoubleZero; // q
+    };
+
+    explicit FlProfilerFrameView(size_t stripFrames = 120U) noexcept : m_stripFrames{ stripFrames } {}
+
+    /// <summary>
+    /// t[EiłΒ stripFrames 蒼܂B
+    /// </summary>
+    /// <returns>蒼ꍇ true</returns>
+    bool RefreshFrameMarks(const FlProfiler& profiler);
+
+    /// <summary>
+    /// ŐV̊t[Iт܂B
+    /// </summary>
+    /// <returns>oꍇ true</returns>
+    bool SelectLatest(const FlProfiler& profiler);
+
+    /// <summary>
+    /// frameEnd Ԗڂ̋EŏIt[Iт܂BOƓ͈͂Ȃ牽܂B
+    /// </summary>
+    /// <returns>oꍇ true</returns>
+    bool Select(const FlProfiler& profiler, size_t frameEnd);
+
+    const auto& GetFrameMarks () const noexcept { return m_frameMarks; }
+    auto        GetSelectedEnd() const noexcept { return m_selectedEnd; }
+    const auto& GetCapture    () const noexcept { return m_capture; }
+    const auto& GetSummary    () const noexcept { return m_summary; }
+    auto        GetStripFrames() const noexcept { return m_stripFrames; }
+
+    /// <summary>
+    /// CaptureRange Ă񂾉
+    /// </summary>
+    auto GetCaptureCount() const noexcept { return m_captureCount; }
+
+private:
+
+    // JnE[ɕ񂾃][AOƂ̌Ăяo񐔁Eg̎ԁEv߂
+    void Summarize();
+
+    size_t m_stripFrames;
+
+    std::vector<FlProfiler::Ticks> m_frameMarks;                         // \̋EiÂj
+    uint64_t                       m_markedFrameCount = Def::ULongLongZero; // m_frameMarks  GetFrameCount
+    size_t                         m_selectedEnd      = Def::ULongLongZero; // I񂾃t[̏I̋Ëʒu
+    FlProfiler::Capture            m_capture;
+    std::vector<SummaryRow>        m_summary;
+    uint64_t                       m_captureCount     = Def::ULongLongZero;
+
+    // Wv̍Ɨ̈ig񂷁j
+    std::unordered_map<std::string_view, size_t> m_rowIndices;
+    std::vector<double>                          m_selfMs;
+    std::vector<std::pair<uint32_t, size_t>>     m_open;
+};
@@ -0,0 +1,158 @@
+#pragma once
+
+/// <summary>
+/// ߐ؂iO̒ߐ؂ + 1t[j܂ł̑ҋ@ueҋ@ + ŌゾXsvōsy[T[łB
+/// eҋ@̐Q߂ʂ𑪂ė]Ti}[Wjō킹Aߐ؂Ƃ̂𓝌vɎc܂B
+///
+/// Clock ͎^łiւ OS Ɉ˂炸ł܂j
+///   TimePoint now()                     : ݎisteady_clock::time_pointj
+///   void      sleep_for(Duration)       : eҋ@iQ߂Ă悢j
+///   void      relax()                   : Xs1񕪂̃qg
+/// </summary>
+template<class Clock>
+class FlFramePacer
+{
+public:
+    using TimePoint = std::chrono::steady_clock::time_point;
+    using Duration  = std::chrono::duration<double>;
+
+    struct Settings
+    {
+        Duration initialMargin{ 0.0015 };  // ZÕ}[W
+        Duration minMargin    { 0.0002 };  // }[W̉
+        Duration maxMargin    { 0.004  };  // }[W̏
+        double   lateToleranceMs = 0.2;    // 𒴂Ēxꂽuxt[v
+        uint32_t maxBacklogFrames = 4;     // xłȂƂɒǂƂőt[
+        bool     isLowLatency     = true;  // xꂽ痭܂̂Ăč琔
+    };
+
+    struct Statistics
+    {
+        FlChronus::FrameStatistics::Summary error; // ߐ؂Ƃ̂̐Βlimsj
+        uint64_t frames  = Def::ULongLongZero;
+        uint64_t late    = Def::ULongLongZero;    // lateToleranceMs 𒴂Ēxꂽt[
+        uint64_t dropped = Def::ULongLongZero;    // Ŏ̂Ăߐ؂
+        double   marginMs = Def::DoubleZero;      // ݂̃}[W
+    };
+
+    explicit FlFramePacer(Clock clock = Clock{}, const Settings& settings = Settings{})
+        : m_clock{ std::move(clock) }
+        , m_settings{ settings }
+        , m_margin{ settings.initialMargin }
+    {}
+
+    /// <summary>
+    /// ̒ߐ؂܂ő҂܂B
+    /// </summary>
+    /// <param name="frameTime">1t[̖ڕW</param>
+    void Wait(const Duration frameTime)
+    {
+        auto now{ m_clock.now() };
+        if (!m_isAnchored)
+        {
+            m_deadline   = now + std::chrono::duration_cast<std::chrono::steady_clock::duration>(frameTime);
+            m_isAnchored = true;
+        }
+        else m_deadline += std::chrono::duration_cast<std::chrono::steady_clock::duration>(frameTime);
+
+        // ɒߐ؂߂Ă
+        if (now >= m_deadline)
+        {
+            Record(now);
+
+            const auto backlog{ m_settings.isLowLatency ? Duration::zero() : frameTime * m_settings.maxBacklogFrames };
+            if (Duration{ now - m_deadline } > backlog)
+            {
+                m_dropped += static_cast<uint64_t>(Duration{ now - m_deadline } / frameTime) + Def::ULongLongOne;
+                m_deadline = now;
+            }
+            return;
+        }
+
+        // eҋ@i}[WcĐQj
+        const auto remaining{ Duration{ m_deadline - now } };
+        if (remaining > m_margin)
+        {
+            const auto request{ remaining - m_margin };
+            m_clock.sleep_for(request);
+            const auto woke{ m_clock.now() };
+            Calibrate(Duration{ woke - now } - request);
+            now = woke;
+        }
+
+        // Ō̓Xs
+        while (now < m_deadline)
+        {
+            m_clock.relax();
+            now = m_clock.now();
+        }
+
+        Record(now);
+    }
+
+    /// <summary>
+    /// ߐ؂̂Ă܂B Wait ͌Ă񂾎琔܂BỉEڕW̕ύXȂǁj
+    /// </summary>
+    void Reset() noexcept { m_isAnchored = false; }
+
+    /// <summary>
+    /// O̒ߐ؂ lastDeadline ƂĐ܂Bi̒ߐ؂ lastDeadline + frameTimej
+    /// </summary>
+    void Reset(const TimePoint lastDeadline) noexcept
+    {
+        m_deadline   = lastDeadline;
+        m_isAnchored = true;
+    }
+
+    Statistics GetStatistics() const noexcept
+    {
+        return { m_errors.summary(), m_frames, m_late, m_dropped, std::chrono::duration<double, std::milli>(m_margin).count() };
+    }
+
+    auto& WorkSettings() noexcept { return m_settings; }
+    const auto& GetSettings() const noexcept { return m_settings; }
+
+    auto& WorkClock() noexcept { return m_clock; }
+
+private:
+
+    void Record(const TimePoint now) noexcept
+    {
+        const auto errorMs{ std::chrono::duration<double, std::milli>(now - m_deadline).count() };
+        m_errors.add(std::abs(errorMs));
+        ++m_frames;
+        if (errorMs > m_settings.lateToleranceMs) ++m_late;
+    }
+
+    // Q߂ʂ̕ςƕϕ΍wړςŒǂA}[W =  + 4΍B
+    // }[W𒴂ĐQ߂瑦ɍLA߂̂͂B
+    void Calibrate(const Duration overshoot) noexcept
+    {
+        constexpr auto Rate{ 0.05 };
+        const auto sample{ std::max(overshoot.count(), Def::DoubleZero) };
+
+        m_overshootMean      += (sample - m_overshootMean) * Rate;
+        m_overshootDeviation += (std::abs(sample - m_overshootMean) - m_overshootDeviation) * Rate;
+
+        auto target{ Duration{ m_overshootMean + m_overshootDeviation * 4.0 } };
+        if (overshoot > m_margin) target = std::max(target, overshoot * 1.25);
+
+        m_margin = std::clamp(target > m_margin ? target : m_margin + (target - m_margin) * Rate,
+            m_settings.minMargin, m_settings.maxMargin);
+    }
+
+    Clock    m_clock;
+    Settings m_settings;
+
+    TimePoint m_deadline{};
+    bool      m_isAnchored = false;
+
+    Duration m_margin;
+    double   m_overshootMean      = Def::DoubleZero; // b
+    double   m_overshootDeviation = Def::DoubleZero; // b
+
+    FlChronus::FrameStatistics m_errors{ 600 };
+    uint64_t m_frames  = Def::ULongLongZero;
+    uint64_t m_late    = Def::ULongLongZero;
+    uint64_t m_dropped = Def::ULongLongZero;
+};
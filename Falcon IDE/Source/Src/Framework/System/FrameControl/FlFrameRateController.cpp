@@ -10,24 +10,38 @@ void FlFrameRateController::BeginFrame() noexcept
     else {
         auto duration{ currentTime - m_previousStartTime };
         m_deltaTime = std::chrono::duration_cast<std::chrono::duration<float>>(duration).count();
+        m_frameStatistics.add(std::chrono::duration<double, std::milli>(duration).count());
         UpdateFPS();
     }
     m_previousStartTime = currentTime;
 }
 
-void FlFrameRateController::EndFrame() const noexcept
+void FlFrameRateController::EndFrame()
 {
-    // <Quick Return:VsyncL̏ꍇ̓t[Ԃ𒲐Ȃ>
-    if (m_isVsync) return; 
-
-    auto endTime{ std::chrono::steady_clock::now() };
-    auto frameDuration{ endTime - m_previousStartTime };
-
     auto isForegroundWindow{ (GetForegroundWindow() == m_windowHandle) };
 
+    // <Quick Return:VsyncLEȂ̏ꍇ̓t[Ԃ𒲐Ȃ>
+    if (m_isVsync || (isForegroundWindow && m_isLimitless))
+    {
+        m_wasPacing = false;
+        return;
+    }
+
     auto targetMinFrameTime = isForegroundWindow ? m_minFrameTime : m_backgroundMinFrameTime;
 
-    if (isForegroundWindow && m_isLimitless) return;
+    if (m_pacingMode == PacingMode::Hybrid)
+    {
+        if (!m_wasPacing) m_pacer.Reset(m_previousStartTime);
+        m_wasPacing = true;
+        m_pacer.Wait(targetMinFrameTime);
+        return;
+    }
+
+    // Sleep ̊Ԃ͒ߐ؂ȂiHybrid ɖ߂ɑOt[̊Jn琔j
+    m_wasPacing = false;
+
+    auto endTime{ std::chrono::steady_clock::now() };
+    auto frameDuration{ endTime - m_previousStartTime };
 
     if (frameDuration < targetMinFrameTime) 
     {
@@ -53,6 +67,7 @@ void FlFrameRateController::UpdateFPS() noexcept
     if (elapsedSinceLastFPS >= Def::DoubleOne) 
     { // 1bƂFPSvZ
         m_currentFPS           = static_cast<float>(m_frameCount) / static_cast<float>(m_frameTimeAccumulator);
+        m_frameSummary         = m_frameStatistics.summary();
         m_frameCount           = Def::UIntZero;
         m_frameTimeAccumulator = Def::DoubleZero;
         m_lastFPSTime          = currentTime;
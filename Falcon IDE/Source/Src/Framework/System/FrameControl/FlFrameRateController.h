@@ -2,6 +2,15 @@
 
 class FlFrameRateController {
 public:
+    /// <summary>
+    /// t[Ԃ̑҂
+    /// </summary>
+    enum class PacingMode : uint32_t
+    {
+        Sleep,  // Ot[̊Jn sleep_fori]j
+        Hybrid, // ߐ؂܂ō\^C}[ + XsiFlFramePacerj
+    };
+
     /// <summary>
     /// w肳ꂽt[[gŃt[[gsRg[[̃RXgN^łB
     /// </summary>
@@ -31,7 +40,7 @@ public:
     /// <summary>
     /// t[̏I܂B
     /// </summary>
-    void EndFrame() const noexcept;
+    void EndFrame();
 
     /// <summary>
     /// oߎԁif^^Cj擾܂B
@@ -45,6 +54,12 @@ public:
     /// <returns>݂FPSlB</returns>
     const auto GetCurrentFPS() const noexcept { return m_currentFPS; }
 
+    /// <summary>
+    /// ߂̃t[Ԃ̓viŏEőEρEW΍EP50/P95/P99A~bj擾܂B
+    /// FPS Ɠ1bƂɍXV܂B
+    /// </summary>
+    const auto& GetFrameStatistics() const noexcept { return m_frameSummary; }
+
 	auto& WorkIsVsync() noexcept { return m_isVsync; }
 	const auto& GetIsVsync() const noexcept { return m_isVsync; }
 
@@ -79,6 +94,22 @@ public:
     /// <param name="isVsync">Vsync Lɂꍇ trueAɂꍇ false w肵܂B</param>
     void SetIsVsync(bool isVsync) noexcept;
 
+    /// <summary>
+    /// t[Ԃ̑҂ݒ肵܂B
+    /// </summary>
+    void SetPacingMode(PacingMode mode) noexcept
+    {
+        m_pacingMode = mode;
+        m_pacer.Reset();
+    }
+    const auto GetPacingMode() const noexcept { return m_pacingMode; }
+
+    /// <summary>
+    /// Hybrid ̃y[T[iݒ̕ύXEߐ؂Ƃ̂̓vj
+    /// </summary>
+    auto& WorkPacer() noexcept { return m_pacer; }
+    const auto& GetPacer() const noexcept { return m_pacer; }
+
 private:
     /// <summary>
     /// FPSit[bjXV܂B
@@ -94,6 +125,13 @@ private:
 
     double m_frameTimeAccumulator; // t[ԗݐ
 
+    FlChronus::FrameStatistics          m_frameStatistics; // ߂̃t[
+    FlChronus::FrameStatistics::Summary m_frameSummary;    // 1bƂɎov
+
+    FlFramePacer<FlHighResolutionClock> m_pacer;           // Hybrid ̑ҋ@
+    PacingMode m_pacingMode = PacingMode::Hybrid;
+    bool       m_wasPacing  = false;                       // Ot[őҋ@ỉ߂ɐj
+
     float m_desiredFPS;            // ]FPS
 	float m_backgroundFPS;         // obNOEh̊]FPS
     float m_deltaTime;             // ŐṼf^^Cibj
@@ -0,0 +1,40 @@
+#include "FlHighResolutionClock.h"
+
+FlHighResolutionClock::FlHighResolutionClock()
+{
+    // Windows 10 1803 ȍ~Bs sleep_for ɔC
+    m_timer = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+}
+
+FlHighResolutionClock::~FlHighResolutionClock()
+{
+    if (m_timer) CloseHandle(m_timer);
+}
+
+FlHighResolutionClock& FlHighResolutionClock::operator=(FlHighResolutionClock&& other) noexcept
+{
+    if (this != &other)
+    {
+        if (m_timer) CloseHandle(m_timer);
+        m_timer = std::exchange(other.m_timer, nullptr);
+    }
+    return *this;
+}
+
+void FlHighResolutionClock::sleep_for(std::chrono::duration<double> duration) noexcept
+{
+    if (duration <= std::chrono::duration<double>::zero()) return;
+
+    if (m_timer)
+    {
+        // ̒l͑Ύԁi100ns Pʁj
+        auto dueTime{ LARGE_INTEGER{} };
+        dueTime.QuadPart = -static_cast<LONGLONG>(duration.count() * 1e7);
+        if (SetWaitableTimerEx(m_timer, &dueTime, Def::IntZero, nullptr, nullptr, nullptr, Def::UIntZero))
+        {
+            WaitForSingleObject(m_timer, INFINITE);
+            return;
+        }
+    }
+    std::this_thread::sleep_for(duration);
+}
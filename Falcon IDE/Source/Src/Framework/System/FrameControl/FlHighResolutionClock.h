@@ -0,0 +1,29 @@
+#pragma once
+
+/// <summary>
+/// FlFramePacer p̎vłBeҋ@͍\̑ҋ@\^C}[igȂ sleep_forjōs܂B
+/// </summary>
+class FlHighResolutionClock
+{
+public:
+    FlHighResolutionClock();
+    ~FlHighResolutionClock();
+
+    FlHighResolutionClock(FlHighResolutionClock&& other) noexcept : m_timer{ std::exchange(other.m_timer, nullptr) } {}
+    FlHighResolutionClock& operator=(FlHighResolutionClock&& other) noexcept;
+
+    FlHighResolutionClock(const FlHighResolutionClock&) = delete;
+    FlHighResolutionClock& operator=(const FlHighResolutionClock&) = delete;
+
+    auto now() const noexcept { return std::chrono::steady_clock::now(); }
+
+    void sleep_for(std::chrono::duration<double> duration) noexcept;
+
+    void relax() const noexcept { YieldProcessor(); }
+
+    // \^C}[gĂ邩
+    auto IsHighResolution() const noexcept { return m_timer != nullptr; }
+
+private:
+    HANDLE m_timer = nullptr;
+};
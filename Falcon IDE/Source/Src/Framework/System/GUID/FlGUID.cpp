@@ -1,4 +1,78 @@
 #include "FlGUID.h"
 
-// staticoϐ̎̂`
-std::map<std::string, std::string> FlGuid::m_replacedGuids;
\ No newline at end of file
+namespace
+{
+	uint64_t SplitMix64(uint64_t& state) noexcept
+	{
+		auto z{ state += 0x9E3779B97F4A7C15ULL };
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+		return z ^ (z >> 31);
+	}
+
+	/// <summary>
+	/// XbhƂ xoshiro256** B random_deviceEEXbhŗL̃AhX
+	/// </summary>
+	class GuidRandom
+	{
+	public:
+		GuidRandom()
+		{
+			auto device{ std::random_device{} };
+			auto seed{ (static_cast<uint64_t>(device()) << 32) ^ device() };
+			seed ^= static_cast<uint64_t>(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+			seed ^= reinterpret_cast<uintptr_t>(this);
+
+			for (auto& s : m_state) s = SplitMix64(seed) ^ ((static_cast<uint64_t>(device()) << 32) | device());
+		}
+
+		uint64_t Next() noexcept
+		{
+			const auto result{ std::rotl(m_state[1] * 5, 7) * 9 };
+			const auto t{ m_state[1] << 17 };
+
+			m_state[2] ^= m_state[0];
+			m_state[3] ^= m_state[1];
+			m_state[1] ^= m_state[2];
+			m_state[0] ^= m_state[3];
+			m_state[2] ^= t;
+			m_state[3]  = std::rotl(m_state[3], 45);
+
+			return result;
+		}
+
+	private:
+		std::array<uint64_t, 4> m_state{};
+	};
+
+	// uOGUIDƒuGUID̃}bv
+	std::unordered_map<FlGuid, FlGuid> g_replacedGuids;
+	std::mutex                         g_replacedMutex;
+}
+
+void FlGuid::NewGuid()
+{
+	thread_local auto random{ GuidRandom{} };
+
+	// łGUIDݒ肳Ă邩ǂ
+	const auto prev{ *this };
+
+	// v4: (4bit)  ώ(2bit) ȊO͗
+	m_high = (random.Next() & ~0x000000000000F000ULL) | 0x0000000000004000ULL;
+	m_low  = (random.Next() & ~0xC000000000000000ULL) | 0x8000000000000000ULL;
+
+	if (!prev.IsNil())
+	{
+		auto lock{ std::lock_guard{ g_replacedMutex } };
+		g_replacedGuids.insert_or_assign(prev, *this); // uOGUIDƒuGUIDL^
+	}
+}
+
+FlGuid FlGuid::GetReplacedGuid(const FlGuid& oldGuid)
+{
+	auto lock{ std::lock_guard{ g_replacedMutex } };
+
+	auto it{ g_replacedGuids.find(oldGuid) };
+	if (it != g_replacedGuids.end()) return it->second; // uGUIDԂ
+	return oldGuid; // ȂΌGUIDԂ
+}
@@ -1,51 +1,147 @@
 #pragma once
 
+/// <summary>
+/// 128bit ̒l^GUIDiRFC 4122 v4j
+/// ̓XbhƂ̗ōs OS Ăт܂B񉻁E͂̓q[vg킸A
+/// ̃L[ɂ 16oCg̒l̂܂܎g܂Bistd::hash ꉻj
+/// ͏]ʂ菬 "xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx" łB
+/// </summary>
 class FlGuid
 {
 public:
 
+	static constexpr size_t StringLength = 36;
+
 	FlGuid() { NewGuid(); }
 
+	constexpr FlGuid(const uint64_t high, const uint64_t low) noexcept
+		: m_high{ high }
+		, m_low { low }
+	{}
+
+	// S0GUIDiݒ\j
+	static constexpr FlGuid Nil() noexcept { return FlGuid{ Def::ULongLongZero, Def::ULongLongZero }; }
+
 	// VGUID쐬
-	void NewGuid()
+	void NewGuid();
+
+	std::string ToString() const
+	{
+		auto ret{ std::string(StringLength, '\0') };
+		ToChars(ret.data());
+		return ret;
+	}
+
+	/// <summary>
+	/// out  StringLength ݂܂BiI[͏܂j
+	/// </summary>
+	/// <returns>񂾖</returns>
+	char* ToChars(char* out) const noexcept
 	{
-		// łGUIDݒ肳Ă邩ǂ
-		auto prevId{ ToString() };
-		auto status{ RPC_STATUS{} };
+		constexpr char Hex[]{ "0123456789abcdef" };
 
-		do {
-			status = UuidCreate(&m_guid);
-			if (status != RPC_S_OK) _ASSERT_EXPR(false, "GUID Not Create");
-		} while (status == RPC_S_UUID_LOCAL_ONLY);
+		for (auto i{ size_t{} }; i < 16; ++i)
+		{
+			out[DigitPositions[i]]      = Hex[(m_high >> (60 - i * 4)) & 0xF];
+			out[DigitPositions[i + 16]] = Hex[(m_low  >> (60 - i * 4)) & 0xF];
+		}
+		out[8] = out[13] = out[18] = out[23] = '-';
+		return out + StringLength;
+	}
 
-		if (!prevId.empty()) m_replacedGuids[prevId] = ToString(); // uOGUIDƒuGUIDL^
+	/// <summary>
+	/// 񂩂ݒ肵܂B啶EO {} EnCt32󂯕t܂B
+	/// </summary>
+	/// <returns>͂łȂ falseil͕ςȂj</returns>
+	bool FromString(const std::string_view strGuid)
+	{
+		if (auto guid{ Parse(strGuid) })
+		{
+			*this = *guid;
+			return true;
+		}
+		_ASSERT_EXPR(false, "GUID Not From String");
+		return false;
 	}
 
-	std::string ToString() const
+	static constexpr std::optional<FlGuid> Parse(std::string_view str) noexcept
 	{
-		auto ret   { std::string{} };
-		auto string{ RPC_CSTR{} };
+		if (str.size() == StringLength + 2 && str.front() == '{' && str.back() == '}') str = str.substr(1, StringLength);
 
-		if (UuidToStringA(&m_guid, &string) == RPC_S_OK) ret = reinterpret_cast<char*>(string);
+		const auto isDashed{ str.size() == StringLength };
+		if (isDashed)
+		{
+			if (str[8] != '-' || str[13] != '-' || str[18] != '-' || str[23] != '-') return std::nullopt;
+		}
+		else if (str.size() != 32) return std::nullopt;
 
-		return ret;
+		// sȕΏʃrbg̂ōŌɂ܂Ƃ߂Ĕ肷
+		auto high   { uint64_t{} };
+		auto low    { uint64_t{} };
+		auto invalid{ uint8_t{} };
+		for (auto i{ size_t{} }; i < 16; ++i)
+		{
+			const auto h{ HexValue(str[isDashed ? DigitPositions[i] : i]) };
+			const auto l{ HexValue(str[isDashed ? DigitPositions[i + 16] : i + 16]) };
+			invalid |= h | l;
+			high = (high << 4) | (h & 0xF);
+			low  = (low  << 4) | (l & 0xF);
+		}
+		if (invalid & 0x80) return std::nullopt;
+
+		return FlGuid{ high, low };
 	}
 
-	auto FromString(const std::string& strGuid)
-	{
-		auto status{ UuidFromStringA(reinterpret_cast<RPC_CSTR>(const_cast<char*>(strGuid.c_str())), &m_guid)};
+	constexpr bool IsNil() const noexcept { return m_high == Def::ULongLongZero && m_low == Def::ULongLongZero; }
+
+	constexpr uint64_t GetHigh() const noexcept { return m_high; }
+	constexpr uint64_t GetLow () const noexcept { return m_low; }
+
+	constexpr auto operator<=>(const FlGuid&) const noexcept = default;
+
+	// uGUIDԂiuĂȂ oldGuid ̂܂܁j
+	static FlGuid GetReplacedGuid(const FlGuid& oldGuid);
 
-		if (status != RPC_S_OK && status != RPC_S_UUID_LOCAL_ONLY) _ASSERT_EXPR(false, "GUID Not From String");
+	static std::string GetReplacedGuid(const std::string& oldGuid)
+	{
+		auto guid{ Parse(oldGuid) };
+		return guid ? GetReplacedGuid(*guid).ToString() : oldGuid;
 	}
 
-	static const auto& GetReplacedGuid(const std::string& oldGuid)
+private:
+
+	// 16ïʒui8-4-4-4-12 ̃nCt΂j
+	static constexpr std::array<uint8_t, 32> DigitPositions{
+		 0,  1,  2,  3,  4,  5,  6,  7,
+		 9, 10, 11, 12,
+		14, 15, 16, 17,
+		19, 20, 21, 22,
+		24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35,
+	};
+
+	// 16i̒lBłȂ 0x80
+	static constexpr uint8_t HexValue(const char c) noexcept
 	{
-		auto it{ m_replacedGuids.find(oldGuid) };
+		if (c >= '0' && c <= '9') return static_cast<uint8_t>(c - '0');
+		if (c >= 'a' && c <= 'f') return static_cast<uint8_t>(c - 'a' + 10);
+		if (c >= 'A' && c <= 'F') return static_cast<uint8_t>(c - 'A' + 10);
+		return 0x80;
+	}
+
+	uint64_t m_high{}; // ̐擪 16
+	uint64_t m_low {}; // ̖ 16
+};
 
-		if (it != m_replacedGuids.end()) return it->second; // uGUIDԂ 
-		return oldGuid; // ȂΌGUIDԂ
+template<>
+struct std::hash<FlGuid>
+{
+	size_t operator()(const FlGuid& guid) const noexcept
+	{
+		// RłȂli菑EAԁjł΂Ȃ悤ɍ
+		auto h{ guid.GetHigh() * 0x9E3779B97F4A7C15ULL ^ guid.GetLow() };
+		h ^= h >> 33;
+		h *= 0xFF51AFD7ED558CCDULL;
+		h ^= h >> 33;
+		return static_cast<size_t>(h);
 	}
-private:
-	UUID m_guid{};
-	static std::map<std::string, std::string> m_replacedGuids; // uOGUIDƒuGUID̃}bv
-};
\ No newline at end of file
+};
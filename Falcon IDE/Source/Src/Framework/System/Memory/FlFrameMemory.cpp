@@ -0,0 +1,33 @@
+#include "FlFrameMemory.h"
+
+FlFrameMemory::Scratch& FlFrameMemory::RegisterScratch()
+{
+    // Xbh̏IŃXNb`ig͋Ȃ̂ł̂܂܎̃Xbh։񂷁j
+    struct Holder
+    {
+        Scratch* pScratch = nullptr;
+        ~Holder() { if (pScratch) pScratch->isOrphaned.store(true, std::memory_order_release); }
+    };
+    thread_local auto holder{ Holder{} };
+
+    auto& memory{ Instance() };
+    auto lock{ std::lock_guard{ memory.m_registryMutex } };
+
+    auto pScratch{ static_cast<Scratch*>(nullptr) };
+    for (const auto& upScratch : memory.m_scratches)
+    {
+        auto isOrphaned{ true };
+        if (upScratch->isOrphaned.compare_exchange_strong(isOrphaned, false, std::memory_order_acq_rel))
+        {
+            pScratch = upScratch.get();
+            break;
+        }
+    }
+    if (!pScratch) pScratch = memory.m_scratches.emplace_back(std::make_unique<Scratch>()).get();
+
+    pScratch->name = std::format("Scratch {}", memory.m_nextScratchIndex++);
+
+    holder.pScratch = pScratch;
+    s_pScratch      = pScratch;
+    return *pScratch;
+}
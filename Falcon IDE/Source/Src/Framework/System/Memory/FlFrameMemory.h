@@ -0,0 +1,110 @@
+#pragma once
+#include "FlLinearArena.h"
+
+/// <summary> =Singleton= </summary>
+/// t[Pʂ̈ꎞłB
+///  t[A[i : CXbhpBmۂ͎̂ BeginFrame ł܂Ƃ߂Ď̂Ă܂B
+///  XNb`       : XbhƂ̃A[iBFlScratchScope ̎̊Ԃg܂B
+class FlFrameMemory
+{
+public:
+
+    static constexpr size_t FrameCapacity  { 1024U * 1024U };
+    static constexpr size_t ScratchCapacity{ 256U * 1024U };
+
+    /// <summary>
+    /// t[̐擪ŃCXbhĂт܂BOt[̊mۂSĎ̂Ă܂B
+    /// </summary>
+    void BeginFrame() { m_frameArena.Reset(); }
+
+    FlLinearArena& WorkFrameArena() noexcept { return m_frameArena; }
+
+    /// <summary>
+    /// ĂяoXbh̃XNb`iɓo^j
+    /// </summary>
+    static FlLinearArena& WorkScratchArena()
+    {
+        return s_pScratch ? s_pScratch->arena : RegisterScratch().arena;
+    }
+
+    /// <summary>
+    /// t[A[iƓo^ς݂̃XNb`̓vn܂Bifn(O, v)Eǂ̃Xbhłj
+    /// </summary>
+    template<class Fn>
+    void ForEachStatistics(Fn&& fn) const
+    {
+        fn("Frame", m_frameArena.GetStatistics());
+
+        auto lock{ std::lock_guard{ m_registryMutex } };
+        for (const auto& upScratch : m_scratches)
+        {
+            if (upScratch->isOrphaned.load(std::memory_order_acquire)) continue;
+            fn(upScratch->name.c_str(), upScratch->arena.GetStatistics());
+        }
+    }
+
+    static auto& Instance() noexcept
+    {
+        static auto instance{ FlFrameMemory{} };
+        return instance;
+    }
+
+private:
+
+    FlFrameMemory() = default;
+    ~FlFrameMemory() = default;
+
+    FlFrameMemory(const FlFrameMemory&) = delete;
+    FlFrameMemory& operator=(const FlFrameMemory&) = delete;
+
+    struct Scratch
+    {
+        FlLinearArena     arena{ ScratchCapacity };
+        std::string       name;
+        std::atomic<bool> isOrphaned{ false }; // ̃XbhIiɓo^Xbhgj
+    };
+
+    static Scratch& RegisterScratch();
+
+    FlLinearArena m_frameArena{ FrameCapacity };
+
+    mutable std::mutex                    m_registryMutex;
+    std::vector<std::unique_ptr<Scratch>> m_scratches;
+    uint32_t                              m_nextScratchIndex = Def::UIntZero;
+
+    static inline thread_local Scratch* s_pScratch = nullptr;
+};
+
+/// <summary>
+/// Ԃ̊ԂĂяoXbh̃XNb`g܂BƓ_܂Ŗ߂܂B
+/// qɂł܂Amۂ̂XR[v̊O֎oȂłB
+/// </summary>
+class FlScratchScope
+{
+public:
+
+    FlScratchScope()
+        : m_arena { FlFrameMemory::WorkScratchArena() }
+        , m_marker{ m_arena.GetMarker() }
+    {}
+
+    ~FlScratchScope() { m_arena.Rewind(m_marker); }
+
+    FlScratchScope(const FlScratchScope&) = delete;
+    FlScratchScope& operator=(const FlScratchScope&) = delete;
+
+    FlLinearArena& WorkArena() const noexcept { return m_arena; }
+
+    template<class T>
+    std::span<T> AllocateSpan(const size_t count) { return m_arena.AllocateSpan<T>(count); }
+
+    std::string_view CopyString(const std::string_view str) { return m_arena.CopyString(str); }
+
+    template<class T>
+    FlArenaVector<T> MakeVector() const { return FlArenaVector<T>{ FlArenaAllocator<T>{ m_arena } }; }
+
+private:
+
+    FlLinearArena&        m_arena;
+    FlLinearArena::Marker m_marker;
+};
@@ -0,0 +1,97 @@
+#include "FlLinearArena.h"
+
+FlLinearArena::FlLinearArena(const size_t capacity)
+{
+    m_chunks.push_back({ std::make_unique_for_overwrite<std::byte[]>(capacity), capacity });
+    m_capacity.store(capacity, std::memory_order_relaxed);
+    m_charge.Set(capacity);
+}
+
+void* FlLinearArena::AllocateSlow(const size_t size, const size_t alignment)
+{
+    // ̉򂪎cĂ΁iRewind jgAΔ{̑傫ő
+    while (++m_chunkIndex < m_chunks.size())
+    {
+        m_chunkBase += m_chunks[m_chunkIndex - Def::ULongLongOne].size;
+        m_offset     = Def::ULongLongZero;
+        if (m_chunks[m_chunkIndex].size >= size + alignment) return Allocate(size, alignment);
+    }
+
+    const auto& last{ m_chunks.back() };
+    const auto chunkSize{ std::max(last.size * 2U, size + alignment) };
+
+    m_chunkBase += last.size;
+    m_offset     = Def::ULongLongZero;
+    m_chunks.push_back({ std::make_unique_for_overwrite<std::byte[]>(chunkSize), chunkSize });
+
+    m_capacity.fetch_add(chunkSize, std::memory_order_relaxed);
+    m_charge.Add(chunkSize);
+    m_overflows.fetch_add(Def::ULongLongOne, std::memory_order_relaxed);
+
+    return Allocate(size, alignment);
+}
+
+void FlLinearArena::PoisonReleased([[maybe_unused]] const Marker from) noexcept
+{
+#ifdef _DEBUG
+    for (auto i{ from.chunk }; i <= m_chunkIndex; ++i)
+    {
+        const auto begin{ i == from.chunk   ? from.offset : Def::ULongLongZero };
+        const auto end  { i == m_chunkIndex ? m_offset    : m_chunks[i].size };
+        if (end > begin) Poison(m_chunks[i].upData.get() + begin, end - begin, ReleasedPattern);
+    }
+#endif // _DEBUG
+}
+
+void FlLinearArena::Rewind(const Marker marker) noexcept
+{
+    if (marker.chunk == Def::ULongLongZero && marker.offset == Def::ULongLongZero)
+    {
+        Reset();
+        return;
+    }
+
+    m_peak = std::max(m_peak, GetUsed());
+    PoisonReleased(marker);
+
+    while (m_chunkIndex > marker.chunk)
+    {
+        --m_chunkIndex;
+        m_chunkBase -= m_chunks[m_chunkIndex].size;
+    }
+    m_offset = marker.offset;
+}
+
+void FlLinearArena::Reset()
+{
+    m_peak = std::max(m_peak, GetUsed());
+    PoisonReleased({});
+
+    // 1ŉ򂪑獇v̑傫1ɒui͈̎Ȃj
+    if (m_chunks.size() > Def::ULongLongOne)
+    {
+        auto total{ Def::ULongLongZero };
+        for (const auto& chunk : m_chunks) total += chunk.size;
+
+        m_chunks.clear();
+        m_chunks.push_back({ std::make_unique_for_overwrite<std::byte[]>(total), total });
+        m_capacity.store(total, std::memory_order_relaxed);
+        m_charge.Set(total);
+    }
+
+    m_chunkIndex = Def::ULongLongZero;
+    m_chunkBase  = Def::ULongLongZero;
+    m_offset     = Def::ULongLongZero;
+
+    Publish();
+}
+
+void FlLinearArena::Publish() noexcept
+{
+    m_lastPeak.store(m_peak, std::memory_order_relaxed);
+    if (m_peak > m_highWater.load(std::memory_order_relaxed)) m_highWater.store(m_peak, std::memory_order_relaxed);
+    m_lastAllocations.store(m_allocations, std::memory_order_relaxed);
+
+    m_peak        = Def::ULongLongZero;
+    m_allocations = Def::ULongLongZero;
+}
@@ -0,0 +1,201 @@
+#pragma once
+
+/// <summary>
+/// `iovjAP[^łBmۂ̓|C^i߂邾Ōʂɂ͉A
+/// Rewind / Reset ł܂Ƃ߂Ė߂܂Bi1XbhpEfXgN^͌Ăт܂j
+/// 򂪑ȂȂƃq[vǉA Reset 1̑傫ȉɂ܂Ƃߒ߁A
+/// gpʂ̓q[vmۂN܂B
+/// _DEBUG ł͊mۂ̈ 0xCDA߂̈ 0xDD Ŗ߂Ď؂̎QƂ₷܂B
+/// </summary>
+class FlLinearArena
+{
+public:
+
+    static constexpr size_t DefaultCapacity{ 256U * 1024U };
+
+    struct Marker
+    {
+        size_t chunk  = Def::ULongLongZero;
+        size_t offset = Def::ULongLongZero;
+    };
+
+    // Reseti܂͐擪܂ł Rewindj̎_ōXV܂BXbhǂ߂܂
+    struct Statistics
+    {
+        size_t   lastPeak    = Def::ULongLongZero; // O̎ōłg
+        size_t   highWater   = Def::ULongLongZero; // ܂ł̍ő
+        size_t   capacity    = Def::ULongLongZero; // mۍς݂̉̍v
+        uint64_t allocations = Def::ULongLongZero; // O̎̊mۉ
+        uint64_t overflows   = Def::ULongLongZero; // 𑫂񐔁i݌vj
+    };
+
+    explicit FlLinearArena(const size_t capacity = DefaultCapacity);
+    ~FlLinearArena() = default;
+
+    FlLinearArena(const FlLinearArena&) = delete;
+    FlLinearArena& operator=(const FlLinearArena&) = delete;
+
+    /// <summary>
+    /// ̗̈mۂ܂B
+    /// </summary>
+    /// <param name="alignment">2̗ݏ</param>
+    void* Allocate(const size_t size, const size_t alignment = alignof(std::max_align_t))
+    {
+        const auto& chunk{ m_chunks[m_chunkIndex] };
+        const auto base   { reinterpret_cast<uintptr_t>(chunk.upData.get()) };
+        const auto aligned{ (base + m_offset + alignment - Def::ULongLongOne) & ~(alignment - Def::ULongLongOne) };
+        const auto end    { aligned - base + size };
+        if (end > chunk.size) return AllocateSlow(size, alignment);
+
+        m_offset = end;
+        ++m_allocations;
+        Poison(reinterpret_cast<std::byte*>(aligned), size, AllocatedPattern);
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    /// <summary>
+    /// count \zzmۂ܂BijɃfXgN^͌Ă΂܂j
+    /// </summary>
+    template<class T>
+    std::span<T> AllocateSpan(const size_t count)
+    {
+        static_assert(std::is_trivially_destructible_v<T>, "FlLinearArena does not run destructors");
+
+        auto p{ static_cast<T*>(Allocate(sizeof(T) * count, alignof(T))) };
+        std::uninitialized_default_construct_n(p, count);
+        return { p, count };
+    }
+
+    /// <summary>
+    /// 𕡐܂BiI[tE̓A[iɏ]j
+    /// </summary>
+    std::string_view CopyString(const std::string_view str)
+    {
+        auto p{ static_cast<char*>(Allocate(str.size() + Def::ULongLongOne, alignof(char))) };
+        std::memcpy(p, str.data(), str.size());
+        p[str.size()] = '\0';
+        return { p, str.size() };
+    }
+
+    /// <summary>
+    /// OɊmۂ̈Ȃ߂܂BȊO͉܂BiSTL A_v^pj
+    /// </summary>
+    void Deallocate(void* p, const size_t size) noexcept
+    {
+        const auto top{ m_chunks[m_chunkIndex].upData.get() + m_offset };
+        if (static_cast<std::byte*>(p) + size != top) return;
+
+        m_offset -= size;
+        Poison(static_cast<std::byte*>(p), size, ReleasedPattern);
+    }
+
+    Marker GetMarker() const noexcept { return { m_chunkIndex, m_offset }; }
+
+    /// <summary>
+    /// marker _܂Ŗ߂܂B擪܂Ŗ߂ꍇ Reset ƓłB
+    /// </summary>
+    void Rewind(const Marker marker) noexcept;
+
+    /// <summary>
+    /// SĖ߂A򂪕1ɂ܂ƂߒēvXV܂B
+    /// </summary>
+    void Reset();
+
+    // ݂̎gpʁiỎ̗]܂ށj
+    size_t GetUsed() const noexcept { return m_chunkBase + m_offset; }
+
+    Statistics GetStatistics() const noexcept
+    {
+        return {
+            m_lastPeak.load(std::memory_order_relaxed),
+            m_highWater.load(std::memory_order_relaxed),
+            m_capacity.load(std::memory_order_relaxed),
+            m_lastAllocations.load(std::memory_order_relaxed),
+            m_overflows.load(std::memory_order_relaxed),
+        };
+    }
+
+private:
+
+    struct Chunk
+    {
+        std::unique_ptr<std::byte[]> upData;
+        size_t                       size = Def::ULongLongZero;
+    };
+
+    static constexpr uint8_t AllocatedPattern{ 0xCD };
+    static constexpr uint8_t ReleasedPattern { 0xDD };
+
+    static void Poison([[maybe_unused]] std::byte* p, [[maybe_unused]] const size_t size, [[maybe_unused]] const uint8_t pattern) noexcept
+    {
+#ifdef _DEBUG
+        std::memset(p, pattern, size);
+#endif // _DEBUG
+    }
+
+    void* AllocateSlow(const size_t size, const size_t alignment);
+
+    // [from, ݈ʒu) ߂Ŗ߂
+    void PoisonReleased(const Marker from) noexcept;
+
+    void Publish() noexcept;
+
+    std::vector<Chunk> m_chunks;
+    size_t m_chunkIndex = Def::ULongLongZero;
+    size_t m_chunkBase  = Def::ULongLongZero; // m_chunkIndex Ỏ̍v
+    size_t m_offset     = Def::ULongLongZero;
+
+    size_t   m_peak        = Def::ULongLongZero;
+    uint64_t m_allocations = Def::ULongLongZero;
+
+    std::atomic<size_t>   m_lastPeak       { Def::ULongLongZero };
+    std::atomic<size_t>   m_highWater      { Def::ULongLongZero };
+    std::atomic<size_t>   m_capacity       { Def::ULongLongZero };
+    std::atomic<uint64_t> m_lastAllocations{ Def::ULongLongZero };
+    std::atomic<uint64_t> m_overflows      { Def::ULongLongZero };
+
+    FlMemoryCharge m_charge{ FlMemoryTag::FrameArena };
+};
+
+/// <summary>
+/// FlLinearArena mۂ STL ݊AP[^łB
+/// ͒O̊mۂ̎sAc̓A[i Rewind / Reset Ŗ߂܂B
+/// </summary>
+template<class T>
+class FlArenaAllocator
+{
+public:
+
+    using value_type = T;
+
+    FlArenaAllocator(FlLinearArena& arena) noexcept
+        : m_pArena{ &arena }
+    {}
+
+    template<class U>
+    FlArenaAllocator(const FlArenaAllocator<U>& other) noexcept
+        : m_pArena{ other.GetArena() }
+    {}
+
+    T* allocate(const size_t count)
+    {
+        return static_cast<T*>(m_pArena->Allocate(sizeof(T) * count, alignof(T)));
+    }
+
+    void deallocate(T* p, const size_t count) noexcept
+    {
+        m_pArena->Deallocate(p, sizeof(T) * count);
+    }
+
+    FlLinearArena* GetArena() const noexcept { return m_pArena; }
+
+    template<class U>
+    bool operator==(const FlArenaAllocator<U>& other) const noexcept { return m_pArena == other.GetArena(); }
+
+private:
+
+    FlLinearArena* m_pArena;
+};
+
+template<class T>
+using FlArenaVector = std::vector<T, FlArenaAllocator<T>>;
@@ -0,0 +1,218 @@
+#include "FlMemoryTracker.h"
+
+#ifdef _WIN32
+
+#pragma comment(lib, "dbghelp.lib")
+#include <dbghelp.h>
+
+uint8_t FlMemoryTracker::CaptureCallstack(std::array<void*, MaxCallstackDepth>& frames) noexcept
+{
+    // CaptureCallstack / Remember / Record ΂
+    return static_cast<uint8_t>(RtlCaptureStackBackTrace(3UL, static_cast<ULONG>(frames.size()), frames.data(), nullptr));
+}
+
+std::string FlMemoryTracker::ResolveSymbol(void* address)
+{
+    // DbgHelp ̓XbhZ[tł͂Ȃ̂ŉ1{
+    static auto mutex{ std::mutex{} };
+    auto lock{ std::lock_guard{ mutex } };
+
+    static const auto isInitialized{ [] {
+        SymSetOptions(SYMOPT_UNDNAME | SYMOPT_DEFERRED_LOADS | SYMOPT_LOAD_LINES);
+        return SymInitialize(GetCurrentProcess(), nullptr, TRUE) != FALSE;
+    }() };
+    if (!isInitialized) return std::format("0x{:016X}", reinterpret_cast<uintptr_t>(address));
+
+    auto buffer{ std::array<std::byte, sizeof(SYMBOL_INFO) + MAX_SYM_NAME>{} };
+    auto pSymbol{ reinterpret_cast<SYMBOL_INFO*>(buffer.data()) };
+    pSymbol->SizeOfStruct = sizeof(SYMBOL_INFO);
+    pSymbol->MaxNameLen   = MAX_SYM_NAME;
+
+    const auto process{ GetCurrentProcess() };
+    const auto address64{ reinterpret_cast<DWORD64>(address) };
+    if (!SymFromAddr(process, address64, nullptr, pSymbol)) return std::format("0x{:016X}", address64);
+
+    auto line{ IMAGEHLP_LINE64{} };
+    line.SizeOfStruct = sizeof(IMAGEHLP_LINE64);
+    auto displacement{ DWORD{} };
+    if (SymGetLineFromAddr64(process, address64, &displacement, &line))
+        return std::format("{} ({}:{})", pSymbol->Name, line.FileName, line.LineNumber);
+
+    return pSymbol->Name;
+}
+
+#elif defined(__linux__)
+
+#include <execinfo.h>
+
+uint8_t FlMemoryTracker::CaptureCallstack(std::array<void*, MaxCallstackDepth>& frames) noexcept
+{
+    constexpr auto Skip{ 3 };
+
+    auto buffer{ std::array<void*, MaxCallstackDepth + Skip>{} };
+    const auto depth{ backtrace(buffer.data(), static_cast<int>(buffer.size())) };
+    if (depth <= Skip) return Def::UIntZero;
+
+    std::copy(buffer.begin() + Skip, buffer.begin() + depth, frames.begin());
+    return static_cast<uint8_t>(depth - Skip);
+}
+
+std::string FlMemoryTracker::ResolveSymbol(void* address)
+{
+    auto symbols{ backtrace_symbols(&address, 1) };
+    if (!symbols) return std::format("{}", address);
+
+    auto name{ std::string{ symbols[0] } };
+    std::free(symbols);
+    return name;
+}
+
+#else
+
+uint8_t FlMemoryTracker::CaptureCallstack(std::array<void*, MaxCallstackDepth>&) noexcept { return Def::UIntZero; }
+
+std::string FlMemoryTracker::ResolveSymbol(void* address) { return std::format("{}", address); }
+
+#endif // _WIN32
+
+FlMemoryTracker::TagStatistics FlMemoryTracker::GetStatistics(const FlMemoryTag tag) const noexcept
+{
+    const auto& counter{ s_counters[static_cast<size_t>(tag)] };
+    return {
+        counter.current.load(std::memory_order_relaxed),
+        counter.peak.load(std::memory_order_relaxed),
+        counter.allocations.load(std::memory_order_relaxed),
+        counter.frees.load(std::memory_order_relaxed),
+        counter.budget.load(std::memory_order_relaxed),
+    };
+}
+
+void FlMemoryTracker::ResetPeaks() noexcept
+{
+    for (auto& counter : s_counters) counter.peak.store(counter.current.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+void FlMemoryTracker::SetCaptureCallstacks(const bool isCapture) noexcept
+{
+    if (isCapture) s_hasRemembered.store(true, std::memory_order_relaxed);
+    s_isCapturing.store(isCapture, std::memory_order_relaxed);
+}
+
+void FlMemoryTracker::Remember(const FlMemoryTag tag, const size_t bytes, const void* p) noexcept
+{
+    auto allocation{ Allocation{ tag } };
+    allocation.bytes = bytes;
+    allocation.depth = CaptureCallstack(allocation.frames);
+
+    try
+    {
+        auto& tracker{ Instance() };
+        auto lock{ std::lock_guard{ tracker.m_liveMutex } };
+        tracker.m_live.insert_or_assign(p, allocation);
+    }
+    catch (...) {} // oȂĂmێ̂͑
+}
+
+void FlMemoryTracker::Forget(const void* p) noexcept
+{
+    auto& tracker{ Instance() };
+    auto lock{ std::lock_guard{ tracker.m_liveMutex } };
+    tracker.m_live.erase(p);
+
+    // Sĉꂽȍ~̉ŃbNȂ
+    if (tracker.m_live.empty() && !s_isCapturing.load(std::memory_order_relaxed)) s_hasRemembered.store(false, std::memory_order_relaxed);
+}
+
+std::vector<FlMemoryTracker::LiveAllocationGroup> FlMemoryTracker::CollectLiveAllocations() const
+{
+    struct Group
+    {
+        FlMemoryTag         tag   = FlMemoryTag::Count;
+        size_t              bytes = Def::ULongLongZero;
+        size_t              count = Def::ULongLongZero;
+        std::vector<void*>  frames;
+    };
+
+    // Ăяoiƃ^Oĵ܂Ƃ߂BO͒x̂ŃbNĂ
+    auto groups{ std::vector<Group>{} };
+    {
+        auto lock { std::lock_guard{ m_liveMutex } };
+        auto index{ std::unordered_map<std::string, size_t>{} };
+
+        for (const auto& [_, allocation] : m_live)
+        {
+            // L[ = ^O1oCg + ߂AhX̕
+            auto key{ std::string(Def::ULongLongOne, static_cast<char>(allocation.tag)) };
+            key.append(reinterpret_cast<const char*>(allocation.frames.data()), sizeof(void*) * allocation.depth);
+
+            auto [it, isInserted]{ index.try_emplace(std::move(key), groups.size()) };
+            if (isInserted) groups.push_back({ allocation.tag, Def::ULongLongZero, Def::ULongLongZero,
+                { allocation.frames.begin(), allocation.frames.begin() + allocation.depth } });
+
+            auto& group{ groups[it->second] };
+            group.bytes += allocation.bytes;
+            ++group.count;
+        }
+    }
+
+    std::ranges::sort(groups, std::greater{}, &Group::bytes);
+
+    auto result{ std::vector<LiveAllocationGroup>{} };
+    result.reserve(groups.size());
+    for (auto& group : groups)
+    {
+        auto& live{ result.emplace_back(LiveAllocationGroup{ group.tag, group.bytes, group.count }) };
+        live.frames.reserve(group.frames.size());
+        for (const auto address : group.frames) live.frames.push_back(ResolveSymbol(address));
+    }
+    return result;
+}
+
+nlohmann::json FlMemoryTracker::ToJson(const bool isIncludeAllocations) const
+{
+    nlohmann::json root = nlohmann::json::object();
+    root["enabled"] = FL_MEMORY_TRACKING_ENABLED != 0;
+
+    nlohmann::json tags = nlohmann::json::object();
+    for (auto i{ size_t{} }; i < TagCount; ++i)
+    {
+        const auto stats{ GetStatistics(static_cast<FlMemoryTag>(i)) };
+        tags[TagNames[i]] = {
+            { "current",     stats.current },
+            { "peak",        stats.peak },
+            { "allocations", stats.allocations },
+            { "frees",       stats.frees },
+            { "budget",      stats.budget },
+            { "overBudget",  stats.IsOverBudget() },
+        };
+    }
+    root["tags"] = std::move(tags);
+
+    if (isIncludeAllocations)
+    {
+        nlohmann::json allocations = nlohmann::json::array();
+        for (const auto& group : CollectLiveAllocations())
+        {
+            allocations.push_back({
+                { "tag",    TagNames[static_cast<size_t>(group.tag)] },
+                { "bytes",  group.bytes },
+                { "count",  group.count },
+                { "frames", group.frames },
+            });
+        }
+        root["allocations"] = std::move(allocations);
+    }
+    return root;
+}
+
+bool FlMemoryTracker::DumpJson(const std::filesystem::path& path, const bool isIncludeAllocations) const
+{
+    auto ec{ std::error_code{} };
+    if (path.has_parent_path()) std::filesystem::create_directories(path.parent_path(), ec);
+
+    auto ofs{ std::ofstream{ path } };
+    if (!ofs) return false;
+
+    ofs << ToJson(isIncludeAllocations).dump(2);
+    return static_cast<bool>(ofs);
+}
@@ -0,0 +1,276 @@
+#pragma once
+
+// 0 `đŜrhƋL^ׂċɂȂ܂iAP[^ std::allocator Ɠj
+#ifndef FL_MEMORY_TRACKING_ENABLED
+#define FL_MEMORY_TRACKING_ENABLED 1
+#endif // !FL_MEMORY_TRACKING_ENABLED
+
+/// <summary>
+/// 𐔂TuVXe̋敪
+/// </summary>
+enum class FlMemoryTag : uint8_t
+{
+    Ecs,         // ECS ̃Xg[WEXbg
+    Resource,    // \[X}l[W̃LbV
+    BinaryCache, // FlBinaryManager ̃LbV
+    Log,         // O̗
+    Guid,        // ^t@C GUID Ή\
+    Mesh,        // bV̒_ECfbNXiAbv[hq[vj CPU ̎ʂ
+    FrameArena,  // t[EXNb`A[ỉ
+    EditHistory, // GfB^̌ɖ߂E蒼̋L^
+    Count
+};
+
+/// <summary> =Singleton= </summary>
+/// TuVXeiFlMemoryTagjƂ̎gpʁEs[NEmۉ񐔂Ɨ\Z𐔂܂B
+/// ̂ FlTrackedAllocator gRei FlMemoryCharge Ő\łBivZXŜł͂Ȃj
+/// L^̓^OƂ̌qJE^̉ŁAbN܂B
+/// ĂяőL^LɂƁAȍ~̃|C^t̊mۂ𐶑̊Ԃoă[Nꗗɏo܂B
+class FlMemoryTracker
+{
+public:
+
+    static constexpr size_t TagCount{ static_cast<size_t>(FlMemoryTag::Count) };
+
+    static constexpr std::array<const char*, TagCount> TagNames{
+        "ECS", "Resource", "BinaryCache", "Log", "Guid", "Mesh", "FrameArena", "EditHistory",
+    };
+
+    static constexpr size_t MaxCallstackDepth{ 24U };
+
+    struct TagStatistics
+    {
+        size_t   current     = Def::ULongLongZero;
+        size_t   peak        = Def::ULongLongZero;
+        uint64_t allocations = Def::ULongLongZero;
+        uint64_t frees       = Def::ULongLongZero;
+        size_t   budget      = Def::ULongLongZero; // 0 Ȃ疳
+
+        bool IsOverBudget() const noexcept { return budget != Def::ULongLongZero && current > budget; }
+    };
+
+    // ĂяomۂĐĂ̂܂Ƃ߂
+    struct LiveAllocationGroup
+    {
+        FlMemoryTag              tag   = FlMemoryTag::Count;
+        size_t                   bytes = Def::ULongLongZero;
+        size_t                   count = Def::ULongLongZero;
+        std::vector<std::string> frames; // Ăяo珇
+    };
+
+    static void Record([[maybe_unused]] const FlMemoryTag tag, [[maybe_unused]] const size_t bytes, [[maybe_unused]] const void* p = nullptr) noexcept
+    {
+#if FL_MEMORY_TRACKING_ENABLED
+        auto& counter{ s_counters[static_cast<size_t>(tag)] };
+        const auto current{ counter.current.fetch_add(bytes, std::memory_order_relaxed) + bytes };
+        counter.allocations.fetch_add(Def::ULongLongOne, std::memory_order_relaxed);
+
+        auto peak{ counter.peak.load(std::memory_order_relaxed) };
+        while (current > peak && !counter.peak.compare_exchange_weak(peak, current, std::memory_order_relaxed)) {}
+
+        if (p && s_isCapturing.load(std::memory_order_relaxed)) Remember(tag, bytes, p);
+#endif // FL_MEMORY_TRACKING_ENABLED
+    }
+
+    static void Release([[maybe_unused]] const FlMemoryTag tag, [[maybe_unused]] const size_t bytes, [[maybe_unused]] const void* p = nullptr) noexcept
+    {
+#if FL_MEMORY_TRACKING_ENABLED
+        auto& counter{ s_counters[static_cast<size_t>(tag)] };
+        counter.current.fetch_sub(bytes, std::memory_order_relaxed);
+        counter.frees.fetch_add(Def::ULongLongOne, std::memory_order_relaxed);
+
+        // L^~߂AL^Ɋô͉ŏ
+        if (p && s_hasRemembered.load(std::memory_order_relaxed)) Forget(p);
+#endif // FL_MEMORY_TRACKING_ENABLED
+    }
+
+    TagStatistics GetStatistics(const FlMemoryTag tag) const noexcept;
+
+    void SetBudget(const FlMemoryTag tag, const size_t bytes) noexcept
+    {
+        s_counters[static_cast<size_t>(tag)].budget.store(bytes, std::memory_order_relaxed);
+    }
+
+    // s[N݂̎gpʂɖ߂
+    void ResetPeaks() noexcept;
+
+    /// <summary>
+    /// ĂяőL^؂ւ܂BiL̊mۂ1ƂɃbNƗ̎擾܂j
+    /// </summary>
+    void SetCaptureCallstacks(const bool isCapture) noexcept;
+    bool IsCapturingCallstacks() const noexcept { return s_isCapturing.load(std::memory_order_relaxed); }
+
+    /// <summary>
+    /// L^ɊmۂA܂ĂȂ̂ĂяoƂɂ܂Ƃ߂ĕԂ܂Bi傫j
+    /// </summary>
+    std::vector<LiveAllocationGroup> CollectLiveAllocations() const;
+
+    /// <summary>
+    /// ^OƂ̓vi isIncludeAllocations Ȃ琶̊mہj JSON ɂ܂B
+    /// { "enabled", "tags": { O: { current, peak, allocations, frees, budget, overBudget } }, "allocations": [...] }
+    /// </summary>
+    nlohmann::json ToJson(const bool isIncludeAllocations = false) const;
+
+    bool DumpJson(const std::filesystem::path& path, const bool isIncludeAllocations = false) const;
+
+    static auto& Instance() noexcept
+    {
+        static auto instance{ FlMemoryTracker{} };
+        return instance;
+    }
+
+private:
+
+    FlMemoryTracker() = default;
+
+    // ォjÓIIuWFNg̉ m_live ɐGȂ悤ɂ
+    ~FlMemoryTracker()
+    {
+        s_isCapturing.store(false, std::memory_order_relaxed);
+        s_hasRemembered.store(false, std::memory_order_relaxed);
+    }
+
+    FlMemoryTracker(const FlMemoryTracker&) = delete;
+    FlMemoryTracker& operator=(const FlMemoryTracker&) = delete;
+
+    static constexpr size_t CacheLineSize{ 64U };
+
+    // std::atomic ͊\z 0iÓÏɒuߏq͏Ȃj
+    struct alignas(CacheLineSize) Counter
+    {
+        std::atomic<size_t>   current;
+        std::atomic<size_t>   peak;
+        std::atomic<uint64_t> allocations;
+        std::atomic<uint64_t> frees;
+        std::atomic<size_t>   budget;
+    };
+
+    struct Allocation
+    {
+        FlMemoryTag tag   = FlMemoryTag::Count;
+        uint8_t     depth = Def::UIntZero;
+        size_t      bytes = Def::ULongLongZero;
+        std::array<void*, MaxCallstackDepth> frames{};
+    };
+
+    static void Remember(const FlMemoryTag tag, const size_t bytes, const void* p) noexcept;
+    static void Forget(const void* p) noexcept;
+
+    static uint8_t CaptureCallstack(std::array<void*, MaxCallstackDepth>& frames) noexcept;
+    static std::string ResolveSymbol(void* address);
+
+    static inline std::array<Counter, TagCount> s_counters{};
+    static inline std::atomic<bool>             s_isCapturing  { false };
+    static inline std::atomic<bool>             s_hasRemembered{ false };
+
+    // m_live ̂ std::allocator ŊmۂiƍċAj
+    mutable std::mutex                          m_liveMutex;
+    std::unordered_map<const void*, Allocation> m_live;
+};
+
+/// <summary>
+/// mہE^O֐ STL ݊AP[^łBiԂAstd::allocator Ɠ悤ɔr͏ɓj
+/// </summary>
+template<class T, FlMemoryTag Tag>
+class FlTrackedAllocator
+{
+public:
+
+    using value_type = T;
+
+    template<class U>
+    struct rebind { using other = FlTrackedAllocator<U, Tag>; };
+
+    FlTrackedAllocator() noexcept = default;
+
+    template<class U>
+    FlTrackedAllocator(const FlTrackedAllocator<U, Tag>&) noexcept {}
+
+    T* allocate(const size_t count)
+    {
+        auto p{ std::allocator<T>{}.allocate(count) };
+        FlMemoryTracker::Record(Tag, sizeof(T) * count, p);
+        return p;
+    }
+
+    void deallocate(T* p, const size_t count) noexcept
+    {
+        FlMemoryTracker::Release(Tag, sizeof(T) * count, p);
+        std::allocator<T>{}.deallocate(p, count);
+    }
+
+    template<class U>
+    bool operator==(const FlTrackedAllocator<U, Tag>&) const noexcept { return true; }
+};
+
+template<class T, FlMemoryTag Tag>
+using FlTrackedVector = std::vector<T, FlTrackedAllocator<T, Tag>>;
+
+template<class Key, class Value, FlMemoryTag Tag, class Hash = std::hash<Key>>
+using FlTrackedUnorderedMap = std::unordered_map<Key, Value, Hash, std::equal_to<Key>, FlTrackedAllocator<std::pair<const Key, Value>, Tag>>;
+
+/// <summary>
+/// AP[^ʂȂiGPU ̃obt@ELf[^j\܂B
+///  Set / Add ʂ^O֐AjŖ߂܂B
+/// </summary>
+class FlMemoryCharge
+{
+public:
+
+    explicit FlMemoryCharge(const FlMemoryTag tag, const size_t bytes = Def::ULongLongZero) noexcept
+        : m_tag{ tag }
+    {
+        Set(bytes);
+    }
+
+    ~FlMemoryCharge() { Set(Def::ULongLongZero); }
+
+    FlMemoryCharge(const FlMemoryCharge& other) noexcept
+        : m_tag{ other.m_tag }
+    {
+        Set(other.m_bytes);
+    }
+
+    FlMemoryCharge& operator=(const FlMemoryCharge& other) noexcept
+    {
+        if (this != &other)
+        {
+            Set(Def::ULongLongZero);
+            m_tag = other.m_tag;
+            Set(other.m_bytes);
+        }
+        return *this;
+    }
+
+    FlMemoryCharge(FlMemoryCharge&& other) noexcept
+        : m_tag  { other.m_tag }
+        , m_bytes{ std::exchange(other.m_bytes, Def::ULongLongZero) }
+    {}
+
+    FlMemoryCharge& operator=(FlMemoryCharge&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Set(Def::ULongLongZero);
+            m_tag   = other.m_tag;
+            m_bytes = std::exchange(other.m_bytes, Def::ULongLongZero);
+        }
+        return *this;
+    }
+
+    void Set(const size_t bytes) noexcept
+    {
+        if (bytes > m_bytes)      FlMemoryTracker::Record(m_tag, bytes - m_bytes);
+        else if (bytes < m_bytes) FlMemoryTracker::Release(m_tag, m_bytes - bytes);
+        m_bytes = bytes;
+    }
+
+    void Add(const size_t bytes) noexcept { Set(m_bytes + bytes); }
+
+    size_t GetBytes() const noexcept { return m_bytes; }
+
+private:
+
+    FlMemoryTag m_tag;
+    size_t      m_bytes = Def::ULongLongZero;
+};
@@ -0,0 +1,152 @@
+#include "FlSystemMonitor.h"
+
+FlSystemMonitor::FlSystemMonitor(const std::chrono::milliseconds interval)
+    : m_intervalMs{ std::clamp(static_cast<uint32_t>(interval.count()), MinIntervalMs, MaxIntervalMs) }
+{
+    m_state.processId      = m_backend.GetProcessId();
+    m_state.processorCount = m_backend.GetProcessorCount();
+}
+
+FlSystemMonitor::~FlSystemMonitor()
+{
+    Stop();
+}
+
+void FlSystemMonitor::Start()
+{
+    if (m_isRunning) return;
+
+    m_isStop    = false;
+    m_isRunning = true;
+    m_thread    = std::thread{ [this] { Run(); } };
+}
+
+void FlSystemMonitor::Stop()
+{
+    if (!m_isRunning) return;
+
+    {
+        auto lock{ std::lock_guard{ m_mutex } };
+        m_isStop = true;
+    }
+    m_condition.notify_one();
+
+    if (m_thread.joinable()) m_thread.join();
+    m_isRunning = false;
+}
+
+void FlSystemMonitor::SetInterval(const std::chrono::milliseconds interval) noexcept
+{
+    m_intervalMs.store(std::clamp(static_cast<uint32_t>(interval.count()), MinIntervalMs, MaxIntervalMs), std::memory_order_relaxed);
+    m_condition.notify_one();
+}
+
+void FlSystemMonitor::Run()
+{
+    FL_PROFILE_THREAD("SystemMonitor");
+
+    // ͍̊
+    m_backend.ReadSystemCpu(m_previousSystem);
+    auto process{ FlSystemMonitorBackend::ProcessSample{} };
+    m_backend.ReadProcess(process);
+    m_previousProcessSec = process.userSec + process.kernelSec;
+    m_backend.ReadThreads(m_threadSamples);
+    m_state.threads.clear();
+    for (const auto& sample : m_threadSamples)
+        m_state.threads.push_back({ sample.threadId, sample.priority, sample.userSec, sample.kernelSec });
+    std::ranges::sort(m_state.threads, {}, &ThreadRow::threadId);
+    m_previousTime = std::chrono::steady_clock::now();
+
+    auto next{ m_previousTime };
+    auto lock{ std::unique_lock{ m_mutex } };
+    for (;;)
+    {
+        // Ԋuς҂iZɌÂԊu҂؂Ȃj
+        auto intervalMs{ m_intervalMs.load(std::memory_order_relaxed) };
+        while (!m_isStop && m_condition.wait_until(lock, next + std::chrono::milliseconds{ intervalMs }, [&]
+            { return m_isStop || m_intervalMs.load(std::memory_order_relaxed) != intervalMs; }))
+        {
+            intervalMs = m_intervalMs.load(std::memory_order_relaxed);
+        }
+        if (m_isStop) break;
+
+        lock.unlock();
+        Sample();
+        lock.lock();
+
+        // 1Ԋuȏxꂽ߂ƂA琔
+        next += std::chrono::milliseconds{ intervalMs };
+        if (const auto now{ std::chrono::steady_clock::now() }; next + std::chrono::milliseconds{ intervalMs } < now) next = now;
+    }
+}
+
+void FlSystemMonitor::Sample()
+{
+    FL_PROFILE_FUNCTION();
+
+    const auto begin{ std::chrono::steady_clock::now() };
+
+    auto system { FlSystemMonitorBackend::CpuTimes{} };
+    auto process{ FlSystemMonitorBackend::ProcessSample{} };
+    const auto hasSystem { m_backend.ReadSystemCpu(system) };
+    const auto hasProcess{ m_backend.ReadProcess(process) };
+    m_backend.ReadThreads(m_threadSamples);
+
+    const auto now    { std::chrono::steady_clock::now() };
+    const auto elapsed{ std::max(std::chrono::duration<double>(now - m_previousTime).count(), 1e-6) };
+    m_previousTime = now;
+
+    // VXeS
+    if (hasSystem)
+    {
+        const auto total{ system.total - m_previousSystem.total };
+        const auto idle { system.idle  - m_previousSystem.idle };
+        const auto usage{ total ? (1.0 - static_cast<double>(idle) / static_cast<double>(total)) * 100.0 : Def::DoubleZero };
+        m_state.systemCpu.Push(static_cast<float>(std::clamp(usage, Def::DoubleZero, 100.0)));
+        m_previousSystem = system;
+    }
+
+    // vZX
+    if (hasProcess)
+    {
+        const auto processSec{ process.userSec + process.kernelSec };
+        const auto usage{ (processSec - m_previousProcessSec) / elapsed / m_state.processorCount * 100.0 };
+        m_state.processCpu.Push(static_cast<float>(std::clamp(usage, Def::DoubleZero, 100.0)));
+        m_state.workingSet.Push(static_cast<float>(process.workingSet / (1024.0 * 1024.0)));
+        m_state.peakWorkingSet = process.peakWorkingSet;
+        m_previousProcessSec   = processSec;
+    }
+
+    // XbhBO̍s ID œ˂킹ėpiǂ ID j
+    std::ranges::sort(m_threadSamples, {}, &FlSystemMonitorBackend::ThreadSample::threadId);
+
+    m_scratchThreads.clear();
+    auto previous{ m_state.threads.cbegin() };
+    for (const auto& sample : m_threadSamples)
+    {
+        while (previous != m_state.threads.cend() && previous->threadId < sample.threadId) ++previous;
+        const auto isKnown{ previous != m_state.threads.cend() && previous->threadId == sample.threadId };
+
+        auto& row{ m_scratchThreads.emplace_back() };
+        row.threadId  = sample.threadId;
+        row.priority  = sample.priority;
+        row.userSec   = sample.userSec;
+        row.kernelSec = sample.kernelSec;
+
+        if (isKnown)
+        {
+            const auto delta{ (sample.userSec + sample.kernelSec) - (previous->userSec + previous->kernelSec) };
+            row.cpuPercent = static_cast<float>(std::clamp(delta / elapsed * 100.0, Def::DoubleZero, 100.0));
+            row.cpuHistory = previous->cpuHistory;
+        }
+        row.cpuHistory.Push(row.cpuPercent);
+    }
+    std::swap(m_state.threads, m_scratchThreads);
+
+    ++m_state.sequence;
+    m_state.sampleCostMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+
+    // J2O̒gcĂ̂ŊۂƏ㏑ieʂ͎g񂳂j
+    m_snapshots.WorkBack() = m_state;
+    m_snapshots.Publish();
+}
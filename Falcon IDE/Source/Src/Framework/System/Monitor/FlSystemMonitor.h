@@ -0,0 +1,123 @@
+#pragma once
+#include "FlSystemMonitorBackend.h"
+
+/// <summary>
+/// CPUEEXbhƂ CPU ԂpXbhňԊuƂɌvA
+/// iOobt@j FlTripleBuffer ŌJ܂B
+/// `摤 Acquire ōŐV̌ʂǂނŁAOS ւ̖₢킹bN܂B
+/// </summary>
+class FlSystemMonitor
+{
+public:
+
+    static constexpr size_t HistoryLength{ 120U };
+
+    /// <summary>
+    /// Œ蒷̎nBImGui::PlotLines ɂ̂܂ܓn܂B
+    /// iGetData / GetCount / GetOffset  values / values_count / values_offset ցj
+    /// </summary>
+    class History
+    {
+    public:
+        void Push(const float value) noexcept
+        {
+            m_values[m_head] = value;
+            m_head  = (m_head + 1U) % HistoryLength;
+            m_count = std::min(m_count + 1U, static_cast<uint32_t>(HistoryLength));
+        }
+
+        const float* GetData() const noexcept { return m_values.data(); }
+        int GetCount () const noexcept { return static_cast<int>(m_count); }
+        int GetOffset() const noexcept { return m_count < HistoryLength ? Def::IntZero : static_cast<int>(m_head); }
+
+        float GetLatest() const noexcept
+        {
+            return m_count ? m_values[(m_head + HistoryLength - 1U) % HistoryLength] : Def::FloatZero;
+        }
+
+    private:
+        std::array<float, HistoryLength> m_values{};
+        uint32_t m_head  = Def::UIntZero;
+        uint32_t m_count = Def::UIntZero;
+    };
+
+    struct ThreadRow
+    {
+        uint32_t threadId   = Def::UIntZero;
+        int      priority   = Def::IntZero;
+        double   userSec    = Def::DoubleZero;
+        double   kernelSec  = Def::DoubleZero;
+        float    cpuPercent = Def::FloatZero; // 1RAɑ΂銄
+        History  cpuHistory;
+    };
+
+    struct Snapshot
+    {
+        uint64_t sequence       = Def::ULongLongZero; // 0 ͂܂vĂȂ
+        uint32_t processId      = Def::UIntZero;
+        uint32_t processorCount = Def::UIntOne;
+
+        History  systemCpu;   // %iSRAvɑ΂銄j
+        History  processCpu;  // %iSRAvɑ΂銄j
+        History  workingSet;  // MB
+        uint64_t peakWorkingSet = Def::ULongLongZero; // oCg
+
+        std::vector<ThreadRow> threads; // Xbh ID 
+
+        double sampleCostMs = Def::DoubleZero; // Ǒvɂ
+    };
+
+    explicit FlSystemMonitor(std::chrono::milliseconds interval = std::chrono::milliseconds{ 500 });
+    ~FlSystemMonitor();
+
+    FlSystemMonitor(const FlSystemMonitor&) = delete;
+    FlSystemMonitor& operator=(const FlSystemMonitor&) = delete;
+
+    void Start();
+    void Stop();
+    bool IsRunning() const noexcept { return m_isRunning; }
+
+    /// <summary>
+    /// vԊuς܂Bҋ@̌vXbhɂf܂B
+    /// </summary>
+    void SetInterval(std::chrono::milliseconds interval) noexcept;
+    auto GetInterval() const noexcept { return std::chrono::milliseconds{ m_intervalMs.load(std::memory_order_relaxed) }; }
+
+    /// <summary>
+    /// `Xbhi1jĂяo܂BŐV̌vʂ荞ŕԂ܂B
+    /// </summary>
+    const Snapshot& Acquire() noexcept
+    {
+        m_snapshots.Update();
+        return m_snapshots.GetFront();
+    }
+
+private:
+
+    static constexpr uint32_t MinIntervalMs{ 16U };
+    static constexpr uint32_t MaxIntervalMs{ 10000U };
+
+    void Run();
+
+    // v m_state i߁AJivXbhpj
+    void Sample();
+
+    FlSystemMonitorBackend m_backend;
+    FlTripleBuffer<Snapshot> m_snapshots;
+
+    // ȉ͌vXbhp
+    Snapshot m_state;
+    std::vector<FlSystemMonitorBackend::ThreadSample> m_threadSamples;
+    std::vector<ThreadRow> m_scratchThreads;
+    FlSystemMonitorBackend::CpuTimes m_previousSystem;
+    double m_previousProcessSec = Def::DoubleZero;
+    std::chrono::steady_clock::time_point m_previousTime;
+
+    std::atomic<uint32_t> m_intervalMs;
+
+    std::thread             m_thread;
+    std::mutex              m_mutex;
+    std::condition_variable m_condition;
+    bool                    m_isStop    = false;
+    bool                    m_isRunning = false;
+};
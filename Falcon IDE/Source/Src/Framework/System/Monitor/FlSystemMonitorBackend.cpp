@@ -0,0 +1,254 @@
+#include "FlSystemMonitorBackend.h"
+
+#ifdef _WIN32
+
+#pragma comment(lib, "psapi.lib")
+#include <psapi.h>
+#include <tlhelp32.h>
+
+namespace
+{
+    // FILETIMEi100ns Pʁj𐔒l
+    uint64_t ToTicks(const FILETIME& time) noexcept
+    {
+        return (static_cast<uint64_t>(time.dwHighDateTime) << 32) | time.dwLowDateTime;
+    }
+
+    double ToSeconds(const FILETIME& time) noexcept
+    {
+        return static_cast<double>(ToTicks(time)) / 1e7;
+    }
+}
+
+FlSystemMonitorBackend::FlSystemMonitorBackend()
+    : m_processId{ GetCurrentProcessId() }
+{
+    auto info{ SYSTEM_INFO{} };
+    GetSystemInfo(&info);
+    m_processorCount = std::max(static_cast<uint32_t>(info.dwNumberOfProcessors), Def::UIntOne);
+}
+
+bool FlSystemMonitorBackend::ReadSystemCpu(CpuTimes& out) noexcept
+{
+    auto idle  { FILETIME{} };
+    auto kernel{ FILETIME{} };
+    auto user  { FILETIME{} };
+    if (!GetSystemTimes(&idle, &kernel, &user)) return false;
+
+    // J[lԂ̓ACh܂
+    out.idle  = ToTicks(idle);
+    out.total = ToTicks(kernel) + ToTicks(user);
+    return true;
+}
+
+bool FlSystemMonitorBackend::ReadProcess(ProcessSample& out) noexcept
+{
+    const auto process{ GetCurrentProcess() };
+
+    auto create{ FILETIME{} };
+    auto exit  { FILETIME{} };
+    auto kernel{ FILETIME{} };
+    auto user  { FILETIME{} };
+    if (!GetProcessTimes(process, &create, &exit, &kernel, &user)) return false;
+
+    out.userSec   = ToSeconds(user);
+    out.kernelSec = ToSeconds(kernel);
+
+    auto counters{ PROCESS_MEMORY_COUNTERS{} };
+    if (GetProcessMemoryInfo(process, &counters, sizeof(counters)))
+    {
+        out.workingSet     = counters.WorkingSetSize;
+        out.peakWorkingSet = counters.PeakWorkingSetSize;
+    }
+    return true;
+}
+
+bool FlSystemMonitorBackend::ReadThreads(std::vector<ThreadSample>& out)
+{
+    out.clear();
+
+    const auto snapshot{ CreateToolhelp32Snapshot(TH32CS_SNAPTHREAD, Def::ULongZero) };
+    if (snapshot == INVALID_HANDLE_VALUE) return false;
+
+    auto entry{ THREADENTRY32{} };
+    entry.dwSize = sizeof(entry);
+
+    if (Thread32First(snapshot, &entry))
+    {
+        do
+        {
+            if (entry.th32OwnerProcessID != m_processId) continue;
+
+            auto& sample{ out.emplace_back() };
+            sample.threadId = entry.th32ThreadID;
+
+            const auto thread{ OpenThread(THREAD_QUERY_LIMITED_INFORMATION, FALSE, entry.th32ThreadID) };
+            if (!thread) continue;
+
+            auto create{ FILETIME{} };
+            auto exit  { FILETIME{} };
+            auto kernel{ FILETIME{} };
+            auto user  { FILETIME{} };
+            if (GetThreadTimes(thread, &create, &exit, &kernel, &user))
+            {
+                sample.userSec   = ToSeconds(user);
+                sample.kernelSec = ToSeconds(kernel);
+            }
+            sample.priority = GetThreadPriority(thread);
+            CloseHandle(thread);
+        } while (Thread32Next(snapshot, &entry));
+    }
+
+    CloseHandle(snapshot);
+    return true;
+}
+
+#elif defined(__linux__)
+
+#include <unistd.h>
+#include <fcntl.h>
+
+namespace
+{
+    // /proc ̏ȃt@CۂƓǂށiq[vgȂj
+    std::string_view ReadProcFile(const char* path, std::span<char> buffer) noexcept
+    {
+        const auto fd{ ::open(path, O_RDONLY | O_CLOEXEC) };
+        if (fd < 0) return {};
+
+        auto size{ size_t{} };
+        while (size < buffer.size())
+        {
+            const auto read{ ::read(fd, buffer.data() + size, buffer.size() - size) };
+            if (read <= 0) break;
+            size += static_cast<size_t>(read);
+        }
+        ::close(fd);
+        return { buffer.data(), size };
+    }
+
+    // 󔒋؂̐l擪1o
+    uint64_t NextNumber(std::string_view& text) noexcept
+    {
+        while (!text.empty() && text.front() == ' ') text.remove_prefix(1);
+
+        auto value{ int64_t{} };
+        const auto [ptr, ec] { std::from_chars(text.data(), text.data() + text.size(), value) };
+        text.remove_prefix(static_cast<size_t>(ptr - text.data()));
+        while (!text.empty() && text.front() != ' ' && text.front() != '\n') text.remove_prefix(1);
+        return ec == std::errc{} ? static_cast<uint64_t>(value) : Def::ULongLongZero;
+    }
+
+    // <pid>/stat  ")" ȍ~i3Ԗڂ̍ڂjԂBOɋ󔒂 ")" ܂łȂ
+    std::string_view StatFields(const std::string_view stat) noexcept
+    {
+        const auto close{ stat.rfind(')') };
+        return close == std::string_view::npos ? std::string_view{} : stat.substr(std::min(close + 2, stat.size()));
+    }
+
+    struct StatTimes
+    {
+        uint64_t utime    = Def::ULongLongZero;
+        uint64_t stime    = Def::ULongLongZero;
+        int      priority = Def::IntZero;
+    };
+
+    // utime 14ԖځAstime 15ԖځApriority 18Ԗ
+    StatTimes ParseStat(std::string_view fields) noexcept
+    {
+        auto times{ StatTimes{} };
+        if (fields.empty()) return times;
+
+        for (auto field{ 3 }; field <= 18; ++field)
+        {
+            const auto value{ NextNumber(fields) };
+            if      (field == 14) times.utime    = value;
+            else if (field == 15) times.stime    = value;
+            else if (field == 18) times.priority = static_cast<int>(static_cast<int64_t>(value));
+        }
+        return times;
+    }
+
+    // /proc/self/status  "Key:   1234 kB" oCgŕԂ
+    uint64_t StatusKiloBytes(const std::string_view status, const std::string_view key) noexcept
+    {
+        const auto pos{ status.find(key) };
+        if (pos == std::string_view::npos) return Def::ULongLongZero;
+
+        auto rest{ status.substr(pos + key.size()) };
+        while (!rest.empty() && (rest.front() == ' ' || rest.front() == '\t')) rest.remove_prefix(1);
+        return NextNumber(rest) * 1024U;
+    }
+}
+
+FlSystemMonitorBackend::FlSystemMonitorBackend()
+    : m_processId{ static_cast<uint32_t>(::getpid()) }
+{
+    if (const auto count{ ::sysconf(_SC_NPROCESSORS_ONLN) }; count > 0) m_processorCount = static_cast<uint32_t>(count);
+    if (const auto ticks{ ::sysconf(_SC_CLK_TCK) }; ticks > 0) m_ticksPerSecond = static_cast<double>(ticks);
+}
+
+bool FlSystemMonitorBackend::ReadSystemCpu(CpuTimes& out) noexcept
+{
+    auto buffer{ std::array<char, 512>{} };
+    auto text{ ReadProcFile("/proc/stat", buffer) };
+    if (!text.starts_with("cpu ")) return false;
+    text.remove_prefix(4);
+
+    // user nice system idle iowait irq softirq steal
+    auto values{ std::array<uint64_t, 8>{} };
+    for (auto& value : values) value = NextNumber(text);
+
+    out.idle  = values[3] + values[4];
+    out.total = std::accumulate(values.begin(), values.end(), uint64_t{});
+    return true;
+}
+
+bool FlSystemMonitorBackend::ReadProcess(ProcessSample& out) noexcept
+{
+    auto buffer{ std::array<char, 4096>{} };
+
+    const auto stat{ ParseStat(StatFields(ReadProcFile("/proc/self/stat", buffer))) };
+    out.userSec   = static_cast<double>(stat.utime) / m_ticksPerSecond;
+    out.kernelSec = static_cast<double>(stat.stime) / m_ticksPerSecond;
+
+    const auto status{ ReadProcFile("/proc/self/status", buffer) };
+    if (status.empty()) return false;
+
+    out.workingSet     = StatusKiloBytes(status, "VmRSS:");
+    out.peakWorkingSet = StatusKiloBytes(status, "VmHWM:");
+    return true;
+}
+
+bool FlSystemMonitorBackend::ReadThreads(std::vector<ThreadSample>& out)
+{
+    out.clear();
+
+    auto ec{ std::error_code{} };
+    auto it{ std::filesystem::directory_iterator{ "/proc/self/task", ec } };
+    if (ec) return false;
+
+    auto path  { std::array<char, 64>{} };
+    auto buffer{ std::array<char, 1024>{} };
+    for (const auto end{ std::filesystem::directory_iterator{} }; it != end; it.increment(ec))
+    {
+        if (ec) break;
+
+        auto threadId{ uint32_t{} };
+        const auto name{ it->path().filename().native() };
+        if (std::from_chars(name.data(), name.data() + name.size(), threadId).ec != std::errc{}) continue;
+
+        // 񋓂ǂނ܂łɏIXbh͔΂
+        std::snprintf(path.data(), path.size(), "/proc/self/task/%u/stat", threadId);
+        const auto fields{ StatFields(ReadProcFile(path.data(), buffer)) };
+        if (fields.empty()) continue;
+
+        const auto stat{ ParseStat(fields) };
+        out.push_back({ threadId, stat.priority,
+            static_cast<double>(stat.utime) / m_ticksPerSecond,
+            static_cast<double>(stat.stime) / m_ticksPerSecond });
+    }
+    return true;
+}
+
+#endif // _WIN32 // __linux__
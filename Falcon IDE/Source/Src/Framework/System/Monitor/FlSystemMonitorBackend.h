@@ -0,0 +1,53 @@
+#pragma once
+
+/// <summary>
+/// VXej^̌v OS Ƃɐ؂ւwłBiWindows / Linux  /procj
+/// lׂ͂ėݐϒlŁAgp͌ĂяoOƂ̍狁߂܂B
+/// </summary>
+class FlSystemMonitorBackend
+{
+public:
+
+    // VXeŜ CPU ԁiPʂ OS ˑB䂾gj
+    struct CpuTimes
+    {
+        uint64_t idle  = Def::ULongLongZero;
+        uint64_t total = Def::ULongLongZero;
+    };
+
+    struct ProcessSample
+    {
+        double   userSec        = Def::DoubleZero;
+        double   kernelSec      = Def::DoubleZero;
+        uint64_t workingSet     = Def::ULongLongZero; // oCg
+        uint64_t peakWorkingSet = Def::ULongLongZero; // oCg
+    };
+
+    struct ThreadSample
+    {
+        uint32_t threadId  = Def::UIntZero;
+        int      priority  = Def::IntZero;
+        double   userSec   = Def::DoubleZero;
+        double   kernelSec = Def::DoubleZero;
+    };
+
+    FlSystemMonitorBackend();
+
+    bool ReadSystemCpu(CpuTimes& out) noexcept;
+
+    bool ReadProcess(ProcessSample& out) noexcept;
+
+    /// <summary>
+    /// vZX̃Xbh out ɋlߒ܂Bieʂ͎g񂷁j
+    /// </summary>
+    bool ReadThreads(std::vector<ThreadSample>& out);
+
+    auto GetProcessId     () const noexcept { return m_processId; }
+    auto GetProcessorCount() const noexcept { return m_processorCount; }
+
+private:
+
+    uint32_t m_processId      = Def::UIntZero;
+    uint32_t m_processorCount = Def::UIntOne;
+    double   m_ticksPerSecond = 100.0; // Linux  clock tick
+};
@@ -0,0 +1,95 @@
+#pragma once
+
+/// <summary>
+/// Œ蒷EbNt[̕Y/P҃Oobt@
+/// t̏ꍇ͏݂jAj𐔂܂BiY҂̓ubNȂj
+/// </summary>
+/// <typeparam name="T">[u\ȗvf^</typeparam>
+/// <typeparam name="Capacity">eʁi2̗ݏj</typeparam>
+template<class T, size_t Capacity>
+class FlLockFreeRingBuffer
+{
+	static_assert(Capacity >= 2U && (Capacity & (Capacity - 1U)) == 0U, "Capacity must be a power of two.");
+
+public:
+
+	FlLockFreeRingBuffer()
+		: m_upCells{ std::make_unique<Cell[]>(Capacity) }
+	{
+		for (auto i{ size_t{} }; i < Capacity; ++i)
+			m_upCells[i].sequence.store(i, std::memory_order_relaxed);
+	}
+
+	FlLockFreeRingBuffer(const FlLockFreeRingBuffer&) = delete;
+	FlLockFreeRingBuffer& operator=(const FlLockFreeRingBuffer&) = delete;
+
+	/// <summary>
+	/// Cӂ̃Xbhǉ܂B
+	/// </summary>
+	/// <returns>tŔjꍇ false</returns>
+	bool TryPush(T&& value) noexcept
+	{
+		auto pos{ m_enqueuePos.load(std::memory_order_relaxed) };
+		for (;;)
+		{
+			auto& cell{ m_upCells[pos & Mask] };
+			const auto seq { cell.sequence.load(std::memory_order_acquire) };
+			const auto diff{ static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos) };
+
+			if (diff == 0)
+			{
+				// ݈ʒumۂłZɂ
+				if (m_enqueuePos.compare_exchange_weak(pos, pos + 1U, std::memory_order_relaxed))
+				{
+					cell.value = std::move(value);
+					cell.sequence.store(pos + 1U, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (diff < 0)
+			{
+				m_droppedCount.fetch_add(1U, std::memory_order_relaxed);
+				return false;
+			}
+			else pos = m_enqueuePos.load(std::memory_order_relaxed);
+		}
+	}
+
+	/// <summary>
+	/// ҃Xbĥ݌Ăяo܂B
+	/// </summary>
+	bool TryPop(T& out) noexcept
+	{
+		auto& cell{ m_upCells[m_dequeuePos & Mask] };
+		const auto seq{ cell.sequence.load(std::memory_order_acquire) };
+
+		if (seq != m_dequeuePos + 1U) return false;
+
+		out = std::move(cell.value);
+		cell.sequence.store(m_dequeuePos + Capacity, std::memory_order_release);
+		++m_dequeuePos;
+		return true;
+	}
+
+	const auto GetDroppedCount() const noexcept { return m_droppedCount.load(std::memory_order_relaxed); }
+
+	static constexpr size_t GetCapacity() noexcept { return Capacity; }
+
+private:
+
+	struct Cell
+	{
+		std::atomic<size_t> sequence;
+		T					value{};
+	};
+
+	static constexpr size_t Mask		 { Capacity - 1U };
+	static constexpr size_t CacheLineSize{ 64U };
+
+	std::unique_ptr<Cell[]> m_upCells;
+
+	// Y҂Ə҂̈ʒu͕ʃLbVC
+	alignas(CacheLineSize) std::atomic<size_t> m_enqueuePos{};
+	alignas(CacheLineSize) size_t				 m_dequeuePos{};
+	alignas(CacheLineSize) std::atomic<size_t> m_droppedCount{};
+};
@@ -0,0 +1,63 @@
+#pragma once
+
+/// <summary>
+/// PꐶY/P҂̎Odobt@
+/// Y҂͏IloA҂͂łŐV̏oオlǂ߂܂BiǂubNȂj
+/// ǂݏIOɉxĂAr̒l͎̂ĂŐVc܂B
+/// </summary>
+/// <typeparam name="T">\z\ȗvf^</typeparam>
+template<class T>
+class FlTripleBuffer
+{
+public:
+
+	FlTripleBuffer() = default;
+
+	FlTripleBuffer(const FlTripleBuffer&) = delete;
+	FlTripleBuffer& operator=(const FlTripleBuffer&) = delete;
+
+	/// <summary>
+	/// Y҃Xbĥ݌Ăяo܂BݐiO̒gcĂ܂j
+	/// </summary>
+	T& WorkBack() noexcept { return m_buffers[m_back]; }
+
+	/// <summary>
+	/// Y҃Xbĥ݌Ăяo܂BWorkBack ɏlo܂B
+	/// </summary>
+	void Publish() noexcept
+	{
+		const auto previous{ m_middle.exchange(static_cast<uint8_t>(m_back | DirtyBit), std::memory_order_acq_rel) };
+		m_back = previous & IndexMask;
+	}
+
+	/// <summary>
+	/// ҃Xbĥ݌Ăяo܂BVloĂΎ荞݂܂B
+	/// </summary>
+	/// <returns>荞񂾏ꍇ true</returns>
+	bool Update() noexcept
+	{
+		if ((m_middle.load(std::memory_order_relaxed) & DirtyBit) == 0) return false;
+
+		const auto previous{ m_middle.exchange(m_front, std::memory_order_acq_rel) };
+		m_front = previous & IndexMask;
+		return true;
+	}
+
+	/// <summary>
+	/// ҃Xbĥ݌Ăяo܂BŌɎ荞񂾒l
+	/// </summary>
+	const T& GetFront() const noexcept { return m_buffers[m_front]; }
+
+private:
+
+	static constexpr uint8_t IndexMask	 { 0b011 };
+	static constexpr uint8_t DirtyBit	 { 0b100 };
+	static constexpr size_t  CacheLineSize{ 64U };
+
+	std::array<T, 3> m_buffers{};
+
+	// 󂯓n̔ԍ + Vl̈BYҁEҐp̔ԍ͕ʃLbVC
+	alignas(CacheLineSize) std::atomic<uint8_t> m_middle{ 1 };
+	alignas(CacheLineSize) uint8_t				 m_back	 { 2 };
+	alignas(CacheLineSize) uint8_t				 m_front { 0 };
+};
@@ -90,30 +90,171 @@ public:
     // ====== FPS viړρj ======
     class FpsAverager {
     public:
-        explicit FpsAverager(size_t window = 100) : _window(window) { _prev = Steady::now(); }
-        // t[ĂԁB݂FPSƕFPS
+        explicit FpsAverager(size_t window = 100) : _samples(std::max<size_t>(window, 1)) { _prev = Steady::now(); }
+        // t[ĂԁB݂FPSƕFPSiOobt@Ɨ݌v O(1)j
         std::pair<double, double> on_frame() {
             auto now{ Steady::now() };
             auto dt{ std::chrono::duration<double>(now - _prev).count() };
             _prev = now;
             auto inst{ (dt > Def::DoubleZero) ? (Def::DoubleOne / dt) : Def::DoubleZero };
 
-            if (_samples.size() == _window) _samples.erase(_samples.begin());
-            _samples.push_back(inst);
+            if (_count == _samples.size()) _sum -= _samples[_head];
+            else ++_count;
+            _samples[_head] = inst;
+            _sum += inst;
+            _head = (_head + 1) % _samples.size();
 
-            auto avg{ Def::DoubleZero };
-            if (!_samples.empty()) {
-                avg = std::accumulate(_samples.begin(), _samples.end(), Def::DoubleZero) / _samples.size();
-            }
-            return { inst, avg };
+            return { inst, _sum / _count };
         }
-        void reset() { _samples.clear(); _prev = Steady::now(); }
+        void reset() { _head = _count = 0; _sum = Def::DoubleZero; _prev = Steady::now(); }
     private:
-        size_t _window{};
         std::vector<double> _samples;
+        size_t _head{};
+        size_t _count{};
+        double _sum{};
         TP _prev{};
     };
 
+    // ====== t[Ԃ̓vi window t[j ======
+    // ǉ O(1)iŏEő͒PL[AρEU͗݌vjB
+    // p[Z^C͑Ό덷 1% ̑ΐqXgOiOꂽ͈jŁAWv̓oPbgɔB
+    class FrameStatistics {
+    public:
+        struct Summary {
+            size_t count{};
+            double minMs{}, maxMs{}, meanMs{}, stdDevMs{};
+            double p50Ms{}, p95Ms{}, p99Ms{};
+            double fps() const noexcept { return meanMs > Def::DoubleZero ? 1000.0 / meanMs : Def::DoubleZero; }
+        };
+
+        explicit FrameStatistics(size_t window = 600)
+            : _ring(std::max<size_t>(window, 1)), _minQueue(_ring.size()), _maxQueue(_ring.size()), _buckets(BucketCount) {}
+
+        // t[ԁi~bj1ǉ
+        void add(double frameMs) noexcept {
+            const auto window{ _ring.size() };
+            const auto slot{ static_cast<size_t>(_pushed % window) };
+
+            if (_pushed >= window) {
+                const auto old{ _ring[slot] };
+                _sum   -= old;
+                _sumSq -= old * old;
+                --_buckets[bucket_of(old)];
+            }
+
+            _ring[slot] = frameMs;
+            _sum   += frameMs;
+            _sumSq += frameMs * frameMs;
+            ++_buckets[bucket_of(frameMs)];
+
+            // OꂽԍɎ̂ĂiL[ window ܂łĂȂj
+            const auto oldest{ _pushed >= window ? _pushed + 1 - window : uint64_t{} };
+            _minQueue.expire(oldest);
+            _maxQueue.expire(oldest);
+
+            _minQueue.push(_pushed, _ring, std::greater_equal<double>{});
+            _maxQueue.push(_pushed, _ring, std::less_equal<double>{});
+            ++_pushed;
+
+            // Ž덷܂Ȃ悤ɈƂɎ蒼iς O(1)j
+            if (++_sinceRecompute >= window) recompute();
+        }
+
+        Summary summary() const noexcept {
+            auto s{ Summary{} };
+            s.count = count();
+            if (s.count == 0) return s;
+
+            const auto n{ static_cast<double>(s.count) };
+            s.minMs    = _ring[static_cast<size_t>(_minQueue.front() % _ring.size())];
+            s.maxMs    = _ring[static_cast<size_t>(_maxQueue.front() % _ring.size())];
+            s.meanMs   = _sum / n;
+            s.stdDevMs = std::sqrt(std::max(_sumSq / n - s.meanMs * s.meanMs, Def::DoubleZero));
+
+            // 3̏ʂ1̑ŏE
+            const std::array<double, 3> quantiles{ 0.50, 0.95, 0.99 };
+            std::array<double*, 3> outputs{ &s.p50Ms, &s.p95Ms, &s.p99Ms };
+            auto q{ size_t{} };
+            auto cumulative{ uint64_t{} };
+            for (auto i{ size_t{} }; i < BucketCount && q < quantiles.size(); ++i) {
+                cumulative += _buckets[i];
+                while (q < quantiles.size() && cumulative > static_cast<uint64_t>(quantiles[q] * (n - 1))) {
+                    *outputs[q++] = std::clamp(bucket_value(i), s.minMs, s.maxMs);
+                }
+            }
+            return s;
+        }
+
+        size_t count() const noexcept { return static_cast<size_t>(std::min<uint64_t>(_pushed, _ring.size())); }
+
+        void reset() noexcept {
+            _pushed = _sinceRecompute = 0;
+            _sum = _sumSq = Def::DoubleZero;
+            _minQueue.clear();
+            _maxQueue.clear();
+            std::fill(_buckets.begin(), _buckets.end(), 0u);
+        }
+
+    private:
+        // vfԍ̒PL[iŒ蒷̏zzj
+        class MonotonicQueue {
+        public:
+            explicit MonotonicQueue(size_t capacity) : _ids(capacity) {}
+
+            // dominated(̒l, Vl) ^̊ԁÂĂĂς
+            template<class Dominated>
+            void push(uint64_t id, const std::vector<double>& ring, Dominated dominated) noexcept {
+                const auto value{ ring[static_cast<size_t>(id % ring.size())] };
+                while (_size > 0 && dominated(ring[static_cast<size_t>(back() % ring.size())], value)) --_size;
+                _ids[(_head + _size) % _ids.size()] = id;
+                ++_size;
+            }
+            void expire(uint64_t oldest) noexcept {
+                while (_size > 0 && _ids[_head] < oldest) { _head = (_head + 1) % _ids.size(); --_size; }
+            }
+            uint64_t front() const noexcept { return _ids[_head]; }
+            void clear() noexcept { _head = _size = 0; }
+        private:
+            uint64_t back() const noexcept { return _ids[(_head + _size - 1) % _ids.size()]; }
+            std::vector<uint64_t> _ids;
+            size_t _head{};
+            size_t _size{};
+        };
+
+        // ΐoPbg: [MinMs, MaxMs]  Gamma ŋ؂i\l̑Ό덷 Alpha ȓj
+        static constexpr double Alpha   = 0.01;
+        static constexpr double Gamma   = (1.0 + Alpha) / (1.0 - Alpha);
+        static constexpr double MinMs   = 1e-3;
+        static constexpr double MaxMs   = 1e5;
+        static inline const double LogGamma{ std::log(Gamma) };
+        static inline const size_t BucketCount{ static_cast<size_t>(std::ceil(std::log(MaxMs / MinMs) / std::log(Gamma))) + 2 };
+
+        static size_t bucket_of(double ms) noexcept {
+            if (!(ms > MinMs)) return 0;
+            if (ms >= MaxMs) return BucketCount - 1;
+            return std::min(static_cast<size_t>(std::ceil(std::log(ms / MinMs) / LogGamma)), BucketCount - 1);
+        }
+        static double bucket_value(size_t index) noexcept {
+            // oPbg (^(i-1), ^i] ̒
+            return MinMs * std::pow(Gamma, static_cast<double>(index)) * 2.0 / (1.0 + Gamma);
+        }
+
+        void recompute() noexcept {
+            _sum = _sumSq = Def::DoubleZero;
+            for (auto i{ size_t{} }; i < count(); ++i) { _sum += _ring[i]; _sumSq += _ring[i] * _ring[i]; }
+            _sinceRecompute = 0;
+        }
+
+        std::vector<double>   _ring;
+        MonotonicQueue        _minQueue;
+        MonotonicQueue        _maxQueue;
+        std::vector<uint32_t> _buckets;
+        uint64_t _pushed{};
+        size_t   _sinceRecompute{};
+        double   _sum{};
+        double   _sumSq{};
+    };
+
     /// <summary> Resource Acquisition Is Initialization </summary>
 
     // ====== XR[vviIɃR[obN/Oj ======
@@ -146,9 +287,11 @@ public:
     }
 
     // ǎvFISOۂ
-    static std::string now_iso8601() {
-        auto now = System::now();
-        auto t = System::to_time_t(now);
+    static std::string now_iso8601() { return to_iso8601(System::now()); }
+
+    // L^ς݂̎𓯂Łi\ɒxĐ`pj
+    static std::string to_iso8601(System::time_point tp) {
+        auto t = System::to_time_t(tp);
         std::tm tm{};
 #if defined(_WIN32)
         localtime_s(&tm, &t);
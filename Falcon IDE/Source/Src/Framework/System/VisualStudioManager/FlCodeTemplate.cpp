@@ -0,0 +1,278 @@
+#include "FlCodeTemplate.h"
+
+namespace
+{
+    const bool IsNameChar(const char c) noexcept
+    {
+        return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '_';
+    }
+}
+
+FlCodeTemplate::Arguments& FlCodeTemplate::Arguments::Set(const std::string& name, std::string value)
+{
+    m_values.insert_or_assign(name, std::move(value));
+    return *this;
+}
+
+FlCodeTemplate::Arguments& FlCodeTemplate::Arguments::SetGenerator(const std::string& name, std::function<std::string()> generator)
+{
+    m_generators.insert_or_assign(name, std::move(generator));
+    return *this;
+}
+
+FlCodeTemplate::Arguments& FlCodeTemplate::Arguments::AddItem(const std::string& name)
+{
+    return *m_items[name].emplace_back(std::make_unique<Arguments>());
+}
+
+const bool FlCodeTemplate::Arguments::Contains(const std::string& name) const noexcept
+{
+    return m_values.contains(name) || m_generators.contains(name) || m_items.contains(name);
+}
+
+std::shared_ptr<FlCodeTemplate> FlCodeTemplate::Parse(std::string source)
+{
+    auto spTemplate{ std::make_shared<FlCodeTemplate>() };
+    spTemplate->m_source = std::move(source);
+
+    const auto& src{ spTemplate->m_source };
+    auto& segments { spTemplate->m_segments };
+
+    // JĂԁiZOg̃CfbNXj
+    auto openSections{ std::vector<uint32_t>{} };
+
+    auto textBegin{ size_t{} };
+    const auto flushText{ [&](const size_t pos)
+        {
+            if (pos <= textBegin) return;
+            auto segment{ Segment{} };
+            segment.offset = static_cast<uint32_t>(textBegin);
+            segment.length = static_cast<uint32_t>(pos - textBegin);
+            spTemplate->m_textSize += segment.length;
+            segments.push_back(std::move(segment));
+        } };
+
+    auto pos{ src.find('#') };
+    while (pos != std::string::npos)
+    {
+        // "#" [?*/] Name "#"
+        auto nameBegin{ pos + Def::ULongLongOne };
+        auto kind     { SegmentKind::Slot };
+        auto isClose  { false };
+        if (nameBegin < src.size())
+        {
+            switch (src[nameBegin])
+            {
+            case '?': kind = SegmentKind::Section; ++nameBegin; break;
+            case '*': kind = SegmentKind::Loop;    ++nameBegin; break;
+            case '/': isClose = true;              ++nameBegin; break;
+            default: break;
+            }
+        }
+
+        auto nameEnd{ nameBegin };
+        while (nameEnd < src.size() && IsNameChar(src[nameEnd])) ++nameEnd;
+
+        // OEĂȂ͕̂ʂ̕i#include Ȃǁj
+        if (nameEnd == nameBegin || nameEnd >= src.size() || src[nameEnd] != '#')
+        {
+            pos = src.find('#', pos + Def::ULongLongOne);
+            continue;
+        }
+
+        auto name{ src.substr(nameBegin, nameEnd - nameBegin) };
+
+        // Ή̖I[͕ƂĎc
+        if (isClose && (openSections.empty() || segments[openSections.back()].name != name))
+        {
+            spTemplate->AddDiagnostic(pos, "Unmatched #/" + name + "#");
+            pos = src.find('#', nameEnd + Def::ULongLongOne);
+            continue;
+        }
+
+        flushText(pos);
+        textBegin = nameEnd + Def::ULongLongOne;
+
+        if (isClose)
+        {
+            segments[openSections.back()].end = static_cast<uint32_t>(segments.size());
+            openSections.pop_back();
+        }
+        else
+        {
+            auto segment{ Segment{} };
+            segment.kind   = kind;
+            segment.offset = static_cast<uint32_t>(pos);
+            segment.length = static_cast<uint32_t>(textBegin - pos);
+            segment.name   = std::move(name);
+
+            if (kind != SegmentKind::Slot) openSections.push_back(static_cast<uint32_t>(segments.size()));
+            segments.push_back(std::move(segment));
+        }
+
+        pos = src.find('#', textBegin);
+    }
+    flushText(src.size());
+
+    // ĂȂԂ͖ŕ
+    for (auto it{ openSections.rbegin() }; it != openSections.rend(); ++it)
+    {
+        const auto& segment{ segments[*it] };
+        spTemplate->AddDiagnostic(segment.offset, "Unclosed section " + src.substr(segment.offset, segment.length));
+        segments[*it].end = static_cast<uint32_t>(segments.size());
+    }
+    return spTemplate;
+}
+
+void FlCodeTemplate::AddDiagnostic(const size_t offset, std::string message)
+{
+    const auto lineEnd{ offset > Def::ULongLongZero ? m_source.rfind('\n', offset - Def::ULongLongOne) : std::string::npos };
+    const auto lineBegin{ lineEnd == std::string::npos ? Def::ULongLongZero : lineEnd + Def::ULongLongOne };
+
+    auto diagnostic{ Diagnostic{} };
+    diagnostic.line    = static_cast<uint32_t>(std::count(m_source.begin(), m_source.begin() + static_cast<ptrdiff_t>(lineBegin), '\n')) + Def::UIntOne;
+    diagnostic.column  = static_cast<uint32_t>(offset - lineBegin) + Def::UIntOne;
+    diagnostic.message = std::move(message);
+    m_diagnostics.push_back(std::move(diagnostic));
+}
+
+std::string FlCodeTemplate::Render(const Arguments& args) const
+{
+    // Œ蕶 + ̍ݒl̕ɊmۂĂ
+    auto reserveSize{ m_textSize };
+    for (const auto& segment : m_segments)
+    {
+        if (segment.kind != SegmentKind::Slot) continue;
+        if (auto it{ args.m_values.find(segment.name) }; it != args.m_values.end()) reserveSize += it->second.size();
+        else reserveSize += segment.length;
+    }
+
+    auto out{ std::string{} };
+    out.reserve(reserveSize);
+
+    auto scope{ Scope{ &args } };
+    RenderRange(Def::UIntZero, static_cast<uint32_t>(m_segments.size()), scope, out);
+    return out;
+}
+
+bool FlCodeTemplate::RenderToFile(const std::filesystem::path& path, const Arguments& args) const noexcept
+{
+    try {
+        const auto text{ Render(args) };
+
+        std::ofstream ofs(path);
+        if (!ofs) return false;
+        ofs << text;
+        return !ofs.fail();
+    }
+    catch (...) {
+        return false;
+    }
+}
+
+void FlCodeTemplate::RenderRange(const uint32_t begin, const uint32_t end, Scope& scope, std::string& out) const
+{
+    for (auto i{ begin }; i < end; )
+    {
+        const auto& segment{ m_segments[i] };
+        switch (segment.kind)
+        {
+        case SegmentKind::Text:
+            out.append(m_source, segment.offset, segment.length);
+            ++i;
+            break;
+
+        case SegmentKind::Slot:
+            if (const auto* pValue{ FindValue(scope, segment.name) }) out += *pValue;
+            else if (const auto* pGenerator{ FindGenerator(scope, segment.name) }) out += (*pGenerator)();
+            else out.append(m_source, segment.offset, segment.length);
+            ++i;
+            break;
+
+        case SegmentKind::Section:
+        {
+            const auto* pValue{ FindValue(scope, segment.name) };
+            const auto* pItems{ FindItems(scope, segment.name) };
+            if ((pValue && !pValue->empty()) || FindGenerator(scope, segment.name) || (pItems && !pItems->empty()))
+                RenderRange(i + Def::UIntOne, segment.end, scope, out);
+            i = segment.end;
+            break;
+        }
+
+        case SegmentKind::Loop:
+            if (const auto* pItems{ FindItems(scope, segment.name) })
+            {
+                for (const auto& upItem : *pItems)
+                {
+                    scope.push_back(upItem.get());
+                    RenderRange(i + Def::UIntOne, segment.end, scope, out);
+                    scope.pop_back();
+                }
+            }
+            i = segment.end;
+            break;
+        }
+    }
+}
+
+const std::string* FlCodeTemplate::FindValue(const Scope& scope, const std::string& name) noexcept
+{
+    for (auto it{ scope.rbegin() }; it != scope.rend(); ++it)
+        if (auto found{ (*it)->m_values.find(name) }; found != (*it)->m_values.end()) return &found->second;
+    return nullptr;
+}
+
+const std::function<std::string()>* FlCodeTemplate::FindGenerator(const Scope& scope, const std::string& name) noexcept
+{
+    for (auto it{ scope.rbegin() }; it != scope.rend(); ++it)
+        if (auto found{ (*it)->m_generators.find(name) }; found != (*it)->m_generators.end()) return &found->second;
+    return nullptr;
+}
+
+const std::vector<std::unique_ptr<FlCodeTemplate::Arguments>>* FlCodeTemplate::FindItems(const Scope& scope, const std::string& name) noexcept
+{
+    for (auto it{ scope.rbegin() }; it != scope.rend(); ++it)
+        if (auto found{ (*it)->m_items.find(name) }; found != (*it)->m_items.end()) return &found->second;
+    return nullptr;
+}
+
+std::shared_ptr<const FlCodeTemplate> FlCodeTemplateCache::Acquire(const std::filesystem::path& path) noexcept
+{
+    auto ec{ std::error_code{} };
+    const auto writeTime{ std::filesystem::last_write_time(path, ec) };
+    if (ec) return nullptr;
+    const auto size{ std::filesystem::file_size(path, ec) };
+    if (ec) return nullptr;
+
+    {
+        auto lock{ std::lock_guard{ m_mutex } };
+        if (auto it{ m_cache.find(path) }; it != m_cache.end() && it->second.writeTime == writeTime && it->second.size == size)
+            return it->second.spTemplate;
+    }
+
+    try {
+        // ] LoadTextFile ƓeLXg[hœǂށis̈ςȂj
+        std::ifstream ifs(path);
+        if (!ifs) return nullptr;
+        std::stringstream ss;
+        ss << ifs.rdbuf();
+
+        auto spTemplate{ std::shared_ptr<const FlCodeTemplate>{ FlCodeTemplate::Parse(ss.str()) } };
+        for (const auto& diagnostic : spTemplate->GetDiagnostics())
+            FlEditorAdministrator::Instance().GetLogger()->AddWarningLog("Template %s(%u,%u): %s",
+                path.string().c_str(), diagnostic.line, diagnostic.column, diagnostic.message.c_str());
+
+        auto lock{ std::lock_guard{ m_mutex } };
+        m_cache.insert_or_assign(path, CacheEntry{ writeTime, size, spTemplate });
+        return spTemplate;
+    }
+    catch (...) {
+        return nullptr;
+    }
+}
+
+void FlCodeTemplateCache::Clear() noexcept
+{
+    auto lock{ std::lock_guard{ m_mutex } };
+    m_cache.clear();
+}
@@ -0,0 +1,133 @@
+#pragma once
+
+/// <summary>
+/// .flsample ev[gx͂AZOgƂĕێ܂B
+/// :
+///   #Name#            ݁il "#Name#" ̂܂܏ój
+///   #?Name# ` #/Name#  Name ɒlƂo
+///   #*Name# ` #/Name#  Name ɒǉڂ̐JԂo
+/// 񂾒l͍đ܂B
+/// </summary>
+class FlCodeTemplate
+{
+public:
+
+    /// <summary>
+    /// ޒl̏W
+    /// </summary>
+    class Arguments
+    {
+    public:
+
+        Arguments& Set(const std::string& name, std::string value);
+
+        /// <summary>
+        /// oxɒl𐶐܂Bi#GUID# Ȃǁj
+        /// </summary>
+        Arguments& SetGenerator(const std::string& name, std::function<std::string()> generator);
+
+        /// <summary>
+        /// #*Name# ̌JԂڂ1ǉ܂BړŌȂO͊OT܂B
+        /// </summary>
+        Arguments& AddItem(const std::string& name);
+
+        const bool Contains(const std::string& name) const noexcept;
+
+    private:
+        friend class FlCodeTemplate;
+
+        std::unordered_map<std::string, std::string>                           m_values;
+        std::unordered_map<std::string, std::function<std::string()>>          m_generators;
+        std::unordered_map<std::string, std::vector<std::unique_ptr<Arguments>>> m_items;
+    };
+
+    /// <summary>
+    /// ̌iʒu1n܂j
+    /// </summary>
+    struct Diagnostic
+    {
+        uint32_t    line   = Def::UIntZero;
+        uint32_t    column = Def::UIntZero;
+        std::string message;
+    };
+
+    /// <summary>
+    /// ͂܂BΉ̖ #/Name# ͕̂܂܎cAĂȂԂ͖ŕāA
+    /// ǂ GetDiagnostics ɋL^܂B
+    /// </summary>
+    static std::shared_ptr<FlCodeTemplate> Parse(std::string source);
+
+    /// <summary>
+    /// SĂ݂̍1pXœWJ܂B
+    /// </summary>
+    std::string Render(const Arguments& args) const;
+
+    /// <summary>
+    /// WJʂt@C1xo܂B
+    /// </summary>
+    bool RenderToFile(const std::filesystem::path& path, const Arguments& args) const noexcept;
+
+    inline const auto& GetSource()      const noexcept { return m_source; }
+    inline const auto& GetDiagnostics() const noexcept { return m_diagnostics; }
+
+private:
+
+    enum class SegmentKind : uint8_t
+    {
+        Text,
+        Slot,
+        Section,
+        Loop,
+    };
+
+    struct Segment
+    {
+        SegmentKind kind   = SegmentKind::Text;
+        uint32_t    offset = Def::UIntZero;   // m_source ̈ʒuiSlot  "#Name#" Śj
+        uint32_t    length = Def::UIntZero;
+        uint32_t    end    = Def::UIntZero;   // Section / Loop ̏I[i#/Name# ̎̃ZOgj
+        std::string name;
+    };
+
+    using Scope = std::vector<const Arguments*>;
+
+    void RenderRange(uint32_t begin, uint32_t end, Scope& scope, std::string& out) const;
+
+    static const std::string* FindValue(const Scope& scope, const std::string& name) noexcept;
+    static const std::function<std::string()>* FindGenerator(const Scope& scope, const std::string& name) noexcept;
+    static const std::vector<std::unique_ptr<Arguments>>* FindItems(const Scope& scope, const std::string& name) noexcept;
+
+    void AddDiagnostic(size_t offset, std::string message);
+
+    std::string             m_source;
+    std::vector<Segment>    m_segments;
+    std::vector<Diagnostic> m_diagnostics;
+    size_t               m_textSize = Def::ULongLongZero; // Œ蕶̍vio̓obt@̗\pj
+};
+
+/// <summary>
+/// pXPʂŉ͍ς݃ev[gێ܂Bt@CXVĂΉ͂܂B
+/// </summary>
+class FlCodeTemplateCache
+{
+public:
+
+    /// ̌͌xƂďo͂Aev[ĝ͕Ԃ܂B
+    /// </summary>
+    /// <returns>ǂݍ݂Ɏsꍇ nullptr</returns>
+    std::shared_ptr<const FlCodeTemplate> Acquire(const std::filesystem::path& path) noexcept;
+
+    void Clear() noexcept;
+
+private:
+
+    struct CacheEntry
+    {
+        std::filesystem::file_time_type       writeTime;
+        uintmax_t                             size = Def::ULongLongZero;
+        std::shared_ptr<const FlCodeTemplate> spTemplate;
+    };
+
+    std::mutex m_mutex;
+    std::unordered_map<std::filesystem::path, CacheEntry> m_cache;
+};
@@ -0,0 +1,94 @@
+#include "FlModuleBuildScheduler.h"
+
+void FlModuleBuildScheduler::Enqueue(const std::string& module, const std::string& source, const TimePoint now)
+{
+	++m_statistics.requested;
+
+	auto& state{ m_modules[module] };
+	state.pending.insert(source);
+	state.lastChange = now;
+
+	// OɎs\[XꏏɃrh
+	if (auto failed{ m_failedSources.find(module) }; failed != m_failedSources.end())
+	{
+		state.pending.merge(failed->second);
+		m_failedSources.erase(failed);
+	}
+
+	// Â\[Xł̃rh͖ʂȂ̂ŎÃ\[X̃rhɊ܂߂
+	if (state.running != Def::ULongLongZero)
+	{
+		m_runner.cancel(state.running);
+		state.pending.insert(state.runningSources.begin(), state.runningSources.end());
+		state.running = Def::ULongLongZero;
+		state.runningSources.clear();
+		++m_statistics.cancelled;
+	}
+}
+
+std::vector<FlModuleBuildScheduler::Completed> FlModuleBuildScheduler::Update(const TimePoint now)
+{
+	auto completed{ std::vector<Completed>{} };
+
+	for (auto it{ m_modules.begin() }; it != m_modules.end();)
+	{
+		auto& [module, state] { *it };
+
+		if (state.running != Def::ULongLongZero)
+		{
+			const auto result{ m_runner.poll(state.running) };
+			if (result == BuildState::Running)
+			{
+				++it;
+				continue;
+			}
+
+			const auto isSucceeded{ result == BuildState::Succeeded };
+			if (!isSucceeded) m_failedSources[module].insert(state.runningSources.begin(), state.runningSources.end());
+			completed.push_back({ module, std::move(state.runningSources), isSucceeded });
+			state.running = Def::ULongLongZero;
+			state.runningSources.clear();
+		}
+
+		if (!state.pending.empty() && now - state.lastChange >= m_quietTime)
+		{
+			auto sources{ std::vector<std::string>(state.pending.begin(), state.pending.end()) };
+			const auto ticket{ m_runner.start(module, sources) };
+			if (ticket == Def::ULongLongZero)
+			{
+				// n߂Ȃ\[X͎sƂĕԂA̕ύXňꏏɃrh
+				m_failedSources[module].insert(sources.begin(), sources.end());
+				completed.push_back({ module, std::move(sources), false });
+			}
+			else
+			{
+				state.running        = ticket;
+				state.runningSources = std::move(sources);
+				++m_statistics.started;
+			}
+			state.pending.clear();
+		}
+
+		if (state.running == Def::ULongLongZero && state.pending.empty()) it = m_modules.erase(it);
+		else ++it;
+	}
+
+	return completed;
+}
+
+void FlModuleBuildScheduler::CancelAll()
+{
+	for (auto& [module, state] : m_modules)
+	{
+		if (state.running == Def::ULongLongZero) continue;
+		m_runner.cancel(state.running);
+		++m_statistics.cancelled;
+	}
+	m_modules.clear();
+}
+
+bool FlModuleBuildScheduler::IsBuilding(const std::string& module) const noexcept
+{
+	auto it{ m_modules.find(module) };
+	return it != m_modules.end() && it->second.running != Def::ULongLongZero;
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+/// <summary>
+/// ύXꂽ\[XW[Pʂɂ܂Ƃ߂ărh\񂵂܂B
+/// EW[̕ύX͏d1̃rhɂ܂Ƃ߂
+/// EŌ̕ύX quietTime ҂Ăn߂iۑ̘Ał1ɂj
+/// ErhɓW[ύXꂽÃrh͎Ď̃rhɍ
+/// Esin߂Ȃj\[X͊oĂAW[̎̕ύXňꏏɃrh
+/// ۂ̃rh Runner ɔĈŁAU Runner n OS Ɉ˂炸m߂܂B
+/// </summary>
+class FlModuleBuildScheduler
+{
+public:
+	using Clock     = std::chrono::steady_clock;
+	using TimePoint = Clock::time_point;
+	using Ticket    = uint64_t;
+
+	enum class BuildState : uint8_t
+	{
+		Running,
+		Succeeded,
+		Failed,
+	};
+
+	struct Runner
+	{
+		// rhn߂ĎʔԍԂi0 ͊Jnsj
+		std::function<Ticket(const std::string& module, const std::vector<std::string>& sources)> start;
+		// iɏIĂĂĂ΂邱Ƃj
+		std::function<void(Ticket)> cancel;
+		std::function<BuildState(Ticket)> poll;
+	};
+
+	// Irh
+	struct Completed
+	{
+		std::string              module;
+		std::vector<std::string> sources;
+		bool                     isSucceeded = false;
+	};
+
+	struct Statistics
+	{
+		uint64_t requested = Def::ULongLongZero; // Enqueue ꂽ
+		uint64_t started   = Def::ULongLongZero; // n߂rh
+		uint64_t cancelled = Def::ULongLongZero; // VύXŎrh
+	};
+
+	explicit FlModuleBuildScheduler(Runner runner, Clock::duration quietTime = std::chrono::milliseconds{ 300 })
+		: m_runner{ std::move(runner) }
+		, m_quietTime{ quietTime }
+	{}
+
+	/// <summary>
+	/// module  source ύXꂽƂ`܂B
+	/// </summary>
+	void Enqueue(const std::string& module, const std::string& source, TimePoint now = Clock::now());
+
+	/// <summary>
+	/// IrhA҂Ԃ̉߂W[̃rhn߂܂B
+	/// </summary>
+	/// <returns>Irh</returns>
+	std::vector<Completed> Update(TimePoint now = Clock::now());
+
+	/// <summary>
+	/// SĎ܂Bis\[X͊o܂܁j
+	/// </summary>
+	void CancelAll();
+
+	bool IsBuilding(const std::string& module) const noexcept;
+	bool IsIdle() const noexcept { return m_modules.empty(); }
+
+	/// <summary>
+	/// ߂̃rhŎsA̕ύX҂Ă\[X
+	/// </summary>
+	const auto& GetFailedSources() const noexcept { return m_failedSources; }
+
+	const auto& GetStatistics() const noexcept { return m_statistics; }
+
+private:
+	struct ModuleState
+	{
+		std::set<std::string> pending;                   // ̃rhɊ܂߂\[XidȂEŒj
+		TimePoint             lastChange{};
+		Ticket                running = Def::ULongLongZero;
+		std::vector<std::string> runningSources;
+	};
+
+	Runner          m_runner;
+	Clock::duration m_quietTime;
+
+	std::map<std::string, ModuleState> m_modules; // rh҂Erh̃W[
+	std::map<std::string, std::set<std::string>> m_failedSources; // W[Ƃ̎s\[X
+	Statistics                         m_statistics;
+};
@@ -41,25 +41,20 @@ bool FlVisualStudioProjectManager::CreateNewProject(const std::string& projectNa
 	return true;
 }
 
-static const std::string LoadTextFile(const std::filesystem::path& path) noexcept
-{
-    if (!std::filesystem::exists(path)) return "";
-
-    std::ifstream ifs(path);
-    std::stringstream ss;
-    ss << ifs.rdbuf();
-    return ss.str();
-}
-
 bool FlVisualStudioProjectManager::FormingModule(const std::filesystem::path& projDir, const std::filesystem::path& codeFile) noexcept
 {
-    m_cppParser->ParseFile(codeFile.string());
+    const auto spIndex{ m_cppIndexer->IndexFile(codeFile) };
+    if (!spIndex)
+    {
+        FlEditorAdministrator::Instance().GetLogger()->AddErrorLog("Failed to parse code file: %s", codeFile.string().c_str());
+        return false;
+    }
     m_autoAdd->SetProjectDirPath(projDir);
 
     auto projName{ projDir.filename().string()};
     auto srt{ std::string{} }; // \̃R[h
 
-    for (auto& s : m_cppParser->GetStructs())
+    for (auto& s : spIndex->structs)
     {
         if (!Str::Contains(s.name, "Component")) continue;
 
@@ -79,9 +74,16 @@ bool FlVisualStudioProjectManager::FormingModule(const std::filesystem::path& pr
         srt = reBuildStruct(s.name, s.contentLines);
     }
 
-    auto temp{ LoadTextFile("Src/Framework/System/VisualStudioManager/Sample/Template.c++.flsample") };
+    const auto spTemplate{ m_templates->Acquire("Src/Framework/System/VisualStudioManager/Sample/Template.c++.flsample") };
+    if (!spTemplate)
+    {
+        FlEditorAdministrator::Instance().GetLogger()->AddErrorLog("Failed to load module template for project %s", projName.c_str());
+        return false;
+    }
 
-    for (auto& fun : m_cppParser->GetFunctions())
+    auto args{ FlCodeTemplate::Arguments{} };
+
+    for (auto& fun : spIndex->functions)
     {
         // t@C
         // 쐬ꂽt@CŕKvR[h
@@ -104,38 +106,22 @@ bool FlVisualStudioProjectManager::FormingModule(const std::filesystem::path& pr
                 return result;
             }
         };
-        if (Str::Contains(fun.name, "Start"))
-        {
-            auto s{ reBuildFunction(fun.contentLines) };
-            temp = Str::ReplaceString(temp, "#ImpStart#", s);
-        }
-        else if (Str::Contains(fun.name, "OnDestroy"))
-        {
-            auto s{ reBuildFunction(fun.contentLines) };
-            temp = Str::ReplaceString(temp, "#ImpOnDestroy#", s);
-        }
-        else if (Str::Contains(fun.name, "Serialize"))
-        {
-            auto s{ reBuildFunction(fun.contentLines) };
-            temp = Str::ReplaceString(temp, "#ImpSerialize#", s);
-        }
-        else if (Str::Contains(fun.name, "Deserialize"))
-        {
-            auto s{ reBuildFunction(fun.contentLines) };
-            temp = Str::ReplaceString(temp, "#ImpDeserialize#", s);
-        }
-        else if (Str::Contains(fun.name, "RenderEditor"))
-        {
-            auto s{ reBuildFunction(fun.contentLines) };
-            temp = Str::ReplaceString(temp, "#ImpRenderEditor#", s);
-        }
-        else if (Str::Contains(fun.name, "Update"))
-        {
-            auto s{ reBuildFunction(fun.contentLines) };
-            temp = Str::ReplaceString(temp, "#ImpUpdate#", s);
-        }
+
+        auto slot{ std::string{} };
+        if      (Str::Contains(fun.name, "Start"))        slot = "ImpStart";
+        else if (Str::Contains(fun.name, "OnDestroy"))    slot = "ImpOnDestroy";
+        else if (Str::Contains(fun.name, "Serialize"))    slot = "ImpSerialize";
+        else if (Str::Contains(fun.name, "Deserialize"))  slot = "ImpDeserialize";
+        else if (Str::Contains(fun.name, "RenderEditor")) slot = "ImpRenderEditor";
+        else if (Str::Contains(fun.name, "Update"))       slot = "ImpUpdate";
+        else continue;
+
+        // ݐ͍ŏ̊֐g
+        if (!args.Contains(slot)) args.Set(slot, reBuildFunction(fun.contentLines));
     }
-    temp = Str::ReplaceString(temp, "#ProjectName#", projName);
+    args.Set("ProjectName", projName);
+
+    auto temp{ spTemplate->Render(args) };
 
     auto autoGenDir{ std::string{"Src/AutomaticallyGenerated"} };
     auto compHeaderPath{ projName + "ComponentAutomaticallyGenerated.hh" };
@@ -215,52 +201,40 @@ bool FlVisualStudioProjectManager::CreateSourceFiles(const std::filesystem::path
     ofsPch << R"PCH(#include "Pch.h")PCH";
 
     // --- Source ---
-    {
-        std::ofstream ofs(cppPath);
-        if (!ofs) return false;
-
-        // Custom Delimiter
-        ofs << LoadTextFile("Src/Framework/System/VisualStudioManager/Sample/Template.cxx.flsample");
-    } // close
+    const auto spTemplate{ m_templates->Acquire("Src/Framework/System/VisualStudioManager/Sample/Template.cxx.flsample") };
+    if (!spTemplate) return false;
 
-    ReplaceInFile(cppPath, "#ProjectName#", name);
-
-    return true;
+    return spTemplate->RenderToFile(cppPath, FlCodeTemplate::Arguments{}.Set("ProjectName", name));
 }
 
 bool FlVisualStudioProjectManager::CreateVcxproj(const std::filesystem::path& dir, const std::string& name) noexcept
 {
     auto path = dir / (name + ".vcxproj");
 
-    {
-        std::ofstream ofs(path);
-        if (!ofs) return false;
+    const auto spTemplate{ m_templates->Acquire("Src/Framework/System/VisualStudioManager/Sample/Template.vcxproj.flsample") };
+    if (!spTemplate) return false;
 
-        ofs << LoadTextFile("Src/Framework/System/VisualStudioManager/Sample/Template.vcxproj.flsample");
-    } // close
-
-    ReplaceInFile(path, "#ProjectName#", name);
-    ReplaceInFile(path, "#GUID#");
-
-    return true;
+    try {
+        return spTemplate->RenderToFile(path, MakeProjectArguments(name));
+    }
+    catch (...) {
+        return false;
+    }
 }
 
 bool FlVisualStudioProjectManager::CreateFilters(const std::filesystem::path& dir, const std::string& name) noexcept
 {
     auto path = dir / (name + ".vcxproj.filters");
 
-    {
-        std::ofstream ofs(path);
-        if (!ofs) return false;
-
-        auto str = LoadTextFile("Src/Framework/System/VisualStudioManager/Sample/Template.vcxproj.filters.flsample");
-        ofs << str;
-    } // close
+    const auto spTemplate{ m_templates->Acquire("Src/Framework/System/VisualStudioManager/Sample/Template.vcxproj.filters.flsample") };
+    if (!spTemplate) return false;
 
-    ReplaceInFile(path, "#ProjectName#", name);
-    ReplaceInFile(path, "#GUID#");
-
-    return true;
+    try {
+        return spTemplate->RenderToFile(path, MakeProjectArguments(name));
+    }
+    catch (...) {
+        return false;
+    }
 }
 
 bool FlVisualStudioProjectManager::AddToSolutionUsingDotNet(const std::filesystem::path& sln, const std::filesystem::path& vcxproj) noexcept
@@ -394,45 +368,14 @@ bool FlVisualStudioProjectManager::AddProjectToSolution(
 }
 
 
-void FlVisualStudioProjectManager::ReplaceInFile(const std::filesystem::path& path, const std::string& from, const std::string& to) noexcept
-{
-    std::ifstream ifs(path);
-    std::stringstream buffer;
-    buffer << ifs.rdbuf();
-
-    std::string text{ buffer.str() };
-    size_t pos{ Def::ULongLongZero };
-
-    while ((pos = text.find(from, pos)) != std::string::npos) {
-        text.replace(pos, from.size(), to);
-        pos += to.size();
-    }
-
-    std::ofstream ofs(path);
-    ofs << text;
-}
-
-void FlVisualStudioProjectManager::ReplaceInFile(const std::filesystem::path& path, const std::string& from) noexcept
+FlCodeTemplate::Arguments FlVisualStudioProjectManager::MakeProjectArguments(const std::string& name)
 {
-    std::ifstream ifs(path);
-    std::stringstream buffer;
-    buffer << ifs.rdbuf();
-
-    std::string text{ buffer.str() };
-    size_t pos{ Def::ULongLongZero };
-
-    while ((pos = text.find(from, pos)) != std::string::npos) {
-
-        // GUID
-        FlGuid guid;
-        auto guidStr{ guid.ToString() };
-
-        text.replace(pos, from.size(), guidStr);
-        pos += guidStr.size();
-    }
+    auto args{ FlCodeTemplate::Arguments{} };
+    args.Set("ProjectName", name);
 
-    std::ofstream ofs(path);
-    ofs << text;
+    // oɕʂGUID𐶐
+    args.SetGenerator("GUID", [] { return FlGuid{}.ToString(); });
+    return args;
 }
 
 bool FlVisualStudioProjectManager::RemoveProjectFromSolution(const std::filesystem::path& projPath) noexcept
@@ -2,6 +2,7 @@
 
 #include "../System/XMLParser/FlAutomaticFileAddSystem.h"
 #include "../System/CppParser/FlCppParser.h"
+#include "FlCodeTemplate.h"
 
 class FlVisualStudioProjectManager
 {
@@ -9,7 +10,8 @@ public:
     FlVisualStudioProjectManager(const std::filesystem::path& solutionPath)
         : m_solutionPath{ solutionPath }
         , m_autoAdd{ std::make_unique<FlAutomaticFileAddSystem>() }
-        , m_cppParser{ std::make_unique<FlSimpleCppParser>() }
+        , m_cppIndexer{ std::make_unique<FlCppDeclarationIndexer>() }
+        , m_templates{ std::make_unique<FlCodeTemplateCache>() }
     {}
 
     // vWFNg쐬ƃ\[Vւ̒ǉꊇs
@@ -56,20 +58,13 @@ private:
         ) noexcept;
 
     // -----------------------------------------------
-    // eLXguit@CPʁj
+    // .vcxproj / .filters ev[g̈i#ProjectName# / #GUID#j
     // -----------------------------------------------
-    void ReplaceInFile(const std::filesystem::path& path,
-        const std::string& from,
-        const std::string& to) noexcept;
-
-    // -----------------------------------------------
-    // GUIDu
-    // -----------------------------------------------
-    void ReplaceInFile(const std::filesystem::path& path,
-        const std::string& from) noexcept;
+    static FlCodeTemplate::Arguments MakeProjectArguments(const std::string& name);
 
     std::filesystem::path m_solutionPath;
 
     std::unique_ptr<FlAutomaticFileAddSystem> m_autoAdd;
-    std::unique_ptr<FlSimpleCppParser> m_cppParser;
+    std::unique_ptr<FlCppDeclarationIndexer> m_cppIndexer; // ύX̖t@C͍ĉ͂Ȃ
+    std::unique_ptr<FlCodeTemplateCache> m_templates;      // .flsample 1x
 };
@@ -0,0 +1,314 @@
+#include "FlDirectoryModel.h"
+
+bool FlDirectoryModel::View::Update(const std::shared_ptr<const Listing>& spListing, const std::string& filter, const SortKey key, const bool isAscending)
+{
+	if (spListing == m_spListing && filter == m_filter && key == m_key && isAscending == m_isAscending) return false;
+
+	m_spListing	  = spListing;
+	m_filter	  = filter;
+	m_key		  = key;
+	m_isAscending = isAscending;
+	m_indices.clear();
+
+	if (!m_spListing) return true;
+
+	const auto lowerFilter{ ToSortName(filter) };
+
+	const auto& entries{ m_spListing->entries };
+	m_indices.reserve(entries.size());
+	for (auto i{ Def::UIntZero }; i < static_cast<uint32_t>(entries.size()); ++i)
+		if (lowerFilter.empty() || entries[i].sortName.find(lowerFilter) != std::string::npos) m_indices.push_back(i);
+
+	// XibvVbg͖OȂ̂ŁAȌȂ炻̂܂܎g
+	if (key == SortKey::Name && isAscending) return true;
+
+	std::sort(m_indices.begin(), m_indices.end(), [&entries, key, isAscending](const uint32_t l, const uint32_t r)
+		{
+			const auto& lhs{ entries[l] };
+			const auto& rhs{ entries[r] };
+			if (lhs.isDirectory != rhs.isDirectory) return lhs.isDirectory;
+
+			if (key == SortKey::Size && lhs.size != rhs.size) return isAscending ? lhs.size < rhs.size : lhs.size > rhs.size;
+			if (key == SortKey::Time && lhs.time != rhs.time) return isAscending ? lhs.time < rhs.time : lhs.time > rhs.time;
+
+			// l̓CfbNXiOj
+			return isAscending ? l < r : l > r;
+		});
+	return true;
+}
+
+FlDirectoryModel::FlDirectoryModel(const std::filesystem::path& root, const std::chrono::duration<int> interval)
+	: m_root{ root.lexically_normal() }
+	, m_absoluteRoot{ std::filesystem::absolute(root).lexically_normal() }
+	, m_interval{ interval }
+{}
+
+FlDirectoryModel::~FlDirectoryModel()
+{
+	Stop();
+}
+
+void FlDirectoryModel::Start(const bool isWatch)
+{
+	{
+		auto lock{ std::lock_guard{ m_mutex } };
+		if (m_isRunning) return;
+
+		m_isRunning = true;
+		m_isWatch	= isWatch;
+
+		// [g͍ŏɑĂ
+		if (m_pendingSet.insert(m_root).second) m_pendingScans.push_back(m_root);
+	}
+	m_worker = std::thread{ [this] { WorkerLoop(); } };
+}
+
+void FlDirectoryModel::Stop()
+{
+	{
+		auto lock{ std::lock_guard{ m_mutex } };
+		m_isRunning = false;
+	}
+	m_wake.notify_one();
+	m_idle.notify_all();
+
+	if (m_worker.joinable()) m_worker.join();
+
+	// ĎXbh͑XbĥŁAɎ~߂
+	m_upWatcher.reset();
+}
+
+std::shared_ptr<const FlDirectoryModel::Listing> FlDirectoryModel::Acquire(const std::filesystem::path& dir)
+{
+	const auto key{ ToKey(dir) };
+	if (key.empty()) return nullptr;
+
+	auto lock{ std::lock_guard{ m_mutex } };
+	if (auto it{ m_listings.find(key) }; it != m_listings.end()) return it->second;
+
+	if (m_pendingSet.insert(key).second)
+	{
+		m_pendingScans.push_back(key);
+		m_wake.notify_one();
+	}
+	return nullptr;
+}
+
+void FlDirectoryModel::Invalidate(const std::filesystem::path& dir)
+{
+	const auto key{ ToKey(dir) };
+	if (key.empty()) return;
+
+	// I܂ł͌ÂXibvVbg\
+	auto lock{ std::lock_guard{ m_mutex } };
+	if (m_pendingSet.insert(key).second)
+	{
+		m_pendingScans.push_back(key);
+		m_wake.notify_one();
+	}
+}
+
+void FlDirectoryModel::OnFileEvent(const std::filesystem::path& path, const FlFileWatcher::FileStatus status)
+{
+	auto lock{ std::lock_guard{ m_mutex } };
+	m_pendingEvents.push_back(FileEvent{ path, status });
+	m_wake.notify_one();
+}
+
+void FlDirectoryModel::WaitIdle()
+{
+	auto lock{ std::unique_lock{ m_mutex } };
+	m_idle.wait(lock, [this]
+		{
+			return !m_isRunning || (!m_isBusy && m_pendingScans.empty() && m_pendingEvents.empty());
+		});
+}
+
+std::vector<FlDirectoryModel::Entry> FlDirectoryModel::ScanDirectory(const std::filesystem::path& dir)
+{
+	auto entries{ std::vector<Entry>{} };
+
+	auto ec{ std::error_code{} };
+	auto it{ std::filesystem::directory_iterator{ dir, std::filesystem::directory_options::skip_permission_denied, ec } };
+	for (; !ec && it != std::filesystem::directory_iterator{}; it.increment(ec))
+		entries.push_back(MakeEntry(*it));
+
+	std::sort(entries.begin(), entries.end(), LessEntry);
+	return entries;
+}
+
+void FlDirectoryModel::WorkerLoop()
+{
+	auto isWatchPending{ true };
+
+	for (;;)
+	{
+		auto scans { std::vector<std::filesystem::path>{} };
+		auto events{ std::vector<FileEvent>{} };
+		{
+			auto lock{ std::unique_lock{ m_mutex } };
+			m_wake.wait(lock, [this] { return !m_isRunning || !m_pendingScans.empty() || !m_pendingEvents.empty(); });
+			if (!m_isRunning) break;
+
+			scans.swap(m_pendingScans);
+			events.swap(m_pendingEvents);
+
+			// ɓ͂ Invalidate ͎肱ڂȂ悤Aŗ\O
+			for (const auto& dir : scans) m_pendingSet.erase(dir);
+			m_isBusy = true;
+		}
+
+		for (const auto& dir : scans) Publish(dir, ScanDirectory(dir));
+		if (!events.empty()) ApplyEvents(std::move(events));
+
+		// [g\ł悤ɂȂĂĎn߂iőŜ𑖍邽߁j
+		if (isWatchPending && m_isWatch)
+		{
+			isWatchPending = false;
+			try {
+				auto upWatcher{ std::make_unique<FlFileWatcher>() };
+				upWatcher->SetPathAndInterval(m_absoluteRoot, m_interval);
+				upWatcher->Start([this](const std::filesystem::path& path, FlFileWatcher::FileStatus status) {
+					OnFileEvent(path, status);
+					});
+				m_upWatcher = std::move(upWatcher);
+			}
+			catch (const std::filesystem::filesystem_error& e) {
+				FlEditorAdministrator::Instance().GetLogger()->AddErrorLog("Error: Directory Watch %s  Path: %s", e.what(), m_root.string().c_str());
+			}
+		}
+
+		{
+			auto lock{ std::lock_guard{ m_mutex } };
+			m_isBusy = false;
+		}
+		m_idle.notify_all();
+	}
+}
+
+void FlDirectoryModel::ApplyEvents(std::vector<FileEvent>&& events)
+{
+	// efBNgɂ܂Ƃ߂ipX͍Ō̃Cxg΂悢j
+	auto byDirectory{ std::unordered_map<std::filesystem::path, std::unordered_map<std::filesystem::path, FlFileWatcher::FileStatus>>{} };
+	for (auto& event : events)
+	{
+		const auto key{ ToKey(event.path) };
+		if (key.empty() || key == m_root) continue;
+
+		byDirectory[key.parent_path()][key] = event.status;
+
+		if (event.status != FlFileWatcher::FileStatus::Erased) continue;
+
+		// fBNgȉ̃LbV̂Ă
+		auto lock{ std::lock_guard{ m_mutex } };
+		std::erase_if(m_listings, [&key](const auto& pair)
+			{
+				const auto& cached{ pair.first };
+				return std::mismatch(key.begin(), key.end(), cached.begin(), cached.end()).first == key.end();
+			});
+	}
+
+	for (auto& [dir, changes] : byDirectory)
+	{
+		auto spCurrent{ std::shared_ptr<const Listing>{} };
+		{
+			auto lock{ std::lock_guard{ m_mutex } };
+			if (auto it{ m_listings.find(dir) }; it != m_listings.end()) spCurrent = it->second;
+		}
+
+		// xJĂȂfBNǵAJꂽƂɑ
+		if (!spCurrent) continue;
+
+		auto entries{ spCurrent->entries };
+		auto findByName{ [&entries](const std::string& sortName, const bool isDirectory)
+			{
+				auto probe{ Entry{} };
+				probe.sortName	  = sortName;
+				probe.isDirectory = isDirectory;
+				return std::lower_bound(entries.begin(), entries.end(), probe, LessEntry);
+			} };
+		auto erase{ [&entries, &findByName](const std::string& name, const std::string& sortName)
+			{
+				for (const auto isDirectory : { true, false })
+				{
+					auto it{ findByName(sortName, isDirectory) };
+					for (; it != entries.end() && it->isDirectory == isDirectory && it->sortName == sortName; ++it)
+					{
+						if (it->name != name) continue;
+						entries.erase(it);
+						return;
+					}
+				}
+			} };
+
+		for (const auto& [key, status] : changes)
+		{
+			const auto name{ key.filename().string() };
+			erase(name, ToSortName(name));
+			if (status == FlFileWatcher::FileStatus::Erased) continue;
+
+			auto ec{ std::error_code{} };
+			const auto dirEntry{ std::filesystem::directory_entry{ key, ec } };
+			if (ec || !dirEntry.exists(ec)) continue;
+
+			auto entry{ MakeEntry(dirEntry) };
+			entries.insert(std::upper_bound(entries.begin(), entries.end(), entry, LessEntry), std::move(entry));
+		}
+
+		Publish(dir, std::move(entries));
+	}
+}
+
+void FlDirectoryModel::Publish(const std::filesystem::path& dir, std::vector<Entry>&& entries)
+{
+	auto spListing{ std::make_shared<Listing>() };
+	spListing->entries		  = std::move(entries);
+	spListing->directoryCount = static_cast<size_t>(std::count_if(spListing->entries.begin(), spListing->entries.end(),
+		[](const Entry& entry) { return entry.isDirectory; }));
+
+	auto lock{ std::lock_guard{ m_mutex } };
+	spListing->version = m_nextVersion++;
+	m_listings[dir]	   = std::move(spListing);
+}
+
+std::filesystem::path FlDirectoryModel::ToKey(const std::filesystem::path& path) const
+{
+	if (!path.is_absolute()) return path.lexically_normal();
+
+	const auto relative{ path.lexically_normal().lexically_relative(m_absoluteRoot) };
+	if (relative.empty() || *relative.begin() == "..") return {};
+	if (relative == ".") return m_root;
+
+	return (m_root / relative).lexically_normal();
+}
+
+FlDirectoryModel::Entry FlDirectoryModel::MakeEntry(const std::filesystem::directory_entry& dirEntry)
+{
+	auto entry{ Entry{} };
+	auto ec{ std::error_code{} };
+	entry.path		  = dirEntry.path();
+	entry.name		  = entry.path.filename().string();
+	entry.isDirectory = dirEntry.is_directory(ec);
+	entry.time		  = dirEntry.last_write_time(ec);
+	if (!entry.isDirectory)
+	{
+		const auto size{ dirEntry.file_size(ec) };
+		entry.size = ec ? Def::ULongLongZero : size;
+	}
+
+	entry.sortName = ToSortName(entry.name);
+	return entry;
+}
+
+std::string FlDirectoryModel::ToSortName(std::string name)
+{
+	std::transform(name.begin(), name.end(), name.begin(),
+		[](const unsigned char c) { return static_cast<char>(std::tolower(c)); });
+	return name;
+}
+
+bool FlDirectoryModel::LessEntry(const Entry& lhs, const Entry& rhs) noexcept
+{
+	if (lhs.isDirectory != rhs.isDirectory) return lhs.isDirectory;
+	return lhs.sortName < rhs.sortName;
+}
@@ -0,0 +1,156 @@
+#pragma once
+
+// fBNg̒gobNOEhőELbV郂f
+// UIXbh͕sσXibvVbg󂯎邾ŁAfBXNI/Os܂B
+// ĎCxg͐efBNg̃XibvVbg֍ƂĔf܂B
+class FlDirectoryModel
+{
+public:
+
+	struct Entry
+	{
+		std::filesystem::path			path;
+		std::string						name;
+		std::string						sortName;	// OiёւEpj
+		std::filesystem::file_time_type time{};
+		uintmax_t						size = Def::ULongLongZero;
+		bool							isDirectory = false;
+	};
+
+	// 1fBNg̕sσXibvVbgifBNg  t@CAeOj
+	struct Listing
+	{
+		std::vector<Entry> entries;
+		size_t			   directoryCount = Def::ULongLongZero;
+		uint64_t		   version		  = Def::ULongLongZero;
+	};
+
+	/// <summary>
+	/// XibvVbgёւEi荞݂CfbNXiUIXbhŕێj
+	/// ͂ςƂ蒼܂B
+	/// </summary>
+	class View
+	{
+	public:
+
+		enum class SortKey : uint32_t
+		{
+			Name,
+			Size,
+			Time,
+		};
+
+		/// <summary>
+		/// XibvVbgEEя̂ꂩςĂ΍蒼܂B
+		/// </summary>
+		/// <returns>蒼ꍇ true</returns>
+		bool Update(const std::shared_ptr<const Listing>& spListing, const std::string& filter, const SortKey key, const bool isAscending);
+
+		inline const auto  GetSize() const noexcept { return m_indices.size(); }
+		inline const auto& GetEntry(const size_t row) const noexcept { return m_spListing->entries[m_indices[row]]; }
+
+	private:
+
+		std::shared_ptr<const Listing> m_spListing;
+		std::vector<uint32_t>		   m_indices;
+		std::string					   m_filter;
+		SortKey						   m_key		 = SortKey::Name;
+		bool						   m_isAscending = true;
+	};
+
+	/// <summary>
+	/// [gĎE郂f쐬܂BiStart ĂԂ܂ŃXbh͓܂j
+	/// </summary>
+	/// <param name="root">[gfBNgiUI\L̂܂܁j</param>
+	/// <param name="interval">Ď̃|[OԊu</param>
+	FlDirectoryModel(const std::filesystem::path& root, const std::chrono::duration<int> interval);
+	~FlDirectoryModel();
+
+	FlDirectoryModel(const FlDirectoryModel&) = delete;
+	FlDirectoryModel& operator=(const FlDirectoryModel&) = delete;
+
+	/// <summary>
+	/// XbhJnA[g̑ƊĎn߂܂B
+	/// </summary>
+	/// <param name="isWatch">false ̏ꍇ͊Ďs킸 Invalidate ɂXV̂</param>
+	void Start(const bool isWatch = true);
+	void Stop();
+
+	/// <summary>
+	/// fBNg̃XibvVbg擾܂BȂ瑖\񂵂 nullptr Ԃ܂B
+	/// </summary>
+	std::shared_ptr<const Listing> Acquire(const std::filesystem::path& dir);
+
+	/// <summary>
+	/// fBNg𑖍܂BiGfB^̑쒼ȂǁAĎ̎҂ɔfƂj
+	/// </summary>
+	void Invalidate(const std::filesystem::path& dir);
+
+	/// <summary>
+	/// ĎCxgƂĎ󂯕t܂BXbhZ[t
+	/// </summary>
+	void OnFileEvent(const std::filesystem::path& path, const FlFileWatcher::FileStatus status);
+
+	/// <summary>
+	/// \ς݂̑EׂĔf܂őҋ@܂B
+	/// </summary>
+	void WaitIdle();
+
+	/// <summary>
+	/// fBNg𑖍ĕבւGgԂ܂BiXbhĂ΂܂j
+	/// </summary>
+	static std::vector<Entry> ScanDirectory(const std::filesystem::path& dir);
+
+	inline const auto& GetRoot() const noexcept { return m_root; }
+
+private:
+
+	struct FileEvent
+	{
+		std::filesystem::path	  path;
+		FlFileWatcher::FileStatus status;
+	};
+
+	void WorkerLoop();
+
+	/// <summary>
+	/// ĎCxgefBNgPʂɂ܂Ƃ߁AfBNg1񂾂Ĕf܂B
+	/// </summary>
+	void ApplyEvents(std::vector<FileEvent>&& events);
+
+	void Publish(const std::filesystem::path& dir, std::vector<Entry>&& entries);
+
+	/// <summary>
+	/// UI\Liroot/...j֐K܂B[gÕpX͋Ԃ܂B
+	/// </summary>
+	std::filesystem::path ToKey(const std::filesystem::path& path) const;
+
+	static Entry MakeEntry(const std::filesystem::directory_entry& dirEntry);
+
+	static std::string ToSortName(std::string name);
+
+	// fBNgDEO̔r
+	static bool LessEntry(const Entry& lhs, const Entry& rhs) noexcept;
+
+	std::filesystem::path m_root;
+	std::filesystem::path m_absoluteRoot;
+
+	std::unique_ptr<FlFileWatcher> m_upWatcher;
+	std::chrono::duration<int>	   m_interval;
+
+	std::mutex			   m_mutex;
+	std::condition_variable m_wake;
+	std::condition_variable m_idle;
+
+	std::unordered_map<std::filesystem::path, std::shared_ptr<const Listing>> m_listings;
+	std::unordered_set<std::filesystem::path> m_pendingSet;
+	std::vector<std::filesystem::path>		  m_pendingScans;
+	std::vector<FileEvent>					  m_pendingEvents;
+
+	uint64_t m_nextVersion = Def::ULongLongOne;
+	bool	 m_isRunning   = false;
+	bool	 m_isBusy	   = false;
+	bool	 m_isWatch	   = true;
+
+	std::thread m_worker;
+};
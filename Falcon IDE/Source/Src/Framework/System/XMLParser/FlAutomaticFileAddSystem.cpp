@@ -1,7 +1,5 @@
 #include "FlAutomaticFileAddSystem.h"
 
-using namespace tinyxml2;
-
 FlAutomaticFileAddSystem::FlAutomaticFileAddSystem(const std::filesystem::path& vcxprojPath,
     const std::filesystem::path& filtersPath)
     : m_vcxprojPath{ vcxprojPath }, m_filtersPath{ filtersPath }, m_projectDir{ m_vcxprojPath.parent_path().lexically_normal() },
@@ -20,7 +18,9 @@ FlAutomaticFileAddSystem::FlAutomaticFileAddSystem(const std::filesystem::path&
         { ".asm", "MASM" },
         { ".hlsl", "FxCompile" },
     }
-{}
+{
+    m_upSession = std::make_unique<FlProjectDocumentSession>(m_vcxprojPath, m_filtersPath);
+}
 
 FlAutomaticFileAddSystem::FlAutomaticFileAddSystem()
     : TypeMap{
@@ -65,40 +65,23 @@ bool FlAutomaticFileAddSystem::AddFiles(const std::vector<FileCreationConfig>& f
 		if (!WriteFileToDisk(fullPath, file.content)) return false;
 	}
 
-	// 2. vcxproj̍XV (xLoad/Save)
-	{
-		tinyxml2::XMLDocument doc;
-		if (doc.LoadFile(m_vcxprojPath.string().c_str()) != XML_SUCCESS) return false;
+	// 2. vWFNgt@C̍XV (ob`łȂ΂1񂾂o)
+	if (!m_upSession || !m_upSession->Begin()) return false;
 
-		for (const auto& file : files)
-		{
-			auto fullPath = outputDir / file.fileName;
-			if (file.itemType == Def::EmptyStr) AddToVcxproj(doc, fullPath, DetectItemType(file.fileName));
-			else AddToVcxproj(doc, fullPath, file.itemType);
-		}
-
-		if (doc.SaveFile(m_vcxprojPath.string().c_str()) != XML_SUCCESS) return false;
-	}
-
-	// 3. filters̍XV (xLoad/Save)
+	for (const auto& file : files)
 	{
-		tinyxml2::XMLDocument doc;
-		if (doc.LoadFile(m_filtersPath.string().c_str()) != XML_SUCCESS) return false;
-
-		// w肳ꂽtB^Kw݂Ȃꍇ͍쐬
-		EnsureFilterPathExists(doc, normalizedFilterPath);
+		auto fullPath{ outputDir / file.fileName };
+		auto relPath { std::filesystem::relative(fullPath, m_projectDir).generic_string() };
+		auto itemType{ file.itemType == Def::EmptyStr ? DetectItemType(file.fileName) : file.itemType };
 
-		for (const auto& file : files)
+		if (!m_upSession->AddItem(relPath, itemType, normalizedFilterPath))
 		{
-			auto fullPath = outputDir / file.fileName;
-			if (file.itemType == Def::EmptyStr) AddToFilters(doc, fullPath, DetectItemType(file.fileName), normalizedFilterPath);
-			else AddToFilters(doc, fullPath, file.itemType, normalizedFilterPath);
+			m_upSession->Rollback();
+			return false;
 		}
-
-		if (doc.SaveFile(m_filtersPath.string().c_str()) != XML_SUCCESS) return false;
 	}
 
-    return true;
+	return m_upSession->Commit();
 }
 
 bool FlAutomaticFileAddSystem::RemoveFiles(const std::vector<std::string>& fileNames, const std::string& filterPath) noexcept
@@ -106,30 +89,14 @@ bool FlAutomaticFileAddSystem::RemoveFiles(const std::vector<std::string>& fileN
     auto normalizedFilterPath{ std::filesystem::path(filterPath).lexically_normal().string() };
     auto outputDir{ m_projectDir / normalizedFilterPath };
 
-    // vcxproj폜
-    {
-        tinyxml2::XMLDocument doc;
-        if (doc.LoadFile(m_vcxprojPath.string().c_str()) == XML_SUCCESS)
-        {
-            for (const auto& name : fileNames)
-            {
-                RemoveFromVcxproj(doc, outputDir / name);
-            }
-            doc.SaveFile(m_vcxprojPath.string().c_str());
-        }
-    }
-
-    // filters폜
+    // vWFNgt@C폜
+    if (m_upSession && m_upSession->Begin())
     {
-        tinyxml2::XMLDocument doc;
-        if (doc.LoadFile(m_filtersPath.string().c_str()) == XML_SUCCESS)
+        for (const auto& name : fileNames)
         {
-            for (const auto& name : fileNames)
-            {
-                RemoveFromFilters(doc, outputDir / name);
-            }
-            doc.SaveFile(m_filtersPath.string().c_str());
+            m_upSession->RemoveItem(std::filesystem::relative(outputDir / name, m_projectDir).generic_string());
         }
+        m_upSession->Commit();
     }
 
     // t@C̍폜
@@ -143,14 +110,29 @@ bool FlAutomaticFileAddSystem::RemoveFiles(const std::vector<std::string>& fileN
     return allDeleted;
 }
 
+bool FlAutomaticFileAddSystem::BeginBatch() noexcept
+{
+    return m_upSession && m_upSession->Begin();
+}
+
+bool FlAutomaticFileAddSystem::EndBatch() noexcept
+{
+    return m_upSession && m_upSession->Commit();
+}
+
 void FlAutomaticFileAddSystem::SetProjectDirPath(std::filesystem::path projectDir) noexcept
 {
     // <QuickReturn:݂Ȃꍇ>
     if (!std::filesystem::exists(projectDir)) return;
 
+    // <QuickReturn:vWFNgiǂݍݍς݂̃hLgg񂷁j>
+    if (m_upSession && projectDir.lexically_normal() == m_projectDir) return;
+
     m_projectDir  = projectDir.lexically_normal();
     m_vcxprojPath = *Str::GetFilePaths(m_projectDir.string(), ".vcxproj").data();
     m_filtersPath = *Str::GetFilePaths(m_projectDir.string(), ".filters").data();
+
+    m_upSession = std::make_unique<FlProjectDocumentSession>(m_vcxprojPath, m_filtersPath);
 }
 
 bool FlAutomaticFileAddSystem::WriteFileToDisk(const std::filesystem::path& fullPath, const std::string& content) noexcept
@@ -173,197 +155,6 @@ bool FlAutomaticFileAddSystem::DeleteFileFromDisk(const std::filesystem::path& f
     }
 }
 
-// ---------------------------------------------------------
-// XML Manipulation Helper
-// ---------------------------------------------------------
-
-bool FlAutomaticFileAddSystem::AddToVcxproj(tinyxml2::XMLDocument& doc, const std::filesystem::path& filePath, const std::string& itemType) noexcept
-{
-    XMLElement* root = doc.RootElement();
-    if (!root) return false;
-
-    // ItemGroupTAȂ΍
-    XMLElement* itemGroup = nullptr;
-    for (XMLElement* ig = root->FirstChildElement("ItemGroup"); ig; ig = ig->NextSiblingElement("ItemGroup"))
-    {
-        if (ig->FirstChildElement(itemType.c_str()))
-        {
-            itemGroup = ig;
-            break;
-        }
-    }
-    if (!itemGroup)
-    {
-        itemGroup = doc.NewElement("ItemGroup");
-        root->InsertEndChild(itemGroup);
-    }
-
-    auto relPath = std::filesystem::relative(filePath, m_projectDir).generic_string();
-
-    // d`FbN (Ȉ)
-    for (XMLElement* e = itemGroup->FirstChildElement(itemType.c_str()); e; e = e->NextSiblingElement(itemType.c_str()))
-    {
-        const char* inc = e->Attribute("Include");
-        if (inc && relPath == inc) return true; // ɂ
-    }
-
-    XMLElement* elem = doc.NewElement(itemType.c_str());
-    elem->SetAttribute("Include", relPath.c_str());
-    itemGroup->InsertEndChild(elem);
-
-    return true;
-}
-
-void FlAutomaticFileAddSystem::EnsureFilterPathExists(tinyxml2::XMLDocument& doc, const std::string& filterPathStr) noexcept
-{
-    XMLElement* root = doc.RootElement();
-    if (!root) return;
-
-    std::string filterPathWin = filterPathStr;
-    std::replace(filterPathWin.begin(), filterPathWin.end(), '/', '\\');
-
-    // Filter`pItemGroupT
-    XMLElement* filterItemGroup = nullptr;
-    for (XMLElement* ig = root->FirstChildElement("ItemGroup"); ig; ig = ig->NextSiblingElement("ItemGroup"))
-    {
-        if (ig->FirstChildElement("Filter"))
-        {
-            filterItemGroup = ig;
-            break;
-        }
-    }
-    if (!filterItemGroup)
-    {
-        filterItemGroup = doc.NewElement("ItemGroup");
-        root->InsertEndChild(filterItemGroup);
-    }
-
-    // pX𕪉Đe珇ɑ݊mFE쐬
-    std::string currentPath;
-    std::stringstream ss(filterPathWin);
-    std::string segment;
-
-    while (std::getline(ss, segment, '\\'))
-    {
-        if (!currentPath.empty()) currentPath += "\\";
-        currentPath += segment;
-
-        bool exists = false;
-        for (XMLElement* f = filterItemGroup->FirstChildElement("Filter"); f; f = f->NextSiblingElement("Filter"))
-        {
-            const char* inc = f->Attribute("Include");
-            if (inc && currentPath == inc)
-            {
-                exists = true;
-                break;
-            }
-        }
-
-        if (!exists)
-        {
-            XMLElement* filterElem = doc.NewElement("Filter");
-            filterElem->SetAttribute("Include", currentPath.c_str());
-
-            XMLElement* uid = doc.NewElement("UniqueIdentifier");
-            // : {UUIDCugׂłA̎dlɏ]ȈՓIȒl܂
-            // Kvɉ std::hash  Windows API (CoCreateGuid) gpĂ
-            uid->SetText(("{" + std::to_string(std::hash<std::string>{}(currentPath)) + "}").c_str());
-
-            filterElem->InsertEndChild(uid);
-            filterItemGroup->InsertEndChild(filterElem);
-        }
-    }
-}
-
-bool FlAutomaticFileAddSystem::AddToFilters(tinyxml2::XMLDocument& doc, const std::filesystem::path& filePath, const std::string& itemType, const std::string& filterPathStr) noexcept
-{
-	XMLElement* root = doc.RootElement();
-	if (!root) return false;
-
-	// ItemTypeɑΉItemGroupT
-	XMLElement* itemGroup = nullptr;
-	for (XMLElement* ig = root->FirstChildElement("ItemGroup"); ig; ig = ig->NextSiblingElement("ItemGroup"))
-	{
-		if (ig->FirstChildElement(itemType.c_str()))
-		{
-			itemGroup = ig;
-			break;
-		}
-	}
-
-	if (!itemGroup)
-	{
-		itemGroup = doc.NewElement("ItemGroup");
-		root->InsertEndChild(itemGroup);
-	}
-
-	auto relPath = std::filesystem::relative(filePath, m_projectDir).generic_string();
-	std::string filterPathWin = filterPathStr;
-	std::replace(filterPathWin.begin(), filterPathWin.end(), '/', '\\');
-
-	// d`FbN
-	for (XMLElement* e = itemGroup->FirstChildElement(itemType.c_str()); e; e = e->NextSiblingElement(itemType.c_str()))
-	{
-		const char* inc = e->Attribute("Include");
-		if (inc && relPath == inc) return true;
-	}
-
-	XMLElement* elem = doc.NewElement(itemType.c_str());
-	elem->SetAttribute("Include", relPath.c_str());
-
-	XMLElement* filterElem = doc.NewElement("Filter");
-	filterElem->SetText(filterPathWin.c_str());
-	elem->InsertEndChild(filterElem);
-
-	itemGroup->InsertEndChild(elem);
-	return true;
-}
-
-bool FlAutomaticFileAddSystem::RemoveFromVcxproj(tinyxml2::XMLDocument& doc, const std::filesystem::path& filePath) noexcept
-{
-    XMLElement* root{ doc.RootElement() };
-    if (!root) return false;
-
-    auto relPath{ std::filesystem::relative(filePath, m_projectDir).generic_string() };
-    auto removed{ false };
-
-    for (XMLElement* ig = root->FirstChildElement("ItemGroup"); ig; )
-    {
-        XMLElement* nextIg = ig->NextSiblingElement("ItemGroup");
-        bool groupEmpty = true;
-
-        for (XMLElement* elem = ig->FirstChildElement(); elem; )
-        {
-            XMLElement* nextElem = elem->NextSiblingElement();
-            const char* include = elem->Attribute("Include");
-
-            if (include && relPath == include)
-            {
-                ig->DeleteChild(elem);
-                removed = true;
-            }
-            else
-            {
-                groupEmpty = false;
-            }
-            elem = nextElem;
-        }
-
-        if (groupEmpty && !ig->FirstChildElement())
-        {
-            root->DeleteChild(ig);
-        }
-        ig = nextIg;
-    }
-    return removed;
-}
-
-bool FlAutomaticFileAddSystem::RemoveFromFilters(tinyxml2::XMLDocument& doc, const std::filesystem::path& filePath) noexcept
-{
-    // WbN RemoveFromVcxproj ƂقړiIncludeŃ}b`Oďj
-    return RemoveFromVcxproj(doc, filePath);
-}
-
 std::string FlAutomaticFileAddSystem::DetectItemType(const std::filesystem::path& filePath) noexcept
 {
     std::string ext = filePath.extension().string();
@@ -1,5 +1,5 @@
 #pragma once
-#include "tinyxml2.h"
+#include "FlProjectDocumentSession.h"
 
 /// <summary>
 /// 쐬t@C̍\
@@ -32,6 +32,16 @@ public:
     /// </summary>
     bool RemoveFiles(const std::vector<std::string>& fileNames, const std::string& filterPath) noexcept;
 
+    /// <summary>
+    /// ȍ~ AddFiles / RemoveFiles 1̃gUNVɂ܂Ƃ߂ivWFNgt@C̏o EndBatch 1j
+    /// </summary>
+    bool BeginBatch() noexcept;
+
+    /// <summary>
+    /// BeginBatch ̕ύX܂Ƃ߂ďo
+    /// </summary>
+    bool EndBatch() noexcept;
+
     /// <summary>
     /// ProjectfBNgpX̃Zb^iProjectt@CtB^t@CpX̎ݒj
     /// </summary>
@@ -43,20 +53,13 @@ private:
     bool WriteFileToDisk(const std::filesystem::path& fullPath, const std::string& content) noexcept;
     bool DeleteFileFromDisk(const std::filesystem::path& fullPath) noexcept;
 
-    // XML (hLgŎ󂯎`ɕύXAAɑΉ)
-    bool AddToVcxproj(tinyxml2::XMLDocument& doc, const std::filesystem::path& filePath, const std::string& itemType) noexcept;
-    bool AddToFilters(tinyxml2::XMLDocument& doc, const std::filesystem::path& filePath, const std::string& itemType, const std::string& filterPathStr) noexcept;
-
-    bool RemoveFromVcxproj(tinyxml2::XMLDocument& doc, const std::filesystem::path& filePath) noexcept;
-    bool RemoveFromFilters(tinyxml2::XMLDocument& doc, const std::filesystem::path& filePath) noexcept;
-
-    // tB^Kw쐬wp[
-    void EnsureFilterPathExists(tinyxml2::XMLDocument& doc, const std::string& filterPathStr) noexcept;
-
     std::string DetectItemType(const std::filesystem::path& filePath) noexcept;
 
     std::filesystem::path m_vcxprojPath;
     std::filesystem::path m_filtersPath;
     std::filesystem::path m_projectDir;
+
+    // vWFNgt@C͏풓ĕҏWipXݒ莞ɍ蒼j
+    std::unique_ptr<FlProjectDocumentSession> m_upSession;
     const std::unordered_map<std::string, std::string> TypeMap;
 };
\ No newline at end of file
@@ -0,0 +1,341 @@
+#include "FlProjectDocumentSession.h"
+
+using namespace tinyxml2;
+
+FlProjectDocumentSession::FlProjectDocumentSession(const std::filesystem::path& vcxprojPath, const std::filesystem::path& filtersPath)
+{
+    m_vcxproj.path = vcxprojPath;
+    m_filters.path = filtersPath;
+}
+
+bool FlProjectDocumentSession::Begin() noexcept
+{
+    if (m_depth++ > Def::UIntZero) return true;
+
+    // ǍEOōXVꂽǂݍ
+    for (auto* pDocument : { &m_vcxproj, &m_filters })
+    {
+        if (pDocument->upDoc && !IsChangedOnDisk(*pDocument)) continue;
+        if (Load(*pDocument)) continue;
+
+        m_depth = Def::UIntZero;
+        return false;
+    }
+    return true;
+}
+
+bool FlProjectDocumentSession::Commit() noexcept
+{
+    if (m_depth == Def::UIntZero) return false;
+    if (--m_depth > Def::UIntZero) return true;
+
+    if (!m_vcxproj.isDirty && !m_filters.isDirty) return true;
+
+    // ̈ꎞt@CĂu
+    auto pending{ std::vector<std::pair<Document*, std::filesystem::path>>{} };
+    for (auto* pDocument : { &m_vcxproj, &m_filters })
+    {
+        if (!pDocument->isDirty) continue;
+
+        auto tempPath{ pDocument->path };
+        tempPath += ".tmp";
+        if (!WriteTemporary(*pDocument, tempPath))
+        {
+            auto ec{ std::error_code{} };
+            for (const auto& [pWritten, path] : pending) std::filesystem::remove(path, ec);
+            std::filesystem::remove(tempPath, ec);
+
+            FlEditorAdministrator::Instance().GetLogger()->AddErrorLog("Failed to write project file: %s", pDocument->path.string().c_str());
+            Rollback();
+            return false;
+        }
+        pending.emplace_back(pDocument, tempPath);
+    }
+
+    // uOɗ̑ޔArŎsuς݂̕ɖ߂
+    const auto backupOf{ [](const std::filesystem::path& path) { auto backup{ path }; backup += ".bak"; return backup; } };
+    const auto discard { [&pending]
+        {
+            auto ec{ std::error_code{} };
+            for (const auto& [pDocument, tempPath] : pending) std::filesystem::remove(tempPath, ec);
+        } };
+
+    for (const auto& [pDocument, tempPath] : pending)
+    {
+        auto ec{ std::error_code{} };
+        if (!std::filesystem::exists(pDocument->path, ec)) continue;
+        if (std::filesystem::copy_file(pDocument->path, backupOf(pDocument->path), std::filesystem::copy_options::overwrite_existing, ec)) continue;
+
+        FlEditorAdministrator::Instance().GetLogger()->AddErrorLog("Failed to back up project file: %s", pDocument->path.string().c_str());
+        for (const auto& [pBackedUp, unused] : pending) std::filesystem::remove(backupOf(pBackedUp->path), ec);
+        discard();
+        Rollback();
+        return false;
+    }
+
+    auto replaced{ size_t{} };
+    for (; replaced < pending.size(); ++replaced)
+    {
+        auto ec{ std::error_code{} };
+        std::filesystem::rename(pending[replaced].second, pending[replaced].first->path, ec);
+        if (ec)
+        {
+            FlEditorAdministrator::Instance().GetLogger()->AddErrorLog("Failed to replace project file: %s", pending[replaced].first->path.string().c_str());
+            break;
+        }
+    }
+
+    const auto isSuccess{ replaced == pending.size() };
+    for (auto i{ size_t{} }; i < pending.size(); ++i)
+    {
+        auto* pDocument{ pending[i].first };
+        auto  ec       { std::error_code{} };
+        if (isSuccess)
+        {
+            pDocument->isDirty   = false;
+            pDocument->writeTime = std::filesystem::last_write_time(pDocument->path, ec);
+            pDocument->size      = std::filesystem::file_size(pDocument->path, ec);
+            std::filesystem::remove(backupOf(pDocument->path), ec);
+        }
+        else if (i < replaced)
+        {
+            std::filesystem::rename(backupOf(pDocument->path), pDocument->path, ec);
+            if (ec) FlEditorAdministrator::Instance().GetLogger()->AddErrorLog("Failed to restore project file, backup kept: %s", backupOf(pDocument->path).string().c_str());
+        }
+        else std::filesystem::remove(backupOf(pDocument->path), ec);
+    }
+
+    if (!isSuccess)
+    {
+        discard();
+        Rollback();
+    }
+    return isSuccess;
+}
+
+void FlProjectDocumentSession::Rollback() noexcept
+{
+    m_depth = Def::UIntZero;
+    for (auto* pDocument : { &m_vcxproj, &m_filters })
+    {
+        //  Begin œǂݍݒ
+        pDocument->upDoc.reset();
+        pDocument->isDirty = false;
+    }
+}
+
+bool FlProjectDocumentSession::AddItem(const std::string& include, const std::string& itemType, const std::string& filterPath) noexcept
+{
+    if (!IsInTransaction()) return false;
+
+    return AddElement(m_vcxproj, include, itemType, {}) &&
+           AddElement(m_filters, include, itemType, filterPath);
+}
+
+bool FlProjectDocumentSession::RemoveItem(const std::string& include) noexcept
+{
+    if (!IsInTransaction()) return false;
+
+    const auto removedProject{ RemoveElements(m_vcxproj, include) };
+    const auto removedFilters{ RemoveElements(m_filters, include) };
+    return removedProject || removedFilters;
+}
+
+const bool FlProjectDocumentSession::Contains(const std::string& include) const noexcept
+{
+    return m_vcxproj.items.contains(ToKey(include));
+}
+
+bool FlProjectDocumentSession::Load(Document& document) noexcept
+{
+    auto upDoc{ std::make_unique<XMLDocument>() };
+    if (upDoc->LoadFile(document.path.string().c_str()) != XML_SUCCESS || !upDoc->RootElement()) return false;
+
+    auto ec{ std::error_code{} };
+    document.upDoc     = std::move(upDoc);
+    document.isDirty   = false;
+    document.writeTime = std::filesystem::last_write_time(document.path, ec);
+    document.size      = std::filesystem::file_size(document.path, ec);
+
+    BuildIndex(document);
+    return true;
+}
+
+const bool FlProjectDocumentSession::IsChangedOnDisk(const Document& document) const noexcept
+{
+    auto ec{ std::error_code{} };
+    const auto writeTime{ std::filesystem::last_write_time(document.path, ec) };
+    if (ec) return true;
+    const auto size{ std::filesystem::file_size(document.path, ec) };
+    if (ec) return true;
+
+    return writeTime != document.writeTime || size != document.size;
+}
+
+void FlProjectDocumentSession::BuildIndex(Document& document) noexcept
+{
+    document.items.clear();
+    document.itemGroups.clear();
+    document.filters.clear();
+    document.pFilterGroup = nullptr;
+
+    auto* pRoot{ document.upDoc->RootElement() };
+    for (auto* pGroup{ pRoot->FirstChildElement("ItemGroup") }; pGroup; pGroup = pGroup->NextSiblingElement("ItemGroup"))
+    {
+        for (auto* pElem{ pGroup->FirstChildElement() }; pElem; pElem = pElem->NextSiblingElement())
+        {
+            const auto* include{ pElem->Attribute("Include") };
+            if (!include) continue;
+
+            const auto name{ std::string{ pElem->Name() } };
+            document.itemGroups.try_emplace(name, pGroup);
+
+            // .filters  ItemGroup  Filter ̓tB^`
+            if (name == "Filter")
+            {
+                if (!document.pFilterGroup) document.pFilterGroup = pGroup;
+                document.filters.try_emplace(ToKey(include), pElem);
+            }
+            else document.items[ToKey(include)].push_back(pElem);
+        }
+    }
+}
+
+bool FlProjectDocumentSession::AddElement(Document& document, const std::string& include, const std::string& itemType, const std::string& filterPath) noexcept
+{
+    if (!document.upDoc) return false;
+
+    // d`FbN
+    const auto key{ ToKey(include) };
+    if (auto it{ document.items.find(key) }; it != document.items.end())
+        for (const auto* pElem : it->second)
+            if (itemType == pElem->Name()) return true;
+
+    auto* pGroup{ FindOrCreateItemGroup(document, itemType) };
+    if (!pGroup) return false;
+
+    auto* pElem{ document.upDoc->NewElement(itemType.c_str()) };
+    pElem->SetAttribute("Include", include.c_str());
+
+    if (!filterPath.empty())
+    {
+        auto filterPathWin{ filterPath };
+        std::replace(filterPathWin.begin(), filterPathWin.end(), '/', '\\');
+
+        EnsureFilterPathExists(document, filterPathWin);
+
+        auto* pFilter{ document.upDoc->NewElement("Filter") };
+        pFilter->SetText(filterPathWin.c_str());
+        pElem->InsertEndChild(pFilter);
+    }
+
+    pGroup->InsertEndChild(pElem);
+    document.items[key].push_back(pElem);
+    document.isDirty = true;
+    return true;
+}
+
+bool FlProjectDocumentSession::RemoveElements(Document& document, const std::string& include) noexcept
+{
+    if (!document.upDoc) return false;
+
+    auto it{ document.items.find(ToKey(include)) };
+    if (it == document.items.end()) return false;
+
+    auto* pRoot{ document.upDoc->RootElement() };
+    for (auto* pElem : it->second)
+    {
+        auto* pGroup{ pElem->Parent()->ToElement() };
+        pGroup->DeleteChild(pElem);
+
+        if (pGroup->FirstChildElement()) continue;
+
+        // ɂȂ ItemGroup 菜A̎ނ̑\T
+        for (auto groupIt{ document.itemGroups.begin() }; groupIt != document.itemGroups.end(); )
+        {
+            if (groupIt->second != pGroup) { ++groupIt; continue; }
+
+            const auto type{ groupIt->first };
+            groupIt = document.itemGroups.erase(groupIt);
+
+            for (auto* pOther{ pRoot->FirstChildElement("ItemGroup") }; pOther; pOther = pOther->NextSiblingElement("ItemGroup"))
+            {
+                if (pOther == pGroup || !pOther->FirstChildElement(type.c_str())) continue;
+                document.itemGroups.emplace(type, pOther);
+                break;
+            }
+        }
+        if (document.pFilterGroup == pGroup) document.pFilterGroup = nullptr;
+        pRoot->DeleteChild(pGroup);
+    }
+
+    document.items.erase(it);
+    document.isDirty = true;
+    return true;
+}
+
+void FlProjectDocumentSession::EnsureFilterPathExists(Document& document, const std::string& filterPath) noexcept
+{
+    if (!document.pFilterGroup)
+    {
+        document.pFilterGroup = document.upDoc->NewElement("ItemGroup");
+        document.upDoc->RootElement()->InsertEndChild(document.pFilterGroup);
+    }
+
+    // pX𕪉Đe珇ɑ݊mFE쐬
+    auto currentPath{ std::string{} };
+    auto ss         { std::stringstream{ filterPath } };
+    auto segment    { std::string{} };
+
+    while (std::getline(ss, segment, '\\'))
+    {
+        if (!currentPath.empty()) currentPath += "\\";
+        currentPath += segment;
+
+        const auto key{ ToKey(currentPath) };
+        if (document.filters.contains(key)) continue;
+
+        auto* pFilter{ document.upDoc->NewElement("Filter") };
+        pFilter->SetAttribute("Include", currentPath.c_str());
+
+        auto* pUid{ document.upDoc->NewElement("UniqueIdentifier") };
+        pUid->SetText(("{" + std::to_string(std::hash<std::string>{}(currentPath)) + "}").c_str());
+
+        pFilter->InsertEndChild(pUid);
+        document.pFilterGroup->InsertEndChild(pFilter);
+        document.filters.emplace(key, pFilter);
+        document.itemGroups.try_emplace("Filter", document.pFilterGroup);
+    }
+}
+
+tinyxml2::XMLElement* FlProjectDocumentSession::FindOrCreateItemGroup(Document& document, const std::string& itemType) noexcept
+{
+    if (auto it{ document.itemGroups.find(itemType) }; it != document.itemGroups.end()) return it->second;
+
+    auto* pGroup{ document.upDoc->NewElement("ItemGroup") };
+    document.upDoc->RootElement()->InsertEndChild(pGroup);
+    document.itemGroups.emplace(itemType, pGroup);
+    return pGroup;
+}
+
+bool FlProjectDocumentSession::WriteTemporary(const Document& document, const std::filesystem::path& tempPath) noexcept
+{
+    // SaveFile Ɠ`Ń֏o
+    auto printer{ XMLPrinter{} };
+    document.upDoc->Print(&printer);
+
+    auto ofs{ std::ofstream{ tempPath, std::ios::binary | std::ios::trunc } };
+    if (!ofs) return false;
+
+    ofs.write(printer.CStr(), static_cast<std::streamsize>(printer.CStrSize() - Def::ULongLongOne));
+    ofs.close();
+    return !ofs.fail();
+}
+
+std::string FlProjectDocumentSession::ToKey(std::string path)
+{
+    std::replace(path.begin(), path.end(), '/', '\\');
+    std::transform(path.begin(), path.end(), path.begin(),
+        [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return path;
+}
@@ -0,0 +1,96 @@
+#pragma once
+#include "tinyxml2.h"
+
+/// <summary>
+/// .vcxproj / .filters 풓AڂƃtB^nbVň悤ɂҏWZbV
+/// Begin ` Commit ̊Ԃ̒ǉE폜̓ōsACommit 1xo܂B
+/// </summary>
+class FlProjectDocumentSession
+{
+public:
+
+    FlProjectDocumentSession(const std::filesystem::path& vcxprojPath, const std::filesystem::path& filtersPath);
+
+    /// <summary>
+    /// gUNVJn܂BqɂłAłO Commit ł̂ݏo܂B
+    /// OiIDEjŃt@CXVĂΓǂݍݒ܂B
+    /// </summary>
+    bool Begin() noexcept;
+
+    /// <summary>
+    /// ύXΗt@Cꎞt@C֏Ău܂B
+    /// uOɗ ".bak" ֑ޔAЕ̒uɎs痼Ƃ̓eɖ߂܂B
+    /// </summary>
+    /// <returns>oɎsꍇ falsei̕ύX͔jj</returns>
+    bool Commit() noexcept;
+
+    /// <summary>
+    /// o̕ύXjAfBXN̓eǂݍݒ܂B
+    /// </summary>
+    void Rollback() noexcept;
+
+    /// <summary>
+    /// ڂǉ܂BiɂΉȂj
+    /// </summary>
+    /// <param name="include">vWFNg̑΃pX</param>
+    /// <param name="itemType">ClCompile / ClInclude Ȃ</param>
+    /// <param name="filterPath">VS̃tB^Kwi΍쐬j</param>
+    bool AddItem(const std::string& include, const std::string& itemType, const std::string& filterPath) noexcept;
+
+    /// <summary>
+    /// ڂ𗼃t@C폜܂BɂȂ ItemGroup 菜܂B
+    /// </summary>
+    bool RemoveItem(const std::string& include) noexcept;
+
+    const bool Contains(const std::string& include) const noexcept;
+
+    inline const auto IsInTransaction() const noexcept { return m_depth > Def::UIntZero; }
+    inline const auto GetItemCount() const noexcept { return m_vcxproj.items.size(); }
+
+private:
+
+    struct Document
+    {
+        std::filesystem::path                  path;
+        std::unique_ptr<tinyxml2::XMLDocument> upDoc;
+        std::filesystem::file_time_type        writeTime{};
+        uintmax_t                              size = Def::ULongLongZero;
+        bool                                   isDirty = false;
+
+        // K Include  vfi Include ̎ނɂ邱Ƃj
+        std::unordered_map<std::string, std::vector<tinyxml2::XMLElement*>> items;
+        //   ŏɂ̎ނ܂ ItemGroup
+        std::unordered_map<std::string, tinyxml2::XMLElement*> itemGroups;
+        // tB^`i.filters ̂݁j
+        std::unordered_map<std::string, tinyxml2::XMLElement*> filters;
+        tinyxml2::XMLElement* pFilterGroup = nullptr;
+    };
+
+    bool Load(Document& document) noexcept;
+
+    /// <summary>
+    /// fBXN̍XVETCYǂݍݎƈႦ true
+    /// </summary>
+    const bool IsChangedOnDisk(const Document& document) const noexcept;
+
+    void BuildIndex(Document& document) noexcept;
+
+    bool AddElement(Document& document, const std::string& include, const std::string& itemType, const std::string& filterPath) noexcept;
+    bool RemoveElements(Document& document, const std::string& include) noexcept;
+
+    void EnsureFilterPathExists(Document& document, const std::string& filterPath) noexcept;
+
+    tinyxml2::XMLElement* FindOrCreateItemGroup(Document& document, const std::string& itemType) noexcept;
+
+    /// <summary>
+    /// ꎞt@C֏o܂Biu͑SďĂj
+    /// </summary>
+    bool WriteTemporary(const Document& document, const std::filesystem::path& tempPath) noexcept;
+
+    // ؂ '\' ɁApɂrpL[
+    static std::string ToKey(std::string path);
+
+    Document m_vcxproj;
+    Document m_filters;
+    uint32_t m_depth = Def::UIntZero;
+};
@@ -21,12 +21,16 @@
 #include <unordered_set>
 #include <string>
 #include <array>
+#include <span>
+#include <optional>
 #include <vector>
 #include <stack>
 #include <list>
 #include <iterator>
 #include <queue>
+#include <deque>
 #include <algorithm>
+#include <numeric>
 #include <memory>
 #include <random>
 #include <fstream>
@@ -36,15 +40,18 @@
 #include <thread>
 #include <atomic>
 #include <mutex>
+#include <shared_mutex>
 #include <condition_variable>
 #include <future>
 #include <fileSystem>
 #include <stdexcept>
 #include <chrono>
 #include <format>
+#include <charconv>
 #include <type_traits>
 #include <set>
 #include <numbers>
+#include <bit>
 #include <cstdint>
 #include <omp.h>
 
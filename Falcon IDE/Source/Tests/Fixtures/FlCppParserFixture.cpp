@@ -0,0 +1,53 @@
+#include "x.h" // struct Fake {
+#define MACRO(x) \
+    struct NotReal { int y; };
+/* class Commented { }; */
+namespace game::core {
+const char* s = "struct InString { }";
+auto raw = R"xx(
+struct InRaw { void f() { } };
+)xx";
+template<class T, typename U = std::vector<int>>
+struct PlayerComponent final : public Base<T>, private Other
+{
+public:
+    int hp = 100, mp{ 5 };
+    std::array<int, 3> slots;
+    std::function<void(int)> callback = [](int v) { if (v) { } };
+    unsigned flags : 3;
+    char c = '{';
+    PlayerComponent() : hp{ 1 }, mp(2) { }
+    ~PlayerComponent() = default;
+    bool operator==(const PlayerComponent&) const noexcept;
+    void operator()(int) { }
+    enum class State : uint8_t { Idle, Run = 1'000, Jump };
+private:
+    struct Inner { int z; } inner;
+};
+void Start(void* component) noexcept
+{
+    auto p{ static_cast<PlayerComponent<int>*>(component) };
+    if (p) { p->hp = 1; } // }
+}
+void Guarded(int v) try
+{
+    Start(nullptr);
+}
+catch (const std::exception& e)
+{
+    (void)e;
+}
+catch (...)
+{
+}
+struct Holder
+{
+    Holder() try : m_value{ 1 } { } catch (...) { }
+    int m_value;
+};
+int Local() { try { return 1; } catch (...) { return 0; } }
+}
+static int Foo::Bar<int>::Update(float dt) { return 0; }
+extern "C" {
+void CFunc();
+}
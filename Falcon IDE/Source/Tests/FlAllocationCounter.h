@@ -0,0 +1,50 @@
+#pragma once
+// <Allocation Counter for Tests>
+// O[o operator new uāAĂяoXbh̃q[vmۂ̉񐔂𐔂܂B
+// u͎st@C1ûŁAeXg .cpp 1xCN[hĂB
+#include <new>
+#include <cstdlib>
+
+namespace FlAllocationCounter
+{
+	inline thread_local uint64_t t_count = 0U;
+
+	// Ԃ̊ԂɌĂяoXbhŋNmۂ̉
+	class Scope
+	{
+	public:
+
+		Scope() noexcept : m_begin{ t_count } {}
+
+		uint64_t GetCount() const noexcept { return t_count - m_begin; }
+
+	private:
+
+		uint64_t m_begin;
+	};
+
+	inline void* Allocate(const std::size_t size, const std::size_t alignment)
+	{
+		++t_count;
+		const auto bytes{ size ? size : std::size_t{ 1U } };
+		auto p{ alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__
+			? std::aligned_alloc(alignment, (bytes + alignment - 1U) & ~(alignment - 1U))
+			: std::malloc(bytes) };
+		if (!p) throw std::bad_alloc{};
+		return p;
+	}
+}
+
+void* operator new(std::size_t size) { return FlAllocationCounter::Allocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new[](std::size_t size) { return FlAllocationCounter::Allocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new(std::size_t size, std::align_val_t alignment) { return FlAllocationCounter::Allocate(size, static_cast<std::size_t>(alignment)); }
+void* operator new[](std::size_t size, std::align_val_t alignment) { return FlAllocationCounter::Allocate(size, static_cast<std::size_t>(alignment)); }
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
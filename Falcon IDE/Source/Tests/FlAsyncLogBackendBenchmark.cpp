@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+
+#include "Framework/System/Debugger/Logger/FlAsyncLogBackend.h"
+
+namespace
+{
+	struct Result
+	{
+		double linesPerSecond = 0.0;
+		double p99Nanoseconds = 0.0;
+	};
+
+	// producerCount {̃Xbh perProducer sBwrite 1snŁA̎ԂsƂɑ
+	// ݑx finishifBXN֏I܂Łj܂߂Ԃŏo
+	template<class Write, class Finish>
+	Result Run(const uint32_t producerCount, const uint32_t perProducer, Write&& write, Finish&& finish)
+	{
+		auto latencies{ std::vector<std::vector<uint32_t>>(producerCount) };
+		for (auto& perThread : latencies) perThread.reserve(perProducer);
+
+		const auto start{ std::chrono::steady_clock::now() };
+		auto producers{ std::vector<std::thread>{} };
+		for (auto p{ 0U }; p < producerCount; ++p)
+		{
+			producers.emplace_back([&, p] {
+				for (auto i{ 0U }; i < perProducer; ++i)
+				{
+					auto line{ "[12:00:00] thread " + std::to_string(p) + " frame " + std::to_string(i) + " value updated\n" };
+
+					const auto begin{ std::chrono::steady_clock::now() };
+					write(std::move(line));
+					latencies[p].push_back(static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count()));
+				}
+			});
+		}
+		for (auto& producer : producers) producer.join();
+		finish();
+		const auto seconds{ std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() };
+
+		auto all{ std::vector<uint32_t>{} };
+		for (const auto& perThread : latencies) all.insert(all.end(), perThread.begin(), perThread.end());
+		const auto p99{ all.begin() + static_cast<std::ptrdiff_t>(all.size() * 99U / 100U) };
+		std::nth_element(all.begin(), p99, all.end());
+
+		return { static_cast<double>(all.size()) / seconds, static_cast<double>(*p99) };
+	}
+
+	size_t CountLines(const std::filesystem::path& path)
+	{
+		auto stream{ std::ifstream{ path } };
+		auto line  { std::string{} };
+		auto count { size_t{} };
+		while (std::getline(stream, line)) ++count;
+		return count;
+	}
+
+	// ݃XbhƂɁA񓯊obNGhƈȑO̓݁ibN1s std::endljׂ
+	void Compare(const uint32_t producerCount, const uint32_t perProducer)
+	{
+		const auto dir{ std::filesystem::temp_directory_path() / "FlAsyncLogBackendBenchmark" };
+		std::filesystem::remove_all(dir);
+		std::filesystem::create_directories(dir);
+		const auto total{ static_cast<size_t>(producerCount) * perProducer };
+
+		// s𐔂̂Ń[e[VȂ
+		auto& backend{ FlAsyncLogBackend::Instance() };
+		backend.SetRotation(std::numeric_limits<size_t>::max(), 3U);
+
+		const auto asyncPath{ dir / "async.log" };
+		const auto id{ backend.Open(asyncPath.string()) };
+		ASSERT_NE(id, FlAsyncLogBackend::InvalidFile);
+
+		const auto async{ Run(producerCount, perProducer,
+			[&](std::string&& line) { backend.Write(id, std::move(line)); },
+			[&] { EXPECT_TRUE(backend.Close(id)); }) };
+
+		const auto syncPath{ dir / "sync.log" };
+		auto mutex { std::mutex{} };
+		auto stream{ std::ofstream{ syncPath, std::ios::app } };
+		const auto sync{ Run(producerCount, perProducer,
+			[&](std::string&& line) {
+				auto lock{ std::lock_guard{ mutex } };
+				line.pop_back();
+				stream << line << std::endl;
+			},
+			[&] { stream.close(); }) };
+
+		std::printf("[ BENCH ] FlAsyncLogBackend %u producers x %u lines: async %.2f M lines/s (p99 %.0f ns), sync %.2f M lines/s (p99 %.0f ns)\n",
+			producerCount, perProducer, async.linesPerSecond * 1e-6, async.p99Nanoseconds, sync.linesPerSecond * 1e-6, sync.p99Nanoseconds);
+		::testing::Test::RecordProperty("async_lines_per_s", std::to_string(async.linesPerSecond));
+		::testing::Test::RecordProperty("async_p99_ns", std::to_string(async.p99Nanoseconds));
+		::testing::Test::RecordProperty("sync_lines_per_s", std::to_string(sync.linesPerSecond));
+		::testing::Test::RecordProperty("sync_p99_ns", std::to_string(sync.p99Nanoseconds));
+
+		EXPECT_EQ(CountLines(asyncPath), total);
+		EXPECT_EQ(CountLines(syncPath), total);
+
+		backend.SetRotation(8U * 1024U * 1024U, 3U);
+
+		std::filesystem::remove_all(dir);
+	}
+}
+
+TEST(FlAsyncLogBackendBenchmark, OneProducer)
+{
+	Compare(1U, 200000U);
+}
+
+TEST(FlAsyncLogBackendBenchmark, FourProducers)
+{
+	Compare(4U, 100000U);
+}
+
+TEST(FlAsyncLogBackendBenchmark, EightProducers)
+{
+	Compare(8U, 50000U);
+}
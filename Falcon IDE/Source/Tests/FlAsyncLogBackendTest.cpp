@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+
+#include "Framework/System/Debugger/Logger/FlAsyncLogBackend.h"
+
+namespace
+{
+	class FlAsyncLogBackendTest : public ::testing::Test
+	{
+	protected:
+
+		void SetUp() override
+		{
+			m_dir = std::filesystem::temp_directory_path() / "FlAsyncLogBackendTest";
+			std::filesystem::remove_all(m_dir);
+			std::filesystem::create_directories(m_dir);
+		}
+
+		void TearDown() override
+		{
+			FlAsyncLogBackend::Instance().SetRotation(8U * 1024U * 1024U, 3U);
+			std::filesystem::remove_all(m_dir);
+		}
+
+		std::string PathOf(const std::string_view& name) const { return (m_dir / name).string(); }
+
+		static size_t CountLines(const std::filesystem::path& path)
+		{
+			auto stream{ std::ifstream{ path } };
+			auto line  { std::string{} };
+			auto count { size_t{} };
+			while (std::getline(stream, line)) ++count;
+			return count;
+		}
+
+		std::filesystem::path m_dir;
+	};
+}
+
+TEST_F(FlAsyncLogBackendTest, CloseWritesEveryLineFromManyThreads)
+{
+	auto& backend{ FlAsyncLogBackend::Instance() };
+	const auto id{ backend.Open(PathOf("threads.log")) };
+	ASSERT_NE(id, FlAsyncLogBackend::InvalidFile);
+
+	constexpr auto threadCount{ 8 };
+	constexpr auto lineCount  { 20000 };
+
+	auto threads{ std::vector<std::thread>{} };
+	for (auto t{ 0 }; t < threadCount; ++t)
+	{
+		threads.emplace_back([&backend, id, t] {
+			for (auto i{ 0 }; i < lineCount; ++i)
+				backend.Write(id, "thread " + std::to_string(t) + " line " + std::to_string(i) + "\n");
+		});
+	}
+	for (auto& thread : threads) thread.join();
+
+	EXPECT_TRUE(backend.Close(id));
+	EXPECT_EQ(CountLines(PathOf("threads.log")), static_cast<size_t>(threadCount * lineCount));
+}
+
+TEST_F(FlAsyncLogBackendTest, CloseReleasesThePathAndDropsLaterWrites)
+{
+	auto& backend{ FlAsyncLogBackend::Instance() };
+	const auto path{ PathOf("export.log") };
+
+	const auto first{ backend.Open(path) };
+	ASSERT_NE(first, FlAsyncLogBackend::InvalidFile);
+	EXPECT_EQ(backend.Open(path), first);
+
+	backend.Write(first, "before close\n");
+	EXPECT_TRUE(backend.Close(first));
+	EXPECT_FALSE(backend.Close(first));
+
+	// ݂͎̏̂ĂApX͐VIDŊJ
+	backend.Write(first, "after close\n");
+	backend.Flush();
+	EXPECT_EQ(CountLines(path), 1U);
+
+	const auto second{ backend.Open(path) };
+	ASSERT_NE(second, FlAsyncLogBackend::InvalidFile);
+	EXPECT_NE(second, first);
+	backend.Write(second, "reopened\n");
+	EXPECT_TRUE(backend.Close(second));
+	EXPECT_EQ(CountLines(path), 2U);
+}
+
+TEST_F(FlAsyncLogBackendTest, CloseReportsWriteFailure)
+{
+	// ݂K ENOSPC ŎsfoCX
+	if (!std::filesystem::exists("/dev/full")) GTEST_SKIP() << "/dev/full is not available";
+
+	auto& backend{ FlAsyncLogBackend::Instance() };
+	const auto id{ backend.Open("/dev/full") };
+	ASSERT_NE(id, FlAsyncLogBackend::InvalidFile);
+
+	backend.Write(id, "lost\n");
+	EXPECT_FALSE(backend.Close(id));
+}
+
+TEST_F(FlAsyncLogBackendTest, RotationKeepsAtMostMaxFiles)
+{
+	auto& backend{ FlAsyncLogBackend::Instance() };
+	backend.SetRotation(1024U, 2U);
+
+	const auto path{ PathOf("rotate.log") };
+	const auto id  { backend.Open(path) };
+	ASSERT_NE(id, FlAsyncLogBackend::InvalidFile);
+
+	// 1 s 100 oCg Flush ɏă[e[VxN
+	const auto line{ std::string(99U, 'x') + "\n" };
+	for (auto batch{ 0 }; batch < 40; ++batch)
+	{
+		for (auto i{ 0 }; i < 4; ++i) backend.Write(id, std::string{ line });
+		backend.Flush();
+	}
+	EXPECT_TRUE(backend.Close(id));
+
+	EXPECT_TRUE(std::filesystem::exists(path));
+	EXPECT_TRUE(std::filesystem::exists(path + ".1"));
+	EXPECT_TRUE(std::filesystem::exists(path + ".2"));
+	EXPECT_FALSE(std::filesystem::exists(path + ".3"));
+	EXPECT_LT(std::filesystem::file_size(path), 1024U + 4U * line.size());
+}
@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+
+#include "Core/FlEntityComponentSystemKernel.h"
+#include "Framework/Module/RuntimeModule/ResistCamera.h"
+#include "Framework/Module/RuntimeModule/ResistModelRender.h"
+#include "Framework/Module/RuntimeModule/ResistCollision.h"
+#include "Framework/Module/RuntimeModule/Transform.h"
+
+// `E蔻̃R|[lg DirectX Ɉˑ̂ŃeXgł͓o^Ȃ
+ResistCamera::ResistCamera() {}
+ResistModelRender::ResistModelRender() {}
+ResistCollision::ResistCollision() {}
+
+namespace
+{
+	constexpr auto EntityCount{ 100000U };
+	constexpr auto DynamicStep{ 100U };    // 100 1 (1%) t[
+	constexpr auto FrameCount { 20U };
+
+	struct MotionComponent
+	{
+		float x = 0.0f;
+		float y = 0.0f;
+		float z = 0.0f;
+	};
+
+	void RegisterMotion()
+	{
+		auto reflection{ ComponentReflection{} };
+		reflection.Create      = []() -> void* { return new MotionComponent{}; };
+		reflection.Destroy     = [](void* p) { delete static_cast<MotionComponent*>(p); };
+		reflection.Serialize   = [](void* p, nlohmann::json& json) {
+			const auto* pMotion{ static_cast<MotionComponent*>(p) };
+			json["x"] = pMotion->x;
+			json["y"] = pMotion->y;
+			json["z"] = pMotion->z;
+		};
+		reflection.Deserialize = [](void* p, const nlohmann::json& json) {
+			auto* pMotion{ static_cast<MotionComponent*>(p) };
+			json.at("x").get_to(pMotion->x);
+			json.at("y").get_to(pMotion->y);
+			json.at("z").get_to(pMotion->z);
+		};
+		FlEntityComponentSystemKernel::Instance().RegisterModule("Motion", reflection);
+	}
+
+	double ElapsedMs(const std::chrono::steady_clock::time_point start)
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	// GeBeB݂̎QƂœ
+	void MoveDynamic(const std::vector<entityId>& ids)
+	{
+		auto& kernel{ FlEntityComponentSystemKernel::Instance() };
+		for (auto i{ size_t{} }; i < ids.size(); i += DynamicStep)
+			static_cast<MotionComponent*>(kernel.WorkComponent("Motion", ids[i]))->x += 1.0f;
+	}
+}
+
+// 100k GeBeBiTransform + MotionA1% t[j:
+// SEۑƁAύX̔łςEE̕ۑ̔r
+TEST(FlChangeVersionBenchmark, HundredThousandEntitiesOnePercentDynamic)
+{
+	auto& kernel{ FlEntityComponentSystemKernel::Instance() };
+	kernel.initialize();
+	RegisterMotion();
+	kernel.AllDestroyEntities();
+
+	const auto ids{ kernel.CreateEntities(EntityCount) };
+	ASSERT_EQ(ids.size(), EntityCount);
+	for (const auto id : ids)
+	{
+		kernel.AddComponent("Transform", id);
+		kernel.AddComponent("Motion", id);
+	}
+	const auto dynamicCount{ (EntityCount + DynamicStep - 1U) / DynamicStep };
+
+	// t[S
+	auto scanSum{ 0.0f };
+	auto scanMs { 0.0 };
+	for (auto frame{ 0U }; frame < FrameCount; ++frame)
+	{
+		MoveDynamic(ids);
+		const auto start{ std::chrono::steady_clock::now() };
+		for (const auto& [id, pComponent] : kernel.GetComponentsOfType("Motion"))
+			scanSum += static_cast<MotionComponent*>(pComponent)->x;
+		scanMs += ElapsedMs(start);
+	}
+
+	// Õt[̔łɕςE
+	auto deltaSum{ 0.0f };
+	auto deltaMs { 0.0 };
+	auto changed { std::vector<entityId>{} };
+	auto since   { kernel.GetChangeVersion() };
+	for (auto frame{ 0U }; frame < FrameCount; ++frame)
+	{
+		MoveDynamic(ids);
+		const auto start{ std::chrono::steady_clock::now() };
+		changed.clear();
+		EXPECT_TRUE(kernel.CollectChangedEntities("Motion", since, changed));
+		since = kernel.GetChangeVersion();
+		for (const auto id : changed)
+			deltaSum += static_cast<MotionComponent*>(kernel.GetComponent("Motion", id))->x;
+		deltaMs += ElapsedMs(start);
+		EXPECT_EQ(changed.size(), dynamicCount);
+	}
+	EXPECT_GT(scanSum, 0.0f);
+	EXPECT_GT(deltaSum, 0.0f);
+
+	// 1t[̕ύX̌̕ۑ
+	const auto saved{ kernel.GetChangeVersion() };
+	MoveDynamic(ids);
+
+	auto start{ std::chrono::steady_clock::now() };
+	const nlohmann::json full = kernel.SerializeScene();
+	const auto fullText{ full.dump() };
+	const auto fullSaveMs{ ElapsedMs(start) };
+
+	start = std::chrono::steady_clock::now();
+	const nlohmann::json delta = kernel.SerializeSceneChanges(saved);
+	const auto deltaText{ delta.dump() };
+	const auto deltaSaveMs{ ElapsedMs(start) };
+
+	ASSERT_TRUE(delta["Complete"].get<bool>());
+	EXPECT_EQ(delta["Entities"].size(), dynamicCount);
+	EXPECT_EQ(full["Entities"].size(), EntityCount);
+
+	const auto scanFrameMs { scanMs / FrameCount };
+	const auto deltaFrameMs{ deltaMs / FrameCount };
+	std::printf("[ BENCH ] ECS %u entities, %u dynamic: per-frame scan %.3f ms, changed-since %.3f ms (%.0fx); save full %.1f ms / %zu bytes, delta %.2f ms / %zu bytes (%.0fx)\n",
+		EntityCount, dynamicCount, scanFrameMs, deltaFrameMs, scanFrameMs / deltaFrameMs,
+		fullSaveMs, fullText.size(), deltaSaveMs, deltaText.size(), fullSaveMs / deltaSaveMs);
+	::testing::Test::RecordProperty("scan_frame_ms", std::to_string(scanFrameMs));
+	::testing::Test::RecordProperty("changed_frame_ms", std::to_string(deltaFrameMs));
+	::testing::Test::RecordProperty("full_save_ms", std::to_string(fullSaveMs));
+	::testing::Test::RecordProperty("delta_save_ms", std::to_string(deltaSaveMs));
+	::testing::Test::RecordProperty("full_save_bytes", std::to_string(fullText.size()));
+	::testing::Test::RecordProperty("delta_save_bytes", std::to_string(deltaText.size()));
+
+	EXPECT_LT(deltaFrameMs * 5.0, scanFrameMs);
+	EXPECT_LT(deltaSaveMs * 10.0, fullSaveMs);
+	EXPECT_LT(deltaText.size() * 10U, fullText.size());
+
+	kernel.AllDestroyEntities();
+}
@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+#include <iomanip>
+
+#include "Framework/System/Timer/FlChronus.hpp"
+
+namespace
+{
+	using Statistics = FlChronus::FrameStatistics;
+
+	// ̒gבւċ߂ip[Z^C summary Ɠ 0 n܂̏ floor(q * (n - 1))j
+	struct NaiveSummary
+	{
+		double minMs{}, maxMs{}, meanMs{};
+		double p50Ms{}, p95Ms{}, p99Ms{};
+	};
+
+	NaiveSummary Naive(const std::vector<double>& trace, const size_t window)
+	{
+		const auto begin{ trace.size() > window ? trace.size() - window : size_t{} };
+		auto sorted{ std::vector<double>(trace.begin() + static_cast<ptrdiff_t>(begin), trace.end()) };
+		std::sort(sorted.begin(), sorted.end());
+
+		const auto n{ static_cast<double>(sorted.size()) };
+		const auto rank{ [&](const double q) { return sorted[static_cast<size_t>(q * (n - 1))]; } };
+
+		auto s{ NaiveSummary{} };
+		s.minMs  = sorted.front();
+		s.maxMs  = sorted.back();
+		s.meanMs = std::accumulate(sorted.begin(), sorted.end(), 0.0) / n;
+		s.p50Ms  = rank(0.50);
+		s.p95Ms  = rank(0.95);
+		s.p99Ms  = rank(0.99);
+		return s;
+	}
+
+	Statistics::Summary Feed(Statistics& statistics, const std::vector<double>& trace)
+	{
+		for (const auto ms : trace) statistics.add(ms);
+		return statistics.summary();
+	}
+
+	std::vector<double> Ramp(const double first, const double step, const size_t count)
+	{
+		auto trace{ std::vector<double>(count) };
+		for (auto i{ size_t{} }; i < count; ++i) trace[i] = first + step * static_cast<double>(i);
+		return trace;
+	}
+
+	// ΐqXgȎ\l͑Ό덷 1% ȓ
+	constexpr auto PercentileTolerance{ 0.0101 };
+}
+
+TEST(FlChronusFrameStatistics, WindowOfThreeDropsTheOldestMinimum)
+{
+	auto statistics{ Statistics{ 3U } };
+	const auto s{ Feed(statistics, { 1.0, 2.0, 3.0, 4.0 }) };
+
+	EXPECT_EQ(s.count, 3U);
+	EXPECT_DOUBLE_EQ(s.minMs, 2.0);
+	EXPECT_DOUBLE_EQ(s.maxMs, 4.0);
+	EXPECT_DOUBLE_EQ(s.meanMs, 3.0);
+}
+
+TEST(FlChronusFrameStatistics, IncreasingRampKeepsTheOldestFrameInTheWindowAsMinimum)
+{
+	//  600 ɑ΂ 1300 t[iɎĉ 700 Ԉȍ~j
+	auto statistics{ Statistics{ 600U } };
+	const auto s{ Feed(statistics, Ramp(16.0, 0.002, 1300U)) };
+
+	EXPECT_EQ(s.count, 600U);
+	EXPECT_NEAR(s.minMs, 17.4, 1e-9);
+	EXPECT_NEAR(s.maxMs, 18.598, 1e-9);
+}
+
+TEST(FlChronusFrameStatistics, DecreasingRampKeepsTheOldestFrameInTheWindowAsMaximum)
+{
+	auto statistics{ Statistics{ 600U } };
+	const auto s{ Feed(statistics, Ramp(30.0, -0.002, 1300U)) };
+
+	EXPECT_EQ(s.count, 600U);
+	EXPECT_NEAR(s.maxMs, 28.6, 1e-9);
+	EXPECT_NEAR(s.minMs, 27.402, 1e-9);
+}
+
+TEST(FlChronusFrameStatistics, SlidingWindowMatchesNaiveSortOnSyntheticTraces)
+{
+	auto rng{ std::mt19937{ 39U } };
+	auto base  { std::normal_distribution<double>{ 16.6, 1.5 } };
+	auto spike { std::uniform_real_distribution<double>{ 30.0, 90.0 } };
+	auto chance{ std::uniform_int_distribution<int>{ 0, 99 } };
+
+	for (const auto window : { size_t{ 1U }, size_t{ 2U }, size_t{ 7U }, size_t{ 120U }, size_t{ 600U } })
+	{
+		auto statistics{ Statistics{ window } };
+		auto trace{ std::vector<double>{} };
+		for (auto frame{ 0 }; frame < 2500; ++frame)
+		{
+			// i 60fps t߁A܂Ƀqb`
+			trace.push_back(chance(rng) < 3 ? spike(rng) : std::max(base(rng), 0.5));
+			statistics.add(trace.back());
+			if (frame % 97 != 0 && frame != 2499) continue;
+
+			const auto s{ statistics.summary() };
+			const auto expected{ Naive(trace, window) };
+			ASSERT_EQ(s.count, std::min(trace.size(), window)) << window << " " << frame;
+			ASSERT_DOUBLE_EQ(s.minMs, expected.minMs) << window << " " << frame;
+			ASSERT_DOUBLE_EQ(s.maxMs, expected.maxMs) << window << " " << frame;
+			ASSERT_NEAR(s.meanMs, expected.meanMs, 1e-9) << window << " " << frame;
+			ASSERT_NEAR(s.p50Ms, expected.p50Ms, expected.p50Ms * PercentileTolerance) << window << " " << frame;
+			ASSERT_NEAR(s.p95Ms, expected.p95Ms, expected.p95Ms * PercentileTolerance) << window << " " << frame;
+			ASSERT_NEAR(s.p99Ms, expected.p99Ms, expected.p99Ms * PercentileTolerance) << window << " " << frame;
+		}
+	}
+}
+
+TEST(FlChronusFrameStatistics, PercentilesOfAShuffledUniformTrace)
+{
+	auto trace{ Ramp(1.0, 1.0, 1000U) };
+	std::shuffle(trace.begin(), trace.end(), std::mt19937{ 7U });
+
+	auto statistics{ Statistics{ 1000U } };
+	const auto s{ Feed(statistics, trace) };
+
+	EXPECT_DOUBLE_EQ(s.minMs, 1.0);
+	EXPECT_DOUBLE_EQ(s.maxMs, 1000.0);
+	EXPECT_NEAR(s.meanMs, 500.5, 1e-9);
+	EXPECT_NEAR(s.p50Ms, 500.0, 500.0 * PercentileTolerance);
+	EXPECT_NEAR(s.p95Ms, 950.0, 950.0 * PercentileTolerance);
+	EXPECT_NEAR(s.p99Ms, 990.0, 990.0 * PercentileTolerance);
+	EXPECT_NEAR(s.fps(), 1000.0 / 500.5, 1e-9);
+}
+
+TEST(FlChronusFrameStatistics, ResetStartsAnEmptyWindow)
+{
+	auto statistics{ Statistics{ 4U } };
+	Feed(statistics, { 5.0, 1.0, 9.0, 3.0, 7.0 });
+	statistics.reset();
+	EXPECT_EQ(statistics.summary().count, 0U);
+
+	const auto s{ Feed(statistics, { 8.0, 6.0 }) };
+	EXPECT_EQ(s.count, 2U);
+	EXPECT_DOUBLE_EQ(s.minMs, 6.0);
+	EXPECT_DOUBLE_EQ(s.maxMs, 8.0);
+	EXPECT_DOUBLE_EQ(s.meanMs, 7.0);
+}
@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+
+#include "Framework/System/VisualStudioManager/FlCodeTemplate.h"
+
+namespace
+{
+	using namespace FlCodeTemplateTest;
+
+	template<class Function>
+	double MeasureUs(const int iterations, Function&& function)
+	{
+		const auto start{ std::chrono::steady_clock::now() };
+		for (auto i{ 0 }; i < iterations; ++i) function();
+		return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / iterations;
+	}
+}
+
+// ͍ς݃ev[g 1 pXWJƁAݖƂɑSu鋌̔r
+TEST(FlCodeTemplateBenchmark, RenderAgainstChainedReplacement)
+{
+	constexpr auto iterations{ 2000 };
+
+	for (const auto* name : { "Template.c++.flsample", "Template.vcxproj.flsample", "Template.vcxproj.filters.flsample" })
+	{
+		const auto source{ LoadSample(name) };
+		ASSERT_FALSE(source.empty()) << name;
+
+		auto guids{ 0U };
+		auto args { FlCodeTemplate::Arguments{} };
+		args.Set("ProjectName", "BenchmarkProject");
+		args.SetGenerator("GUID", MakeSequentialGuid(guids));
+		for (const auto* slot : { "ImpStart", "ImpUpdate", "ImpOnDestroy", "ImpSerialize", "ImpDeserialize", "ImpRenderEditor" })
+			args.Set(slot, "                     DoSomething();");
+
+		auto sink{ size_t{} };
+		const auto parseUs{ MeasureUs(iterations, [&] { sink += FlCodeTemplate::Parse(source)->GetSource().size(); }) };
+
+		const auto spTemplate{ FlCodeTemplate::Parse(source) };
+		const auto renderUs{ MeasureUs(iterations, [&] { sink += spTemplate->Render(args).size(); }) };
+
+		const auto chainedUs{ MeasureUs(iterations, [&] {
+			auto text{ ReplaceAll(source, "#ProjectName#", [] { return std::string{ "BenchmarkProject" }; }) };
+			for (const auto* slot : { "ImpStart", "ImpUpdate", "ImpOnDestroy", "ImpSerialize", "ImpDeserialize", "ImpRenderEditor" })
+				text = ReplaceAll(std::move(text), std::string{ "#" } + slot + "#", [] { return std::string{ "                     DoSomething();" }; });
+			text = ReplaceAll(std::move(text), "#GUID#", MakeSequentialGuid(guids));
+			sink += text.size();
+		}) };
+
+		EXPECT_GT(sink, 0U);
+		std::printf("[ BENCH ] FlCodeTemplate %s (%zu bytes): parse %.2f us, render %.2f us, chained replace %.2f us\n",
+			name, source.size(), parseUs, renderUs, chainedUs);
+		::testing::Test::RecordProperty(std::string{ name } + "_render_us", std::to_string(renderUs));
+		::testing::Test::RecordProperty(std::string{ name } + "_chained_us", std::to_string(chainedUs));
+	}
+}
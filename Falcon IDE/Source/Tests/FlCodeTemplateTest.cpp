@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+
+#include "Framework/System/VisualStudioManager/FlCodeTemplate.h"
+
+namespace
+{
+	using namespace FlCodeTemplateTest;
+
+	const std::vector<std::pair<std::string, std::string>> ModuleBodies{
+		{ "ImpStart",        "                     auto p{ static_cast<PlayerComponent*>(component) };\n                     p->hp = 100;" },
+		{ "ImpUpdate",       "                     // #include <cmath> ܂ރRg\n                     p->x += dt;" },
+		{ "ImpOnDestroy",    "" },
+		{ "ImpSerialize",    "                     j[\"hp\"] = p->hp;" },
+		{ "ImpDeserialize",  "                     p->hp = j.value(\"hp\", 0);" },
+		{ "ImpRenderEditor", "                     ImGui::DragInt(\"HP\", &p->hp);" },
+	};
+}
+
+TEST(FlCodeTemplate, ModuleSampleMatchesChainedReplacementByteForByte)
+{
+	const auto source{ LoadSample("Template.c++.flsample") };
+	ASSERT_FALSE(source.empty());
+
+	const auto spTemplate{ FlCodeTemplate::Parse(source) };
+	ASSERT_NE(spTemplate, nullptr);
+	EXPECT_TRUE(spTemplate->GetDiagnostics().empty());
+
+	auto args    { FlCodeTemplate::Arguments{} };
+	auto expected{ source };
+	for (const auto& [slot, body] : ModuleBodies)
+	{
+		args.Set(slot, body);
+		expected = ReplaceAll(expected, "#" + slot + "#", [&body] { return body; });
+	}
+	args.Set("ProjectName", "Player");
+	expected = ReplaceAll(expected, "#ProjectName#", [] { return std::string{ "Player" }; });
+
+	EXPECT_EQ(spTemplate->Render(args), expected);
+}
+
+TEST(FlCodeTemplate, ProjectSamplesMatchChainedReplacementByteForByte)
+{
+	for (const auto* name : { "Template.cxx.flsample", "Template.vcxproj.flsample", "Template.vcxproj.filters.flsample" })
+	{
+		const auto source{ LoadSample(name) };
+		ASSERT_FALSE(source.empty()) << name;
+
+		const auto spTemplate{ FlCodeTemplate::Parse(source) };
+		ASSERT_NE(spTemplate, nullptr) << name;
+		EXPECT_TRUE(spTemplate->GetDiagnostics().empty()) << name;
+
+		//  #ProjectName#  #GUID# ̏ɒuAGUID ͏oɐĂ
+		auto renderedGuids{ 0U };
+		auto args{ FlCodeTemplate::Arguments{} };
+		args.Set("ProjectName", "My Game");
+		args.SetGenerator("GUID", MakeSequentialGuid(renderedGuids));
+
+		auto chainedGuids{ 0U };
+		auto expected{ ReplaceAll(source, "#ProjectName#", [] { return std::string{ "My Game" }; }) };
+		expected = ReplaceAll(expected, "#GUID#", MakeSequentialGuid(chainedGuids));
+
+		EXPECT_EQ(spTemplate->Render(args), expected) << name;
+		EXPECT_EQ(renderedGuids, chainedGuids) << name;
+
+		// t@Cւ̏oe
+		const auto path{ std::filesystem::temp_directory_path() / "FlCodeTemplateTest.out" };
+		renderedGuids = 0U;
+		ASSERT_TRUE(spTemplate->RenderToFile(path, args));
+		EXPECT_EQ(LoadText(path), expected) << name;
+		std::filesystem::remove(path);
+	}
+}
+
+TEST(FlCodeTemplate, SectionsLoopsAndUnboundSlots)
+{
+	const auto spTemplate{ FlCodeTemplate::Parse("#include <a>\n#?Debug#D:#Level#;#/Debug##*Item#[#Name#/#Kind#]#/Item# #Missing# #x") };
+	ASSERT_NE(spTemplate, nullptr);
+	EXPECT_TRUE(spTemplate->GetDiagnostics().empty());
+
+	auto args{ FlCodeTemplate::Arguments{} };
+	args.Set("Kind", "k");
+	args.AddItem("Item").Set("Name", "a");
+	args.AddItem("Item").Set("Name", "b").Set("Kind", "own");
+	EXPECT_EQ(spTemplate->Render(args), "#include <a>\n[a/k][b/own] #Missing# #x");
+
+	args.Set("Debug", "1").Set("Level", "#Kind#");
+	EXPECT_EQ(spTemplate->Render(args), "#include <a>\nD:#Kind#;[a/k][b/own] #Missing# #x");
+}
+
+TEST(FlCodeTemplate, StrayCloseIsKeptAsTextWithDiagnostic)
+{
+	const auto spTemplate{ FlCodeTemplate::Parse("a\n  b #/Name#Value# #Value#") };
+	ASSERT_NE(spTemplate, nullptr);
+
+	ASSERT_EQ(spTemplate->GetDiagnostics().size(), 1U);
+	const auto& diagnostic{ spTemplate->GetDiagnostics().front() };
+	EXPECT_EQ(diagnostic.line, 2U);
+	EXPECT_EQ(diagnostic.column, 5U);
+	EXPECT_NE(diagnostic.message.find("#/Name#"), std::string::npos);
+
+	// I[ '#' V݂n߂Ȃ
+	EXPECT_EQ(spTemplate->Render(FlCodeTemplate::Arguments{}.Set("Value", "v")), "a\n  b #/Name#Value# v");
+}
+
+TEST(FlCodeTemplate, MismatchedAndUnclosedSectionsAreClosedAtTheEnd)
+{
+	const auto spTemplate{ FlCodeTemplate::Parse("x#?A#a#?B#b#/A#\ny") };
+	ASSERT_NE(spTemplate, nullptr);
+
+	const auto& diagnostics{ spTemplate->GetDiagnostics() };
+	ASSERT_EQ(diagnostics.size(), 3U);
+	EXPECT_NE(diagnostics[0].message.find("#/A#"), std::string::npos);
+	EXPECT_EQ(diagnostics[0].column, 12U);
+	EXPECT_NE(diagnostics[1].message.find("#?B#"), std::string::npos);
+	EXPECT_NE(diagnostics[2].message.find("#?A#"), std::string::npos);
+	EXPECT_EQ(diagnostics[2].column, 2U);
+
+	EXPECT_EQ(spTemplate->Render(FlCodeTemplate::Arguments{}), "x");
+	EXPECT_EQ(spTemplate->Render(FlCodeTemplate::Arguments{}.Set("A", "1")), "xa");
+	EXPECT_EQ(spTemplate->Render(FlCodeTemplate::Arguments{}.Set("A", "1").Set("B", "1")), "xab#/A#\ny");
+}
+
+TEST(FlCodeTemplate, CacheReportsDiagnosticsAsWarnings)
+{
+	const auto path{ std::filesystem::temp_directory_path() / "FlCodeTemplateCache.flsample" };
+	std::ofstream{ path } << "#Name# #/Name#";
+
+	auto& logger{ *FlEditorAdministrator::Instance().GetLogger() };
+	logger.Clear();
+
+	auto cache{ FlCodeTemplateCache{} };
+	const auto spTemplate{ cache.Acquire(path) };
+	ASSERT_NE(spTemplate, nullptr);
+	EXPECT_EQ(cache.Acquire(path), spTemplate);
+	EXPECT_EQ(logger.Count(FlTestLogger::Severity::Warning), 1U);
+	EXPECT_EQ(logger.Count(FlTestLogger::Severity::Error), 0U);
+	EXPECT_EQ(spTemplate->Render(FlCodeTemplate::Arguments{}.Set("Name", "n")), "n #/Name#");
+
+	std::filesystem::remove(path);
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+namespace FlCodeTemplateTest
+{
+	/// <summary>
+	/// uO FlVisualStudioProjectManager ƓAݖƂɑSuĂQƎ
+	/// </summary>
+	inline std::string ReplaceAll(std::string text, const std::string& from, const std::function<std::string()>& makeTo)
+	{
+		auto pos{ size_t{} };
+		while ((pos = text.find(from, pos)) != std::string::npos)
+		{
+			const auto to{ makeTo() };
+			text.replace(pos, from.size(), to);
+			pos += to.size();
+		}
+		return text;
+	}
+
+	// ev[gƓeLXg[hœǂ
+	inline std::string LoadText(const std::filesystem::path& path)
+	{
+		auto ifs{ std::ifstream{ path } };
+		auto ss { std::stringstream{} };
+		ss << ifs.rdbuf();
+		return ss.str();
+	}
+
+	inline std::string LoadSample(const std::string& name)
+	{
+		return LoadText(std::filesystem::path{ FL_TEST_SAMPLE_DIR } / name);
+	}
+
+	/// <summary>
+	/// Ă΂ꂽɘAԂԂ GUID ̑
+	/// </summary>
+	inline std::function<std::string()> MakeSequentialGuid(uint32_t& counter)
+	{
+		return [&counter] {
+			auto text{ std::array<char, 40U>{} };
+			std::snprintf(text.data(), text.size(), "{00000000-0000-0000-0000-%012u}", ++counter);
+			return std::string{ text.data() };
+		};
+	}
+}
@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+
+#include "Framework/System/CppParser/FlCppParser.h"
+
+namespace
+{
+	// XNvgW[̃wb_Ɏ1t@CiOԁER|[lg\́Eo֐ERgEj
+	std::string MakeHeader(const uint32_t file, const uint32_t structCount)
+	{
+		auto source{ std::string{ "#pragma once\n#include <vector>\n#include <string>\n\n" } };
+		source += "namespace game::module" + std::to_string(file) + "\n{\n";
+		for (auto s{ 0U }; s < structCount; ++s)
+		{
+			const auto name{ "Component" + std::to_string(s) };
+			source += "\t// " + name + " ̏ { } ;\n";
+			source += "\tstruct " + name + "\n\t{\n";
+			source += "\t\tfloat speed = 1.0f;\n\t\tint hp{ 100 };\n\t\tstd::vector<int> slots;\n";
+			source += "\t\tstd::string label = \"struct Fake { };\";\n";
+			source += "\t\tenum class State { Idle, Run, Jump } state = State::Idle;\n\n";
+			source += "\t\tvoid Update(float dt)\n\t\t{\n\t\t\tif (hp > 0) { speed += dt; }\n\t\t\t/* { */ slots.push_back(hp);\n\t\t}\n\n";
+			source += "\t\ttemplate<class T> T Get() const { return static_cast<T>(speed); }\n";
+			source += "\t};\n\n";
+			source += "\tinline void Reset" + name + "(" + name + "& c) { c = " + name + "{}; }\n\n";
+		}
+		source += "}\n";
+		return source;
+	}
+
+	template<class Fn>
+	double BestMs(Fn&& fn)
+	{
+		auto best{ std::numeric_limits<double>::max() };
+		for (auto round{ 0 }; round < 3; ++round)
+		{
+			const auto start{ std::chrono::steady_clock::now() };
+			fn();
+			best = std::min(best, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+		}
+		return best;
+	}
+}
+
+//  500 wb_ie 20 \́jAiǂݍ + ́jƃLbVꍇŔׂ
+TEST(FlCppParserBenchmark, GeneratedHeaderCorpusColdAndCached)
+{
+	constexpr auto fileCount  { 500U };
+	constexpr auto structCount{ 20U };
+
+	const auto dir{ std::filesystem::temp_directory_path() / "FlCppParserBenchmark" };
+	std::filesystem::remove_all(dir);
+	std::filesystem::create_directories(dir);
+
+	auto paths{ std::vector<std::filesystem::path>{} };
+	auto bytes{ size_t{} };
+	for (auto f{ 0U }; f < fileCount; ++f)
+	{
+		const auto source{ MakeHeader(f, structCount) };
+		paths.push_back(dir / ("Module" + std::to_string(f) + ".h"));
+		std::ofstream{ paths.back(), std::ios::binary } << source;
+		bytes += source.size();
+	}
+
+	auto declarations{ size_t{} };
+	auto indexAll{ [&](FlCppDeclarationIndexer& indexer) {
+		declarations = 0U;
+		for (const auto& path : paths)
+		{
+			const auto spIndex{ indexer.IndexFile(path) };
+			ASSERT_NE(spIndex, nullptr);
+			declarations += spIndex->declarations.size();
+		}
+	} };
+
+	// VCfNTőSĉ͂
+	const auto coldMs{ BestMs([&] {
+		auto indexer{ FlCppDeclarationIndexer{} };
+		indexAll(indexer);
+		EXPECT_EQ(indexer.GetParseCount(), fileCount);
+	}) };
+	EXPECT_GT(declarations, static_cast<size_t>(fileCount) * structCount * 8U);
+
+	// CfNTňiXVƃTCY邾j
+	auto indexer{ FlCppDeclarationIndexer{} };
+	indexAll(indexer);
+	const auto cachedMs{ BestMs([&] { indexAll(indexer); }) };
+	EXPECT_EQ(indexer.GetParseCount(), fileCount);
+	EXPECT_EQ(indexer.GetCacheHitCount(), static_cast<uint64_t>(fileCount) * 3U);
+
+	const auto megabytes{ static_cast<double>(bytes) / (1024.0 * 1024.0) };
+	std::printf("[ BENCH ] FlCppDeclarationIndexer %u files (%.1f MB, %zu declarations): cold %.1f ms (%.1f MB/s), cached %.2f ms (%.0fx)\n",
+		fileCount, megabytes, declarations, coldMs, megabytes / (coldMs * 1e-3), cachedMs, coldMs / cachedMs);
+	::testing::Test::RecordProperty("cold_ms", std::to_string(coldMs));
+	::testing::Test::RecordProperty("cached_ms", std::to_string(cachedMs));
+
+	EXPECT_LT(cachedMs * 5.0, coldMs);
+
+	std::filesystem::remove_all(dir);
+}
@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+
+#include "Framework/System/CppParser/FlCppParser.h"
+
+namespace
+{
+	const CppDeclaration* Find(const CppFileIndex& index, const std::string_view qualifiedName)
+	{
+		for (const auto& decl : index.declarations)
+			if (decl.qualifiedName == qualifiedName) return &decl;
+		return nullptr;
+	}
+
+	std::vector<std::string> QualifiedNames(const CppFileIndex& index, const CppDeclarationKind kind)
+	{
+		auto names{ std::vector<std::string>{} };
+		for (const auto& decl : index.declarations)
+			if (decl.kind == kind) names.push_back(decl.qualifiedName);
+		return names;
+	}
+
+	std::filesystem::path FixturePath()
+	{
+		return std::filesystem::path{ FL_TEST_FIXTURE_DIR } / "FlCppParserFixture.cpp";
+	}
+}
+
+TEST(FlCppParser, FixtureSkipsCommentsStringsAndPreprocessor)
+{
+	auto indexer{ FlCppDeclarationIndexer{} };
+	const auto spIndex{ indexer.IndexFile(FixturePath()) };
+	ASSERT_NE(spIndex, nullptr);
+
+	for (const auto* name : { "Fake", "NotReal", "Commented", "InString", "InRaw" })
+		EXPECT_EQ(Find(*spIndex, std::string{ "game::core::" } + name), nullptr) << name;
+
+	EXPECT_EQ(QualifiedNames(*spIndex, CppDeclarationKind::Struct), (std::vector<std::string>{
+		"game::core::PlayerComponent", "game::core::PlayerComponent::Inner", "game::core::Holder" }));
+
+	EXPECT_EQ(QualifiedNames(*spIndex, CppDeclarationKind::Member), (std::vector<std::string>{
+		"game::core::PlayerComponent::hp", "game::core::PlayerComponent::mp", "game::core::PlayerComponent::slots",
+		"game::core::PlayerComponent::callback", "game::core::PlayerComponent::flags", "game::core::PlayerComponent::c",
+		"game::core::PlayerComponent::State::Idle", "game::core::PlayerComponent::State::Run", "game::core::PlayerComponent::State::Jump",
+		"game::core::PlayerComponent::Inner::z", "game::core::PlayerComponent::inner", "game::core::Holder::m_value" }));
+}
+
+TEST(FlCppParser, FixtureFunctionsIncludingFunctionTryBlocks)
+{
+	auto indexer{ FlCppDeclarationIndexer{} };
+	const auto spIndex{ indexer.IndexFile(FixturePath()) };
+	ASSERT_NE(spIndex, nullptr);
+
+	// catch nh͊֐ƂďEȂ
+	EXPECT_EQ(QualifiedNames(*spIndex, CppDeclarationKind::Function), (std::vector<std::string>{
+		"game::core::PlayerComponent::PlayerComponent", "game::core::PlayerComponent::~PlayerComponent",
+		"game::core::PlayerComponent::operator==", "game::core::PlayerComponent::operator()",
+		"game::core::Start", "game::core::Guarded", "game::core::Holder::Holder", "game::core::Local",
+		"Foo::Bar<int>::Update", "CFunc" }));
+
+	// ֐ try ubN͍Ō̃nh܂ł{́Atry ͐錾Ɋ܂߂Ȃ
+	const auto* pGuarded{ Find(*spIndex, "game::core::Guarded") };
+	ASSERT_NE(pGuarded, nullptr);
+	EXPECT_TRUE(pGuarded->hasBody);
+	EXPECT_EQ(pGuarded->signature, "void Guarded(int v)");
+	EXPECT_EQ(pGuarded->body.beginLine, 32U);
+	EXPECT_EQ(pGuarded->body.endLine, 41U);
+	EXPECT_EQ(pGuarded->range.endLine, 41U);
+
+	const auto* pHolder{ Find(*spIndex, "game::core::Holder::Holder") };
+	ASSERT_NE(pHolder, nullptr);
+	EXPECT_EQ(pHolder->signature, "Holder()");
+	EXPECT_EQ(pHolder->range.endLine, 44U);
+	EXPECT_EQ(pHolder->range.endColumn, 50U);
+
+	// ֐ try / catch ͂̃ubN
+	const auto* pLocal{ Find(*spIndex, "game::core::Local") };
+	ASSERT_NE(pLocal, nullptr);
+	EXPECT_EQ(pLocal->range.beginLine, pLocal->range.endLine);
+
+	// W[p̐؂oɂnh܂Ŋ܂܂
+	auto isFound{ false };
+	for (const auto& function : spIndex->functions)
+	{
+		if (function.name != "Guarded") continue;
+		isFound = true;
+		EXPECT_EQ(function.contentLines.size(), 9U);
+		EXPECT_EQ(function.contentLines.back(), "}");
+	}
+	EXPECT_TRUE(isFound);
+}
+
+TEST(FlCppParser, FunctionTryBlockDoesNotLeakIntoFollowingDeclarations)
+{
+	const auto spIndex{ FlCppDeclarationIndexer::IndexSource(
+		"void K() try {} catch(...) {}\n"
+		"struct After { int a; };\n"
+		"void L() {}\n"
+		"void M() try { } catch (int) { } catch (...) { } void N() { }\n") };
+
+	EXPECT_EQ(QualifiedNames(*spIndex, CppDeclarationKind::Function), (std::vector<std::string>{ "K", "L", "M", "N" }));
+	EXPECT_EQ(QualifiedNames(*spIndex, CppDeclarationKind::Struct), (std::vector<std::string>{ "After" }));
+	EXPECT_EQ(QualifiedNames(*spIndex, CppDeclarationKind::Member), (std::vector<std::string>{ "After::a" }));
+	EXPECT_EQ(Find(*spIndex, "catch"), nullptr);
+
+	const auto* pM{ Find(*spIndex, "M") };
+	ASSERT_NE(pM, nullptr);
+	EXPECT_EQ(pM->signature, "void M()");
+	EXPECT_EQ(pM->body.endColumn, 47U);
+}
+
+TEST(FlCppParser, IndexFileReusesCacheUntilContentChanges)
+{
+	const auto path{ std::filesystem::temp_directory_path() / "FlCppParserCache.cpp" };
+	std::ofstream{ path } << "void A() {}\n";
+
+	auto indexer{ FlCppDeclarationIndexer{} };
+	const auto spFirst{ indexer.IndexFile(path) };
+	ASSERT_NE(spFirst, nullptr);
+	EXPECT_EQ(indexer.IndexFile(path), spFirst);
+	EXPECT_EQ(indexer.GetParseCount(), 1U);
+	EXPECT_EQ(indexer.GetCacheHitCount(), 1U);
+
+	// eςΉ͂
+	std::ofstream{ path } << "void A() {}\nvoid B() {}\n";
+	std::filesystem::last_write_time(path, std::filesystem::last_write_time(path) + std::chrono::seconds{ 2 });
+	const auto spSecond{ indexer.IndexFile(path) };
+	ASSERT_NE(spSecond, nullptr);
+	EXPECT_NE(spSecond, spFirst);
+	EXPECT_EQ(spSecond->declarations.size(), 2U);
+	EXPECT_EQ(indexer.GetParseCount(), 2U);
+
+	std::filesystem::remove(path);
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+// FlUtilityString.hxx  MSVC gɈ˂邽߁AFlCppParser g֐𓯂Œu
+namespace Str
+{
+	[[nodiscard]] inline const auto StringToNumber(const std::string& str) noexcept
+	{
+		auto hash_fn{ std::hash<std::string>{} };
+		return hash_fn(str);
+	}
+}
@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+
+#include "Framework/System/Watcher/FlDirectoryModel.h"
+
+namespace
+{
+	namespace fs = std::filesystem;
+
+	class FlDirectoryModelTest : public ::testing::Test
+	{
+	protected:
+
+		void SetUp() override
+		{
+			m_root = fs::temp_directory_path() / "FlDirectoryModelTest";
+			fs::remove_all(m_root);
+			fs::create_directories(m_root / "Beta");
+			fs::create_directories(m_root / "alpha");
+			WriteFile("b.txt", 30U);
+			WriteFile("A.txt", 10U);
+			WriteFile("c.log", 20U);
+		}
+
+		void TearDown() override { fs::remove_all(m_root); }
+
+		void WriteFile(const std::string& name, const size_t bytes) const
+		{
+			auto stream{ std::ofstream{ m_root / name, std::ios::binary } };
+			stream << std::string(bytes, 'x');
+		}
+
+		static std::vector<std::string> Names(const FlDirectoryModel::Listing& listing)
+		{
+			auto names{ std::vector<std::string>{} };
+			for (const auto& entry : listing.entries) names.push_back(entry.name);
+			return names;
+		}
+
+		static std::vector<std::string> Names(const FlDirectoryModel::View& view)
+		{
+			auto names{ std::vector<std::string>{} };
+			for (auto row{ size_t{} }; row < view.GetSize(); ++row) names.push_back(view.GetEntry(row).name);
+			return names;
+		}
+
+		fs::path m_root;
+	};
+}
+
+TEST_F(FlDirectoryModelTest, ScanListsDirectoriesFirstThenCaseInsensitiveNames)
+{
+	const auto entries{ FlDirectoryModel::ScanDirectory(m_root) };
+	auto names{ std::vector<std::string>{} };
+	for (const auto& entry : entries) names.push_back(entry.name);
+
+	EXPECT_EQ(names, (std::vector<std::string>{ "alpha", "Beta", "A.txt", "b.txt", "c.log" }));
+	EXPECT_TRUE(entries[0].isDirectory);
+	EXPECT_EQ(entries[2].size, 10U);
+}
+
+TEST_F(FlDirectoryModelTest, AcquireScansLazilyAndInvalidateRescans)
+{
+	auto model{ FlDirectoryModel{ m_root, std::chrono::seconds{ 1 } } };
+	model.Start(false);
+	model.WaitIdle();
+
+	const auto spRoot{ model.Acquire(m_root) };
+	ASSERT_NE(spRoot, nullptr);
+	EXPECT_EQ(spRoot->entries.size(), 5U);
+	EXPECT_EQ(spRoot->directoryCount, 2U);
+
+	// qfBNg͏߂ėvꂽƂɑ
+	EXPECT_EQ(model.Acquire(m_root / "alpha"), nullptr);
+	model.WaitIdle();
+	ASSERT_NE(model.Acquire(m_root / "alpha"), nullptr);
+	EXPECT_TRUE(model.Acquire(m_root / "alpha")->entries.empty());
+
+	// [gO͈Ȃ
+	EXPECT_EQ(model.Acquire(m_root.parent_path()), nullptr);
+
+	WriteFile("alpha/new.txt", 1U);
+	model.Invalidate(m_root / "alpha");
+	model.WaitIdle();
+	EXPECT_EQ(Names(*model.Acquire(m_root / "alpha")), (std::vector<std::string>{ "new.txt" }));
+
+	// ܂ŌÂXibvVbg͕ςȂ
+	EXPECT_EQ(Names(*spRoot), (std::vector<std::string>{ "alpha", "Beta", "A.txt", "b.txt", "c.log" }));
+	model.Stop();
+}
+
+TEST_F(FlDirectoryModelTest, FileEventsAreAppliedAsSortedDeltas)
+{
+	auto model{ FlDirectoryModel{ m_root, std::chrono::seconds{ 1 } } };
+	model.Start(false);
+	model.WaitIdle();
+	const auto spBefore{ model.Acquire(m_root) };
+	ASSERT_NE(spBefore, nullptr);
+
+	fs::remove(m_root / "b.txt");
+	WriteFile("aa.txt", 5U);
+	fs::create_directory(m_root / "Gamma");
+	WriteFile("c.log", 99U);
+
+	model.OnFileEvent(m_root / "b.txt", FlFileWatcher::FileStatus::Erased);
+	model.OnFileEvent(m_root / "aa.txt", FlFileWatcher::FileStatus::Created);
+	model.OnFileEvent(m_root / "Gamma", FlFileWatcher::FileStatus::Created);
+	model.OnFileEvent(m_root / "c.log", FlFileWatcher::FileStatus::Modified);
+	// JĂȂfBNgւ̃Cxg͖
+	model.OnFileEvent(m_root / "Beta" / "x.txt", FlFileWatcher::FileStatus::Created);
+	model.WaitIdle();
+
+	const auto spAfter{ model.Acquire(m_root) };
+	ASSERT_NE(spAfter, nullptr);
+	EXPECT_GT(spAfter->version, spBefore->version);
+	EXPECT_EQ(Names(*spAfter), (std::vector<std::string>{ "alpha", "Beta", "Gamma", "A.txt", "aa.txt", "c.log" }));
+	EXPECT_EQ(spAfter->directoryCount, 3U);
+	EXPECT_EQ(spAfter->entries.back().size, 99U);
+
+	// ̌ʂ̓fBXN𑖍ʂƈv
+	EXPECT_EQ(Names(*spAfter), Names(FlDirectoryModel::Listing{ FlDirectoryModel::ScanDirectory(m_root) }));
+	model.Stop();
+}
+
+TEST_F(FlDirectoryModelTest, ViewFiltersSortsAndRebuildsOnlyOnChange)
+{
+	auto listing{ std::make_shared<FlDirectoryModel::Listing>() };
+	listing->entries = FlDirectoryModel::ScanDirectory(m_root);
+	const auto spListing{ std::shared_ptr<const FlDirectoryModel::Listing>{ listing } };
+
+	using SortKey = FlDirectoryModel::View::SortKey;
+	auto view{ FlDirectoryModel::View{} };
+
+	EXPECT_TRUE(view.Update(spListing, "", SortKey::Name, true));
+	EXPECT_FALSE(view.Update(spListing, "", SortKey::Name, true));
+	EXPECT_EQ(Names(view), (std::vector<std::string>{ "alpha", "Beta", "A.txt", "b.txt", "c.log" }));
+
+	// 啶ʂȂv
+	EXPECT_TRUE(view.Update(spListing, "TXT", SortKey::Name, true));
+	EXPECT_EQ(Names(view), (std::vector<std::string>{ "A.txt", "b.txt" }));
+
+	// fBNg͏ɐ擪At@C̓TCY̍~
+	EXPECT_TRUE(view.Update(spListing, "", SortKey::Size, false));
+	EXPECT_EQ(Names(view), (std::vector<std::string>{ "Beta", "alpha", "b.txt", "c.log", "A.txt" }));
+
+	EXPECT_TRUE(view.Update(spListing, "", SortKey::Name, false));
+	EXPECT_EQ(Names(view), (std::vector<std::string>{ "Beta", "alpha", "c.log", "b.txt", "A.txt" }));
+
+	EXPECT_TRUE(view.Update(nullptr, "", SortKey::Name, false));
+	EXPECT_EQ(view.GetSize(), 0U);
+}
@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+
+#include "Core/FlEntityComponentSystemKernel.h"
+#include "Framework/Module/RuntimeModule/ResistCamera.h"
+#include "Framework/Module/RuntimeModule/ResistModelRender.h"
+#include "Framework/Module/RuntimeModule/ResistCollision.h"
+#include "Framework/Module/RuntimeModule/Transform.h"
+
+// `E蔻̃R|[lg DirectX Ɉˑ̂ŃeXgł͓o^Ȃ
+ResistCamera::ResistCamera() {}
+ResistModelRender::ResistModelRender() {}
+ResistCollision::ResistCollision() {}
+
+namespace
+{
+	// Collision ̑ɔ̃GeBeB֕t^
+	struct ProbeComponent
+	{
+		float radius = 1.0f;
+	};
+
+	void RegisterProbe()
+	{
+		auto reflection{ ComponentReflection{} };
+		reflection.Create  = []() -> void* { return new ProbeComponent{}; };
+		reflection.Destroy = [](void* p) { delete static_cast<ProbeComponent*>(p); };
+		reflection.Copy    = [](void* p) -> void* { return new ProbeComponent{ *static_cast<ProbeComponent*>(p) }; };
+		FlEntityComponentSystemKernel::Instance().RegisterModule("Probe", reflection);
+	}
+
+	double ElapsedMs(const std::chrono::steady_clock::time_point start)
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	template<class Fn>
+	double BestMs(Fn&& fn)
+	{
+		auto best{ std::numeric_limits<double>::max() };
+		for (auto round{ 0 }; round < 3; ++round)
+		{
+			const auto start{ std::chrono::steady_clock::now() };
+			fn();
+			best = std::min(best, ElapsedMs(start));
+		}
+		return best;
+	}
+}
+
+// 100k GeBeBi Probej: GetAllEntityIds + HasComponent + GetComponent ̑ƃNG̔r
+TEST(FlEcsQueryBenchmark, HundredThousandEntities)
+{
+	constexpr auto entityCount{ 100000U };
+
+	auto& kernel{ FlEntityComponentSystemKernel::Instance() };
+	kernel.initialize();
+	RegisterProbe();
+	kernel.AllDestroyEntities();
+
+	const auto ids{ kernel.CreateEntities(entityCount) };
+	ASSERT_EQ(ids.size(), entityCount);
+	for (auto i{ size_t{} }; i < ids.size(); ++i)
+	{
+		kernel.AddComponent("Transform", ids[i]);
+		if (i % 2U == 0U) kernel.AddComponent("Probe", ids[i]);
+	}
+
+	auto scanSum{ 0.0f };
+	const auto scanMs{ BestMs([&] {
+		for (const auto id : kernel.GetAllEntityIds())
+		{
+			if (!kernel.HasComponent("Probe", id)) continue;
+			const auto* pProbe    { static_cast<ProbeComponent*>(kernel.GetComponent("Probe", id)) };
+			const auto* pTransform{ static_cast<TransformComponent*>(kernel.GetComponent("Transform", id)) };
+			if (pProbe && pTransform) scanSum += pProbe->radius;
+		}
+	}) };
+
+	const auto required{ std::array<std::string, 2U>{ "Probe", "Transform" } };
+	const auto query{ kernel.RegisterQuery(required) };
+	ASSERT_NE(query, InvalidQueryId);
+
+	auto view{ FlEcsQueryView{} };
+	auto querySum{ 0.0f };
+	const auto iterate{ [&] {
+		for (auto row{ size_t{} }; row < view.size(); ++row)
+		{
+			const auto* pProbe    { static_cast<ProbeComponent*>(view.Get(row, 0U)) };
+			const auto* pTransform{ static_cast<TransformComponent*>(view.Get(row, 1U)) };
+			if (pTransform) querySum += pProbe->radius;
+		}
+	} };
+
+	// ω̖t[ił̔rŎʂȂj
+	kernel.SyncQuery(query, view);
+	const auto queryMs{ BestMs([&] {
+		kernel.SyncQuery(query, view);
+		iterate();
+	}) };
+
+	// 1tOĎʂt[
+	auto toggle{ size_t{ 1U } };
+	const auto resyncMs{ BestMs([&] {
+		kernel.AddComponent("Probe", ids[toggle]);
+		kernel.RemoveComponent("Probe", ids[toggle]);
+		toggle += 2U;
+		EXPECT_TRUE(kernel.SyncQuery(query, view));
+		iterate();
+	}) };
+
+	EXPECT_EQ(view.size(), entityCount / 2U);
+	EXPECT_EQ(querySum, scanSum * 2.0f);
+
+	std::printf("[ BENCH ] ECS %u entities, %zu rows: scan %.2f ms, query %.3f ms (%.0fx), query with resync %.3f ms (%.0fx)\n",
+		entityCount, view.size(), scanMs, queryMs, scanMs / queryMs, resyncMs, scanMs / resyncMs);
+	::testing::Test::RecordProperty("scan_ms", std::to_string(scanMs));
+	::testing::Test::RecordProperty("query_ms", std::to_string(queryMs));
+	::testing::Test::RecordProperty("query_resync_ms", std::to_string(resyncMs));
+
+	EXPECT_LT(queryMs * 10.0, scanMs);
+	EXPECT_LT(resyncMs * 5.0, scanMs);
+
+	kernel.AllDestroyEntities();
+}
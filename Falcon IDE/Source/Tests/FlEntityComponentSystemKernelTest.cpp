@@ -0,0 +1,910 @@
+#include <gtest/gtest.h>
+
+#include "Core/FlEntityComponentSystemKernel.h"
+#include "Framework/Module/RuntimeModule/ResistCamera.h"
+#include "Framework/Module/RuntimeModule/ResistModelRender.h"
+#include "Framework/Module/RuntimeModule/ResistCollision.h"
+#include "Framework/Module/RuntimeModule/Transform.h"
+
+#include "FlAllocationCounter.h"
+
+// `E蔻̃R|[lg DirectX Ɉˑ̂ŃeXgł͓o^Ȃ
+ResistCamera::ResistCamera() {}
+ResistModelRender::ResistModelRender() {}
+ResistCollision::ResistCollision() {}
+
+namespace
+{
+	class FlEntityComponentSystemKernelTest : public ::testing::Test
+	{
+	protected:
+
+		static void SetUpTestSuite() { FlEntityComponentSystemKernel::Instance().initialize(); }
+
+		void SetUp() override { Kernel().AllDestroyEntities(); }
+		void TearDown() override { Kernel().AllDestroyEntities(); }
+
+		static FlEntityComponentSystemKernel& Kernel() { return FlEntityComponentSystemKernel::Instance(); }
+
+		static TransformComponent* TransformOf(const entityId id)
+		{
+			return static_cast<TransformComponent*>(Kernel().GetComponent("Transform", id));
+		}
+
+		// ۑł int ̌^
+		static void RegisterScore()
+		{
+			auto reflection{ ComponentReflection{} };
+			reflection.Create      = []() -> void* { return new int{}; };
+			reflection.Destroy     = [](void* p) { delete static_cast<int*>(p); };
+			reflection.Serialize   = [](void* p, nlohmann::json& json) { json["value"] = *static_cast<int*>(p); };
+			reflection.Deserialize = [](void* p, const nlohmann::json& json) { json.at("value").get_to(*static_cast<int*>(p)); };
+			Kernel().RegisterModule("Score", reflection);
+		}
+
+		// Score  i ̃GeBeB count 
+		static std::vector<entityId> CreateScored(const uint32_t count)
+		{
+			auto ids{ std::vector<entityId>{} };
+			for (auto i{ 0U }; i < count; ++i)
+			{
+				ids.push_back(Kernel().CreateEntity());
+				*static_cast<int*>(Kernel().AddComponent("Score", ids.back())) = static_cast<int>(i);
+			}
+			return ids;
+		}
+
+		// tĂȂ -1
+		static int ScoreOf(const entityId id)
+		{
+			const auto* pScore{ static_cast<int*>(Kernel().GetComponent("Score", id)) };
+			return pScore ? *pScore : -1;
+		}
+
+		static std::vector<entityId> Sorted(std::vector<entityId> ids)
+		{
+			std::ranges::sort(ids);
+			return ids;
+		}
+
+		// SerializeSceneChanges ̍IDǂݒ֕tւ
+		static nlohmann::json RemapChanges(const nlohmann::json& delta, const std::unordered_map<entityId, entityId>& remap)
+		{
+			nlohmann::json out = delta;
+			out["Entities"] = nlohmann::json::object();
+			if (delta.contains("Entities"))
+				for (auto& [idStr, compJson] : delta["Entities"].items())
+					out["Entities"][std::to_string(remap.at(static_cast<entityId>(std::stoul(idStr))))] = compJson;
+
+			if (out.contains("Removed"))
+				for (auto& [_, ids] : out["Removed"].items())
+					for (auto& id : ids) id = remap.at(id.get<entityId>());
+
+			for (auto& id : out["Destroyed"]) id = remap.at(id.get<entityId>());
+			return out;
+		}
+
+		// eqɂ2̃GeBeB
+		static std::pair<entityId, entityId> CreateParentAndChild()
+		{
+			const auto parent{ Kernel().CreateEntity() };
+			const auto child { Kernel().CreateEntity() };
+			TransformOf(parent)->m_children = { child };
+			TransformOf(child)->m_parent    = parent;
+			return { parent, child };
+		}
+
+		// ǂݍݒeq݂wĂ邩
+		static void ExpectLinkedPair(const std::pair<entityId, entityId>& stale)
+		{
+			const auto ids{ Kernel().GetAllEntityIds() };
+			ASSERT_EQ(ids.size(), 2U);
+			for (auto id : ids)
+			{
+				EXPECT_NE(id, stale.first);
+				EXPECT_NE(id, stale.second);
+			}
+
+			const auto isParent{ !TransformOf(ids[0])->m_children.empty() };
+			const auto parent  { isParent ? ids[0] : ids[1] };
+			const auto child   { isParent ? ids[1] : ids[0] };
+			EXPECT_EQ(TransformOf(parent)->m_children, (std::vector<entityId>{ child }));
+			EXPECT_EQ(TransformOf(child)->m_parent, parent);
+			EXPECT_EQ(TransformOf(parent)->m_parent, UINT32_MAX);
+		}
+	};
+}
+
+TEST_F(FlEntityComponentSystemKernelTest, SpecifiedCreateNeverRevivesReleasedHandle)
+{
+	auto& kernel{ Kernel() };
+	const auto id{ kernel.CreateEntity() };
+	ASSERT_NE(id, InvalidEntityId);
+	kernel.DestroyEntity(id);
+
+	EXPECT_FALSE(kernel.CreateEntity(id));
+	EXPECT_FALSE(kernel.IsActive(id));
+
+	// i߂w蔭s͒ʂǍ͂Â󂯕tȂ
+	const auto index{ GetEntityIndex(id) };
+	const auto ahead{ MakeEntityId(index, GetEntityGeneration(id) + 5U) };
+	ASSERT_TRUE(kernel.CreateEntity(ahead));
+	kernel.DestroyEntity(ahead);
+	EXPECT_FALSE(kernel.CreateEntity(MakeEntityId(index, GetEntityGeneration(id) + 1U)));
+	EXPECT_FALSE(kernel.CreateEntity(ahead));
+	EXPECT_FALSE(kernel.IsActive(ahead));
+}
+
+TEST_F(FlEntityComponentSystemKernelTest, RestoreEntityOnlyRevivesTheLatestGeneration)
+{
+	auto& kernel{ Kernel() };
+	const auto id{ kernel.CreateEntity() };
+	kernel.DestroyEntity(id);
+
+	ASSERT_TRUE(kernel.CanCreateEntity(id, true));
+	ASSERT_TRUE(kernel.RestoreEntity(id));
+	EXPECT_TRUE(kernel.IsActive(id));
+	kernel.DestroyEntity(id);
+
+	// ̃GeBeBXbgg͖߂Ȃ
+	const auto reused{ kernel.CreateEntity() };
+	ASSERT_EQ(GetEntityIndex(reused), GetEntityIndex(id));
+	kernel.DestroyEntity(reused);
+	EXPECT_FALSE(kernel.CanCreateEntity(id, true));
+	EXPECT_FALSE(kernel.RestoreEntity(id));
+	EXPECT_TRUE(kernel.RestoreEntity(reused));
+}
+
+TEST_F(FlEntityComponentSystemKernelTest, RevertedCreateLetsTheSlotRestoreTheEarlierEntity)
+{
+	auto& kernel{ Kernel() };
+	const auto id{ kernel.CreateEntity() };
+	kernel.DestroyEntity(id);
+
+	// 폜    ߂  폜߂ȀɌɖ߂
+	const auto created{ kernel.CreateEntity() };
+	ASSERT_EQ(GetEntityIndex(created), GetEntityIndex(id));
+	kernel.RevertCreatedEntity(created);
+	EXPECT_FALSE(kernel.IsActive(created));
+	EXPECT_EQ(kernel.GetComponent("Transform", created), nullptr);
+	ASSERT_TRUE(kernel.RestoreEntity(id));
+
+	// 蒼͓IDō蒼
+	kernel.DestroyEntity(id);
+	EXPECT_TRUE(kernel.RestoreEntity(created));
+	EXPECT_FALSE(kernel.IsActive(id));
+}
+
+TEST_F(FlEntityComponentSystemKernelTest, SaturatedGenerationRetiresTheSlot)
+{
+	auto& kernel{ Kernel() };
+	const auto retiredBefore{ kernel.GetRetiredSlotCount() };
+
+	const auto index{ uint32_t{ 4000U } };
+	const auto last { MakeEntityId(index, EntityGenerationMask) };
+	ASSERT_TRUE(kernel.CreateEntity(last));
+	kernel.DestroyEntity(last);
+
+	EXPECT_FALSE(kernel.IsActive(last));
+	EXPECT_EQ(kernel.GetRetiredSlotCount(), retiredBefore + 1U);
+	EXPECT_FALSE(kernel.CreateEntity(MakeEntityId(index, 0U)));
+	EXPECT_FALSE(kernel.CreateEntity(last));
+	EXPECT_FALSE(kernel.RestoreEntity(last));
+
+	// słޖXbg͓nȂ
+	for (auto i{ 0 }; i < 5000; ++i)
+		ASSERT_NE(GetEntityIndex(kernel.CreateEntity()), index);
+}
+
+TEST_F(FlEntityComponentSystemKernelTest, FuzzHandlesNeverComeBackToLife)
+{
+	auto& kernel{ Kernel() };
+	auto rng{ std::mt19937{ 20260315U } };
+	auto pick{ [&rng](const size_t size) { return std::uniform_int_distribution<size_t>{ 0U, size - 1U }(rng); } };
+
+	auto alive   { std::vector<entityId>{} };
+	auto dead    { std::unordered_set<entityId>{} };
+	auto reserved{ std::vector<entityId>{} };
+	auto latest  { std::vector<entityId>{} }; // Oɔj IDiRestoreEntity Ŗ߂Ă悢́j
+
+	auto isAlive{ [&](const entityId id) { return std::ranges::find(alive, id) != alive.end(); } };
+	auto onCreated{ [&](const entityId id) {
+		ASSERT_NE(id, InvalidEntityId);
+		ASSERT_FALSE(dead.contains(id)) << "revived " << id;
+		ASSERT_FALSE(isAlive(id));
+		for (auto r : reserved) ASSERT_NE(GetEntityIndex(r), GetEntityIndex(id));
+		alive.push_back(id);
+	} };
+
+	const auto retiredBefore{ kernel.GetRetiredSlotCount() };
+	auto saturated{ size_t{} };
+
+	for (auto step{ 0 }; step < 20000; ++step)
+	{
+		switch (pick(8U))
+		{
+		case 0U: case 1U:
+			onCreated(kernel.CreateEntity());
+			break;
+
+		case 2U:
+		{
+			// jς݁EE\񒆁E܂XbgĎw肷
+			auto id{ MakeEntityId(static_cast<uint32_t>(pick(300U)), static_cast<uint32_t>(pick(8U))) };
+			if (!dead.empty() && pick(2U) == 0U)
+				id = *std::next(dead.begin(), static_cast<std::ptrdiff_t>(pick(std::min<size_t>(dead.size(), 64U))));
+			else if (pick(16U) == 0U)
+			{
+				// g؂Xbg
+				id = MakeEntityId(static_cast<uint32_t>(300U + pick(200U)), EntityGenerationMask - static_cast<uint32_t>(pick(2U)));
+			}
+
+			const auto wasRejected{ dead.contains(id) || isAlive(id) };
+			const auto isCreated  { kernel.CreateEntity(id) };
+			if (wasRejected) ASSERT_FALSE(isCreated) << id;
+			if (isCreated)
+			{
+				onCreated(id);
+				if (GetEntityGeneration(id) == EntityGenerationMask) ++saturated;
+			}
+			break;
+		}
+
+		case 3U: case 4U:
+			if (alive.empty()) break;
+			{
+				const auto i { pick(alive.size()) };
+				const auto id{ alive[i] };
+				alive[i] = alive.back();
+				alive.pop_back();
+				kernel.DestroyEntity(id);
+				dead.insert(id);
+				latest.push_back(id);
+			}
+			break;
+
+		case 5U:
+			if (latest.empty()) break;
+			{
+				// ߂̂̓XbgɎgĂȂO̐ゾ
+				const auto id{ latest[pick(latest.size())] };
+				const auto index{ GetEntityIndex(id) };
+				const auto isTaken{ std::ranges::any_of(alive, [&](auto a) { return GetEntityIndex(a) == index; }) ||
+					std::ranges::any_of(reserved, [&](auto r) { return GetEntityIndex(r) == index; }) };
+				if (kernel.RestoreEntity(id))
+				{
+					ASSERT_FALSE(isTaken);
+					for (auto d : dead)
+						ASSERT_FALSE(GetEntityIndex(d) == index && GetEntityGeneration(d) > GetEntityGeneration(id)) << id;
+					dead.erase(id);
+					alive.push_back(id);
+				}
+				std::erase(latest, id);
+			}
+			break;
+
+		case 6U:
+		{
+			auto ids{ std::array<entityId, 4U>{} };
+			const auto count{ kernel.ReserveEntityIds(ids) };
+			for (auto i{ size_t{} }; i < count; ++i)
+			{
+				ASSERT_FALSE(dead.contains(ids[i]));
+				ASSERT_FALSE(isAlive(ids[i]));
+				ASSERT_FALSE(kernel.IsActive(ids[i]));
+				ASSERT_FALSE(kernel.CreateEntity(ids[i])); // \񒆂͎w蔭słȂ
+				reserved.push_back(ids[i]);
+			}
+			break;
+		}
+
+		case 7U:
+			kernel.CancelReservedIds(reserved);
+			reserved.clear();
+			break;
+		}
+
+		// ͈vAjς݂ ID ͐ԂĂȂ
+		if (step % 97 == 0)
+		{
+			ASSERT_EQ(kernel.GetActiveIdCount(), alive.size());
+			for (auto id : alive) ASSERT_TRUE(kernel.IsActive(id)) << id;
+			for (auto id : dead)  ASSERT_FALSE(kernel.IsActive(id)) << id;
+		}
+	}
+
+	// g؂Xbgĵ͑ޖĂ
+	auto retired{ size_t{} };
+	for (auto id : dead)
+		if (GetEntityGeneration(id) == EntityGenerationMask) ++retired;
+	EXPECT_GT(saturated, 0U);
+	EXPECT_EQ(kernel.GetRetiredSlotCount(), retiredBefore + retired);
+
+	kernel.CancelReservedIds(reserved);
+}
+
+TEST_F(FlEntityComponentSystemKernelTest, IsActiveIsSafeWhileSlotsGrow)
+{
+	auto& kernel{ Kernel() };
+	const auto probe{ kernel.CreateEntity() };
+
+	auto isDone{ std::atomic<bool>{ false } };
+	auto isBroken{ std::atomic<bool>{ false } };
+	auto reader{ std::thread{ [&] {
+		while (!isDone.load(std::memory_order_acquire))
+		{
+			if (!kernel.IsActive(probe)) isBroken = true;
+			std::this_thread::yield();
+		}
+	} } };
+
+	// Xbgzxmۂ
+	for (auto i{ uint32_t{} }; i < 2000U; ++i)
+	{
+		const auto id{ MakeEntityId(6000U + i * 16U, 0U) };
+		if (kernel.CreateEntity(id)) kernel.DestroyEntity(id);
+	}
+	isDone = true;
+	reader.join();
+
+	EXPECT_FALSE(isBroken.load());
+	EXPECT_TRUE(kernel.IsActive(probe));
+}
+
+TEST_F(FlEntityComponentSystemKernelTest, LoadingStaleIdsRemapsTransformLinks)
+{
+	auto& kernel{ Kernel() };
+	const auto stale{ CreateParentAndChild() };
+	const nlohmann::json scene = kernel.SerializeScene();
+	kernel.AllDestroyEntities();
+
+	// jŐオi񂾂̂Ō ID ł͍ꂸAV ID ɕtւēǂ
+	kernel.DeserializeScene(scene);
+	ExpectLinkedPair(stale);
+}
+
+TEST_F(FlEntityComponentSystemKernelTest, LoadingStaleBinaryIdsRemapsTransformLinks)
+{
+	auto& kernel{ Kernel() };
+	const auto stale{ CreateParentAndChild() };
+	const auto bytes{ kernel.SerializeSceneBinary(true) };
+	kernel.AllDestroyEntities();
+
+	ASSERT_TRUE(kernel.DeserializeSceneBinary(bytes));
+	ExpectLinkedPair(stale);
+}
+
+TEST_F(FlEntityComponentSystemKernelTest, CopiedTransformsMoveIndependently)
+{
+	auto& kernel{ Kernel() };
+	const auto source{ kernel.CreateEntity() };
+	const auto child { kernel.CreateEntity() };
+	const auto first { kernel.CreateEntity() };
+	const auto second{ kernel.CreateEntity() };
+
+	const auto spSource{ TransformOf(source)->m_transform };
+	spSource->SetLocalPosition({ 1.0F, 2.0F, 3.0F });
+	TransformOf(child)->m_transform->SetParent(spSource);
+
+	const auto targets{ std::array<entityId, 2U>{ first, second } };
+	ASSERT_EQ(kernel.AddComponentCopies("Transform", TransformOf(source), targets), 2U);
+
+	auto       spFirst { TransformOf(first)->m_transform };
+	const auto spSecond{ TransformOf(second)->m_transform };
+	ASSERT_NE(spFirst, spSource);
+	ASSERT_NE(spFirst, spSecond);
+	EXPECT_EQ(spFirst->GetLocalPosition(), (Math::Vector3{ 1.0F, 2.0F, 3.0F }));
+
+	// Е𓮂Ă͓Ȃ
+	spFirst->SetLocalPosition({ 5.0F, 0.0F, 0.0F });
+	EXPECT_EQ(spFirst->GetWorldPosition(), (Math::Vector3{ 5.0F, 0.0F, 0.0F }));
+	EXPECT_EQ(spSecond->GetWorldPosition(), (Math::Vector3{ 1.0F, 2.0F, 3.0F }));
+	EXPECT_EQ(spSource->GetWorldPosition(), (Math::Vector3{ 1.0F, 2.0F, 3.0F }));
+
+	// ͌̎qȂ̂ŁAjĂ̐eq͎c
+	EXPECT_TRUE(spFirst->GetChildren().empty());
+	kernel.DestroyEntity(first);
+	spFirst.reset();
+	EXPECT_EQ(spSource->GetChildren().size(), 1U);
+	EXPECT_EQ(TransformOf(child)->m_transform->GetParent().lock(), spSource);
+}
+
+TEST_F(FlEntityComponentSystemKernelTest, UnplayedCommandBufferReturnsItsReservations)
+{
+	auto& kernel{ Kernel() };
+
+	// obt@\񂷂ƓXbgTĂ
+	auto slots{ std::array<entityId, 64U>{} };
+	ASSERT_EQ(kernel.ReserveEntityIds(slots), slots.size());
+	kernel.CancelReservedIds(slots);
+
+	auto created{ std::vector<entityId>{} };
+	{
+		auto buffer{ FlEntityCommandBuffer{} };
+		for (auto i{ 0 }; i < 3; ++i) created.push_back(buffer.CreateEntity());
+		for (auto id : created) EXPECT_FALSE(kernel.CreateEntity(id)) << id;
+	}
+
+	// fȂAgȂ\wIDō
+	for (auto id : slots) EXPECT_TRUE(kernel.CreateEntity(id)) << id;
+	for (auto id : created) EXPECT_TRUE(kernel.IsActive(id)) << id;
+}
+
+TEST_F(FlEntityComponentSystemKernelTest, FlushReturnsUnusedReservations)
+{
+	auto& kernel{ Kernel() };
+
+	auto slots{ std::array<entityId, 64U>{} };
+	ASSERT_EQ(kernel.ReserveEntityIds(slots), slots.size());
+	kernel.CancelReservedIds(slots);
+
+	const auto id{ FlEntityComponentSystemKernel::WorkCommandBuffer().CreateEntity() };
+	ASSERT_NE(id, InvalidEntityId);
+	EXPECT_GT(kernel.FlushCommandBuffers(), 0U);
+	EXPECT_TRUE(kernel.IsActive(id));
+	EXPECT_NE(TransformOf(id), nullptr);
+
+	// c̗\͎̃t[֎zȂiǂݍ݁Eɖ߂̃Xbggj
+	for (auto slot : slots)
+		if (slot != id) EXPECT_TRUE(kernel.CreateEntity(slot)) << slot;
+}
+
+TEST_F(FlEntityComponentSystemKernelTest, CommandBufferCopiesTransformsIndependently)
+{
+	auto& kernel{ Kernel() };
+	const auto source{ kernel.CreateEntity() };
+	const auto target{ kernel.CreateEntity() };
+	TransformOf(source)->m_transform->SetLocalPosition({ 1.0F, 2.0F, 3.0F });
+
+	// AddComponentCopy  AddComponentCopies Ɠ Copyi[jʂ
+	FlEntityComponentSystemKernel::WorkCommandBuffer().AddComponentCopy(target, "Transform", TransformOf(source));
+	kernel.FlushCommandBuffers();
+
+	const auto spSource{ TransformOf(source)->m_transform };
+	const auto spTarget{ TransformOf(target)->m_transform };
+	ASSERT_NE(spTarget, spSource);
+	EXPECT_EQ(spTarget->GetLocalPosition(), (Math::Vector3{ 1.0F, 2.0F, 3.0F }));
+
+	spTarget->SetLocalPosition({ 5.0F, 0.0F, 0.0F });
+	EXPECT_EQ(spSource->GetWorldPosition(), (Math::Vector3{ 1.0F, 2.0F, 3.0F }));
+}
+
+TEST_F(FlEntityComponentSystemKernelTest, UpdateDefersDestroysThroughTheCommandBuffer)
+{
+	auto& kernel{ Kernel() };
+
+	// Update ̒瑼̃GeBeB^
+	static auto s_victim{ InvalidEntityId };
+	static auto s_wasVictimAliveInUpdate{ false };
+	auto reflection{ ComponentReflection{} };
+	reflection.Create  = []() -> void* { return new int{}; };
+	reflection.Destroy = [](void* p) { delete static_cast<int*>(p); };
+	reflection.Update  = [](void*, entityId, float) {
+		if (!FlEntityComponentSystemKernel::IsUpdating()) return;
+		FlEntityComponentSystemKernel::WorkCommandBuffer().DestroyEntity(s_victim);
+		s_wasVictimAliveInUpdate = FlEntityComponentSystemKernel::Instance().IsActive(s_victim);
+	};
+	kernel.RegisterModule("Deferred", reflection);
+
+	const auto killer{ kernel.CreateEntity() };
+	s_victim = kernel.CreateEntity();
+	kernel.AddComponent("Deferred", killer);
+
+	EXPECT_FALSE(FlEntityComponentSystemKernel::IsUpdating());
+	kernel.UpdateAll(1.0f / 60.0f);
+	EXPECT_FALSE(FlEntityComponentSystemKernel::IsUpdating());
+
+	// ͐ĂāAUpdateAll ̍Ō̔fŏ
+	EXPECT_TRUE(s_wasVictimAliveInUpdate);
+	EXPECT_FALSE(kernel.IsActive(s_victim));
+	EXPECT_TRUE(kernel.IsActive(killer));
+}
+
+TEST_F(FlEntityComponentSystemKernelTest, ThreadedCommandBuffersFlushDeterministicallyWithoutLeaking)
+{
+	auto& kernel{ Kernel() };
+
+	RegisterScore();
+
+	constexpr auto ThreadCount{ 4U };
+	constexpr auto PerThread  { 100U };
+
+	// XbhƂ i Ԗڂ̃GeBeB EScore ̒li -1j
+	using State = std::map<std::pair<uint32_t, uint32_t>, std::pair<bool, int>>;
+
+	const auto runRound{ [&] {
+		// Xbh̗\񂪑SĂo悤Aɋ󂫃XbgTĕԂĂ
+		auto slots{ std::vector<entityId>(ThreadCount * PerThread * 2U) };
+		EXPECT_EQ(kernel.ReserveEntityIds(slots), slots.size());
+		kernel.CancelReservedIds(slots);
+
+		auto ids{ std::array<std::vector<entityId>, ThreadCount>{} };
+		auto isGo{ std::atomic<bool>{ false } };
+		auto workers{ std::vector<std::thread>{} };
+		for (auto t{ 0U }; t < ThreadCount; ++t)
+		{
+			workers.emplace_back([&, t] {
+				while (!isGo.load(std::memory_order_acquire)) std::this_thread::yield();
+
+				auto& buffer{ FlEntityComponentSystemKernel::WorkCommandBuffer() };
+				for (auto i{ 0U }; i < PerThread; ++i)
+				{
+					const auto id{ buffer.CreateEntity() };
+					ids[t].push_back(id);
+					const auto value{ static_cast<int>(t * 1000U + i) };
+					buffer.AddComponent(id, "Score", [value](void* p) { *static_cast<int*>(p) = value; });
+					if (i % 5U == 0U) buffer.RemoveComponent(id, "Score");
+					if (i % 3U == 0U) buffer.DestroyEntity(id);
+				}
+			});
+		}
+		isGo = true;
+		for (auto& worker : workers) worker.join();
+
+		// IXbh̃obt@܂Ƃ߂Ĕf
+		EXPECT_GT(kernel.FlushCommandBuffers(), 0U);
+
+		auto state{ State{} };
+		auto used{ std::unordered_set<entityId>{} };
+		auto aliveCount{ size_t{} };
+		for (auto t{ 0U }; t < ThreadCount; ++t)
+		{
+			EXPECT_EQ(ids[t].size(), PerThread);
+			for (auto i{ 0U }; i < ids[t].size(); ++i)
+			{
+				const auto id{ ids[t][i] };
+				EXPECT_TRUE(used.insert(id).second) << id;
+				state[{ t, i }] = { kernel.IsActive(id), ScoreOf(id) };
+				if (kernel.IsActive(id)) ++aliveCount;
+			}
+		}
+		EXPECT_EQ(kernel.GetActiveIdCount(), aliveCount);
+
+		// gȂ\AjXbgNĂȂ
+		for (auto slot : slots)
+		{
+			if (!used.contains(slot))
+				EXPECT_TRUE(kernel.CreateEntity(slot)) << slot;
+			else if (!kernel.IsActive(slot))
+				EXPECT_TRUE(kernel.CreateEntity(MakeEntityId(GetEntityIndex(slot), GetEntityGeneration(slot) + 1U))) << slot;
+		}
+		kernel.AllDestroyEntities();
+		return state;
+	} };
+
+	const auto first{ runRound() };
+	for (auto t{ 0U }; t < ThreadCount; ++t)
+	{
+		for (auto i{ 0U }; i < PerThread; ++i)
+		{
+			const auto& [isAlive, score] { first.at({ t, i }) };
+			EXPECT_EQ(isAlive, i % 3U != 0U) << t << ":" << i;
+			EXPECT_EQ(score, isAlive && i % 5U != 0U ? static_cast<int>(t * 1000U + i) : -1) << t << ":" << i;
+		}
+	}
+
+	// L^̏ԂςĂʂ͓
+	for (auto round{ 0 }; round < 3; ++round) EXPECT_EQ(runRound(), first);
+}
+
+TEST_F(FlEntityComponentSystemKernelTest, ChangedEntitiesListsEachWrittenEntityOnce)
+{
+	auto& kernel{ Kernel() };
+	RegisterScore();
+	const auto ids{ CreateScored(5U) };
+
+	const auto since{ kernel.GetChangeVersion() };
+	*static_cast<int*>(kernel.WorkComponent("Score", ids[1])) = 10;
+	*static_cast<int*>(kernel.WorkComponent("Score", ids[1])) = 11;
+	kernel.MarkComponentChanged("Score", ids[3]);
+	EXPECT_NE(kernel.GetComponent("Score", ids[4]), nullptr); // ǂނȂL^Ȃ
+
+	auto changed{ std::vector<entityId>{} };
+	auto removed{ std::vector<entityId>{} };
+	EXPECT_TRUE(kernel.CollectChangedEntities("Score", since, changed, &removed));
+	std::ranges::sort(changed);
+	EXPECT_EQ(changed, Sorted({ ids[1], ids[3] }));
+	EXPECT_TRUE(removed.empty());
+
+	EXPECT_GT(kernel.GetStorageVersion("Score"), since);
+	EXPECT_GT(kernel.GetComponentVersion("Score", ids[1]), since);
+	EXPECT_LE(kernel.GetComponentVersion("Score", ids[4]), since);
+
+	// ̔ł͉B^͋ŁAL^͑Ă
+	changed.clear();
+	EXPECT_TRUE(kernel.CollectChangedEntities("Score", kernel.GetChangeVersion(), changed, &removed));
+	EXPECT_TRUE(kernel.CollectChangedEntities("NoSuchType", since, changed, &removed));
+	EXPECT_TRUE(changed.empty());
+	EXPECT_TRUE(removed.empty());
+}
+
+TEST_F(FlEntityComponentSystemKernelTest, RemovalLogSkipsReaddedEntities)
+{
+	auto& kernel{ Kernel() };
+	RegisterScore();
+	const auto ids{ CreateScored(4U) };
+
+	const auto since{ kernel.GetChangeVersion() };
+	kernel.RemoveComponent("Score", ids[0]);
+	kernel.RemoveComponent("Score", ids[1]);
+	kernel.AddComponent("Score", ids[1]);
+	kernel.DestroyEntity(ids[2]);
+
+	// t͕̂ύX̑AĵOꂽɓ
+	auto changed{ std::vector<entityId>{} };
+	auto removed{ std::vector<entityId>{} };
+	EXPECT_TRUE(kernel.CollectChangedEntities("Score", since, changed, &removed));
+	EXPECT_EQ(changed, (std::vector<entityId>{ ids[1] }));
+	EXPECT_EQ(removed, Sorted({ ids[0], ids[2] }));
+	EXPECT_GT(kernel.GetRemovedVersion("Score"), since);
+
+	// ł͔j Destroyed ɍڂ
+	const nlohmann::json delta = kernel.SerializeSceneChanges(since);
+	EXPECT_TRUE(delta["Complete"].get<bool>());
+	EXPECT_EQ(delta["Removed"]["Score"], (std::vector<entityId>{ ids[0] }));
+	EXPECT_EQ(delta["Destroyed"], (std::vector<entityId>{ ids[2] }));
+	EXPECT_TRUE(delta["Entities"].contains(std::to_string(ids[1])));
+	EXPECT_FALSE(delta["Entities"].contains(std::to_string(ids[3])));
+}
+
+TEST_F(FlEntityComponentSystemKernelTest, TrimmedOrClearedHistoryIsReportedIncomplete)
+{
+	auto& kernel{ Kernel() };
+	RegisterScore();
+	const auto id{ CreateScored(1U).front() };
+
+	// 폜̋L^̏𒴂ĕtOƁAÂł͍̍Ȃ
+	const auto before{ kernel.GetChangeVersion() };
+	for (auto i{ 0 }; i < 5000; ++i)
+	{
+		kernel.RemoveComponent("Score", id);
+		kernel.AddComponent("Score", id);
+	}
+
+	auto changed{ std::vector<entityId>{} };
+	auto removed{ std::vector<entityId>{} };
+	EXPECT_FALSE(kernel.CollectChangedEntities("Score", before, changed, &removed));
+	EXPECT_FALSE(kernel.SerializeSceneChanges(before)["Complete"].get<bool>());
+
+	// cĂ͈͍͂
+	const auto recent{ kernel.GetChangeVersion() };
+	kernel.RemoveComponent("Score", id);
+	changed.clear();
+	removed.clear();
+	EXPECT_TRUE(kernel.CollectChangedEntities("Score", recent, changed, &removed));
+	EXPECT_EQ(removed, (std::vector<entityId>{ id }));
+	EXPECT_TRUE(kernel.SerializeSceneChanges(recent)["Complete"].get<bool>());
+
+	// ^ƊOƁAO̍͂ǂ̌^Ȃ
+	auto reflection{ ComponentReflection{} };
+	reflection.Create  = []() -> void* { return new int{}; };
+	reflection.Destroy = [](void* p) { delete static_cast<int*>(p); };
+	kernel.RegisterModule("Scratch", reflection);
+	kernel.AddComponent("Scratch", id);
+
+	const auto beforeClear{ kernel.GetChangeVersion() };
+	kernel.ClearComponent("Scratch");
+	EXPECT_FALSE(kernel.CollectChangedEntities("Score", beforeClear, changed, &removed));
+	EXPECT_FALSE(kernel.CollectChangedEntities("Scratch", beforeClear, changed, &removed));
+	EXPECT_FALSE(kernel.SerializeSceneChanges(beforeClear)["Complete"].get<bool>());
+
+	const auto afterClear{ kernel.GetChangeVersion() };
+	EXPECT_TRUE(kernel.CollectChangedEntities("Scratch", afterClear, changed, &removed));
+	EXPECT_TRUE(kernel.SerializeSceneChanges(afterClear)["Complete"].get<bool>());
+}
+
+TEST_F(FlEntityComponentSystemKernelTest, SceneChangesReplayOntoTheSavedScene)
+{
+	auto& kernel{ Kernel() };
+	RegisterScore();
+	const auto ids{ CreateScored(4U) };
+	const nlohmann::json base = kernel.SerializeScene();
+
+	const auto since{ kernel.GetChangeVersion() };
+	*static_cast<int*>(kernel.WorkComponent("Score", ids[0])) = 100;
+	kernel.RemoveComponent("Score", ids[1]);
+	const auto created{ kernel.CreateEntity() };
+	*static_cast<int*>(kernel.AddComponent("Score", created)) = 7;
+	kernel.DestroyEntity(ids[2]);
+
+	const nlohmann::json delta = kernel.SerializeSceneChanges(since);
+	ASSERT_TRUE(delta["Complete"].get<bool>());
+	EXPECT_EQ(delta["Version"].get<uint64_t>(), kernel.GetChangeVersion());
+
+	// ۑŜǂݒivZXł͕ʂIDɂȂjȀɍ𓖂Ă
+	kernel.AllDestroyEntities();
+	auto remap{ std::unordered_map<entityId, entityId>{} };
+	kernel.DeserializeScene(base, &remap);
+	ASSERT_EQ(remap.size(), ids.size());
+
+	auto slot{ std::array<entityId, 1U>{} };
+	ASSERT_EQ(kernel.ReserveEntityIds(slot), slot.size());
+	kernel.CancelReservedIds(slot);
+	remap[created] = slot[0];
+
+	kernel.DeserializeSceneChanges(RemapChanges(delta, remap));
+
+	EXPECT_EQ(kernel.GetActiveIdCount(), 4U);
+	EXPECT_EQ(ScoreOf(remap[ids[0]]), 100);
+	EXPECT_EQ(ScoreOf(remap[ids[1]]), -1);
+	EXPECT_TRUE(kernel.IsActive(remap[ids[1]]));
+	EXPECT_FALSE(kernel.IsActive(remap[ids[2]]));
+	EXPECT_EQ(ScoreOf(remap[ids[3]]), 3);
+	EXPECT_EQ(ScoreOf(remap[created]), 7);
+	EXPECT_NE(TransformOf(remap[created]), nullptr);
+}
+
+TEST_F(FlEntityComponentSystemKernelTest, SavedSceneChangesAppendAndReplayInOrder)
+{
+	auto& kernel{ Kernel() };
+	RegisterScore();
+	const auto ids{ CreateScored(3U) };
+
+	const auto path{ std::filesystem::temp_directory_path() / "FlEntityComponentSystemKernelTest.flscene.changes" };
+	std::filesystem::remove(path);
+
+	auto since{ kernel.GetChangeVersion() };
+	*static_cast<int*>(kernel.WorkComponent("Score", ids[0])) = 10;
+	ASSERT_TRUE(kernel.SaveSceneChanges(path, since));
+	EXPECT_EQ(since, kernel.GetChangeVersion());
+
+	// ςĂȂΏȂ
+	ASSERT_TRUE(kernel.SaveSceneChanges(path, since));
+
+	*static_cast<int*>(kernel.WorkComponent("Score", ids[0])) = 20;
+	kernel.DestroyEntity(ids[1]);
+	ASSERT_TRUE(kernel.SaveSceneChanges(path, since));
+
+	auto ifs{ std::ifstream{ path } };
+	auto lineCount{ 0 };
+	for (auto line{ std::string{} }; std::getline(ifs, line);) ++lineCount;
+	ifs.close();
+	EXPECT_EQ(lineCount, 2);
+
+	// L^ɖ͓Ēƕۑlɖ߂
+	*static_cast<int*>(kernel.GetComponent("Score", ids[0])) = 99;
+	*static_cast<int*>(kernel.GetComponent("Score", ids[2])) = 99;
+	EXPECT_TRUE(kernel.LoadSceneChanges(path));
+	EXPECT_EQ(ScoreOf(ids[0]), 20);
+	EXPECT_EQ(ScoreOf(ids[2]), 99);
+	EXPECT_FALSE(kernel.IsActive(ids[1]));
+
+	// ̍s͓ǂݍ݂̎sɂ
+	{
+		auto ofs{ std::ofstream{ path, std::ios::binary | std::ios::app } };
+		ofs << "{\"Entities\":";
+	}
+	EXPECT_FALSE(kernel.LoadSceneChanges(path));
+
+	// ^ƊO͍ȂiŜۑj
+	auto reflection{ ComponentReflection{} };
+	reflection.Create  = []() -> void* { return new int{}; };
+	reflection.Destroy = [](void* p) { delete static_cast<int*>(p); };
+	kernel.RegisterModule("Scratch", reflection);
+	kernel.ClearComponent("Scratch");
+	const auto stale{ since };
+	EXPECT_FALSE(kernel.SaveSceneChanges(path, since));
+	EXPECT_EQ(since, stale);
+
+	std::filesystem::remove(path);
+}
+
+TEST_F(FlEntityComponentSystemKernelTest, ComponentCallbacksMayCallBackIntoTheKernel)
+{
+	auto& kernel{ Kernel() };
+
+	// OnDestroyERenderEditor  g_runtimeApi oRŃJ[lĂԌ^ibNɌĂԂƎ~܂j
+	static auto s_target           { InvalidEntityId };
+	static auto s_wasAliveInDestroy{ false };
+	static auto s_hadComponent     { false };
+	static auto s_isRendered       { false };
+	auto reflection{ ComponentReflection{} };
+	reflection.Create  = []() -> void* { return new int{}; };
+	reflection.Destroy = [](void* p) {
+		auto& kernel{ FlEntityComponentSystemKernel::Instance() };
+		s_wasAliveInDestroy = kernel.IsActive(s_target);
+		s_hadComponent      = kernel.GetComponent("Reentrant", s_target) != nullptr;
+		delete static_cast<int*>(p);
+	};
+	reflection.RenderEditor = [](void* p, entityId id) {
+		s_isRendered = FlEntityComponentSystemKernel::Instance().GetComponent("Reentrant", id) == p;
+	};
+	kernel.RegisterModule("Reentrant", reflection);
+
+	// Ô͎ꗗĂĂ΂
+	s_target = kernel.CreateEntity();
+	kernel.AddComponent("Reentrant", s_target);
+	kernel.RemoveComponent("Reentrant", s_target);
+	EXPECT_TRUE(s_wasAliveInDestroy);
+	EXPECT_FALSE(s_hadComponent);
+
+	// j̓GeBeBĂĂ΂
+	kernel.AddComponent("Reentrant", s_target);
+	kernel.DestroyEntity(s_target);
+	EXPECT_FALSE(s_wasAliveInDestroy);
+	EXPECT_FALSE(s_hadComponent);
+
+	// ҏWłi
+	const auto edited{ kernel.CreateEntity() };
+	kernel.AddComponent("Reentrant", edited);
+	const auto before{ kernel.GetComponentVersion("Reentrant", edited) };
+	EXPECT_TRUE(kernel.RenderComponentEditor("Reentrant", edited));
+	EXPECT_TRUE(s_isRendered);
+	EXPECT_EQ(kernel.GetComponentVersion("Reentrant", edited), before);
+
+	ImGui::g_isItemEdited = true;
+	EXPECT_TRUE(kernel.RenderComponentEditor("Reentrant", edited));
+	ImGui::g_isItemEdited = false;
+	EXPECT_GT(kernel.GetComponentVersion("Reentrant", edited), before);
+}
+
+TEST_F(FlEntityComponentSystemKernelTest, QueryViewsMatchAFullScan)
+{
+	auto& kernel{ Kernel() };
+
+	// tO߂̌^
+	auto reflection{ ComponentReflection{} };
+	reflection.Create  = []() -> void* { return new int{}; };
+	reflection.Destroy = [](void* p) { delete static_cast<int*>(p); };
+	kernel.RegisterModule("Probe", reflection);
+
+	const auto required{ std::array<std::string, 2U>{ "Transform", "Probe" } };
+	const auto excluded{ std::array<std::string, 1U>{ "Name" } };
+	const auto query{ kernel.RegisterQuery(required, excluded) };
+	ASSERT_NE(query, InvalidQueryId);
+	EXPECT_EQ(kernel.RegisterQuery(required, excluded), query);
+
+	auto rng{ std::mt19937{ 47U } };
+	auto pick{ [&rng](const size_t size) { return std::uniform_int_distribution<size_t>{ 0U, size - 1U }(rng); } };
+
+	auto view{ FlEcsQueryView{} };
+	for (auto step{ 0 }; step < 3000; ++step)
+	{
+		const auto alive{ kernel.GetAllEntityIds() };
+		const auto id   { alive.empty() ? InvalidEntityId : alive[pick(alive.size())] };
+		switch (alive.empty() ? 0U : pick(8U))
+		{
+		case 0U: case 1U: kernel.CreateEntity(); break;
+		case 2U: kernel.AddComponent("Probe", id); break;
+		case 3U: kernel.RemoveComponent("Probe", id); break;
+		case 4U: kernel.RemoveComponent("Name", id); break;
+		case 5U: kernel.AddComponent("Name", id); break;
+		case 6U: kernel.RemoveComponent("Transform", id); break;
+		case 7U: kernel.DestroyEntity(id); break;
+		}
+
+		const auto version{ view.version };
+		kernel.SyncQuery(query, view);
+		ASSERT_EQ(view.version, kernel.GetQueryVersion(query));
+		if (view.version == version) continue;
+
+		// s͑Sŏɍ̂ƈvÂ GetComponent Ɠ
+		auto expected{ std::vector<entityId>{} };
+		for (auto e : kernel.GetAllEntityIds())
+			if (kernel.HasComponent("Transform", e) && kernel.HasComponent("Probe", e) && !kernel.HasComponent("Name", e)) expected.push_back(e);
+
+		ASSERT_EQ(view.width, 2U);
+		ASSERT_EQ(view.components.size(), view.size() * 2U);
+		auto rows{ view.entities };
+		std::ranges::sort(rows);
+		std::ranges::sort(expected);
+		ASSERT_EQ(rows, expected) << step;
+		for (auto row{ size_t{} }; row < view.size(); ++row)
+		{
+			ASSERT_EQ(view.Get(row, 0U), kernel.GetComponent("Transform", view.entities[row])) << step;
+			ASSERT_EQ(view.Get(row, 1U), kernel.GetComponent("Probe", view.entities[row])) << step;
+		}
+	}
+}
+
+TEST_F(FlEntityComponentSystemKernelTest, SteadyStateUpdateAllDoesNotTouchTheHeap)
+{
+	for (auto i{ 0 }; i < 200; ++i) Kernel().CreateEntity();
+
+	// XNb`̓o^Ə͍̈ŏ̐ōς
+	for (auto frame{ 0 }; frame < 4; ++frame) Kernel().UpdateAll(1.0f / 60.0f);
+
+	auto counter{ FlAllocationCounter::Scope{} };
+	for (auto frame{ 0 }; frame < 100; ++frame) Kernel().UpdateAll(1.0f / 60.0f);
+	EXPECT_EQ(counter.GetCount(), 0U);
+}
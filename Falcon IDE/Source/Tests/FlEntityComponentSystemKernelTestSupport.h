@@ -0,0 +1,17 @@
+#pragma once
+
+// FlEntityComponentSystemKernel.cpp  Pch.h 󂯎镨̑ieXgł DLL vt@CgȂj
+using HMODULE = void*;
+
+#define FALSE 0
+
+struct MEMORY_BASIC_INFORMATION { void* AllocationBase; };
+inline size_t VirtualQuery(const void*, MEMORY_BASIC_INFORMATION*, size_t) noexcept { return 0U; }
+
+#define FL_PROFILER_ENABLED 0
+#define FL_PROFILE_SCOPE(name) ((void)0)
+#define FL_PROFILE_FUNCTION()  ((void)0)
+
+#include "Framework/System/Memory/FlFrameMemory.h"
+#include "Framework/Utility/FlUtilityJson.hxx"
+#include "Framework/Module/FlRunTimeAndDLLsCommon.h++"
@@ -0,0 +1,183 @@
+#include <gtest/gtest.h>
+#include <iomanip>
+
+#include "Framework/System/Timer/FlChronus.hpp"
+#include "Framework/System/FrameControl/FlFramePacer.hpp"
+
+namespace
+{
+	using TimePoint = std::chrono::steady_clock::time_point;
+	using Duration  = std::chrono::duration<double>;
+
+	// p̎visleep_for ͎w overshoot Q߂Arelax  1us iށj
+	struct FakeTime
+	{
+		TimePoint now{ std::chrono::seconds{ 100 } };
+		std::mt19937 rng{ 40U };
+		double minOvershootMs = 0.5;
+		double maxOvershootMs = 2.5;
+		uint64_t sleepCount = 0;
+
+		void Advance(const Duration d) { now += std::chrono::duration_cast<std::chrono::steady_clock::duration>(d); }
+	};
+
+	struct FakeClock
+	{
+		FakeTime* pTime = nullptr;
+
+		TimePoint now() const noexcept { return pTime->now; }
+		void sleep_for(const Duration d)
+		{
+			const auto overshootMs{ std::uniform_real_distribution<double>{ pTime->minOvershootMs, pTime->maxOvershootMs }(pTime->rng) };
+			pTime->Advance(d + Duration{ overshootMs / 1000.0 });
+			++pTime->sleepCount;
+		}
+		void relax() noexcept { pTime->Advance(Duration{ 1e-6 }); }
+	};
+
+	using Pacer = FlFramePacer<FakeClock>;
+
+	// Q߂ZÕ}[Wi1.5msjɎ܂鎞v
+	FakeTime QuietTime()
+	{
+		auto time{ FakeTime{} };
+		time.minOvershootMs = 0.2;
+		time.maxOvershootMs = 1.0;
+		return time;
+	}
+
+	constexpr auto FrameTime{ Duration{ 1.0 / 60.0 } };
+	constexpr auto WorkTime { Duration{ 0.005 } };
+
+	double ToMs(const TimePoint::duration d) { return std::chrono::duration<double, std::milli>(d).count(); }
+}
+
+TEST(FlFramePacer, CalibratedIntervalsHitTheTargetDespiteOversleeping)
+{
+	auto time { FakeTime{} };
+	auto pacer{ Pacer{ FakeClock{ &time } } };
+
+	// ZO 120 t[͎̂Ă
+	for (auto frame{ 0 }; frame < 120; ++frame)
+	{
+		time.Advance(WorkTime);
+		pacer.Wait(FrameTime);
+	}
+
+	const auto before{ pacer.GetStatistics() };
+	auto previous{ time.now };
+	for (auto frame{ 0 }; frame < 600; ++frame)
+	{
+		time.Advance(WorkTime);
+		pacer.Wait(FrameTime);
+		ASSERT_NEAR(ToMs(time.now - previous), 1000.0 / 60.0, 0.002) << frame;
+		previous = time.now;
+	}
+
+	const auto s{ pacer.GetStatistics() };
+	EXPECT_EQ(s.frames, 720U);
+	EXPECT_EQ(s.late, before.late);
+	EXPECT_EQ(s.dropped, 0U);
+	EXPECT_EQ(s.error.count, 600U);
+	EXPECT_LT(s.error.maxMs, 0.002);
+	// Q߂̍ő 2.5ms 𕢂̃}[WɍLĂ
+	EXPECT_GE(s.marginMs, 2.5);
+	EXPECT_LE(s.marginMs, pacer.GetSettings().maxMargin.count() * 1000.0);
+	EXPECT_GT(time.sleepCount, 600U);
+}
+
+TEST(FlFramePacer, LowLatencyDropsMissedDeadlinesAndCountsFromNow)
+{
+	auto time { QuietTime() };
+	auto pacer{ Pacer{ FakeClock{ &time } } };
+	pacer.Wait(FrameTime);
+
+	// ߐ؂ 2 t[߂qb`
+	time.Advance(FrameTime * 3.5);
+	pacer.Wait(FrameTime);
+	const auto hitch{ time.now };
+
+	auto s{ pacer.GetStatistics() };
+	EXPECT_EQ(s.late, 1U);
+	EXPECT_EQ(s.dropped, 3U);
+
+	// ̒ߐ؂̓qb` 1 t[i܂ߐ؂}ŏȂj
+	time.Advance(WorkTime);
+	pacer.Wait(FrameTime);
+	EXPECT_NEAR(ToMs(time.now - hitch), 1000.0 / 60.0, 0.002);
+}
+
+TEST(FlFramePacer, WithoutLowLatencyCatchesUpWithinTheBacklog)
+{
+	auto time{ QuietTime() };
+	auto settings{ Pacer::Settings{} };
+	settings.isLowLatency = false;
+	auto pacer{ Pacer{ FakeClock{ &time }, settings } };
+
+	pacer.Wait(FrameTime);
+	const auto anchor{ time.now };
+
+	// 2 t[xĂߐ؂͌̊iq̂܂
+	time.Advance(FrameTime * 2.5);
+	pacer.Wait(FrameTime);
+	EXPECT_EQ(pacer.GetStatistics().dropped, 0U);
+
+	// xꂽ͑҂ɕԂ
+	pacer.Wait(FrameTime);
+	EXPECT_NEAR(ToMs(time.now - anchor), 2.5 * 1000.0 / 60.0, 0.002);
+
+	// ǂiqɖ߂
+	pacer.Wait(FrameTime);
+	EXPECT_NEAR(ToMs(time.now - anchor), 3.0 * 1000.0 / 60.0, 0.002);
+
+	// backlog 𒴂x͐
+	time.Advance(FrameTime * (settings.maxBacklogFrames + 2));
+	pacer.Wait(FrameTime);
+	EXPECT_GT(pacer.GetStatistics().dropped, 0U);
+}
+
+TEST(FlFramePacer, ErrorWindowForgetsAnOldHitch)
+{
+	auto time { FakeTime{} };
+	auto pacer{ Pacer{ FakeClock{ &time } } };
+	for (auto frame{ 0 }; frame < 120; ++frame)
+	{
+		time.Advance(WorkTime);
+		pacer.Wait(FrameTime);
+	}
+
+	time.Advance(Duration{ 0.030 });
+	pacer.Wait(FrameTime);
+	EXPECT_GT(pacer.GetStatistics().error.maxMs, 10.0);
+
+	// v̑ 600 t[iqb`oől߂j
+	for (auto frame{ 0 }; frame < 600; ++frame)
+	{
+		time.Advance(WorkTime);
+		pacer.Wait(FrameTime);
+	}
+	const auto s{ pacer.GetStatistics() };
+	EXPECT_EQ(s.error.count, 600U);
+	EXPECT_LT(s.error.maxMs, 0.002);
+}
+
+TEST(FlFramePacer, ResetAnchorsAtTheGivenDeadline)
+{
+	auto time { QuietTime() };
+	auto pacer{ Pacer{ FakeClock{ &time } } };
+
+	// Ot[̊Jnߐ؂ƂĐỉ߂j
+	const auto frameStart{ time.now };
+	time.Advance(WorkTime);
+	pacer.Reset(frameStart);
+	pacer.Wait(FrameTime);
+	EXPECT_NEAR(ToMs(time.now - frameStart), 1000.0 / 60.0, 0.002);
+
+	// Reset() ̌͌Ă񂾎
+	time.Advance(Duration{ 0.100 });
+	pacer.Reset();
+	const auto resetAt{ time.now };
+	pacer.Wait(FrameTime);
+	EXPECT_NEAR(ToMs(time.now - resetAt), 1000.0 / 60.0, 0.002);
+	EXPECT_EQ(pacer.GetStatistics().dropped, 0U);
+}
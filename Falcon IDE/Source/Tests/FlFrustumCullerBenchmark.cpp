@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+
+#include "Framework/Graphics/Culling/FlFrustumCuller.h"
+
+namespace
+{
+	Math::Matrix MakeViewProjection()
+	{
+		constexpr auto nearZ{ 0.5f };
+		constexpr auto farZ { 500.0f };
+		const auto yScale{ 1.0f / std::tan(0.5f * 1.0471976f) };
+		const auto range { farZ / (farZ - nearZ) };
+		return Math::Matrix{
+			yScale / (16.0f / 9.0f), 0.0f, 0.0f, 0.0f,
+			0.0f, yScale, 0.0f, 0.0f,
+			0.0f, 0.0f, range, 1.0f,
+			0.0f, 0.0f, -nearZ * range, 0.0f };
+	}
+
+	// 100k ̔𖈃t[o^Ĕ肵Ƃ 1 ̎
+	void RunFrames(const size_t boxCount, const int frames)
+	{
+		auto& culler{ FlFrustumCuller::Instance() };
+		culler.SetIsEnable(true);
+
+		auto rng  { std::mt19937{ 26U } };
+		auto pos  { std::uniform_real_distribution<float>{ -300.0f, 300.0f } };
+		auto boxes{ std::vector<DirectX::BoundingBox>(boxCount) };
+		for (auto& box : boxes) box = DirectX::BoundingBox{ { pos(rng), pos(rng) * 0.3f, pos(rng) + 200.0f }, { 1.0f, 1.0f, 1.0f } };
+
+		const auto view{ Math::Matrix{} };
+		const auto proj{ MakeViewProjection() };
+
+		auto best{ std::chrono::nanoseconds::max() };
+		for (auto frame{ 0 }; frame < frames; ++frame)
+		{
+			const auto start{ std::chrono::steady_clock::now() };
+			culler.Begin(view, proj);
+			for (const auto& box : boxes) culler.AddBounds(box);
+			culler.Execute();
+			best = std::min(best, std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start));
+		}
+
+		const auto perBox{ static_cast<double>(best.count()) / static_cast<double>(boxCount) };
+		std::printf("[ BENCH ] FlFrustumCuller %zu boxes: best %.3f ms/frame, %.2f ns/box, culled %u\n",
+			boxCount, static_cast<double>(best.count()) * 1e-6, perBox, static_cast<unsigned>(culler.GetCulledCount()));
+
+		::testing::Test::RecordProperty("ns_per_box", std::to_string(perBox));
+		EXPECT_EQ(culler.GetTestedCount(), boxCount);
+		EXPECT_GT(culler.GetCulledCount(), 0U);
+	}
+}
+
+TEST(FlFrustumCullerBenchmark, HundredThousandBoxes)
+{
+	RunFrames(100000U, 20);
+}
+
+TEST(FlFrustumCullerBenchmark, SerialPathBelowParallelThreshold)
+{
+	RunFrames(4000U, 200);
+}
@@ -0,0 +1,210 @@
+#include <gtest/gtest.h>
+
+#include "Framework/Graphics/Culling/FlFrustumCuller.h"
+
+namespace
+{
+	constexpr float Near{ 0.5f };
+	constexpr float Far { 200.0f };
+
+	// D3D ̍neisxNgKA0 <= z <= wj
+	Math::Matrix MakeProjection()
+	{
+		const auto yScale{ 1.0f / std::tan(0.5f * 1.0471976f) }; // c 60 x
+		const auto xScale{ yScale / (16.0f / 9.0f) };
+		const auto range { Far / (Far - Near) };
+		return Math::Matrix{
+			xScale, 0.0f,   0.0f,          0.0f,
+			0.0f,   yScale, 0.0f,          0.0f,
+			0.0f,   0.0f,   range,         1.0f,
+			0.0f,   0.0f,   -Near * range, 0.0f };
+	}
+
+	// J (3, -2, -10) ɒur[si]Ȃj
+	Math::Matrix MakeView()
+	{
+		return Math::Matrix::CreateTranslation(-3.0f, 2.0f, 10.0f);
+	}
+
+	struct Box
+	{
+		float cx, cy, cz, ex, ey, ez;
+	};
+
+	enum class Expect : uint8_t
+	{
+		Visible,
+		Hidden,
+		Ambiguous, // ʂɂقڐڂĂ float ̊ۂ߂Ōʂς蓾
+	};
+
+	// DirectXMath ̎iˉes񂩂ăr[̋tsŃ[hցjBContains 6ʂ̔Ȃ̂Ōʂ
+	DirectX::BoundingFrustum MakeReferenceFrustum(const Math::Matrix& view, const Math::Matrix& proj)
+	{
+		auto local{ DirectX::BoundingFrustum{} };
+		DirectX::BoundingFrustum::CreateFromMatrix(local, proj);
+
+		auto world{ DirectX::BoundingFrustum{} };
+		local.Transform(world, view.Invert());
+		return world;
+	}
+
+	// c܂ĂOȂsAk߂ĂȂAǂłȂΕʂɐڂĂ
+	Expect Reference(const DirectX::BoundingFrustum& frustum, const Box& box)
+	{
+		constexpr auto margin{ 1e-3f };
+		auto contains{ [&](const float delta) {
+			return frustum.Contains(DirectX::BoundingBox{ { box.cx, box.cy, box.cz },
+				{ box.ex + delta, box.ey + delta, box.ez + delta } }) != DirectX::DISJOINT; } };
+
+		if (!contains(margin))  return Expect::Hidden;
+		if (contains(-margin))  return Expect::Visible;
+		return Expect::Ambiguous;
+	}
+
+	std::vector<Box> MakeBoxes(const size_t count, const uint32_t seed)
+	{
+		auto rng   { std::mt19937{ seed } };
+		auto center{ std::uniform_real_distribution<float>{ -150.0f, 150.0f } };
+		auto depth { std::uniform_real_distribution<float>{ -50.0f, 250.0f } };
+		auto extent{ std::uniform_real_distribution<float>{ 0.05f, 8.0f } };
+
+		auto boxes{ std::vector<Box>(count) };
+		for (auto& box : boxes) box = { center(rng), center(rng) * 0.5f, depth(rng), extent(rng), extent(rng), extent(rng) };
+		return boxes;
+	}
+
+	void ExpectMatchesReference(const size_t count, const uint32_t seed)
+	{
+		auto& culler{ FlFrustumCuller::Instance() };
+		culler.SetIsEnable(true);
+
+		const auto view { MakeView() };
+		const auto proj { MakeProjection() };
+		const auto boxes{ MakeBoxes(count, seed) };
+
+		culler.Begin(view, proj);
+		for (const auto& box : boxes)
+			culler.AddBounds(DirectX::BoundingBox{ { box.cx, box.cy, box.cz }, { box.ex, box.ey, box.ez } });
+		culler.Execute();
+
+		const auto frustum{ MakeReferenceFrustum(view, proj) };
+		auto hidden   { size_t{} };
+		auto compared { size_t{} };
+		for (auto i{ size_t{} }; i < boxes.size(); ++i)
+		{
+			const auto expect{ Reference(frustum, boxes[i]) };
+			if (expect == Expect::Ambiguous) continue;
+
+			++compared;
+			if (expect == Expect::Hidden) ++hidden;
+			ASSERT_EQ(culler.IsVisible(static_cast<uint32_t>(i)), expect == Expect::Visible) << "box " << i;
+		}
+
+		// ̔ЊĂȂƁǐʂ\Ɋ܂ށj
+		EXPECT_GT(compared, count * 9U / 10U);
+		EXPECT_GT(hidden, count / 10U);
+		EXPECT_LT(hidden, count * 9U / 10U);
+
+		EXPECT_EQ(culler.GetTestedCount(), count);
+		auto culled{ size_t{} };
+		for (auto i{ size_t{} }; i < boxes.size(); ++i) if (!culler.IsVisible(static_cast<uint32_t>(i))) ++culled;
+		EXPECT_EQ(culler.GetCulledCount(), culled);
+	}
+
+	DirectX::BoundingBox UnitBox(const float x, const float y, const float z)
+	{
+		return DirectX::BoundingBox{ { x, y, z }, { 0.5f, 0.5f, 0.5f } };
+	}
+}
+
+TEST(FlFrustumCuller, MatchesBoundingFrustum)
+{
+	// 4 ̔{łȂŃpfBÖm߂
+	ExpectMatchesReference(1001U, 1U);
+	ExpectMatchesReference(3U, 2U);
+}
+
+TEST(FlFrustumCuller, MatchesBoundingFrustumAcrossWorkerThreads)
+{
+	// ParallelThreshold 𒴂ă[J[֕錏
+	ExpectMatchesReference(50003U, 3U);
+}
+
+TEST(FlFrustumCuller, SkipAndDisableTreatEverythingAsVisible)
+{
+	auto& culler{ FlFrustumCuller::Instance() };
+
+	culler.SetIsEnable(false);
+	culler.Begin(MakeView(), MakeProjection());
+	const auto behind{ culler.AddBounds(UnitBox(0.0f, 0.0f, -100.0f)) };
+	culler.Execute();
+	EXPECT_TRUE(culler.IsVisible(behind));
+	EXPECT_TRUE(culler.IsEntityVisible(7U));
+	EXPECT_EQ(culler.GetNodeVisibility(7U), nullptr);
+
+	culler.SetIsEnable(true);
+	culler.Skip();
+	EXPECT_TRUE(culler.IsVisible(behind));
+	EXPECT_TRUE(culler.IsEntityVisible(7U));
+	EXPECT_EQ(culler.GetCulledCount(), Def::UIntZero);
+}
+
+TEST(FlFrustumCuller, ResolvesPerNodeAndPerEntityVisibility)
+{
+	auto& culler{ FlFrustumCuller::Instance() };
+	culler.SetIsEnable(true);
+
+	auto mesh{ std::make_shared<Mesh>() };
+
+	// m[h0: EAm[h1: J̌Am[h2: oEfBOiɕ`j
+	auto partly{ ModelData{} };
+	partly.WorkNodes().resize(3U);
+	for (auto i{ 0 }; i < 3; ++i)
+	{
+		auto& node{ partly.WorkNodes()[i] };
+		node.m_nodeIndex = i;
+		node.m_spMesh    = mesh;
+	}
+	partly.WorkNodes()[0].m_localAABB = UnitBox(3.0f, -2.0f, 20.0f);
+	partly.WorkNodes()[0].m_hasBounds = true;
+	partly.WorkNodes()[1].m_localAABB = UnitBox(3.0f, -2.0f, -40.0f);
+	partly.WorkNodes()[1].m_hasBounds = true;
+
+	// Sm[hJ̌
+	auto behind{ ModelData{} };
+	behind.WorkNodes().resize(1U);
+	behind.WorkNodes()[0].m_nodeIndex = 0;
+	behind.WorkNodes()[0].m_spMesh    = mesh;
+	behind.WorkNodes()[0].m_localAABB = UnitBox(0.0f, 0.0f, -50.0f);
+	behind.WorkNodes()[0].m_hasBounds = true;
+
+	// XLbV̓fŜ̔ SkinBoundsScale {Ĕ肷i[hsŎE̊Oցj
+	auto skinned{ ModelData{} };
+	skinned.SetIsSkinMesh(true);
+	skinned.SetBounds(UnitBox(0.0f, 0.0f, 0.0f));
+
+	culler.Begin(MakeView(), MakeProjection());
+	culler.AddModel(1U, partly,  Math::Matrix{});
+	culler.AddModel(2U, behind,  Math::Matrix{});
+	culler.AddModel(3U, skinned, Math::Matrix::CreateTranslation(3.0f, -2.0f, 30.0f));
+	culler.AddModel(4U, skinned, Math::Matrix::CreateTranslation(3.0f, -2.0f, -30.0f));
+	culler.Execute();
+
+	EXPECT_TRUE(culler.IsEntityVisible(1U));
+	const auto* pNodes{ culler.GetNodeVisibility(1U) };
+	ASSERT_NE(pNodes, nullptr);
+	EXPECT_NE(pNodes[0], 0U);
+	EXPECT_EQ(pNodes[1], 0U);
+	EXPECT_NE(pNodes[2], 0U);
+
+	EXPECT_FALSE(culler.IsEntityVisible(2U));
+	EXPECT_TRUE(culler.IsEntityVisible(3U));
+	EXPECT_FALSE(culler.IsEntityVisible(4U));
+	EXPECT_EQ(culler.GetNodeVisibility(3U), nullptr);
+
+	// o^ĂȂGeBeB͉
+	EXPECT_TRUE(culler.IsEntityVisible(99U));
+	EXPECT_EQ(culler.GetTestedCount(), 5U);
+	EXPECT_EQ(culler.GetCulledCount(), 3U);
+}
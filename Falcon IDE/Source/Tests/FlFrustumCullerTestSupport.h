@@ -0,0 +1,56 @@
+#pragma once
+#include "Framework/System/Multithread/FlMultithreadController.h"
+
+// FlFrustumCuller / FlOcclusionCuller QƂ ModelData ̑iGraphics/Model/Model.h  Direct3D Ɉ˂邽߁j
+struct MeshFace
+{
+	uint32_t Idx[3];
+};
+
+// ՕɎg CPU ̌`
+class Mesh
+{
+public:
+
+	void SetOccluderGeometry(std::vector<Math::Vector3>&& positions, std::vector<MeshFace>&& faces) noexcept
+	{
+		m_positions = std::move(positions);
+		m_faces     = std::move(faces);
+	}
+
+	const std::vector<Math::Vector3>& GetPositions() const noexcept { return m_positions; }
+	const std::vector<MeshFace>& GetFaces() const noexcept { return m_faces; }
+
+private:
+	std::vector<Math::Vector3> m_positions;
+	std::vector<MeshFace>      m_faces;
+};
+
+class ModelData
+{
+public:
+
+	struct Node
+	{
+		std::shared_ptr<Mesh> m_spMesh;
+		Math::Matrix          m_mLocal;
+		int32_t               m_nodeIndex = -Def::IntOne;
+		DirectX::BoundingBox  m_localAABB{};
+		bool                  m_hasBounds = false;
+	};
+
+	const std::vector<Node>& GetNodes() const noexcept { return m_nodes; }
+
+	auto& WorkNodes() noexcept { return m_nodes; }
+
+	inline const auto SetIsSkinMesh(const bool is) noexcept { m_isSkinMesh = is; }
+	inline const auto IsSkinMesh() const noexcept { return m_isSkinMesh; }
+
+	const DirectX::BoundingBox& GetBounds() const noexcept { return m_bounds; }
+	void SetBounds(const DirectX::BoundingBox& bounds) noexcept { m_bounds = bounds; }
+
+private:
+	std::vector<Node>    m_nodes;
+	DirectX::BoundingBox m_bounds{};
+	bool                 m_isSkinMesh = false;
+};
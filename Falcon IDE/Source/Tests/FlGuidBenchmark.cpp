@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+
+#include "Framework/System/GUID/FlGUID.h"
+
+namespace
+{
+	constexpr auto EntryCount{ 100000U };
+
+	template<class Fn>
+	double BestMs(Fn&& fn)
+	{
+		auto best{ std::numeric_limits<double>::max() };
+		for (auto round{ 0 }; round < 3; ++round)
+		{
+			const auto start{ std::chrono::steady_clock::now() };
+			fn();
+			best = std::min(best, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+		}
+		return best;
+	}
+}
+
+TEST(FlGuidBenchmark, NewGuid)
+{
+	constexpr auto count{ 1000000U };
+
+	// 蒼 (ݒς݂ GUID ւ NewGuid) ͒űL^̂ŁA񖢐ݒ肩
+	auto guid{ FlGuid::Nil() };
+	auto mixed{ uint64_t{} };
+	const auto newMs{ BestMs([&] {
+		for (auto i{ 0U }; i < count; ++i)
+		{
+			guid = FlGuid::Nil();
+			guid.NewGuid();
+			mixed ^= guid.GetLow();
+		}
+	}) };
+
+	auto text{ std::array<char, FlGuid::StringLength>{} };
+	const auto toCharsMs{ BestMs([&] {
+		for (auto i{ 0U }; i < count; ++i)
+		{
+			guid.ToChars(text.data());
+			mixed ^= static_cast<uint64_t>(text[i % FlGuid::StringLength]);
+		}
+	}) };
+
+	const auto newNs    { newMs * 1e6 / count };
+	const auto toCharsNs{ toCharsMs * 1e6 / count };
+	std::printf("[ BENCH ] FlGuid NewGuid %.1f ns, ToChars %.1f ns (checksum %llx)\n",
+		newNs, toCharsNs, static_cast<unsigned long long>(mixed));
+	::testing::Test::RecordProperty("new_guid_ns", std::to_string(newNs));
+	::testing::Test::RecordProperty("to_chars_ns", std::to_string(toCharsNs));
+
+	EXPECT_FALSE(guid.IsNil());
+}
+
+// 100k ̎ GUID ̒l̂܂܂ƕňׂiL[ƌȂL[𔼕j
+TEST(FlGuidBenchmark, HundredThousandEntryMap)
+{
+	auto guids{ std::vector<FlGuid>(EntryCount) };
+	auto byGuid  { std::unordered_map<FlGuid, uint32_t>{} };
+	auto byString{ std::unordered_map<std::string, uint32_t>{} };
+	byGuid.reserve(EntryCount);
+	byString.reserve(EntryCount);
+	for (auto i{ 0U }; i < EntryCount; ++i)
+	{
+		byGuid.emplace(guids[i], i);
+		byString.emplace(guids[i].ToString(), i);
+	}
+
+	auto keys{ std::vector<FlGuid>{} };
+	keys.reserve(EntryCount);
+	for (auto i{ 0U }; i < EntryCount; ++i) keys.push_back(i % 2U == 0U ? guids[(i * 7919U) % EntryCount] : FlGuid{});
+
+	auto stringKeys{ std::vector<std::string>{} };
+	stringKeys.reserve(EntryCount);
+	for (const auto& key : keys) stringKeys.push_back(key.ToString());
+
+	auto guidHits{ size_t{} };
+	const auto guidMs{ BestMs([&] {
+		guidHits = 0U;
+		for (const auto& key : keys) guidHits += byGuid.count(key);
+	}) };
+
+	auto stringHits{ size_t{} };
+	const auto stringMs{ BestMs([&] {
+		stringHits = 0U;
+		for (const auto& key : stringKeys) stringHits += byString.count(key);
+	}) };
+
+	EXPECT_EQ(guidHits, EntryCount / 2U);
+	EXPECT_EQ(stringHits, guidHits);
+
+	const auto guidNs  { guidMs * 1e6 / EntryCount };
+	const auto stringNs{ stringMs * 1e6 / EntryCount };
+	std::printf("[ BENCH ] FlGuid %u-entry unordered_map lookup: FlGuid %.1f ns, std::string %.1f ns (%.1fx)\n",
+		EntryCount, guidNs, stringNs, stringNs / guidNs);
+	::testing::Test::RecordProperty("map_guid_ns", std::to_string(guidNs));
+	::testing::Test::RecordProperty("map_string_ns", std::to_string(stringNs));
+
+	EXPECT_LT(guidNs, stringNs);
+}
@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+
+#include "Framework/Resource/Meta/FlGuidSearchIndex.h"
+
+namespace
+{
+	using Field = FlGuidSearchIndex::Field;
+
+	double ElapsedMs(const std::chrono::steady_clock::time_point start)
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	// gȂꍇ1񕪁iSs̏ƕvj
+	size_t LinearFilter(const std::vector<std::pair<FlGuid, std::string>>& entries, const std::string_view term)
+	{
+		auto matched{ size_t{} };
+		auto lower  { std::string{} };
+		for (const auto& [guid, path] : entries)
+		{
+			lower = guid.ToString() + " " + path;
+			for (auto& c : lower) c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+			if (lower.find(term) != std::string::npos) ++matched;
+		}
+		return matched;
+	}
+}
+
+// 100k GUID: ̍쐬AL[͒̌A̍Čit[j
+TEST(FlGuidSearchIndexBenchmark, HundredThousandGuids)
+{
+	constexpr auto entryCount{ 100000 };
+
+	auto rng{ std::mt19937{ 42U } };
+	auto entries{ std::vector<std::pair<FlGuid, std::string>>{} };
+	entries.reserve(entryCount);
+	for (auto i{ 0 }; i < entryCount; ++i)
+		entries.emplace_back(FlGuid{}, "Assets/Folder" + std::to_string(rng() % 500U) + "/Asset_" + std::to_string(i) + (i % 3 ? ".fbx" : ".png"));
+
+	auto start{ std::chrono::steady_clock::now() };
+	auto index{ FlGuidSearchIndex{} };
+	index.Build(entries, 1U);
+	const auto buildMs{ ElapsedMs(start) };
+
+	auto timeQuery{ [&](const std::string& filter, const Field field, size_t& rows) {
+		const auto begin{ std::chrono::steady_clock::now() };
+		rows = index.Query(filter, field).size();
+		return ElapsedMs(begin);
+	} };
+
+	auto selectiveRows{ size_t{} }, shortRows{ size_t{} }, excludeRows{ size_t{} };
+	const auto selectiveMs{ timeQuery("asset_4242", Field::Both, selectiveRows) };
+	const auto shortMs    { timeQuery("42", Field::Both, shortRows) };
+	const auto excludeMs  { timeQuery("-.png", Field::Path, excludeRows) };
+
+	// ςȂԂ͑ǑʂԂ
+	timeQuery("asset_4242", Field::Both, selectiveRows);
+	start = std::chrono::steady_clock::now();
+	for (auto frame{ 0 }; frame < 10000; ++frame) selectiveRows = index.Query("asset_4242", Field::Both).size();
+	const auto cachedUs{ ElapsedMs(start) * 1000.0 / 10000.0 };
+
+	start = std::chrono::steady_clock::now();
+	const auto linearRows{ LinearFilter(entries, "asset_4242") };
+	const auto linearMs{ ElapsedMs(start) };
+
+	EXPECT_EQ(selectiveRows, linearRows);
+	EXPECT_EQ(excludeRows, static_cast<size_t>(entryCount - (entryCount + 2) / 3));
+
+	std::printf("[ BENCH ] FlGuidSearchIndex %d guids: build %.1f ms, selective %.3f ms (%zu rows), 2-char %.2f ms (%zu rows), "
+		"exclude-only %.2f ms (%zu rows), cached %.3f us, linear filter %.1f ms\n",
+		entryCount, buildMs, selectiveMs, selectiveRows, shortMs, shortRows, excludeMs, excludeRows, cachedUs, linearMs);
+
+	::testing::Test::RecordProperty("build_ms", std::to_string(buildMs));
+	::testing::Test::RecordProperty("selective_ms", std::to_string(selectiveMs));
+	::testing::Test::RecordProperty("cached_us", std::to_string(cachedUs));
+	::testing::Test::RecordProperty("linear_ms", std::to_string(linearMs));
+}
@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+
+#include "Framework/Resource/Meta/FlGuidSearchIndex.h"
+
+namespace
+{
+	using Field   = FlGuidSearchIndex::Field;
+	using Entries = std::vector<std::pair<FlGuid, std::string>>;
+
+	std::string ToLower(std::string text)
+	{
+		for (auto& c : text) c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+		return text;
+	}
+
+	// ImGuiTextFilter ƓKőSŝ܂ܒׂ鐳
+	std::vector<uint32_t> NaiveQuery(const FlGuidSearchIndex& index, const std::string& filter, const Field field)
+	{
+		auto includes{ std::vector<std::string>{} };
+		auto excludes{ std::vector<std::string>{} };
+		auto stream  { std::stringstream{ ToLower(filter) } };
+		for (auto term{ std::string{} }; std::getline(stream, term, ',');)
+		{
+			term.erase(0, term.find_first_not_of(' '));
+			term.erase(term.find_last_not_of(' ') + 1);
+			if (term.empty()) continue;
+			if (term.front() != '-') includes.push_back(term);
+			else if (term.size() > 1) excludes.push_back(term.substr(1));
+		}
+
+		const auto contains{ [&](const uint32_t row, const std::string& term) {
+			if ((static_cast<uint8_t>(field) & static_cast<uint8_t>(Field::Guid)) && index.GetGuidString(row).find(term) != std::string::npos) return true;
+			return (static_cast<uint8_t>(field) & static_cast<uint8_t>(Field::Path)) && ToLower(index.GetPath(row)).find(term) != std::string::npos;
+		} };
+
+		auto rows{ std::vector<uint32_t>{} };
+		for (auto row{ uint32_t{} }; row < index.GetSize(); ++row)
+		{
+			if (std::ranges::any_of(excludes, [&](const auto& term) { return contains(row, term); })) continue;
+			if (includes.empty() || std::ranges::any_of(includes, [&](const auto& term) { return contains(row, term); })) rows.push_back(row);
+		}
+		return rows;
+	}
+
+	Entries MakeEntries(std::mt19937& rng, const size_t count)
+	{
+		static constexpr const char* Folders[]{ "Assets/Models/", "Assets/Textures/", "Scripts\\Player\\", "Audio/SE/", "Shaders/", "Assets/\x83\x65\x83\x58\x83\x67/" };
+		static constexpr const char* Stems  []{ "Player", "enemy_boss", "GROUND", "sky-box", "Tree.Oak", "rock", "\x89\xe6\x91\x9c" };
+		static constexpr const char* Exts   []{ ".fbx", ".png", ".cxx", ".wav", ".hlsl", ".flmeta" };
+
+		auto entries{ Entries{} };
+		for (auto i{ size_t{} }; i < count; ++i)
+		{
+			auto path{ std::string{ Folders[rng() % std::size(Folders)] } + Stems[rng() % std::size(Stems)] };
+			if (rng() % 2U) path += "_" + std::to_string(rng() % 1000U);
+			path += Exts[rng() % std::size(Exts)];
+			// pXɕʂ GUID tĂ邱Ƃ
+			entries.emplace_back(FlGuid{}, std::move(path));
+		}
+		return entries;
+	}
+
+	// ̈̕ꕔ啶Đ؂oƁAł߂Ȍ
+	std::string RandomTerm(std::mt19937& rng, const FlGuidSearchIndex& index)
+	{
+		if (rng() % 5U == 0U)
+		{
+			static constexpr const char* Noise[]{ "zz", "q", "_0", ".F", "/", "\x83\x65", "xyz123", "-" };
+			return Noise[rng() % std::size(Noise)];
+		}
+
+		const auto row   { static_cast<uint32_t>(rng() % index.GetSize()) };
+		const auto source{ rng() % 2U ? index.GetGuidString(row) : index.GetPath(row) };
+		const auto length{ std::min<size_t>(1U + rng() % 8U, source.size()) };
+		auto term{ source.substr(rng() % (source.size() - length + 1U), length) };
+		for (auto& c : term)
+			if (rng() % 2U) c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+		return term;
+	}
+}
+
+TEST(FlGuidSearchIndex, RowsAreSortedByPathAndQueriesFollowTheTextFilterSyntax)
+{
+	auto index{ FlGuidSearchIndex{} };
+	const auto guidA{ FlGuid{ 0x0123456789ABCDEFULL, 0x8000000000000001ULL } };
+	const auto guidB{ FlGuid{ 0x0FEDCBA987654321ULL, 0x8000000000000002ULL } };
+	const auto guidC{ FlGuid{ 0x1111111111111111ULL, 0x8000000000000003ULL } };
+	index.Build({ { guidC, "Textures/Sky.png" }, { guidA, "Models/Player.fbx" }, { guidB, "Models/Enemy.fbx" } }, 1U);
+
+	ASSERT_EQ(index.GetSize(), 3U);
+	EXPECT_EQ(index.GetPath(0), "Models/Enemy.fbx");
+	EXPECT_EQ(index.GetPath(1), "Models/Player.fbx");
+	EXPECT_EQ(index.GetGuidString(1), guidA.ToString());
+
+	EXPECT_EQ(index.Query("", Field::Both), (std::vector<uint32_t>{ 0, 1, 2 }));
+	EXPECT_EQ(index.Query("MODELS", Field::Path), (std::vector<uint32_t>{ 0, 1 }));
+	EXPECT_EQ(index.Query("models, sky", Field::Path), (std::vector<uint32_t>{ 0, 1, 2 }));
+	EXPECT_EQ(index.Query("models,-enemy", Field::Path), (std::vector<uint32_t>{ 1 }));
+	EXPECT_EQ(index.Query("-fbx", Field::Path), (std::vector<uint32_t>{ 2 }));
+	EXPECT_EQ(index.Query("89ab", Field::Guid), (std::vector<uint32_t>{ 1 }));
+	EXPECT_TRUE(index.Query("89ab", Field::Path).empty());
+	EXPECT_EQ(index.Query("1111", Field::Both), (std::vector<uint32_t>{ 2 }));
+}
+
+TEST(FlGuidSearchIndex, CachedResultIsReusedUntilFilterFieldOrVersionChanges)
+{
+	auto rng  { std::mt19937{ 42U } };
+	auto index{ FlGuidSearchIndex{} };
+	index.Build(MakeEntries(rng, 200U), 1U);
+
+	const auto* pFirst{ &index.Query("player", Field::Path) };
+	const auto  first { *pFirst };
+	EXPECT_EQ(&index.Query("player", Field::Path), pFirst);
+	EXPECT_EQ(index.Query("player", Field::Path), first);
+
+	EXPECT_NE(index.Query("player", Field::Guid), first);
+
+	// łς瓯ł蒼
+	index.Build({ { FlGuid{}, "Other/Player.fbx" } }, 2U);
+	EXPECT_EQ(index.GetVersion(), 2U);
+	EXPECT_EQ(index.Query("player", Field::Path), (std::vector<uint32_t>{ 0 }));
+}
+
+TEST(FlGuidSearchIndex, RandomQueriesMatchTheNaiveFilter)
+{
+	auto rng  { std::mt19937{ 42U } };
+	auto index{ FlGuidSearchIndex{} };
+	index.Build(MakeEntries(rng, 2000U), 1U);
+
+	for (auto round{ 0 }; round < 1000; ++round)
+	{
+		auto filter{ std::string{} };
+		const auto termCount{ 1U + rng() % 3U };
+		for (auto t{ 0U }; t < termCount; ++t)
+		{
+			if (t != 0U) filter += rng() % 2U ? "," : " , ";
+			if (rng() % 4U == 0U) filter += "-";
+			filter += RandomTerm(rng, index);
+		}
+
+		for (const auto field : { Field::Guid, Field::Path, Field::Both })
+			ASSERT_EQ(index.Query(filter, field), NaiveQuery(index, filter, field)) << "\"" << filter << "\" " << static_cast<int>(field);
+	}
+}
+
+TEST(FlGuidSearchIndex, EmptyIndexAndDegenerateFilters)
+{
+	auto index{ FlGuidSearchIndex{} };
+	index.Build({}, 1U);
+	EXPECT_TRUE(index.Query("", Field::Both).empty());
+	EXPECT_TRUE(index.Query("abc", Field::Both).empty());
+
+	index.Build({ { FlGuid{}, "a/b.txt" } }, 2U);
+	for (const auto* filter : { ",", " , ,", "-", " - ", "--", "-,-" })
+		EXPECT_EQ(index.Query(filter, Field::Both), NaiveQuery(index, filter, Field::Both)) << filter;
+}
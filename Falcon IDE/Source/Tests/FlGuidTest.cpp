@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+
+#include "Framework/System/GUID/FlGUID.h"
+
+namespace
+{
+	// RFC 4122 v4 ̔łƕώ
+	bool IsVersion4(const FlGuid& guid)
+	{
+		return ((guid.GetHigh() >> 12) & 0xF) == 4U && (guid.GetLow() >> 62) == 2U;
+	}
+
+	static_assert(FlGuid::Parse("00112233-4455-6677-8899-aabbccddeeff")->GetHigh() == 0x0011223344556677ULL);
+	static_assert(FlGuid::Parse("00112233-4455-6677-8899-aabbccddeeff")->GetLow()  == 0x8899AABBCCDDEEFFULL);
+}
+
+TEST(FlGuid, ManyThreadsNeverCollide)
+{
+	constexpr auto threadCount{ 8 };
+	constexpr auto perThread  { 100000 };
+
+	auto perThreadGuids{ std::vector<std::vector<FlGuid>>(threadCount) };
+	auto threads{ std::vector<std::thread>{} };
+	for (auto t{ 0 }; t < threadCount; ++t)
+	{
+		threads.emplace_back([&guids = perThreadGuids[t]] {
+			guids.reserve(perThread);
+			for (auto i{ 0 }; i < perThread; ++i) guids.emplace_back();
+		});
+	}
+	for (auto& thread : threads) thread.join();
+
+	auto unique{ std::unordered_set<FlGuid>{} };
+	unique.reserve(threadCount * perThread);
+	for (const auto& guids : perThreadGuids)
+	{
+		for (const auto& guid : guids)
+		{
+			ASSERT_TRUE(IsVersion4(guid)) << guid.ToString();
+			ASSERT_TRUE(unique.insert(guid).second) << guid.ToString();
+		}
+	}
+	EXPECT_EQ(unique.size(), static_cast<size_t>(threadCount * perThread));
+}
+
+TEST(FlGuid, StringRoundTripKeepsTheLegacyFormat)
+{
+	for (auto i{ 0 }; i < 10000; ++i)
+	{
+		const auto guid{ FlGuid{} };
+		const auto str { guid.ToString() };
+
+		ASSERT_EQ(str.size(), FlGuid::StringLength);
+		for (auto pos{ size_t{} }; pos < str.size(); ++pos)
+		{
+			if (pos == 8 || pos == 13 || pos == 18 || pos == 23) ASSERT_EQ(str[pos], '-') << str;
+			else ASSERT_TRUE(std::isxdigit(static_cast<unsigned char>(str[pos])) && !std::isupper(static_cast<unsigned char>(str[pos]))) << str;
+		}
+		EXPECT_EQ(str[14], '4') << str;
+
+		const auto parsed{ FlGuid::Parse(str) };
+		ASSERT_TRUE(parsed.has_value()) << str;
+		ASSERT_EQ(*parsed, guid);
+
+		auto other{ FlGuid::Nil() };
+		ASSERT_TRUE(other.FromString(str));
+		ASSERT_EQ(other, guid);
+	}
+}
+
+TEST(FlGuid, ParseAcceptsBracesUppercaseAndUndashed)
+{
+	const auto expected{ FlGuid{ 0x0123456789ABCDEFULL, 0xFEDCBA9876543210ULL } };
+	EXPECT_EQ(expected.ToString(), "01234567-89ab-cdef-fedc-ba9876543210");
+
+	for (const auto* str : {
+		"01234567-89ab-cdef-fedc-ba9876543210",
+		"01234567-89AB-CDEF-FEDC-BA9876543210",
+		"{01234567-89ab-cdef-fedc-ba9876543210}",
+		"0123456789abcdeffedcba9876543210" })
+	{
+		const auto parsed{ FlGuid::Parse(str) };
+		ASSERT_TRUE(parsed.has_value()) << str;
+		EXPECT_EQ(*parsed, expected) << str;
+	}
+
+	for (const auto* str : {
+		"",
+		"01234567-89ab-cdef-fedc-ba987654321",
+		"01234567-89ab-cdef-fedc-ba98765432100",
+		"01234567+89ab-cdef-fedc-ba9876543210",
+		"0123456789ab-cdef-fedc-ba9876543210-",
+		"01234567-89ab-cdef-fedc-ba987654321g",
+		"{01234567-89ab-cdef-fedc-ba9876543210",
+		"0123456789abcdeffedcba987654321z" })
+		EXPECT_FALSE(FlGuid::Parse(str).has_value()) << str;
+
+	EXPECT_TRUE(FlGuid::Parse("00000000-0000-0000-0000-000000000000")->IsNil());
+}
+
+TEST(FlGuid, RegeneratingRecordsTheReplacement)
+{
+	auto guid{ FlGuid{} };
+	const auto before{ guid };
+	guid.NewGuid();
+
+	EXPECT_NE(guid, before);
+	EXPECT_EQ(FlGuid::GetReplacedGuid(before), guid);
+	EXPECT_EQ(FlGuid::GetReplacedGuid(before.ToString()), guid.ToString());
+
+	// uĂȂ̂͂̂܂
+	EXPECT_EQ(FlGuid::GetReplacedGuid(guid), guid);
+	EXPECT_EQ(FlGuid::GetReplacedGuid(std::string{ "not a guid" }), "not a guid");
+}
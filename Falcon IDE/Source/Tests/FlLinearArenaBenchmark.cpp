@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+
+namespace
+{
+	double ElapsedNs(const std::chrono::steady_clock::time_point start)
+	{
+		return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	// 1t[̈ꎞf[^iUpdateAll ̃XibvEm[hsEO̕ɑj
+	template<class MakeVector, class CopyString>
+	uint64_t Frame(MakeVector&& makeVector, CopyString&& copyString)
+	{
+		auto sum{ uint64_t{} };
+		for (auto type{ 0U }; type < 32U; ++type)
+		{
+			auto entities{ makeVector() };
+			for (auto i{ 0U }; i < 64U; ++i) entities.push_back(uint64_t{ type } * i);
+			sum += entities.back() + copyString("ComponentTypeName").size();
+		}
+		return sum;
+	}
+
+	// t[ frameCount 񗬂ŗǂ1t[̎
+	template<class Fn>
+	double BestFrameNs(const uint32_t frameCount, Fn&& fn)
+	{
+		auto best{ std::numeric_limits<double>::max() };
+		for (auto round{ 0 }; round < 3; ++round)
+		{
+			const auto start{ std::chrono::steady_clock::now() };
+			for (auto frame{ 0U }; frame < frameCount; ++frame) fn();
+			best = std::min(best, ElapsedNs(start) / frameCount);
+		}
+		return best;
+	}
+}
+
+// ̃AP[^iq[vjƃt[A[iEXNb`ł̓ꎞf[^̑gݗ
+TEST(FlLinearArenaBenchmark, FrameTemporaries)
+{
+	constexpr auto frameCount{ 20000U };
+
+	auto sink{ uint64_t{} };
+	const auto heapNs{ BestFrameNs(frameCount, [&sink] {
+		sink += Frame(
+			[] { return std::vector<uint64_t>{}; },
+			[](const std::string_view str) { return std::string{ str }; });
+	}) };
+
+	auto& memory{ FlFrameMemory::Instance() };
+	auto& frameArena{ memory.WorkFrameArena() };
+	const auto frameNs{ BestFrameNs(frameCount, [&] {
+		memory.BeginFrame();
+		sink += Frame(
+			[&frameArena] { return FlArenaVector<uint64_t>{ FlArenaAllocator<uint64_t>{ frameArena } }; },
+			[&frameArena](const std::string_view str) { return frameArena.CopyString(str); });
+	}) };
+
+	const auto scratchNs{ BestFrameNs(frameCount, [&sink] {
+		auto scope{ FlScratchScope{} };
+		sink += Frame(
+			[&scope] { return scope.MakeVector<uint64_t>(); },
+			[&scope](const std::string_view str) { return scope.CopyString(str); });
+	}) };
+
+	std::printf("[ BENCH ] FlLinearArena 32x64 temporaries/frame: heap %.0f ns, frame arena %.0f ns (%.1fx), scratch %.0f ns (%.1fx)\n",
+		heapNs, frameNs, heapNs / frameNs, scratchNs, heapNs / scratchNs);
+	::testing::Test::RecordProperty("heap_ns", std::to_string(heapNs));
+	::testing::Test::RecordProperty("frame_arena_ns", std::to_string(frameNs));
+	::testing::Test::RecordProperty("scratch_ns", std::to_string(scratchNs));
+
+	EXPECT_GT(sink, 0U);
+	EXPECT_LT(frameNs, heapNs);
+	EXPECT_LT(scratchNs, heapNs);
+}
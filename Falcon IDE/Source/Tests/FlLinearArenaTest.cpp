@@ -0,0 +1,194 @@
+#include <gtest/gtest.h>
+
+#include "FlAllocationCounter.h"
+
+namespace
+{
+	// t[̈ꎞf[^ʂgi vectorEspanEEq̃XR[vj
+	uint64_t SimulateFrame(const uint32_t frame)
+	{
+		auto& frameArena{ FlFrameMemory::Instance().WorkFrameArena() };
+		auto nodes{ FlArenaVector<uint32_t>{ FlArenaAllocator<uint32_t>{ frameArena } } };
+		for (auto i{ 0U }; i < 200U + frame % 50U; ++i) nodes.push_back(i);
+
+		auto sum{ uint64_t{} };
+		{
+			auto scope{ FlScratchScope{} };
+			auto matrices{ scope.AllocateSpan<float>(64U) };
+			matrices[63] = static_cast<float>(frame);
+
+			auto names{ scope.MakeVector<std::string_view>() };
+			names.reserve(16U);
+			for (auto i{ 0U }; i < 16U; ++i) names.push_back(scope.CopyString("Transform"));
+			{
+				auto inner{ FlScratchScope{} };
+				auto snaps{ inner.MakeVector<uint64_t>() };
+				for (auto i{ 0U }; i < 100U; ++i) snaps.push_back(i * frame);
+				sum += snaps.back();
+			}
+			sum += names.size() + static_cast<uint64_t>(matrices[63]);
+		}
+		return sum + nodes.back();
+	}
+}
+
+TEST(FlLinearArena, SteadyStateFramesDoNotTouchTheHeap)
+{
+	auto& memory{ FlFrameMemory::Instance() };
+
+	// o^Ə͍̈ŏ̐t[ōς
+	for (auto frame{ 0U }; frame < 4U; ++frame)
+	{
+		memory.BeginFrame();
+		SimulateFrame(frame);
+	}
+
+	auto counter{ FlAllocationCounter::Scope{} };
+	auto sum{ uint64_t{} };
+	for (auto frame{ 0U }; frame < 1000U; ++frame)
+	{
+		memory.BeginFrame();
+		sum += SimulateFrame(frame);
+	}
+	EXPECT_EQ(counter.GetCount(), 0U);
+	EXPECT_GT(sum, 0U);
+}
+
+TEST(FlLinearArena, OverflowIsMergedAtResetAndDoesNotRecur)
+{
+	auto arena{ FlLinearArena{ 1024U } };
+	{
+		auto counter{ FlAllocationCounter::Scope{} };
+		for (auto i{ 0 }; i < 10; ++i) arena.Allocate(512U);
+		arena.Reset();
+		EXPECT_GT(counter.GetCount(), 0U);
+	}
+
+	const auto merged{ arena.GetStatistics() };
+	EXPECT_GT(merged.overflows, 0U);
+	EXPECT_GE(merged.capacity, 5120U);
+	EXPECT_EQ(merged.allocations, 10U);
+
+	// ܂Ƃߒ̓ʂ͈̎ꂸAq[vɂGȂ
+	auto counter{ FlAllocationCounter::Scope{} };
+	for (auto cycle{ 0 }; cycle < 100; ++cycle)
+	{
+		for (auto i{ 0 }; i < 10; ++i) arena.Allocate(512U);
+		arena.Reset();
+	}
+	EXPECT_EQ(counter.GetCount(), 0U);
+	EXPECT_EQ(arena.GetStatistics().overflows, merged.overflows);
+	EXPECT_EQ(arena.GetStatistics().capacity, merged.capacity);
+}
+
+TEST(FlLinearArena, AllocationsAreAligned)
+{
+	auto arena{ FlLinearArena{ 4096U } };
+	for (const auto alignment : { 1U, 2U, 4U, 8U, 16U, 64U, 256U })
+	{
+		arena.Allocate(3U, 1U);
+		const auto p{ reinterpret_cast<uintptr_t>(arena.Allocate(24U, alignment)) };
+		EXPECT_EQ(p % alignment, 0U) << alignment;
+	}
+
+	// đł
+	const auto p{ reinterpret_cast<uintptr_t>(arena.Allocate(8192U, 128U)) };
+	EXPECT_EQ(p % 128U, 0U);
+}
+
+TEST(FlLinearArena, RewindReusesTheSameMemory)
+{
+	auto arena{ FlLinearArena{ 4096U } };
+	arena.Allocate(100U);
+	const auto marker{ arena.GetMarker() };
+	const auto used  { arena.GetUsed() };
+
+	const auto pFirst{ arena.Allocate(64U) };
+	arena.Allocate(64U);
+	arena.Rewind(marker);
+	EXPECT_EQ(arena.GetUsed(), used);
+	EXPECT_EQ(arena.Allocate(64U), pFirst);
+
+	// ꂽ悩߂Ẳ̈ʒu֖߂
+	arena.Rewind(marker);
+	arena.Allocate(8192U);
+	arena.Rewind(marker);
+	EXPECT_EQ(arena.GetUsed(), used);
+	EXPECT_EQ(arena.Allocate(64U), pFirst);
+}
+
+TEST(FlLinearArena, StatisticsArePublishedAtReset)
+{
+	auto arena{ FlLinearArena{ 4096U } };
+	arena.Allocate(1000U, 1U);
+	const auto marker{ arena.GetMarker() };
+	arena.Allocate(2000U, 1U);
+	arena.Rewind(marker);
+	arena.Allocate(10U, 1U);
+
+	// Reset ܂ł͑O̎̒l̂܂
+	EXPECT_EQ(arena.GetStatistics().lastPeak, 0U);
+	arena.Reset();
+
+	const auto first{ arena.GetStatistics() };
+	EXPECT_EQ(first.lastPeak, 3000U);
+	EXPECT_EQ(first.highWater, 3000U);
+	EXPECT_EQ(first.allocations, 3U);
+	EXPECT_EQ(first.capacity, 4096U);
+	EXPECT_EQ(first.overflows, 0U);
+
+	arena.Allocate(100U, 1U);
+	arena.Reset();
+	const auto second{ arena.GetStatistics() };
+	EXPECT_EQ(second.lastPeak, 100U);
+	EXPECT_EQ(second.highWater, 3000U);
+	EXPECT_EQ(second.allocations, 1U);
+}
+
+TEST(FlLinearArena, DeallocateOnlyUndoesTheTopAllocation)
+{
+	auto arena{ FlLinearArena{ 4096U } };
+	const auto pFirst { arena.Allocate(32U, 1U) };
+	const auto pSecond{ arena.Allocate(32U, 1U) };
+
+	arena.Deallocate(pFirst, 32U);
+	EXPECT_EQ(arena.GetUsed(), 64U);
+
+	arena.Deallocate(pSecond, 32U);
+	EXPECT_EQ(arena.GetUsed(), 32U);
+	EXPECT_EQ(arena.Allocate(32U, 1U), pSecond);
+
+	// vector ̐LŎ̂ĂÂ̈ Reset ܂ŎciŏIeʂ2{j
+	arena.Reset();
+	auto values{ FlArenaVector<uint8_t>{ FlArenaAllocator<uint8_t>{ arena } } };
+	for (auto i{ 0 }; i < 1000; ++i) values.push_back(static_cast<uint8_t>(i));
+	EXPECT_LT(arena.GetUsed(), 2048U + 1024U);
+}
+
+TEST(FlLinearArena, ScratchOfAFinishedThreadIsReused)
+{
+	auto& memory{ FlFrameMemory::Instance() };
+	const auto countScratches{ [&memory] {
+		auto count{ 0U };
+		memory.ForEachStatistics([&count](const char* name, const FlLinearArena::Statistics&) {
+			if (std::string_view{ name }.starts_with("Scratch")) ++count;
+		});
+		return count;
+	} };
+
+	auto pFirst{ static_cast<FlLinearArena*>(nullptr) };
+	std::thread{ [&pFirst] { pFirst = &FlFrameMemory::WorkScratchArena(); } }.join();
+	const auto before{ countScratches() };
+
+	for (auto i{ 0 }; i < 8; ++i)
+	{
+		auto pArena{ static_cast<FlLinearArena*>(nullptr) };
+		std::thread{ [&pArena] {
+			auto scope{ FlScratchScope{} };
+			scope.AllocateSpan<uint32_t>(16U);
+			pArena = &scope.WorkArena();
+		} }.join();
+		EXPECT_EQ(pArena, pFirst) << i;
+	}
+	EXPECT_EQ(countScratches(), before);
+}
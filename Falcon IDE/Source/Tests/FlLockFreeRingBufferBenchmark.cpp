@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+
+#include "Framework/System/Multithread/FlLockFreeRingBuffer.hpp"
+
+namespace
+{
+	struct Entry
+	{
+		uint32_t	thread{};
+		uint64_t	value{};
+		const char* pFormat{};
+	};
+
+	// O̐Y producerCount { UI Xbh̏1{ł̉ throughput
+	void RunThroughput(const uint32_t producerCount, const uint64_t perProducer)
+	{
+		auto upBuffer{ std::make_unique<FlLockFreeRingBuffer<Entry, 65536U>>() };
+		auto& buffer{ *upBuffer };
+
+		auto isDone{ std::atomic<bool>{ false } };
+		auto popped{ uint64_t{} };
+
+		auto consumer{ std::thread{ [&] {
+			auto entry{ Entry{} };
+			for (;;)
+			{
+				if (buffer.TryPop(entry)) ++popped;
+				else if (isDone.load(std::memory_order_acquire))
+				{
+					while (buffer.TryPop(entry)) ++popped;
+					break;
+				}
+			}
+		} } };
+
+		const auto start{ std::chrono::steady_clock::now() };
+		auto producers{ std::vector<std::thread>{} };
+		for (auto p{ 0U }; p < producerCount; ++p)
+		{
+			producers.emplace_back([&buffer, p, perProducer] {
+				for (auto i{ uint64_t{} }; i < perProducer; ++i) buffer.TryPush(Entry{ p, i, "%llu" });
+			});
+		}
+		for (auto& producer : producers) producer.join();
+		const auto elapsed{ std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() };
+
+		isDone.store(true, std::memory_order_release);
+		consumer.join();
+
+		const auto total{ producerCount * perProducer };
+		std::printf("[ BENCH ] FlLockFreeRingBuffer %u producers: %.1f ms, %.2f M push/s, popped %llu, dropped %zu\n",
+			producerCount, elapsed, static_cast<double>(total) / elapsed * 1e-3,
+			static_cast<unsigned long long>(popped), buffer.GetDroppedCount());
+
+		EXPECT_EQ(popped + buffer.GetDroppedCount(), total);
+	}
+}
+
+TEST(FlLockFreeRingBufferBenchmark, OneProducer)
+{
+	RunThroughput(1U, 2000000U);
+}
+
+TEST(FlLockFreeRingBufferBenchmark, EightProducers)
+{
+	RunThroughput(8U, 500000U);
+}
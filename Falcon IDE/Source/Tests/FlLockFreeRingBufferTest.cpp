@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include "Framework/System/Multithread/FlLockFreeRingBuffer.hpp"
+
+namespace
+{
+	struct Record
+	{
+		uint32_t				 producer{};
+		uint64_t				 sequence{};
+		std::unique_ptr<uint64_t> upPayload;	// [û݂̌^łȂ
+	};
+
+	// Y producerCount { perProducer ݁A1{o
+	struct StressResult
+	{
+		uint64_t popped{};
+		size_t	 dropped{};
+		bool	 isOrdered{ true };
+		bool	 isPayloadIntact{ true };
+	};
+
+	template<size_t Capacity>
+	StressResult RunStress(const uint32_t producerCount, const uint64_t perProducer)
+	{
+		auto upBuffer{ std::make_unique<FlLockFreeRingBuffer<Record, Capacity>>() };
+		auto& buffer{ *upBuffer };
+
+		auto result	 { StressResult{} };
+		auto isDone	 { std::atomic<bool>{ false } };
+		auto nextSeq { std::vector<uint64_t>(producerCount, 0U) };
+
+		auto consume{ [&](Record& record) {
+			if (record.sequence < nextSeq[record.producer]) result.isOrdered = false;
+			nextSeq[record.producer] = record.sequence + 1U;
+			if (!record.upPayload || *record.upPayload != (uint64_t{ record.producer } << 32U | record.sequence))
+				result.isPayloadIntact = false;
+			++result.popped;
+		} };
+
+		auto consumer{ std::thread{ [&] {
+			auto record{ Record{} };
+			for (;;)
+			{
+				if (buffer.TryPop(record)) consume(record);
+				else if (isDone.load(std::memory_order_acquire))
+				{
+					while (buffer.TryPop(record)) consume(record);
+					break;
+				}
+			}
+		} } };
+
+		auto producers{ std::vector<std::thread>{} };
+		for (auto p{ 0U }; p < producerCount; ++p)
+		{
+			producers.emplace_back([&buffer, p, perProducer] {
+				for (auto i{ uint64_t{} }; i < perProducer; ++i)
+					buffer.TryPush(Record{ p, i, std::make_unique<uint64_t>(uint64_t{ p } << 32U | i) });
+			});
+		}
+		for (auto& producer : producers) producer.join();
+		isDone.store(true, std::memory_order_release);
+		consumer.join();
+
+		result.dropped = buffer.GetDroppedCount();
+		return result;
+	}
+}
+
+TEST(FlLockFreeRingBuffer, SingleThreadFifoAndFullDrop)
+{
+	auto buffer{ FlLockFreeRingBuffer<int, 4U>{} };
+	for (auto i{ 0 }; i < 4; ++i) EXPECT_TRUE(buffer.TryPush(int{ i }));
+	EXPECT_FALSE(buffer.TryPush(99));
+	EXPECT_EQ(buffer.GetDroppedCount(), 1U);
+
+	auto value{ 0 };
+	for (auto i{ 0 }; i < 4; ++i)
+	{
+		ASSERT_TRUE(buffer.TryPop(value));
+		EXPECT_EQ(value, i);
+	}
+	EXPECT_FALSE(buffer.TryPop(value));
+
+	// Ăۂ
+	for (auto i{ 0 }; i < 1000; ++i)
+	{
+		ASSERT_TRUE(buffer.TryPush(int{ i }));
+		ASSERT_TRUE(buffer.TryPop(value));
+		EXPECT_EQ(value, i);
+	}
+}
+
+TEST(FlLockFreeRingBuffer, StressManyProducersNothingLostOrReordered)
+{
+	constexpr auto producerCount{ 8U };
+	constexpr auto perProducer	{ uint64_t{ 200000U } };
+
+	// eʂŖtp
+	const auto result{ RunStress<1024U>(producerCount, perProducer) };
+
+	EXPECT_TRUE(result.isOrdered);
+	EXPECT_TRUE(result.isPayloadIntact);
+	EXPECT_EQ(result.popped + result.dropped, producerCount * perProducer);
+	EXPECT_GT(result.popped, 0U);
+}
+
+TEST(FlLockFreeRingBuffer, StressLargeCapacityKeepsEverything)
+{
+	constexpr auto producerCount{ 4U };
+	constexpr auto perProducer	{ uint64_t{ 16384U } };
+
+	// SeʂȂ҂xĂjȂ
+	const auto result{ RunStress<65536U>(producerCount, perProducer) };
+
+	EXPECT_TRUE(result.isOrdered);
+	EXPECT_TRUE(result.isPayloadIntact);
+	EXPECT_EQ(result.dropped, 0U);
+	EXPECT_EQ(result.popped, producerCount * perProducer);
+}
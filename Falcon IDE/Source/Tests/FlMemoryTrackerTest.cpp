@@ -0,0 +1,218 @@
+#include <gtest/gtest.h>
+
+namespace
+{
+	// ̃eXg̉e󂯂Ȃ悤Av͍Ō
+	struct Delta
+	{
+		int64_t  current{};
+		size_t   peak{};
+		uint64_t allocations{};
+		uint64_t frees{};
+	};
+
+	class TagWatch
+	{
+	public:
+
+		explicit TagWatch(const FlMemoryTag tag)
+			: m_tag   { tag }
+			, m_before{ FlMemoryTracker::Instance().GetStatistics(tag) }
+		{}
+
+		Delta Get() const
+		{
+			const auto after{ FlMemoryTracker::Instance().GetStatistics(m_tag) };
+			return {
+				static_cast<int64_t>(after.current) - static_cast<int64_t>(m_before.current),
+				after.peak,
+				after.allocations - m_before.allocations,
+				after.frees - m_before.frees,
+			};
+		}
+
+		size_t GetBaseline() const noexcept { return m_before.current; }
+
+	private:
+
+		FlMemoryTag                    m_tag;
+		FlMemoryTracker::TagStatistics m_before;
+	};
+}
+
+TEST(FlMemoryTracker, TrackedContainersCountBytesAndCalls)
+{
+	auto& tracker{ FlMemoryTracker::Instance() };
+	tracker.ResetPeaks();
+	const auto watch{ TagWatch{ FlMemoryTag::Guid } };
+	{
+		auto values{ FlTrackedVector<uint64_t, FlMemoryTag::Guid>{} };
+		values.reserve(100U);
+		EXPECT_EQ(watch.Get().current, 800);
+		EXPECT_EQ(watch.Get().allocations, 1U);
+
+		values.reserve(1000U);
+		const auto grown{ watch.Get() };
+		EXPECT_EQ(grown.current, 8000);
+		EXPECT_EQ(grown.allocations, 2U);
+		EXPECT_EQ(grown.frees, 1U);
+
+		// L̈u͐V̗Ă
+		EXPECT_EQ(grown.peak, watch.GetBaseline() + 8800U);
+
+		auto map{ FlTrackedUnorderedMap<uint32_t, uint32_t, FlMemoryTag::Guid>{} };
+		for (auto i{ 0U }; i < 100U; ++i) map.emplace(i, i);
+		EXPECT_GT(watch.Get().current, 8000);
+	}
+
+	const auto released{ watch.Get() };
+	EXPECT_EQ(released.current, 0);
+	EXPECT_EQ(released.allocations, released.frees);
+	EXPECT_GE(released.peak, watch.GetBaseline() + 8800U);
+
+	// s[N݂͌̎gpʂ܂Ŗ߂
+	tracker.ResetPeaks();
+	EXPECT_EQ(tracker.GetStatistics(FlMemoryTag::Guid).peak, watch.GetBaseline());
+}
+
+TEST(FlMemoryTracker, ConcurrentRecordsBalanceAndKeepTheHighestPeak)
+{
+	constexpr auto threadCount{ 8U };
+	constexpr auto perThread  { 20000U };
+
+	auto& tracker{ FlMemoryTracker::Instance() };
+	tracker.ResetPeaks();
+	const auto watch{ TagWatch{ FlMemoryTag::Mesh } };
+
+	// eXbh 1..64 oCgςݏグĂSĖ߂
+	auto threads{ std::vector<std::thread>{} };
+	for (auto t{ 0U }; t < threadCount; ++t)
+	{
+		threads.emplace_back([] {
+			for (auto i{ 0U }; i < perThread; ++i) FlMemoryTracker::Record(FlMemoryTag::Mesh, i % 64U + 1U);
+			for (auto i{ 0U }; i < perThread; ++i) FlMemoryTracker::Release(FlMemoryTag::Mesh, i % 64U + 1U);
+		});
+	}
+	for (auto& thread : threads) thread.join();
+
+	auto perThreadBytes{ size_t{} };
+	for (auto i{ 0U }; i < perThread; ++i) perThreadBytes += i % 64U + 1U;
+
+	const auto delta{ watch.Get() };
+	EXPECT_EQ(delta.current, 0);
+	EXPECT_EQ(delta.allocations, uint64_t{ threadCount } * perThread);
+	EXPECT_EQ(delta.frees, uint64_t{ threadCount } * perThread);
+	EXPECT_GE(delta.peak, watch.GetBaseline() + perThreadBytes);
+	EXPECT_LE(delta.peak, watch.GetBaseline() + perThreadBytes * threadCount);
+}
+
+TEST(FlMemoryTracker, ChargesFollowSetAddCopyAndMove)
+{
+	const auto watch{ TagWatch{ FlMemoryTag::Resource } };
+	{
+		auto charge{ FlMemoryCharge{ FlMemoryTag::Resource, 100U } };
+		EXPECT_EQ(watch.Get().current, 100);
+
+		charge.Add(50U);
+		charge.Set(120U);
+		EXPECT_EQ(watch.Get().current, 120);
+		EXPECT_EQ(charge.GetBytes(), 120U);
+
+		const auto copy{ charge };
+		EXPECT_EQ(watch.Get().current, 240);
+
+		// ړ͐Ȃ
+		auto moved{ std::move(charge) };
+		EXPECT_EQ(watch.Get().current, 240);
+		EXPECT_EQ(charge.GetBytes(), 0U);
+		EXPECT_EQ(moved.GetBytes(), 120U);
+
+		moved = copy;
+		EXPECT_EQ(watch.Get().current, 240);
+	}
+	EXPECT_EQ(watch.Get().current, 0);
+}
+
+TEST(FlMemoryTracker, BudgetIsReportedWhenExceeded)
+{
+	auto& tracker{ FlMemoryTracker::Instance() };
+	const auto baseline{ tracker.GetStatistics(FlMemoryTag::BinaryCache).current };
+	tracker.SetBudget(FlMemoryTag::BinaryCache, baseline + 1000U);
+	{
+		auto charge{ FlMemoryCharge{ FlMemoryTag::BinaryCache, 1000U } };
+		EXPECT_FALSE(tracker.GetStatistics(FlMemoryTag::BinaryCache).IsOverBudget());
+
+		charge.Add(1U);
+		EXPECT_TRUE(tracker.GetStatistics(FlMemoryTag::BinaryCache).IsOverBudget());
+		EXPECT_TRUE(tracker.ToJson()["tags"]["BinaryCache"]["overBudget"].get<bool>());
+	}
+	EXPECT_FALSE(tracker.GetStatistics(FlMemoryTag::BinaryCache).IsOverBudget());
+
+	tracker.SetBudget(FlMemoryTag::BinaryCache, 0U);
+}
+
+TEST(FlMemoryTracker, JsonDumpMatchesTheStatistics)
+{
+	auto& tracker{ FlMemoryTracker::Instance() };
+	auto charge{ FlMemoryCharge{ FlMemoryTag::Log, 4096U } };
+
+	const auto path{ std::filesystem::temp_directory_path() / "FlMemoryTrackerTest" / "memory.json" };
+	std::filesystem::remove_all(path.parent_path());
+	ASSERT_TRUE(tracker.DumpJson(path));
+
+	auto ifs{ std::ifstream{ path } };
+	const nlohmann::json root = nlohmann::json::parse(ifs);
+	EXPECT_TRUE(root["enabled"].get<bool>());
+	EXPECT_FALSE(root.contains("allocations"));
+
+	ASSERT_EQ(root["tags"].size(), FlMemoryTracker::TagCount);
+	for (auto i{ size_t{} }; i < FlMemoryTracker::TagCount; ++i)
+	{
+		const auto name { FlMemoryTracker::TagNames[i] };
+		const auto stats{ tracker.GetStatistics(static_cast<FlMemoryTag>(i)) };
+		const auto& tag { root["tags"][name] };
+		EXPECT_EQ(tag["current"].get<size_t>(), stats.current) << name;
+		EXPECT_EQ(tag["peak"].get<size_t>(), stats.peak) << name;
+		EXPECT_EQ(tag["allocations"].get<uint64_t>(), stats.allocations) << name;
+		EXPECT_EQ(tag["frees"].get<uint64_t>(), stats.frees) << name;
+		EXPECT_EQ(tag["budget"].get<size_t>(), stats.budget) << name;
+	}
+	EXPECT_GE(root["tags"]["Log"]["current"].get<size_t>(), 4096U);
+
+	ifs.close();
+	std::filesystem::remove_all(path.parent_path());
+}
+
+TEST(FlMemoryTracker, CapturedAllocationsAreDumpedUntilFreed)
+{
+	auto& tracker{ FlMemoryTracker::Instance() };
+	tracker.SetCaptureCallstacks(true);
+
+	auto upValues{ std::make_unique<FlTrackedVector<uint32_t, FlMemoryTag::EditHistory>>(300U) };
+
+	// |C^̖\͈ꗗɏoȂ
+	auto charge{ FlMemoryCharge{ FlMemoryTag::EditHistory, 77U } };
+
+	tracker.SetCaptureCallstacks(false);
+	EXPECT_FALSE(tracker.IsCapturingCallstacks());
+
+	// L^~߂̊mۂ͊oȂ
+	auto later{ FlTrackedVector<uint32_t, FlMemoryTag::EditHistory>(10U) };
+
+	const nlohmann::json root = tracker.ToJson(true);
+	ASSERT_TRUE(root.contains("allocations"));
+	ASSERT_EQ(root["allocations"].size(), 1U);
+
+	const auto& group{ root["allocations"][0] };
+	EXPECT_EQ(group["tag"].get<std::string>(), "EditHistory");
+	EXPECT_EQ(group["bytes"].get<size_t>(), 1200U);
+	EXPECT_EQ(group["count"].get<size_t>(), 1U);
+#ifdef __linux__
+	EXPECT_FALSE(group["frames"].empty());
+#endif // __linux__
+
+	// L^~߂łňꗗ
+	upValues.reset();
+	EXPECT_TRUE(tracker.CollectLiveAllocations().empty());
+	EXPECT_TRUE(tracker.ToJson(true)["allocations"].empty());
+}
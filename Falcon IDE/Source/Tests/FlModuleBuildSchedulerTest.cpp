@@ -0,0 +1,236 @@
+#include <gtest/gtest.h>
+
+#include "Framework/System/VisualStudioManager/FlModuleBuildScheduler.h"
+
+namespace
+{
+	using Scheduler = FlModuleBuildScheduler;
+	using BuildState = Scheduler::BuildState;
+	using Sources = std::vector<std::string>;
+
+	constexpr auto QuietTime{ std::chrono::milliseconds{ 300 } };
+
+	// p Runnerirh͌ʂ߂܂ Running ̂܂܁j
+	class FakeRunner
+	{
+	public:
+
+		struct Build
+		{
+			std::string module;
+			Sources     sources;
+			BuildState  state = BuildState::Running;
+			bool        isCancelled = false;
+		};
+
+		Scheduler::Runner Make()
+		{
+			return {
+				[this](const std::string& module, const Sources& sources) -> Scheduler::Ticket
+				{
+					if (m_isRefusing) return 0U;
+					m_builds.push_back({ module, sources });
+					return m_builds.size();
+				},
+				[this](const Scheduler::Ticket ticket) { m_builds[ticket - 1U].isCancelled = true; },
+				[this](const Scheduler::Ticket ticket) { return m_builds[ticket - 1U].state; } };
+		}
+
+		void Finish(const size_t index, const bool isSucceeded) { m_builds[index].state = isSucceeded ? BuildState::Succeeded : BuildState::Failed; }
+		void SetRefusing(const bool isRefusing) noexcept { m_isRefusing = isRefusing; }
+		const std::vector<Build>& GetBuilds() const noexcept { return m_builds; }
+
+	private:
+		std::vector<Build> m_builds;
+		bool               m_isRefusing = false;
+	};
+
+	class FlModuleBuildSchedulerTest : public ::testing::Test
+	{
+	protected:
+
+		Scheduler::TimePoint At(const int ms) const { return m_origin + std::chrono::milliseconds{ ms }; }
+
+		FakeRunner           m_runner;
+		Scheduler            m_scheduler{ m_runner.Make(), QuietTime };
+		Scheduler::TimePoint m_origin{ std::chrono::seconds{ 10 } };
+	};
+}
+
+TEST_F(FlModuleBuildSchedulerTest, ChangesInTheQuietTimeBecomeOneDeduplicatedBuild)
+{
+	m_scheduler.Enqueue("Player", "Player/b.cxx", At(0));
+	m_scheduler.Enqueue("Player", "Player/a.cxx", At(100));
+	m_scheduler.Enqueue("Player", "Player/b.cxx", At(200));
+	m_scheduler.Enqueue("Enemy", "Enemy/e.cxx", At(250));
+
+	// Ō̕ύX 300ms o܂Ŏn߂Ȃ
+	EXPECT_TRUE(m_scheduler.Update(At(450)).empty());
+	EXPECT_TRUE(m_runner.GetBuilds().empty());
+
+	m_scheduler.Update(At(500));
+	ASSERT_EQ(m_runner.GetBuilds().size(), 1U);
+	EXPECT_EQ(m_runner.GetBuilds()[0].module, "Player");
+	EXPECT_EQ(m_runner.GetBuilds()[0].sources, (Sources{ "Player/a.cxx", "Player/b.cxx" }));
+	EXPECT_TRUE(m_scheduler.IsBuilding("Player"));
+	EXPECT_FALSE(m_scheduler.IsBuilding("Enemy"));
+
+	m_scheduler.Update(At(550));
+	ASSERT_EQ(m_runner.GetBuilds().size(), 2U);
+	EXPECT_EQ(m_runner.GetBuilds()[1].module, "Enemy");
+
+	m_runner.Finish(0, true);
+	m_runner.Finish(1, true);
+	const auto completed{ m_scheduler.Update(At(600)) };
+	ASSERT_EQ(completed.size(), 2U);
+	EXPECT_TRUE(completed[0].isSucceeded && completed[1].isSucceeded);
+	EXPECT_TRUE(m_scheduler.IsIdle());
+	EXPECT_EQ(m_scheduler.GetStatistics().requested, 4U);
+	EXPECT_EQ(m_scheduler.GetStatistics().started, 2U);
+}
+
+TEST_F(FlModuleBuildSchedulerTest, ChangeDuringABuildCancelsItAndMergesItsSources)
+{
+	m_scheduler.Enqueue("Player", "Player/a.cxx", At(0));
+	m_scheduler.Update(At(300));
+	ASSERT_EQ(m_runner.GetBuilds().size(), 1U);
+
+	m_scheduler.Enqueue("Player", "Player/b.cxx", At(400));
+	EXPECT_TRUE(m_runner.GetBuilds()[0].isCancelled);
+	EXPECT_FALSE(m_scheduler.IsBuilding("Player"));
+
+	// rȟʂ͕ԂȂ
+	m_runner.Finish(0, true);
+	EXPECT_TRUE(m_scheduler.Update(At(500)).empty());
+
+	m_scheduler.Update(At(700));
+	ASSERT_EQ(m_runner.GetBuilds().size(), 2U);
+	EXPECT_EQ(m_runner.GetBuilds()[1].sources, (Sources{ "Player/a.cxx", "Player/b.cxx" }));
+	EXPECT_EQ(m_scheduler.GetStatistics().cancelled, 1U);
+}
+
+TEST_F(FlModuleBuildSchedulerTest, FailedSourcesAreRebuiltWithTheNextChange)
+{
+	m_scheduler.Enqueue("Player", "Player/a.cxx", At(0));
+	m_scheduler.Update(At(300));
+	m_runner.Finish(0, false);
+
+	const auto completed{ m_scheduler.Update(At(400)) };
+	ASSERT_EQ(completed.size(), 1U);
+	EXPECT_FALSE(completed[0].isSucceeded);
+	EXPECT_EQ(completed[0].sources, (Sources{ "Player/a.cxx" }));
+
+	// sĂɍărh͂Ȃi܂œsJԂj
+	EXPECT_TRUE(m_scheduler.IsIdle());
+	EXPECT_TRUE(m_scheduler.Update(At(5000)).empty());
+	EXPECT_EQ(m_runner.GetBuilds().size(), 1U);
+	ASSERT_EQ(m_scheduler.GetFailedSources().count("Player"), 1U);
+	EXPECT_EQ(m_scheduler.GetFailedSources().at("Player").count("Player/a.cxx"), 1U);
+
+	// ʂ̃W[̕ύXɂ͍Ȃ
+	m_scheduler.Enqueue("Enemy", "Enemy/e.cxx", At(5000));
+	m_scheduler.Update(At(5300));
+	EXPECT_EQ(m_runner.GetBuilds()[1].sources, (Sources{ "Enemy/e.cxx" }));
+
+	// W[̕ʂ̃\[XςAs\[Xꏏ
+	m_scheduler.Enqueue("Player", "Player/b.cxx", At(6000));
+	m_scheduler.Update(At(6300));
+	ASSERT_EQ(m_runner.GetBuilds().size(), 3U);
+	EXPECT_EQ(m_runner.GetBuilds()[2].sources, (Sources{ "Player/a.cxx", "Player/b.cxx" }));
+	EXPECT_TRUE(m_scheduler.GetFailedSources().empty());
+
+	m_runner.Finish(1, true);
+	m_runner.Finish(2, true);
+	const auto rebuilt{ m_scheduler.Update(At(6400)) };
+	ASSERT_EQ(rebuilt.size(), 2U);
+	EXPECT_TRUE(rebuilt[0].isSucceeded && rebuilt[1].isSucceeded);
+	EXPECT_TRUE(m_scheduler.GetFailedSources().empty());
+}
+
+TEST_F(FlModuleBuildSchedulerTest, BuildsThatCannotStartAreKeptAsFailed)
+{
+	m_runner.SetRefusing(true);
+	m_scheduler.Enqueue("Player", "Player/a.cxx", At(0));
+
+	const auto completed{ m_scheduler.Update(At(300)) };
+	ASSERT_EQ(completed.size(), 1U);
+	EXPECT_FALSE(completed[0].isSucceeded);
+	EXPECT_EQ(m_scheduler.GetStatistics().started, 0U);
+	EXPECT_EQ(m_scheduler.GetFailedSources().at("Player").size(), 1U);
+
+	m_runner.SetRefusing(false);
+	m_scheduler.Enqueue("Player", "Player/b.cxx", At(1000));
+	m_scheduler.Update(At(1300));
+	ASSERT_EQ(m_runner.GetBuilds().size(), 1U);
+	EXPECT_EQ(m_runner.GetBuilds()[0].sources, (Sources{ "Player/a.cxx", "Player/b.cxx" }));
+}
+
+TEST_F(FlModuleBuildSchedulerTest, CancelAllStopsRunningBuildsAndKeepsFailures)
+{
+	m_scheduler.Enqueue("Enemy", "Enemy/e.cxx", At(0));
+	m_scheduler.Update(At(300));
+	m_runner.Finish(0, false);
+	m_scheduler.Update(At(400));
+
+	m_scheduler.Enqueue("Player", "Player/a.cxx", At(400));
+	m_scheduler.Update(At(700));
+	ASSERT_TRUE(m_scheduler.IsBuilding("Player"));
+
+	m_scheduler.CancelAll();
+	EXPECT_TRUE(m_runner.GetBuilds()[1].isCancelled);
+	EXPECT_TRUE(m_scheduler.IsIdle());
+	EXPECT_EQ(m_scheduler.GetFailedSources().count("Enemy"), 1U);
+}
+
+TEST_F(FlModuleBuildSchedulerTest, RandomizedScheduleNeverLosesAChangedSource)
+{
+	// ύXꂽ\[X́urhɊ܂܂ꂽvusƂĎcĂv̂ǂ炩
+	auto rng{ std::mt19937{ 41U } };
+	auto built{ std::set<std::string>{} };
+	auto changed{ std::set<std::string>{} };
+
+	auto now{ 0 };
+	for (auto step{ 0 }; step < 5000; ++step)
+	{
+		now += std::uniform_int_distribution<int>{ 0, 200 }(rng);
+		switch (std::uniform_int_distribution<int>{ 0, 3 }(rng))
+		{
+		case 0:
+		{
+			const auto module{ std::string{ "M" } + std::to_string(rng() % 3U) };
+			const auto source{ module + "/" + std::to_string(rng() % 5U) + ".cxx" };
+			changed.insert(source);
+			built.erase(source);
+			m_scheduler.Enqueue(module, source, At(now));
+			break;
+		}
+		case 1:
+			for (auto i{ size_t{} }; i < m_runner.GetBuilds().size(); ++i)
+				if (m_runner.GetBuilds()[i].state == BuildState::Running && rng() % 2U == 0U) m_runner.Finish(i, rng() % 4U != 0U);
+			break;
+		default:
+			for (const auto& completed : m_scheduler.Update(At(now)))
+				if (completed.isSucceeded) built.insert(completed.sources.begin(), completed.sources.end());
+			break;
+		}
+	}
+
+	// ŌɑSė؂
+	for (auto round{ 0 }; round < 4; ++round)
+	{
+		now += 1000;
+		for (auto i{ size_t{} }; i < m_runner.GetBuilds().size(); ++i)
+			if (m_runner.GetBuilds()[i].state == BuildState::Running) m_runner.Finish(i, true);
+		for (const auto& completed : m_scheduler.Update(At(now)))
+			if (completed.isSucceeded) built.insert(completed.sources.begin(), completed.sources.end());
+	}
+	EXPECT_TRUE(m_scheduler.IsIdle());
+
+	for (const auto& source : changed)
+	{
+		const auto module{ source.substr(0, source.find('/')) };
+		const auto failed{ m_scheduler.GetFailedSources().find(module) };
+		const auto isFailed{ failed != m_scheduler.GetFailedSources().end() && failed->second.count(source) != 0U };
+		EXPECT_TRUE(built.count(source) != 0U || isFailed) << source;
+	}
+}
@@ -0,0 +1,205 @@
+#include <gtest/gtest.h>
+
+#include "Framework/Graphics/Culling/FlOcclusionCuller.h"
+
+namespace
+{
+	constexpr float Near{ 0.5f };
+	constexpr float Far { 500.0f };
+
+	// D3D ̍neisxNgKA0 <= z <= wjBJ͌_ +Z 
+	Math::Matrix MakeProjection()
+	{
+		const auto yScale{ 1.0f / std::tan(0.5f * 1.0471976f) }; // c 60 x
+		const auto xScale{ yScale / (16.0f / 9.0f) };
+		const auto range { Far / (Far - Near) };
+		return Math::Matrix{
+			xScale, 0.0f,   0.0f,          0.0f,
+			0.0f,   yScale, 0.0f,          0.0f,
+			0.0f,   0.0f,   range,         1.0f,
+			0.0f,   0.0f,   -Near * range, 0.0f };
+	}
+
+	// 4 _̎lp`i2 Op`j1m[hɎf
+	ModelData MakeQuad(const Math::Vector3& p0, const Math::Vector3& p1, const Math::Vector3& p2, const Math::Vector3& p3)
+	{
+		auto mesh{ std::make_shared<Mesh>() };
+		mesh->SetOccluderGeometry({ p0, p1, p2, p3 }, { MeshFace{ { 0U, 1U, 2U } }, MeshFace{ { 0U, 2U, 3U } } });
+
+		auto model{ ModelData{} };
+		model.WorkNodes().resize(1U);
+		model.WorkNodes()[0].m_nodeIndex = 0;
+		model.WorkNodes()[0].m_spMesh    = mesh;
+		return model;
+	}
+
+	// z ̈ʒuɗ x,y ɕsȕ
+	ModelData MakeWall(const float minX, const float maxX, const float minY, const float maxY, const float z)
+	{
+		return MakeQuad({ minX, minY, z }, { minX, maxY, z }, { maxX, maxY, z }, { maxX, minY, z });
+	}
+
+	DirectX::BoundingBox MakeBox(const float x, const float y, const float z, const float ex, const float ey, const float ez)
+	{
+		return DirectX::BoundingBox{ { x, y, z }, { ex, ey, ez } };
+	}
+
+	class FlOcclusionCullerTest : public ::testing::Test
+	{
+	protected:
+
+		void SetUp() override { Culler().SetIsEnable(true); }
+
+		static FlOcclusionCuller& Culler() { return FlOcclusionCuller::Instance(); }
+
+		// ǂՕɓo^ boxes 𔻒肷
+		static void Run(const ModelData& occluder, const std::vector<DirectX::BoundingBox>& boxes)
+		{
+			auto& culler{ Culler() };
+			culler.Begin(Math::Matrix{}, MakeProjection());
+			culler.AddOccluder(occluder, Math::Matrix{});
+			for (auto i{ size_t{} }; i < boxes.size(); ++i) culler.AddOccludee(static_cast<uint32_t>(i), boxes[i]);
+			culler.Execute();
+		}
+	};
+}
+
+TEST_F(FlOcclusionCullerTest, WallHidesBoxesBehindIt)
+{
+	// z = 20  10x10 ̕ǁiʏ |x/z|, |y/z| <= 0.25j
+	Run(MakeWall(-5.0f, 5.0f, -5.0f, 5.0f, 20.0f), {
+		MakeBox(0.0f, 0.0f, 40.0f, 1.0f, 1.0f, 1.0f),   // 0: ^
+		MakeBox(2.0f, -2.0f, 60.0f, 2.0f, 2.0f, 2.0f),  // 1: ̌
+		MakeBox(0.0f, 0.0f, 10.0f, 1.0f, 1.0f, 1.0f),   // 2: O
+		MakeBox(20.0f, 0.0f, 40.0f, 1.0f, 1.0f, 1.0f),  // 3: ǂ̉
+	});
+
+	auto& culler{ Culler() };
+	EXPECT_GT(culler.GetTriangleCount(), 0U);
+	EXPECT_FALSE(culler.IsEntityVisible(0U));
+	EXPECT_FALSE(culler.IsEntityVisible(1U));
+	EXPECT_TRUE(culler.IsEntityVisible(2U));
+	EXPECT_TRUE(culler.IsEntityVisible(3U));
+	EXPECT_EQ(culler.GetTestedCount(), 4U);
+	EXPECT_EQ(culler.GetCulledCount(), 2U);
+
+	// o^ĂȂGeBeB͉
+	EXPECT_TRUE(culler.IsEntityVisible(99U));
+}
+
+TEST_F(FlOcclusionCullerTest, PartiallyVisibleBoxesStayVisible)
+{
+	Run(MakeWall(-5.0f, 5.0f, -5.0f, 5.0f, 20.0f), {
+		MakeBox(10.0f, 0.0f, 40.0f, 4.0f, 1.0f, 1.0f),  // 0: E[ǂ̊Oւ͂ݏoix/z: 0.15 ` 0.36j
+		MakeBox(0.0f, 10.0f, 40.0f, 1.0f, 4.0f, 1.0f),  // 1: [͂ݏo
+		MakeBox(0.0f, 0.0f, 20.0f, 1.0f, 1.0f, 3.0f),   // 2: ǂтĎOɏoĂ
+		MakeBox(6.0f, 0.0f, 40.0f, 1.0f, 1.0f, 1.0f),   // 3: rpix/z: 0.12 ` 0.18 ŉBj
+	});
+
+	auto& culler{ Culler() };
+	EXPECT_TRUE(culler.IsEntityVisible(0U));
+	EXPECT_TRUE(culler.IsEntityVisible(1U));
+	EXPECT_TRUE(culler.IsEntityVisible(2U));
+	EXPECT_FALSE(culler.IsEntityVisible(3U));
+	EXPECT_EQ(culler.GetCulledCount(), 1U);
+}
+
+TEST_F(FlOcclusionCullerTest, NearPlaneBoxesAndOccludersAreNotTrusted)
+{
+	// jAʂׂEJ͔̌̔łȂ̂ŉ
+	Run(MakeWall(-5.0f, 5.0f, -5.0f, 5.0f, 20.0f), {
+		MakeBox(0.0f, 0.0f, 0.4f, 0.5f, 0.5f, 0.5f),
+		MakeBox(0.0f, 0.0f, -10.0f, 1.0f, 1.0f, 1.0f),
+	});
+	EXPECT_TRUE(Culler().IsEntityVisible(0U));
+	EXPECT_TRUE(Culler().IsEntityVisible(1U));
+	EXPECT_EQ(Culler().GetCulledCount(), 0U);
+
+	// jAʂׂՕ͎̂Ă̂ŁǍ̔BȂ
+	Run(MakeQuad({ -5.0f, -5.0f, -1.0f }, { -5.0f, 5.0f, -1.0f }, { 5.0f, 5.0f, 20.0f }, { 5.0f, -5.0f, 20.0f }), {
+		MakeBox(1.0f, 0.0f, 40.0f, 1.0f, 1.0f, 1.0f),
+	});
+	EXPECT_EQ(Culler().GetTriangleCount(), 0U);
+	EXPECT_TRUE(Culler().IsEntityVisible(0U));
+}
+
+TEST_F(FlOcclusionCullerTest, SkipAndDisableTreatEverythingAsVisible)
+{
+	auto& culler{ Culler() };
+	const auto wall  { MakeWall(-5.0f, 5.0f, -5.0f, 5.0f, 20.0f) };
+	const auto behind{ MakeBox(0.0f, 0.0f, 40.0f, 1.0f, 1.0f, 1.0f) };
+
+	culler.SetIsEnable(false);
+	Run(wall, { behind });
+	EXPECT_TRUE(culler.IsEntityVisible(0U));
+
+	culler.SetIsEnable(true);
+	Run(wall, { behind });
+	EXPECT_FALSE(culler.IsEntityVisible(0U));
+	culler.Skip();
+	EXPECT_TRUE(culler.IsEntityVisible(0U));
+	EXPECT_EQ(culler.GetCulledCount(), 0U);
+}
+
+// ʂ̍ǂǂ 10k ̔BmɉBE锠m߁AJOƎԂo
+TEST_F(FlOcclusionCullerTest, SyntheticSceneReportsCulledRatioAndCost)
+{
+	constexpr auto boxCount{ 10000U };
+	constexpr auto margin  { 0.06f }; // ǂ̉ (x/z = 0) ̗]Ti̋`4sNZPʂɍLĒׂ̂8sNZj
+
+	// z = 50  x <= 0 cςɕiʏ x/z <= 0A|y/z| <= 0.8j
+	const auto wall{ MakeWall(-60.0f, 0.0f, -40.0f, 40.0f, 50.0f) };
+
+	auto rng   { std::mt19937{ 27U } };
+	auto depth { std::uniform_real_distribution<float>{ 60.0f, 200.0f } };
+	auto slopeX{ std::uniform_real_distribution<float>{ -0.9f, 0.9f } };
+	auto slopeY{ std::uniform_real_distribution<float>{ -0.45f, 0.45f } };
+	auto extent{ std::uniform_real_distribution<float>{ 0.5f, 3.0f } };
+
+	auto boxes{ std::vector<DirectX::BoundingBox>(boxCount) };
+	for (auto& box : boxes)
+	{
+		const auto z{ depth(rng) };
+		box = MakeBox(slopeX(rng) * z, slopeY(rng) * z, z, extent(rng), extent(rng), extent(rng));
+	}
+
+	auto best{ std::numeric_limits<float>::max() };
+	for (auto frame{ 0 }; frame < 20; ++frame)
+	{
+		Run(wall, boxes);
+		best = std::min(best, Culler().GetCostMilliseconds());
+	}
+
+	auto& culler{ Culler() };
+	auto sureHidden{ size_t{} }, sureVisible{ size_t{} };
+	for (auto i{ size_t{} }; i < boxes.size(); ++i)
+	{
+		const auto& box{ boxes[i] };
+		const auto nearZ{ box.Center.z - box.Extents.z };
+		const auto right{ std::max((box.Center.x + box.Extents.x) / nearZ, (box.Center.x + box.Extents.x) / (box.Center.z + box.Extents.z)) };
+		const auto left { std::min((box.Center.x - box.Extents.x) / nearZ, (box.Center.x - box.Extents.x) / (box.Center.z + box.Extents.z)) };
+
+		if (right < -margin)
+		{
+			++sureHidden;
+			ASSERT_FALSE(culler.IsEntityVisible(static_cast<uint32_t>(i))) << "box " << i;
+		}
+		else if (left > margin)
+		{
+			++sureVisible;
+			ASSERT_TRUE(culler.IsEntityVisible(static_cast<uint32_t>(i))) << "box " << i;
+		}
+	}
+
+	EXPECT_EQ(culler.GetTestedCount(), boxCount);
+	EXPECT_GT(sureHidden, boxCount / 4U);
+	EXPECT_GT(sureVisible, boxCount / 4U);
+	EXPECT_GE(culler.GetCulledCount(), sureHidden);
+	EXPECT_LE(culler.GetCulledCount(), boxCount - sureVisible);
+
+	const auto culledPercent{ 100.0 * culler.GetCulledCount() / boxCount };
+	std::printf("[ BENCH ] FlOcclusionCuller %u boxes, %u triangles: culled %.1f%%, best %.3f ms/frame\n",
+		boxCount, static_cast<unsigned>(culler.GetTriangleCount()), culledPercent, static_cast<double>(best));
+	::testing::Test::RecordProperty("culled_percent", std::to_string(culledPercent));
+	::testing::Test::RecordProperty("ms_per_frame", std::to_string(best));
+}
@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+
+#include "Core/FlEntityComponentSystemKernel.h"
+#include "Core/FlPrefabCache.h"
+#include "Framework/Module/RuntimeModule/ResistCamera.h"
+#include "Framework/Module/RuntimeModule/ResistModelRender.h"
+#include "Framework/Module/RuntimeModule/ResistCollision.h"
+#include "Framework/Module/RuntimeModule/Transform.h"
+
+// `E蔻̃R|[lg DirectX Ɉˑ̂ŃeXgł͓o^Ȃ
+ResistCamera::ResistCamera() {}
+ResistModelRender::ResistModelRender() {}
+ResistCollision::ResistCollision() {}
+
+namespace
+{
+	namespace fs = std::filesystem;
+
+	constexpr auto ChildCount{ 4U };
+
+	struct HealthComponent
+	{
+		int   hp    = 100;
+		float speed = 1.5f;
+	};
+
+	void RegisterHealth()
+	{
+		auto reflection{ ComponentReflection{} };
+		reflection.Create      = []() -> void* { return new HealthComponent{}; };
+		reflection.Destroy     = [](void* p) { delete static_cast<HealthComponent*>(p); };
+		reflection.Copy        = [](void* p) -> void* { return new HealthComponent{ *static_cast<HealthComponent*>(p) }; };
+		reflection.Serialize   = [](void* p, nlohmann::json& json) { json["hp"] = static_cast<HealthComponent*>(p)->hp; json["speed"] = static_cast<HealthComponent*>(p)->speed; };
+		reflection.Deserialize = [](void* p, const nlohmann::json& json) { json.at("hp").get_to(static_cast<HealthComponent*>(p)->hp); json.at("speed").get_to(static_cast<HealthComponent*>(p)->speed); };
+		FlEntityComponentSystemKernel::Instance().RegisterModule("Health", reflection);
+	}
+
+	// [g (Health t)  ChildCount ̎q̃vnu
+	void WritePrefab(const fs::path& path)
+	{
+		auto& kernel{ FlEntityComponentSystemKernel::Instance() };
+		const auto root{ kernel.CreateEntity() };
+		kernel.AddComponent("Health", root);
+
+		nlohmann::json prefab;
+		prefab["Root"] = root;
+		for (auto c{ 0U }; c < ChildCount; ++c)
+		{
+			const auto child{ kernel.CreateEntity() };
+			static_cast<TransformComponent*>(kernel.GetComponent("Transform", root))->m_children.push_back(child);
+			static_cast<TransformComponent*>(kernel.GetComponent("Transform", child))->m_parent = root;
+		}
+		prefab["Entities"][std::to_string(root)] = kernel.SerializeEntity(root);
+		for (const auto child : static_cast<TransformComponent*>(kernel.GetComponent("Transform", root))->m_children)
+			prefab["Entities"][std::to_string(child)] = kernel.SerializeEntity(child);
+
+		ASSERT_TRUE(FlJsonUtility::Serialize(prefab, path));
+		kernel.AllDestroyEntities();
+	}
+
+	// ȑO InstantiatePrefab ƓA1ƂɃt@Cǂ DeserializeScene Œu
+	void InstantiatePerCopy(const fs::path& path)
+	{
+		nlohmann::json prefab;
+		ASSERT_TRUE(FlJsonUtility::Deserialize(prefab, path));
+
+		auto remap{ std::unordered_map<entityId, entityId>{} };
+		auto& kernel{ FlEntityComponentSystemKernel::Instance() };
+		kernel.DeserializeScene(prefab, &remap);
+		if (auto* pTransform{ static_cast<TransformComponent*>(kernel.GetComponent("Transform", remap[prefab["Root"].get<entityId>()])) })
+			pTransform->m_parent = UINT32_MAX;
+	}
+
+	double ElapsedMs(const std::chrono::steady_clock::time_point start)
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	// count 1ƈꊇŒuA1% ɍtV[̕ۑEǂݍ݁iCX^X̌ђ݁j
+	void Compare(const uint32_t count)
+	{
+		auto& kernel{ FlEntityComponentSystemKernel::Instance() };
+		auto& cache { FlPrefabCache::Instance() };
+		kernel.initialize();
+		RegisterHealth();
+		kernel.AllDestroyEntities();
+		cache.Clear();
+
+		const auto dir{ fs::temp_directory_path() / "FlPrefabCacheBenchmark" };
+		fs::remove_all(dir);
+		fs::create_directories(dir);
+		const auto path{ dir / "Enemy.flprefab" };
+		WritePrefab(path);
+
+		auto start{ std::chrono::steady_clock::now() };
+		for (auto i{ 0U }; i < count; ++i) InstantiatePerCopy(path);
+		const auto perCopyMs{ ElapsedMs(start) };
+		EXPECT_EQ(kernel.GetActiveIdCount(), count * (ChildCount + 1U));
+		kernel.AllDestroyEntities();
+
+		start = std::chrono::steady_clock::now();
+		const auto roots{ cache.Instantiate(path, count) };
+		const auto cachedMs{ ElapsedMs(start) };
+		ASSERT_EQ(roots.size(), count);
+		EXPECT_EQ(kernel.GetActiveIdCount(), count * (ChildCount + 1U));
+
+		for (auto i{ 0U }; i < count; i += 100U)
+			static_cast<HealthComponent*>(kernel.GetComponent("Health", roots[i]))->hp = static_cast<int>(i) + 1;
+
+		start = std::chrono::steady_clock::now();
+		const nlohmann::json scene = kernel.SerializeScene();
+		const auto saveMs{ ElapsedMs(start) };
+		ASSERT_EQ(scene["Prefabs"].size(), count);
+
+		kernel.AllDestroyEntities();
+		start = std::chrono::steady_clock::now();
+		kernel.DeserializeScene(scene);
+		const auto loadMs{ ElapsedMs(start) };
+		EXPECT_EQ(kernel.GetActiveIdCount(), count * (ChildCount + 1U));
+
+		auto linked{ 0U }, overridden{ 0U };
+		for (const auto id : kernel.GetAllEntityIds())
+		{
+			if (cache.GetSourcePath(id).empty()) continue;
+			++linked;
+			if (!cache.CollectOverrides(id).empty()) ++overridden;
+		}
+		EXPECT_EQ(linked, count);
+		EXPECT_EQ(overridden, count / 100U);
+
+		std::printf("[ BENCH ] FlPrefabCache %u copies x %u entities: per-copy %.1f ms, cached %.1f ms (%.0fx), scene save %.1f ms, load + relink %.1f ms\n",
+			count, ChildCount + 1U, perCopyMs, cachedMs, perCopyMs / cachedMs, saveMs, loadMs);
+		const auto suffix{ "_" + std::to_string(count) };
+		::testing::Test::RecordProperty("per_copy_ms" + suffix, std::to_string(perCopyMs));
+		::testing::Test::RecordProperty("cached_ms" + suffix, std::to_string(cachedMs));
+		::testing::Test::RecordProperty("save_ms" + suffix, std::to_string(saveMs));
+		::testing::Test::RecordProperty("load_ms" + suffix, std::to_string(loadMs));
+
+		EXPECT_LT(cachedMs * 3.0, perCopyMs);
+
+		kernel.AllDestroyEntities();
+		cache.Clear();
+		fs::remove_all(dir);
+	}
+}
+
+TEST(FlPrefabCacheBenchmark, OneThousandCopies)
+{
+	Compare(1000U);
+}
+
+TEST(FlPrefabCacheBenchmark, TenThousandCopies)
+{
+	Compare(10000U);
+}
@@ -0,0 +1,334 @@
+#include <gtest/gtest.h>
+
+#include "Core/FlEntityComponentSystemKernel.h"
+#include "Core/FlPrefabCache.h"
+#include "Framework/Module/RuntimeModule/ResistCamera.h"
+#include "Framework/Module/RuntimeModule/ResistModelRender.h"
+#include "Framework/Module/RuntimeModule/ResistCollision.h"
+#include "Framework/Module/RuntimeModule/Transform.h"
+
+// `E蔻̃R|[lg DirectX Ɉˑ̂ŃeXgł͓o^Ȃ
+ResistCamera::ResistCamera() {}
+ResistModelRender::ResistModelRender() {}
+ResistCollision::ResistCollision() {}
+
+namespace
+{
+	namespace fs = std::filesystem;
+
+	// vnũ[gɕt^iCopy ̂Ő`畡j
+	struct HealthComponent
+	{
+		int   hp    = 0;
+		float speed = 0.0f;
+	};
+
+	// CX^Xɂ^iCopy j
+	struct MarkerComponent
+	{
+		int value = 0;
+	};
+
+	void RegisterTestTypes()
+	{
+		auto& kernel{ FlEntityComponentSystemKernel::Instance() };
+		{
+			auto reflection{ ComponentReflection{} };
+			reflection.Create      = []() -> void* { return new HealthComponent{}; };
+			reflection.Destroy     = [](void* p) { delete static_cast<HealthComponent*>(p); };
+			reflection.Copy        = [](void* p) -> void* { return new HealthComponent{ *static_cast<HealthComponent*>(p) }; };
+			reflection.Serialize   = [](void* p, nlohmann::json& json) { json["hp"] = static_cast<HealthComponent*>(p)->hp; json["speed"] = static_cast<HealthComponent*>(p)->speed; };
+			reflection.Deserialize = [](void* p, const nlohmann::json& json) { json.at("hp").get_to(static_cast<HealthComponent*>(p)->hp); json.at("speed").get_to(static_cast<HealthComponent*>(p)->speed); };
+			kernel.RegisterModule("Health", reflection);
+		}
+		{
+			auto reflection{ ComponentReflection{} };
+			reflection.Create      = []() -> void* { return new MarkerComponent{}; };
+			reflection.Destroy     = [](void* p) { delete static_cast<MarkerComponent*>(p); };
+			reflection.Serialize   = [](void* p, nlohmann::json& json) { json["value"] = static_cast<MarkerComponent*>(p)->value; };
+			reflection.Deserialize = [](void* p, const nlohmann::json& json) { json.at("value").get_to(static_cast<MarkerComponent*>(p)->value); };
+			kernel.RegisterModule("Marker", reflection);
+		}
+	}
+
+	class FlPrefabCacheTest : public ::testing::Test
+	{
+	protected:
+
+		static void SetUpTestSuite()
+		{
+			Kernel().initialize();
+			RegisterTestTypes();
+		}
+
+		void SetUp() override
+		{
+			Cache().Clear();
+			Kernel().AllDestroyEntities();
+
+			m_dir = fs::temp_directory_path() / "FlPrefabCacheTest";
+			fs::remove_all(m_dir);
+			fs::create_directories(m_dir);
+			m_path = m_dir / "Enemy.flprefab";
+			WritePrefab(m_path, 100, 1.5f);
+		}
+
+		void TearDown() override
+		{
+			Cache().Clear();
+			Kernel().AllDestroyEntities();
+			fs::remove_all(m_dir);
+		}
+
+		static FlEntityComponentSystemKernel& Kernel() { return FlEntityComponentSystemKernel::Instance(); }
+
+		static FlPrefabCache& Cache() { return FlPrefabCache::Instance(); }
+
+		static TransformComponent* TransformOf(const entityId id)
+		{
+			return static_cast<TransformComponent*>(Kernel().GetComponent("Transform", id));
+		}
+
+		static HealthComponent* HealthOf(const entityId id)
+		{
+			return static_cast<HealthComponent*>(Kernel().GetComponent("Health", id));
+		}
+
+		// [g (Health t) Ǝq1̃vnuAGfB^ CreatePrefab Ɠ`ŏo
+		static void WritePrefab(const fs::path& path, const int hp, const float speed)
+		{
+			auto& kernel{ Kernel() };
+			const auto root { kernel.CreateEntity() };
+			const auto child{ kernel.CreateEntity() };
+			TransformOf(root)->m_children.push_back(child);
+			TransformOf(child)->m_parent = root;
+			TransformOf(child)->m_transform->SetLocalPosition({ 0.0f, 2.0f, 0.0f });
+			*static_cast<HealthComponent*>(kernel.AddComponent("Health", root)) = HealthComponent{ hp, speed };
+
+			nlohmann::json prefab;
+			prefab["Root"] = root;
+			for (const auto id : { root, child })
+				prefab["Entities"][std::to_string(id)] = kernel.SerializeEntity(id);
+			ASSERT_TRUE(FlJsonUtility::Serialize(prefab, path));
+
+			kernel.DestroyEntity(child);
+			kernel.DestroyEntity(root);
+		}
+
+		// CX^X̎qivnu̎q1j
+		static entityId ChildOf(const entityId root)
+		{
+			const auto* pTransform{ TransformOf(root) };
+			return pTransform && pTransform->m_children.size() == 1U ? pTransform->m_children[0] : InvalidEntityId;
+		}
+
+		// SCX^Xɍt: 0 ڂ hp ςA1 ڂ͎q Marker 𑫂 Health O
+		static void EditInstances(const std::vector<entityId>& roots)
+		{
+			HealthOf(roots[0])->hp = 42;
+			static_cast<MarkerComponent*>(Kernel().AddComponent("Marker", ChildOf(roots[1])))->value = 7;
+			Kernel().RemoveComponent("Health", roots[1]);
+		}
+
+		// ǂݍ݌̃[g[gm̕сiHealth ̗LƎq MarkerjŌ
+		static void ExpectEditedInstances(const std::vector<entityId>& roots, const float speed)
+		{
+			ASSERT_EQ(roots.size(), 2U);
+			for (const auto root : roots)
+			{
+				EXPECT_EQ(Cache().GetSourcePath(root), m_path);
+				ASSERT_NE(ChildOf(root), InvalidEntityId);
+				EXPECT_EQ(TransformOf(ChildOf(root))->m_parent, root);
+			}
+
+			ASSERT_NE(HealthOf(roots[0]), nullptr);
+			EXPECT_EQ(HealthOf(roots[0])->hp, 42);
+			EXPECT_FLOAT_EQ(HealthOf(roots[0])->speed, speed);
+			EXPECT_FALSE(Kernel().HasComponent("Marker", ChildOf(roots[0])));
+
+			EXPECT_EQ(HealthOf(roots[1]), nullptr);
+			ASSERT_TRUE(Kernel().HasComponent("Marker", ChildOf(roots[1])));
+			EXPECT_EQ(static_cast<MarkerComponent*>(Kernel().GetComponent("Marker", ChildOf(roots[1])))->value, 7);
+		}
+
+		// e̖GeBeB̂ Health ̂ɂiۑO roots Ɠсj
+		static std::vector<entityId> LoadedRoots()
+		{
+			auto roots{ std::vector<entityId>{} };
+			for (const auto id : Kernel().GetAllEntityIds())
+				if (TransformOf(id) && TransformOf(id)->m_parent == UINT32_MAX) roots.push_back(id);
+			std::ranges::stable_partition(roots, [](const entityId id) { return HealthOf(id) != nullptr; });
+			return roots;
+		}
+
+		static inline fs::path m_dir;
+		static inline fs::path m_path;
+	};
+}
+
+TEST_F(FlPrefabCacheTest, InstantiateRemapsTheHierarchyPerInstance)
+{
+	const auto roots{ Cache().Instantiate(m_path, 3U) };
+	ASSERT_EQ(roots.size(), 3U);
+	EXPECT_EQ(Kernel().GetActiveIdCount(), 6U);
+
+	auto children{ std::set<entityId>{} };
+	for (const auto root : roots)
+	{
+		EXPECT_EQ(Cache().GetSourcePath(root), m_path);
+		EXPECT_EQ(TransformOf(root)->m_parent, UINT32_MAX);
+
+		const auto child{ ChildOf(root) };
+		ASSERT_NE(child, InvalidEntityId);
+		EXPECT_TRUE(Kernel().IsActive(child));
+		EXPECT_EQ(TransformOf(child)->m_parent, root);
+		EXPECT_FLOAT_EQ(TransformOf(child)->m_transform->GetLocalPosition().y, 2.0f);
+		children.insert(child);
+
+		ASSERT_NE(HealthOf(root), nullptr);
+		EXPECT_EQ(HealthOf(root)->hp, 100);
+		EXPECT_EQ(HealthOf(child), nullptr);
+
+		// `ƓȂ獷͖
+		EXPECT_TRUE(Cache().CollectOverrides(root).empty());
+	}
+	EXPECT_EQ(children.size(), 3U);
+
+	// ͕ʁX̎
+	HealthOf(roots[0])->hp = 1;
+	EXPECT_EQ(HealthOf(roots[1])->hp, 100);
+
+	// CX^XłȂGeBeB
+	EXPECT_TRUE(Cache().GetSourcePath(ChildOf(roots[0])).empty());
+	EXPECT_TRUE(Cache().Instantiate(m_dir / "Missing.flprefab").empty());
+}
+
+TEST_F(FlPrefabCacheTest, OverridesAreCollectedAndReapplied)
+{
+	const auto roots{ Cache().Instantiate(m_path, 2U) };
+	ASSERT_EQ(roots.size(), 2U);
+	EditInstances(roots);
+
+	const nlohmann::json first = Cache().CollectOverrides(roots[0]);
+	ASSERT_EQ(first.size(), 1U);
+	EXPECT_TRUE(first.begin()->at("Health").is_array()); // JSON Patch
+
+	const nlohmann::json second = Cache().CollectOverrides(roots[1]);
+	ASSERT_EQ(second.size(), 2U);
+	auto hasRemoval{ false }, hasAddition{ false };
+	for (const auto& delta : second)
+	{
+		hasRemoval  |= delta.contains("Health") && delta["Health"].is_null();
+		hasAddition |= delta.contains("Marker") && delta["Marker"]["value"] == 7;
+	}
+	EXPECT_TRUE(hasRemoval);
+	EXPECT_TRUE(hasAddition);
+
+	// tŔzuƓԂɂȂ
+	const auto copies{ Cache().Instantiate(m_path, 2U, &first) };
+	ASSERT_EQ(copies.size(), 2U);
+	for (const auto copy : copies)
+	{
+		EXPECT_EQ(HealthOf(copy)->hp, 42);
+		EXPECT_EQ(Cache().CollectOverrides(copy), first);
+	}
+
+	EXPECT_TRUE(Cache().ApplyOverrides(copies[0], second));
+	EXPECT_EQ(HealthOf(copies[0]), nullptr);
+	EXPECT_EQ(Cache().CollectOverrides(copies[0]), second);
+	EXPECT_FALSE(Cache().ApplyOverrides(ChildOf(copies[0]), second));
+}
+
+TEST_F(FlPrefabCacheTest, SceneSavesAndReplaysInstanceOverrides)
+{
+	EditInstances(Cache().Instantiate(m_path, 2U));
+
+	const nlohmann::json scene = Kernel().SerializeScene();
+	ASSERT_TRUE(scene.contains("Prefabs"));
+	ASSERT_EQ(scene["Prefabs"].size(), 2U);
+	EXPECT_EQ(fs::path{ scene["Prefabs"][0]["Path"].get<std::string>() }, m_path);
+
+	// j͌ÂIDȂ̂ŁAǂݍ݂ł͕ʂIDɕtւ
+	Kernel().AllDestroyEntities();
+	Kernel().DeserializeScene(scene);
+	EXPECT_EQ(Kernel().GetActiveIdCount(), 4U);
+	ExpectEditedInstances(LoadedRoots(), 1.5f);
+
+	// ђCX^X瓯
+	const nlohmann::json again = Kernel().SerializeScene();
+	ASSERT_EQ(again["Prefabs"].size(), 2U);
+	auto overrides{ std::multiset<std::string>{} };
+	for (const auto& instance : scene["Prefabs"]) overrides.insert(instance["Overrides"].dump());
+	for (const auto& instance : again["Prefabs"]) EXPECT_EQ(overrides.count(instance["Overrides"].dump()), 1U);
+}
+
+TEST_F(FlPrefabCacheTest, BinarySceneCarriesInstances)
+{
+	EditInstances(Cache().Instantiate(m_path, 2U));
+
+	for (const auto isCompress : { false, true })
+	{
+		const auto bytes{ Kernel().SerializeSceneBinary(isCompress) };
+		Kernel().AllDestroyEntities();
+		ASSERT_TRUE(Kernel().DeserializeSceneBinary(bytes));
+		ExpectEditedInstances(LoadedRoots(), 1.5f);
+	}
+}
+
+TEST_F(FlPrefabCacheTest, UpdatedPrefabReachesInstancesUnderTheirOverrides)
+{
+	EditInstances(Cache().Instantiate(m_path, 2U));
+	const nlohmann::json scene = Kernel().SerializeScene();
+	Kernel().AllDestroyEntities();
+
+	// vnu hp  speed ςiXVł傫ō蒼悤ςj
+	WritePrefab(m_path, 1000, 3.25f);
+	fs::last_write_time(m_path, fs::last_write_time(m_path) + std::chrono::seconds{ 2 });
+
+	Kernel().DeserializeScene(scene);
+	const auto roots{ LoadedRoots() };
+
+	// hp  0 ڂ̍Aspeed ͐Vvnu̒lɂȂ
+	ExpectEditedInstances(roots, 3.25f);
+}
+
+TEST_F(FlPrefabCacheTest, ResavedPrefabWithOtherIdsKeepsTheInstanceLinks)
+{
+	EditInstances(Cache().Instantiate(m_path, 2U));
+	const nlohmann::json scene = Kernel().SerializeScene();
+	Kernel().AllDestroyEntities();
+
+	// [gƎqIDւĕۑit@C̕тtɂȂj
+	nlohmann::json prefab;
+	ASSERT_TRUE(FlJsonUtility::Deserialize(prefab, m_path));
+	const auto root { prefab["Root"].get<entityId>() };
+	const auto child{ prefab["Entities"][std::to_string(root)]["Transform"]["children"][0].get<entityId>() };
+	nlohmann::json rootJson  = prefab["Entities"][std::to_string(root)];
+	nlohmann::json childJson = prefab["Entities"][std::to_string(child)];
+	rootJson["Transform"]["children"] = std::vector<entityId>{ root };
+	childJson["Transform"]["parent"]  = child;
+	prefab["Root"]     = child;
+	prefab["Entities"] = { { std::to_string(child), rootJson }, { std::to_string(root), childJson } };
+	ASSERT_TRUE(FlJsonUtility::Serialize(prefab, m_path));
+	fs::last_write_time(m_path, fs::last_write_time(m_path) + std::chrono::seconds{ 2 });
+
+	Kernel().DeserializeScene(scene);
+	ExpectEditedInstances(LoadedRoots(), 1.5f);
+}
+
+TEST_F(FlPrefabCacheTest, MissingPrefabLoadsTheSavedEntitiesWithoutALink)
+{
+	EditInstances(Cache().Instantiate(m_path, 2U));
+	const nlohmann::json scene = Kernel().SerializeScene();
+	Kernel().AllDestroyEntities();
+	Cache().Clear();
+	fs::remove(m_path);
+
+	Kernel().DeserializeScene(scene);
+	const auto roots{ LoadedRoots() };
+	ASSERT_EQ(roots.size(), 2U);
+	EXPECT_EQ(HealthOf(roots[0])->hp, 42);
+	EXPECT_EQ(HealthOf(roots[1]), nullptr);
+	for (const auto root : roots) EXPECT_TRUE(Cache().GetSourcePath(root).empty());
+	EXPECT_FALSE(Kernel().SerializeScene().contains("Prefabs"));
+}
@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+
+#include "Framework/System/Debugger/Profiler/FlProfiler.h"
+#include "Framework/System/Debugger/Profiler/FlProfilerFrameView.h"
+
+namespace
+{
+	void Busy(const std::chrono::microseconds duration)
+	{
+		const auto end{ std::chrono::steady_clock::now() + duration };
+		while (std::chrono::steady_clock::now() < end) {}
+	}
+
+	// Frame  Update  Physics
+	//        Render
+	void RecordFrame()
+	{
+		{
+			FL_PROFILE_SCOPE("Frame");
+			{
+				FL_PROFILE_SCOPE("Update");
+				Busy(std::chrono::microseconds{ 300 });
+				{
+					FL_PROFILE_SCOPE("Physics");
+					Busy(std::chrono::microseconds{ 500 });
+				}
+			}
+			{
+				FL_PROFILE_SCOPE("Render");
+				Busy(std::chrono::microseconds{ 400 });
+			}
+		}
+		FL_PROFILE_FRAME();
+	}
+
+	const FlProfilerFrameView::SummaryRow* FindRow(const FlProfilerFrameView& view, const std::string_view name)
+	{
+		const auto& summary{ view.GetSummary() };
+		const auto it{ std::ranges::find(summary, name, &FlProfilerFrameView::SummaryRow::name) };
+		return it == summary.end() ? nullptr : &*it;
+	}
+}
+
+TEST(FlProfilerFrameView, FollowingTheLatestFrameCapturesOnlyWhenAFrameCompletes)
+{
+	auto& profiler{ FlProfiler::Instance() };
+	FL_PROFILE_FRAME();
+	for (auto frame{ 0 }; frame < 3; ++frame) RecordFrame();
+
+	auto view{ FlProfilerFrameView{ 8U } };
+	EXPECT_TRUE(view.SelectLatest(profiler));
+	EXPECT_EQ(view.GetCaptureCount(), 1U);
+	EXPECT_EQ(view.GetSelectedEnd(), view.GetFrameMarks().size() - 1U);
+
+	// `͖t[łAt[Ei܂ȂΎoȂ
+	for (auto idle{ 0 }; idle < 100; ++idle) EXPECT_FALSE(view.SelectLatest(profiler));
+	EXPECT_EQ(view.GetCaptureCount(), 1U);
+
+	RecordFrame();
+	EXPECT_TRUE(view.SelectLatest(profiler));
+	EXPECT_EQ(view.GetCaptureCount(), 2U);
+	EXPECT_EQ(view.GetCapture().end, view.GetFrameMarks().back());
+}
+
+TEST(FlProfilerFrameView, SelectingAFrameRecomputesOnlyOnChange)
+{
+	auto& profiler{ FlProfiler::Instance() };
+	FL_PROFILE_FRAME();
+	for (auto frame{ 0 }; frame < 4; ++frame) RecordFrame();
+
+	auto view{ FlProfilerFrameView{ 4U } };
+	ASSERT_TRUE(view.RefreshFrameMarks(profiler));
+	EXPECT_FALSE(view.RefreshFrameMarks(profiler));
+	ASSERT_EQ(view.GetFrameMarks().size(), 5U);
+
+	EXPECT_TRUE(view.Select(profiler, 2U));
+	EXPECT_FALSE(view.Select(profiler, 2U));
+	EXPECT_TRUE(view.Select(profiler, 3U));
+	EXPECT_EQ(view.GetCaptureCount(), 2U);
+
+	// ͈͊O͑IׂȂ
+	EXPECT_FALSE(view.Select(profiler, 0U));
+	EXPECT_FALSE(view.Select(profiler, 5U));
+	EXPECT_EQ(view.GetSelectedEnd(), 3U);
+}
+
+TEST(FlProfilerFrameView, SummarySeparatesSelfFromChildTime)
+{
+	auto& profiler{ FlProfiler::Instance() };
+	FL_PROFILE_FRAME();
+	RecordFrame();
+
+	auto view{ FlProfilerFrameView{} };
+	ASSERT_TRUE(view.SelectLatest(profiler));
+
+	const auto& capture{ view.GetCapture() };
+	ASSERT_EQ(capture.threads.size(), 1U);
+	const auto& zones{ capture.threads[0].zones };
+	ASSERT_EQ(zones.size(), 4U);
+	EXPECT_STREQ(zones[0].name, "Frame");
+	EXPECT_STREQ(zones[1].name, "Update");
+	EXPECT_STREQ(zones[2].name, "Physics");
+	EXPECT_STREQ(zones[3].name, "Render");
+	EXPECT_EQ(zones[2].depth, zones[0].depth + 2U);
+	EXPECT_EQ(capture.threads[0].maxDepth, zones[2].depth);
+	EXPECT_EQ(capture.lost, 0U);
+
+	const auto* pFrame  { FindRow(view, "Frame") };
+	const auto* pUpdate { FindRow(view, "Update") };
+	const auto* pPhysics{ FindRow(view, "Physics") };
+	const auto* pRender { FindRow(view, "Render") };
+	ASSERT_TRUE(pFrame && pUpdate && pPhysics && pRender);
+	EXPECT_EQ(pFrame->calls, 1U);
+
+	// g̎Ԃ͎q́Av͎q܂
+	EXPECT_NEAR(pUpdate->selfMs, pUpdate->totalMs - pPhysics->totalMs, 1e-9);
+	EXPECT_NEAR(pFrame->selfMs, pFrame->totalMs - pUpdate->totalMs - pRender->totalMs, 1e-9);
+	EXPECT_NEAR(pPhysics->selfMs, pPhysics->totalMs, 1e-9);
+	EXPECT_GE(pPhysics->totalMs, 0.45);
+	EXPECT_GE(pUpdate->selfMs, 0.25);
+
+	// g̎Ԃ̑
+	EXPECT_TRUE(std::ranges::is_sorted(view.GetSummary(), std::greater{}, &FlProfilerFrameView::SummaryRow::selfMs));
+}
+
+TEST(FlProfilerFrameView, ChromeTraceHasOneCompleteEventPerZone)
+{
+	auto& profiler{ FlProfiler::Instance() };
+	FL_PROFILE_FRAME();
+	RecordFrame();
+	RecordFrame();
+
+	const auto capture{ profiler.CaptureFrames(2U) };
+	const nlohmann::json reparsed = nlohmann::json::parse(FlProfiler::ToChromeTrace(capture).dump());
+
+	auto complete{ size_t{} };
+	auto frames  { size_t{} };
+	for (const auto& event : reparsed["traceEvents"])
+	{
+		if (event["ph"] == "X")
+		{
+			++complete;
+			EXPECT_GE(event["ts"].get<double>(), 0.0);
+			EXPECT_GE(event["dur"].get<double>(), 0.0);
+		}
+		if (event["ph"] == "i") ++frames;
+	}
+	EXPECT_EQ(complete, 8U);
+	EXPECT_EQ(frames, 3U);
+}
@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+
+#include "Framework/System/XMLParser/FlProjectDocumentSession.h"
+
+namespace
+{
+	namespace fs = std::filesystem;
+
+	constexpr auto ItemCount  { 20000U };
+	constexpr auto FolderCount{ 200U };
+
+	std::string IncludeOf(const uint32_t i, const char* extension)
+	{
+		return "Src\\Module" + std::to_string(i % FolderCount) + "\\File" + std::to_string(i) + extension;
+	}
+
+	// ItemCount  .cpp/.h  FolderCount ̃tB^֐U蕪vWFNg
+	void WriteProject(const fs::path& vcxprojPath, const fs::path& filtersPath)
+	{
+		auto project{ std::ofstream{ vcxprojPath, std::ios::binary } };
+		auto filters{ std::ofstream{ filtersPath, std::ios::binary } };
+		project << "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n<Project>\n";
+		filters << "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n<Project>\n  <ItemGroup>\n";
+		for (auto f{ 0U }; f < FolderCount; ++f)
+		{
+			char guid[40]{};
+			std::snprintf(guid, sizeof(guid), "{00000000-0000-0000-0000-%012u}", f);
+			filters << "    <Filter Include=\"Src\\Module" << f << "\">\n"
+				<< "      <UniqueIdentifier>" << guid << "</UniqueIdentifier>\n"
+				<< "    </Filter>\n";
+		}
+		filters << "  </ItemGroup>\n";
+
+		for (const auto& [type, extension] : { std::pair{ "ClCompile", ".cpp" }, std::pair{ "ClInclude", ".h" } })
+		{
+			project << "  <ItemGroup>\n";
+			filters << "  <ItemGroup>\n";
+			for (auto i{ 0U }; i < ItemCount / 2U; ++i)
+			{
+				project << "    <" << type << " Include=\"" << IncludeOf(i, extension) << "\" />\n";
+				filters << "    <" << type << " Include=\"" << IncludeOf(i, extension) << "\">\n"
+					<< "      <Filter>Src\\Module" << i % FolderCount << "</Filter>\n"
+					<< "    </" << type << ">\n";
+			}
+			project << "  </ItemGroup>\n";
+			filters << "  </ItemGroup>\n";
+		}
+		project << "</Project>\n";
+		filters << "</Project>\n";
+	}
+
+	// ȑO FlAutomaticFileAddSystem ƓA1ڂƂɗt@Cǂ݁AItemGroup 𑖍đAo
+	bool AddItemPerCall(const fs::path& vcxprojPath, const fs::path& filtersPath, const std::string& include, const std::string& filterPath)
+	{
+		using namespace tinyxml2;
+
+		auto findGroup{ [](XMLDocument& doc, const char* child) {
+			auto* pRoot{ doc.RootElement() };
+			for (auto* pGroup{ pRoot->FirstChildElement("ItemGroup") }; pGroup; pGroup = pGroup->NextSiblingElement("ItemGroup"))
+				if (pGroup->FirstChildElement(child)) return pGroup;
+			return pRoot->InsertEndChild(doc.NewElement("ItemGroup"))->ToElement();
+		} };
+		auto contains{ [&include](XMLElement* pGroup) {
+			for (auto* pItem{ pGroup->FirstChildElement("ClCompile") }; pItem; pItem = pItem->NextSiblingElement("ClCompile"))
+				if (const auto* pInclude{ pItem->Attribute("Include") }; pInclude && include == pInclude) return true;
+			return false;
+		} };
+
+		{
+			auto doc{ XMLDocument{} };
+			if (doc.LoadFile(vcxprojPath.string().c_str()) != XML_SUCCESS) return false;
+			auto* pGroup{ findGroup(doc, "ClCompile") };
+			if (!contains(pGroup))
+			{
+				auto* pItem{ doc.NewElement("ClCompile") };
+				pItem->SetAttribute("Include", include.c_str());
+				pGroup->InsertEndChild(pItem);
+			}
+			if (doc.SaveFile(vcxprojPath.string().c_str()) != XML_SUCCESS) return false;
+		}
+		{
+			auto doc{ XMLDocument{} };
+			if (doc.LoadFile(filtersPath.string().c_str()) != XML_SUCCESS) return false;
+
+			// tB^`̑iȑO͊KwƂɑS`Ăj
+			auto* pFilters{ findGroup(doc, "Filter") };
+			auto hasFilter{ false };
+			for (auto* pFilter{ pFilters->FirstChildElement("Filter") }; pFilter; pFilter = pFilter->NextSiblingElement("Filter"))
+				if (const auto* pInclude{ pFilter->Attribute("Include") }; pInclude && filterPath == pInclude) hasFilter = true;
+			if (!hasFilter) pFilters->InsertEndChild(doc.NewElement("Filter"))->ToElement()->SetAttribute("Include", filterPath.c_str());
+
+			auto* pGroup{ findGroup(doc, "ClCompile") };
+			if (!contains(pGroup))
+			{
+				auto* pItem{ doc.NewElement("ClCompile") };
+				pItem->SetAttribute("Include", include.c_str());
+				pItem->InsertNewChildElement("Filter")->SetText(filterPath.c_str());
+				pGroup->InsertEndChild(pItem);
+			}
+			if (doc.SaveFile(filtersPath.string().c_str()) != XML_SUCCESS) return false;
+		}
+		return true;
+	}
+
+	double ElapsedMs(const std::chrono::steady_clock::time_point start)
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+}
+
+// 20k ڂ̃vWFNg 200 ڂ𑫂: 1ڂƂ̓ǂݍ݁EoƁA1 Begin ` Commit ׂ
+// i1ڂƂ̕1񂪐S ms |̂ legacyCount 񂾂 200 񕪂ɊZj
+TEST(FlProjectDocumentSessionBenchmark, TwentyThousandItemProject)
+{
+	constexpr auto addCount   { 200U };
+	constexpr auto legacyCount{ 10U };
+
+	const auto dir{ fs::temp_directory_path() / "FlProjectDocumentSessionBenchmark" };
+	fs::remove_all(dir);
+	fs::create_directories(dir);
+	const auto vcxprojPath{ dir / "Game.vcxproj" };
+	const auto filtersPath{ dir / "Game.vcxproj.filters" };
+
+	WriteProject(vcxprojPath, filtersPath);
+	auto start{ std::chrono::steady_clock::now() };
+	for (auto i{ 0U }; i < legacyCount; ++i)
+		ASSERT_TRUE(AddItemPerCall(vcxprojPath, filtersPath, "Src\\Added\\Legacy" + std::to_string(i) + ".cpp", "Src\\Added"));
+	const auto perCallMs{ ElapsedMs(start) / legacyCount * addCount };
+
+	WriteProject(vcxprojPath, filtersPath);
+	auto session{ FlProjectDocumentSession{ vcxprojPath, filtersPath } };
+
+	start = std::chrono::steady_clock::now();
+	ASSERT_TRUE(session.Begin());
+	const auto loadMs{ ElapsedMs(start) };
+	ASSERT_EQ(session.GetItemCount(), ItemCount);
+	for (auto i{ 0U }; i < addCount; ++i)
+		ASSERT_TRUE(session.AddItem("Src\\Added\\Batched" + std::to_string(i) + ".cpp", "ClCompile", "Src/Added"));
+	ASSERT_TRUE(session.Commit());
+	const auto batchedMs{ ElapsedMs(start) };
+
+	// 풓܂܎̃ob`ifBXNςĂȂΓǂݒȂj
+	start = std::chrono::steady_clock::now();
+	ASSERT_TRUE(session.Begin());
+	for (auto i{ 0U }; i < addCount; ++i)
+		ASSERT_TRUE(session.RemoveItem("Src\\Added\\Batched" + std::to_string(i) + ".cpp"));
+	ASSERT_TRUE(session.Commit());
+	const auto residentMs{ ElapsedMs(start) };
+	EXPECT_EQ(session.GetItemCount(), ItemCount);
+
+	std::printf("[ BENCH ] FlProjectDocumentSession %u items + %u adds: per-item load/save ~%.0f ms (%.1f ms/item), "
+		"batched %.1f ms (load %.1f ms, %.0fx), resident batch %.1f ms\n",
+		ItemCount, addCount, perCallMs, perCallMs / addCount, batchedMs, loadMs, perCallMs / batchedMs, residentMs);
+	::testing::Test::RecordProperty("per_item_ms", std::to_string(perCallMs));
+	::testing::Test::RecordProperty("batched_ms", std::to_string(batchedMs));
+	::testing::Test::RecordProperty("resident_batch_ms", std::to_string(residentMs));
+
+	EXPECT_LT(batchedMs * 10.0, perCallMs);
+
+	fs::remove_all(dir);
+}
@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+
+#include "Framework/System/XMLParser/FlProjectDocumentSession.h"
+
+namespace
+{
+	namespace fs = std::filesystem;
+
+	constexpr auto ProjectXml{
+		"<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+		"<Project>\n"
+		"  <ItemGroup>\n"
+		"    <ClCompile Include=\"Src\\Main.cpp\" />\n"
+		"  </ItemGroup>\n"
+		"</Project>\n" };
+
+	constexpr auto FiltersXml{
+		"<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+		"<Project>\n"
+		"  <ItemGroup>\n"
+		"    <ClCompile Include=\"Src\\Main.cpp\" />\n"
+		"  </ItemGroup>\n"
+		"</Project>\n" };
+
+	class FlProjectDocumentSessionTest : public ::testing::Test
+	{
+	protected:
+
+		void SetUp() override
+		{
+			m_dir = fs::temp_directory_path() / "FlProjectDocumentSessionTest";
+			fs::remove_all(m_dir);
+			fs::create_directories(m_dir);
+			std::ofstream{ VcxprojPath(), std::ios::binary } << ProjectXml;
+			std::ofstream{ FiltersPath(), std::ios::binary } << FiltersXml;
+		}
+
+		void TearDown() override { fs::remove_all(m_dir); }
+
+		fs::path VcxprojPath() const { return m_dir / "Game.vcxproj"; }
+		fs::path FiltersPath() const { return m_dir / "Game.vcxproj.filters"; }
+
+		static std::string ReadAll(const fs::path& path)
+		{
+			auto stream{ std::ifstream{ path, std::ios::binary } };
+			return std::string{ std::istreambuf_iterator<char>{ stream }, std::istreambuf_iterator<char>{} };
+		}
+
+		fs::path m_dir;
+	};
+}
+
+TEST_F(FlProjectDocumentSessionTest, CommitReplacesBothFilesAndLeavesNoBackup)
+{
+	auto session{ FlProjectDocumentSession{ VcxprojPath(), FiltersPath() } };
+	ASSERT_TRUE(session.Begin());
+	EXPECT_TRUE(session.AddItem("Src/Game/Player.cpp", "ClCompile", "Src/Game"));
+	EXPECT_TRUE(session.Contains("src\\game\\player.cpp"));
+	ASSERT_TRUE(session.Commit());
+
+	EXPECT_NE(ReadAll(VcxprojPath()).find("Src/Game/Player.cpp"), std::string::npos);
+	EXPECT_NE(ReadAll(FiltersPath()).find("<Filter>Src\\Game</Filter>"), std::string::npos);
+	for (const auto& entry : fs::directory_iterator{ m_dir })
+		EXPECT_EQ(entry.path().extension() == ".bak" || entry.path().extension() == ".tmp", false) << entry.path();
+}
+
+TEST_F(FlProjectDocumentSessionTest, FailedCommitLeavesBothFilesUntouched)
+{
+	auto session{ FlProjectDocumentSession{ VcxprojPath(), FiltersPath() } };
+	ASSERT_TRUE(session.Begin());
+	EXPECT_TRUE(session.AddItem("Src/Game/Player.cpp", "ClCompile", "Src/Game"));
+
+	// .filters ޔułȂԂɂ
+	fs::remove(FiltersPath());
+	fs::create_directories(FiltersPath() / "locked");
+
+	FlEditorAdministrator::Instance().GetLogger()->Clear();
+	EXPECT_FALSE(session.Commit());
+	EXPECT_FALSE(session.IsInTransaction());
+	EXPECT_GT(FlEditorAdministrator::Instance().GetLogger()->Count(FlTestLogger::Severity::Error), 0U);
+
+	// .vcxproj ɒu邱Ƃ͂Ȃ
+	EXPECT_EQ(ReadAll(VcxprojPath()), ProjectXml);
+	EXPECT_FALSE(fs::exists(m_dir / "Game.vcxproj.tmp"));
+	EXPECT_FALSE(fs::exists(m_dir / "Game.vcxproj.bak"));
+	EXPECT_FALSE(fs::exists(m_dir / "Game.vcxproj.filters.tmp"));
+}
+
+TEST_F(FlProjectDocumentSessionTest, RemoveItemDropsEmptyItemGroups)
+{
+	auto session{ FlProjectDocumentSession{ VcxprojPath(), FiltersPath() } };
+	ASSERT_TRUE(session.Begin());
+	EXPECT_TRUE(session.RemoveItem("src/main.cpp"));
+	EXPECT_FALSE(session.RemoveItem("src/main.cpp"));
+	ASSERT_TRUE(session.Commit());
+
+	EXPECT_EQ(ReadAll(VcxprojPath()).find("ItemGroup"), std::string::npos);
+	EXPECT_EQ(ReadAll(FiltersPath()).find("Main.cpp"), std::string::npos);
+}
@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include "Framework/Module/RuntimeRegistry/FlRuntimeRegistry.h"
+
+namespace
+{
+	constexpr auto EntityCount		  { 4096U };
+	constexpr auto ComponentsPerEntity{ 4U };
+
+	void CountCallback(const char*, const char*, void* ptr, void* user)
+	{
+		*static_cast<uintptr_t*>(user) += reinterpret_cast<uintptr_t>(ptr) & 1U;
+		++*(static_cast<uintptr_t*>(user) + 1);
+	}
+
+	// readerCount {őSGeBeB񋓂A1 񂠂̎ԂԂiwriter ͕ʃGeBeBo^Ej
+	double MeasureEnumerateNs(const uint32_t readerCount, const bool withWriter)
+	{
+		constexpr auto rounds{ 50U };
+
+		auto isDone	 { std::atomic<bool>{ false } };
+		auto writer	 { std::thread{} };
+		auto dummy	 { 0 };
+		if (withWriter)
+		{
+			writer = std::thread{ [&] {
+				for (auto i{ 0U }; !isDone.load(std::memory_order_relaxed); ++i)
+				{
+					const auto entity{ EntityCount + i % 1024U };
+					Runtime_RegisterComponent("BenchWriter", entity, "W", &dummy);
+					Runtime_UnregisterComponent("BenchWriter", entity, "W");
+				}
+			} };
+		}
+
+		const auto start{ std::chrono::steady_clock::now() };
+		auto readers{ std::vector<std::thread>{} };
+		auto visited{ std::atomic<uint64_t>{} };
+		for (auto r{ 0U }; r < readerCount; ++r)
+		{
+			readers.emplace_back([&, r] {
+				uintptr_t counters[2]{};
+				for (auto round{ 0U }; round < rounds; ++round)
+					for (auto e{ 0U }; e < EntityCount; ++e)
+						Runtime_EnumerateComponentsForEntity((e + r * 97U) % EntityCount, CountCallback, counters);
+				visited.fetch_add(counters[1]);
+			});
+		}
+		for (auto& reader : readers) reader.join();
+		const auto elapsed{ std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() };
+
+		isDone.store(true, std::memory_order_relaxed);
+		if (writer.joinable()) writer.join();
+
+		EXPECT_EQ(visited.load(), uint64_t{ readerCount } * rounds * EntityCount * ComponentsPerEntity);
+		return elapsed / (double{ rounds } * EntityCount);
+	}
+}
+
+// 񋓒̓V[h̋LbNBǂݎ蓯m͕sɐi݁A͕ʃV[hȂ~܂Ȃ
+TEST(FlRuntimeRegistryBenchmark, EnumerateUnderSharedLock)
+{
+	static auto storage{ std::vector<int>(EntityCount * ComponentsPerEntity) };
+	for (auto e{ 0U }; e < EntityCount; ++e)
+		for (auto c{ 0U }; c < ComponentsPerEntity; ++c)
+			ASSERT_EQ(Runtime_RegisterComponent("BenchDll", e, ("Comp" + std::to_string(c)).c_str(), &storage[e * ComponentsPerEntity + c]), 0);
+
+	for (const auto readerCount : { 1U, 4U })
+	{
+		for (const auto withWriter : { false, true })
+		{
+			const auto ns{ MeasureEnumerateNs(readerCount, withWriter) };
+			std::printf("[ BENCH ] FlRuntimeRegistry enumerate %u components: %u reader(s)%s: %.1f ns/enumeration (wall / reader)\n",
+				ComponentsPerEntity, readerCount, withWriter ? " + writer" : "", ns);
+			::testing::Test::RecordProperty("enumerate_ns_" + std::to_string(readerCount) + (withWriter ? "_writer" : ""), std::to_string(ns));
+		}
+	}
+
+	EXPECT_EQ(Runtime_UnregisterAllForDll("BenchDll"), 0);
+}
+
+// DLL ͍̉ (byDll) 炻 DLL ̓o^B DLL ̓o^Ă 1 ̎Ԃ͕ςȂ
+TEST(FlRuntimeRegistryBenchmark, UnregisterAllForDllScalesWithItsOwnRegistrations)
+{
+	constexpr auto rounds{ 5U };
+
+	static auto dummy{ 0 };
+	auto registerDll{ [](const char* dllName, const uint32_t firstEntity, const uint32_t count) {
+		for (auto i{ 0U }; i < count; ++i)
+			ASSERT_EQ(Runtime_RegisterComponent(dllName, firstEntity + i / ComponentsPerEntity, ("Comp" + std::to_string(i % ComponentsPerEntity)).c_str(), &dummy), 0);
+	} };
+
+	auto perRegistrationNs{ std::vector<double>{} };
+	for (const auto backgroundCount : { 0U, 256U * 1024U })
+	{
+		registerDll("BenchBackground", 0U, backgroundCount);
+		for (const auto ownCount : { 1024U, 16U * 1024U })
+		{
+			auto best{ std::numeric_limits<double>::max() };
+			for (auto round{ 0U }; round < rounds; ++round)
+			{
+				registerDll("BenchUnload", 0U, ownCount);
+				const auto start{ std::chrono::steady_clock::now() };
+				EXPECT_EQ(Runtime_UnregisterAllForDll("BenchUnload"), 0);
+				best = std::min(best, std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count());
+			}
+			EXPECT_EQ(Runtime_GetComponent("BenchUnload", 0U, "Comp0"), nullptr);
+
+			const auto ns{ best / ownCount };
+			perRegistrationNs.push_back(ns);
+			std::printf("[ BENCH ] FlRuntimeRegistry UnregisterAllForDll %u registrations (%u from other DLLs): %.3f ms, %.1f ns/registration\n",
+				ownCount, backgroundCount, best * 1e-6, ns);
+			::testing::Test::RecordProperty("unregister_ns_" + std::to_string(ownCount) + "_" + std::to_string(backgroundCount), std::to_string(ns));
+		}
+		EXPECT_EQ(Runtime_UnregisterAllForDll("BenchBackground"), 0);
+	}
+
+	//  DLL  256k GeBeBɍڂĂĂA1 ̎Ԃ͐{Ɏ܂
+	EXPECT_LT(perRegistrationNs[2], perRegistrationNs[0] * 4.0);
+	EXPECT_LT(perRegistrationNs[3], perRegistrationNs[1] * 4.0);
+}
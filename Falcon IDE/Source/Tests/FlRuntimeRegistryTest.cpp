@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+
+#include "Framework/Module/RuntimeRegistry/FlRuntimeRegistry.h"
+
+namespace
+{
+	struct Probe
+	{
+		std::atomic<bool> isAlive{ true };
+	};
+
+	struct EnumResult
+	{
+		std::vector<std::pair<std::string, void*>> entries;
+		int registerResult	 = 0;
+		int unregisterResult = 0;
+		int nestedResult	 = 0;
+		void* pLookedUp		 = nullptr;
+	};
+}
+
+TEST(FlRuntimeRegistry, EnumeratesEveryComponentOfTheEntity)
+{
+	auto a{ 0 }, b{ 0 }, other{ 0 };
+	ASSERT_EQ(Runtime_RegisterComponent("EnumDll", 10U, "A", &a), 0);
+	ASSERT_EQ(Runtime_RegisterComponent("EnumDll", 10U, "B", &b), 0);
+	ASSERT_EQ(Runtime_RegisterComponent("EnumDll", 11U, "A", &other), 0);
+	EXPECT_EQ(Runtime_RegisterComponent("EnumDll", 10U, "A", &other), -2);
+
+	auto result{ EnumResult{} };
+	EXPECT_EQ(Runtime_EnumerateComponentsForEntity(10U, [](const char* dll, const char* comp, void* ptr, void* user) {
+		static_cast<EnumResult*>(user)->entries.emplace_back(std::string{ dll } + "/" + comp, ptr);
+	}, &result), 0);
+
+	std::ranges::sort(result.entries);
+	EXPECT_EQ(result.entries, (std::vector<std::pair<std::string, void*>>{ { "EnumDll/A", &a }, { "EnumDll/B", &b } }));
+
+	EXPECT_EQ(Runtime_UnregisterAllForDll("EnumDll"), 0);
+	EXPECT_EQ(Runtime_GetComponent("EnumDll", 10U, "A"), nullptr);
+	EXPECT_EQ(Runtime_EnumerateComponentsForEntity(10U, [](const char*, const char*, void*, void*) { FAIL(); }, nullptr), 0);
+}
+
+TEST(FlRuntimeRegistry, CallbackMayOnlyReadTheRegistry)
+{
+	auto a{ 0 }, b{ 0 };
+	ASSERT_EQ(Runtime_RegisterComponent("ReentryDll", 20U, "A", &a), 0);
+
+	auto result{ EnumResult{} };
+	EXPECT_EQ(Runtime_EnumerateComponentsForEntity(20U, [](const char*, const char*, void*, void* user) {
+		auto& r{ *static_cast<EnumResult*>(user) };
+		static auto added{ 0 };
+		r.pLookedUp		   = Runtime_GetComponent("ReentryDll", 20U, "A");
+		r.registerResult   = Runtime_RegisterComponent("ReentryDll", 20U, "B", &added);
+		r.unregisterResult = Runtime_UnregisterComponent("ReentryDll", 20U, "A");
+		r.nestedResult	   = Runtime_EnumerateComponentsForEntity(20U, [](const char*, const char*, void*, void*) {}, nullptr);
+	}, &result), 0);
+
+	EXPECT_EQ(result.pLookedUp, &a);
+	EXPECT_EQ(result.registerResult, -3);
+	EXPECT_EQ(result.unregisterResult, -3);
+	EXPECT_EQ(result.nestedResult, -3);
+	EXPECT_EQ(Runtime_UnregisterAllForDll("ReentryDll"), 0);
+
+	// 񋓂𔲂ΌʂύXł
+	EXPECT_EQ(Runtime_RegisterComponent("ReentryDll", 20U, "B", &b), 0);
+	EXPECT_EQ(Runtime_UnregisterComponent("ReentryDll", 20U, "B"), 0);
+}
+
+TEST(FlRuntimeRegistry, UnregisteredComponentIsNeverHandedToACallback)
+{
+	constexpr auto entityId{ 30U };
+	auto probes{ std::array<Probe, 4U>{} };
+	for (auto i{ size_t{} }; i < probes.size(); ++i)
+		ASSERT_EQ(Runtime_RegisterComponent("RaceDll", entityId, ("C" + std::to_string(i)).c_str(), &probes[i]), 0);
+
+	auto isDone	  { std::atomic<bool>{ false } };
+	auto deadSeen { std::atomic<uint64_t>{} };
+	auto visited  { std::atomic<uint64_t>{} };
+
+	auto readers{ std::vector<std::thread>{} };
+	for (auto t{ 0 }; t < 3; ++t)
+	{
+		readers.emplace_back([&] {
+			struct Counters { std::atomic<uint64_t>* pDead; std::atomic<uint64_t>* pVisited; } counters{ &deadSeen, &visited };
+			while (!isDone.load(std::memory_order_acquire))
+			{
+				Runtime_EnumerateComponentsForEntity(entityId, [](const char*, const char*, void* ptr, void* user) {
+					auto& c{ *static_cast<Counters*>(user) };
+					if (!static_cast<Probe*>(ptr)->isAlive.load(std::memory_order_acquire)) c.pDead->fetch_add(1U);
+					c.pVisited->fetch_add(1U, std::memory_order_relaxed);
+				}, &counters);
+
+				// ǂݎD悷iglibcjł肪荞߂悤
+				std::this_thread::yield();
+			}
+		});
+	}
+
+	// ߂ɁujvA蒼ēo^
+	for (auto i{ 0 }; i < 5000; ++i)
+	{
+		auto& probe{ probes[static_cast<size_t>(i) % probes.size()] };
+		const auto name{ "C" + std::to_string(static_cast<size_t>(i) % probes.size()) };
+		ASSERT_EQ(Runtime_UnregisterComponent("RaceDll", entityId, name.c_str()), 0);
+		probe.isAlive.store(false, std::memory_order_release);
+		std::this_thread::yield();
+		probe.isAlive.store(true, std::memory_order_release);
+		ASSERT_EQ(Runtime_RegisterComponent("RaceDll", entityId, name.c_str(), &probe), 0);
+	}
+	isDone.store(true, std::memory_order_release);
+	for (auto& reader : readers) reader.join();
+
+	EXPECT_EQ(deadSeen.load(), 0U);
+	EXPECT_GT(visited.load(), 0U);
+	EXPECT_EQ(Runtime_UnregisterAllForDll("RaceDll"), 0);
+}
@@ -0,0 +1,9 @@
+#pragma once
+
+// FlRuntimeRegistry.cpp g Win32  DLL ǂݍ݂̑ieXgł DLL ǂ܂Ȃj
+using HMODULE = void*;
+using FARPROC = void*;
+
+inline HMODULE LoadLibraryA(const char*) noexcept { return nullptr; }
+inline int     FreeLibrary(HMODULE) noexcept { return 1; }
+inline FARPROC GetProcAddress(HMODULE, const char*) noexcept { return nullptr; }
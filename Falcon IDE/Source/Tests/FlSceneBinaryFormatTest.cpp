@@ -0,0 +1,222 @@
+#include <gtest/gtest.h>
+
+#include "Framework/Resource/Binary/FlSceneBinaryFormat.h"
+
+namespace
+{
+	constexpr uint32_t MakeTag(const char a, const char b, const char c, const char d) noexcept
+	{
+		return static_cast<uint32_t>(a) | (static_cast<uint32_t>(b) << 8) | (static_cast<uint32_t>(c) << 16) | (static_cast<uint32_t>(d) << 24);
+	}
+
+	// őg񂾃t@CiꂽEVł̃f[^邽߁j
+	class SceneBytes
+	{
+	public:
+
+		explicit SceneBytes(const uint32_t chunkCount)
+		{
+			Put(FlSceneBinaryFormat::Magic);
+			Put(FlSceneBinaryFormat::VersionMajor);
+			Put(FlSceneBinaryFormat::VersionMinor);
+			Put(uint32_t{ 24U }); // headerSize
+			Put(uint32_t{});      // flags
+			Put(chunkCount);
+			Put(uint32_t{});      // entityCount
+		}
+
+		template<typename T>
+		SceneBytes& Put(const T& value)
+		{
+			const auto* p{ reinterpret_cast<const uint8_t*>(&value) };
+			m_bytes.insert(m_bytes.end(), p, p + sizeof(T));
+			return *this;
+		}
+
+		SceneBytes& Chunk(const uint32_t tag, const std::vector<uint8_t>& body, const uint32_t flags = 0U, const uint32_t rawSize = UINT32_MAX)
+		{
+			Put(tag).Put(flags).Put(static_cast<uint32_t>(body.size()));
+			Put(rawSize == UINT32_MAX ? static_cast<uint32_t>(body.size()) : rawSize);
+			m_bytes.insert(m_bytes.end(), body.begin(), body.end());
+			return *this;
+		}
+
+		const std::vector<uint8_t>& Get() const noexcept { return m_bytes; }
+
+	private:
+		std::vector<uint8_t> m_bytes;
+	};
+
+	template<typename... Ts>
+	std::vector<uint8_t> Body(const Ts... values)
+	{
+		auto bytes{ std::vector<uint8_t>{} };
+		(bytes.insert(bytes.end(), reinterpret_cast<const uint8_t*>(&values), reinterpret_cast<const uint8_t*>(&values) + sizeof(Ts)), ...);
+		return bytes;
+	}
+
+	std::vector<uint8_t> MakeScene(const bool isCompress)
+	{
+		auto writer{ FlSceneBinaryFormat::Writer{} };
+		writer.SetEntities({ 1U, 2U, 3U });
+
+		const auto name{ writer.AddType("Name") };
+		const auto transform{ writer.AddType("Transform") };
+		for (auto id : { 1U, 2U, 3U })
+		{
+			writer.AddComponent(name, id, std::vector<uint8_t>(40U, static_cast<uint8_t>('a' + id)));
+			if (id != 2U) writer.AddComponent(transform, id, { 0x90 });
+		}
+		return writer.Finish(isCompress);
+	}
+
+	void ExpectScene(const FlSceneBinaryFormat::SceneData& scene)
+	{
+		EXPECT_EQ(scene.entities, (std::vector<entityId>{ 1U, 2U, 3U }));
+		ASSERT_EQ(scene.blocks.size(), 2U);
+		EXPECT_EQ(scene.blocks[0].typeName, "Name");
+		EXPECT_EQ(scene.blocks[0].entities, (std::vector<entityId>{ 1U, 2U, 3U }));
+		EXPECT_EQ(scene.blocks[0].GetData(2).size(), 40U);
+		EXPECT_EQ(scene.blocks[0].GetData(2)[0], static_cast<uint8_t>('d'));
+		EXPECT_EQ(scene.blocks[1].typeName, "Transform");
+		EXPECT_EQ(scene.blocks[1].entities, (std::vector<entityId>{ 1U, 3U }));
+	}
+}
+
+TEST(FlSceneBinaryFormat, RoundTripsRawAndCompressed)
+{
+	for (const auto isCompress : { false, true })
+	{
+		const auto bytes{ MakeScene(isCompress) };
+		ASSERT_TRUE(FlSceneBinaryFormat::IsBinaryScene(bytes));
+
+		auto scene{ FlSceneBinaryFormat::SceneData{} };
+		ASSERT_TRUE(FlSceneBinaryFormat::Read(bytes, scene)) << isCompress;
+		ExpectScene(scene);
+	}
+	EXPECT_LT(MakeScene(true).size(), MakeScene(false).size());
+}
+
+TEST(FlSceneBinaryFormat, PrefabChunkIsOptionalAndRoundTrips)
+{
+	auto scene{ FlSceneBinaryFormat::SceneData{} };
+	ASSERT_TRUE(FlSceneBinaryFormat::Read(MakeScene(true), scene));
+	EXPECT_TRUE(scene.prefabs.empty());
+
+	const auto prefabs{ std::vector<uint8_t>(300U, 0x90) };
+	for (const auto isCompress : { false, true })
+	{
+		auto writer{ FlSceneBinaryFormat::Writer{} };
+		writer.SetEntities({ 1U });
+		writer.SetPrefabs(prefabs);
+
+		ASSERT_TRUE(FlSceneBinaryFormat::Read(writer.Finish(isCompress), scene)) << isCompress;
+		EXPECT_EQ(scene.entities, (std::vector<entityId>{ 1U }));
+		EXPECT_EQ(scene.prefabs, prefabs);
+	}
+}
+
+TEST(FlSceneBinaryFormat, EmptyBlocksAndEmptyDecompressionAreValid)
+{
+	auto writer{ FlSceneBinaryFormat::Writer{} };
+	writer.AddType("Empty");
+
+	auto scene{ FlSceneBinaryFormat::SceneData{} };
+	ASSERT_TRUE(FlSceneBinaryFormat::Read(writer.Finish(true), scene));
+	EXPECT_TRUE(scene.entities.empty());
+	ASSERT_EQ(scene.blocks.size(), 1U);
+	EXPECT_TRUE(scene.blocks[0].payload.empty());
+
+	// 0 oCgḱie 0 ̃g[N1j
+	const auto compressed{ FlBlockCompressor::Compress(nullptr, 0U) };
+	auto out{ std::vector<uint8_t>{} };
+	EXPECT_TRUE(FlBlockCompressor::Decompress(compressed.data(), compressed.size(), out, 0U));
+	EXPECT_TRUE(out.empty());
+}
+
+TEST(FlSceneBinaryFormat, CountsLargerThanTheChunkFailWithoutAllocating)
+{
+	auto scene{ FlSceneBinaryFormat::SceneData{} };
+
+	const auto strings{ SceneBytes{ 1U }.Chunk(MakeTag('S', 'T', 'R', 'S'), Body(UINT32_MAX)) };
+	EXPECT_FALSE(FlSceneBinaryFormat::Read(strings.Get(), scene));
+
+	const auto types{ SceneBytes{ 1U }.Chunk(MakeTag('T', 'Y', 'P', 'S'), Body(0x10000000U, 0U, 0U)) };
+	EXPECT_FALSE(FlSceneBinaryFormat::Read(types.Get(), scene));
+
+	const auto entities{ SceneBytes{ 1U }.Chunk(MakeTag('E', 'N', 'T', 'S'), Body(UINT32_MAX, 1U)) };
+	EXPECT_FALSE(FlSceneBinaryFormat::Read(entities.Get(), scene));
+
+	// oCg 4GB ߂ɓWJƌ`N
+	const auto inflated{ SceneBytes{ 1U }.Chunk(MakeTag('E', 'N', 'T', 'S'), { 0x00 }, 1U, 0xFFFFFFF0U) };
+	EXPECT_FALSE(FlSceneBinaryFormat::Read(inflated.Get(), scene));
+
+	auto out{ std::vector<uint8_t>{} };
+	const auto token{ std::vector<uint8_t>{ 0x00 } };
+	EXPECT_FALSE(FlBlockCompressor::Decompress(token.data(), token.size(), out, size_t{ 1U } << 40));
+	EXPECT_TRUE(out.empty());
+}
+
+TEST(FlSceneBinaryFormat, UnknownChunksAndTrailingComponentDataAreSkipped)
+{
+	// Vł COMP ̌ɑf[^ƁAmȂ`N
+	auto name{ std::vector<uint8_t>{ 'N', 'a', 'm', 'e' } };
+	auto strings{ Body(1U, 4U) };
+	strings.insert(strings.end(), name.begin(), name.end());
+
+	auto component{ Body(0U, 1U, 7U, 0U, 2U) };
+	component.push_back(0xA1);
+	component.push_back('x');
+	const auto extension{ Body(0xDEADBEEFU, 0xCAFEF00DU) };
+	component.insert(component.end(), extension.begin(), extension.end());
+
+	const auto bytes{ SceneBytes{ 5U }
+		.Chunk(MakeTag('S', 'T', 'R', 'S'), strings)
+		.Chunk(MakeTag('X', 'T', 'R', 'A'), Body(1U, 2U, 3U))
+		.Chunk(MakeTag('E', 'N', 'T', 'S'), Body(1U, 7U))
+		.Chunk(MakeTag('T', 'Y', 'P', 'S'), Body(1U, 0U, 1U))
+		.Chunk(MakeTag('C', 'O', 'M', 'P'), component) };
+
+	auto scene{ FlSceneBinaryFormat::SceneData{} };
+	ASSERT_TRUE(FlSceneBinaryFormat::Read(bytes.Get(), scene));
+	EXPECT_EQ(scene.entities, (std::vector<entityId>{ 7U }));
+	ASSERT_EQ(scene.blocks.size(), 1U);
+	EXPECT_EQ(scene.blocks[0].typeName, "Name");
+	EXPECT_EQ(scene.blocks[0].entities, (std::vector<entityId>{ 7U }));
+	ASSERT_EQ(scene.blocks[0].GetData(0).size(), 2U);
+	EXPECT_EQ(scene.blocks[0].GetData(0)[1], static_cast<uint8_t>('x'));
+}
+
+TEST(FlSceneBinaryFormat, CorruptedFilesNeverThrow)
+{
+	auto rng{ std::mt19937{ 36U } };
+	for (const auto isCompress : { false, true })
+	{
+		const auto original{ MakeScene(isCompress) };
+		for (auto round{ 0 }; round < 4000; ++round)
+		{
+			auto bytes{ original };
+			if (round % 4 == 0) bytes.resize(std::uniform_int_distribution<size_t>{ 0U, bytes.size() }(rng));
+			else
+			{
+				for (auto flips{ round % 4 }; flips > 0; --flips)
+				{
+					const auto at{ std::uniform_int_distribution<size_t>{ 0U, bytes.size() - 1U }(rng) };
+					bytes[at] = static_cast<uint8_t>(rng());
+				}
+			}
+
+			auto scene { FlSceneBinaryFormat::SceneData{} };
+			auto isRead{ false };
+			EXPECT_NO_THROW(isRead = FlSceneBinaryFormat::Read(bytes, scene)) << round;
+			if (!isRead) continue;
+
+			// ǂ߂̂ GetData  payload ̒w
+			for (const auto& block : scene.blocks)
+			{
+				ASSERT_EQ(block.offsets.size(), block.entities.size() + 1U);
+				ASSERT_LE(block.offsets.back(), block.payload.size());
+			}
+		}
+	}
+}
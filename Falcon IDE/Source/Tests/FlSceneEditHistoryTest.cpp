@@ -0,0 +1,412 @@
+#include <gtest/gtest.h>
+
+#include "Core/FlEntityComponentSystemKernel.h"
+#include "Core/FlSceneEditHistory.h"
+#include "Framework/Module/RuntimeModule/ResistCamera.h"
+#include "Framework/Module/RuntimeModule/ResistModelRender.h"
+#include "Framework/Module/RuntimeModule/ResistCollision.h"
+#include "Framework/Module/RuntimeModule/NameAndTag.h"
+#include "Framework/Module/RuntimeModule/Transform.h"
+
+// `E蔻̃R|[lg DirectX Ɉˑ̂ŃeXgł͓o^Ȃ
+ResistCamera::ResistCamera() {}
+ResistModelRender::ResistModelRender() {}
+ResistCollision::ResistCollision() {}
+
+namespace
+{
+	// tOƕҏW^
+	struct PositionComponent
+	{
+		float x = 0.0f;
+		float y = 0.0f;
+	};
+
+	struct TagComponent
+	{
+		int              tag = 0;
+		std::vector<int> blob;
+	};
+
+	void RegisterTestTypes()
+	{
+		auto& kernel{ FlEntityComponentSystemKernel::Instance() };
+		{
+			auto reflection{ ComponentReflection{} };
+			reflection.Create      = []() -> void* { return new PositionComponent{}; };
+			reflection.Destroy     = [](void* p) { delete static_cast<PositionComponent*>(p); };
+			reflection.Serialize   = [](void* p, nlohmann::json& json) { json["x"] = static_cast<PositionComponent*>(p)->x; json["y"] = static_cast<PositionComponent*>(p)->y; };
+			reflection.Deserialize = [](void* p, const nlohmann::json& json) { json.at("x").get_to(static_cast<PositionComponent*>(p)->x); json.at("y").get_to(static_cast<PositionComponent*>(p)->y); };
+			kernel.RegisterModule("Position", reflection);
+		}
+		{
+			auto reflection{ ComponentReflection{} };
+			reflection.Create      = []() -> void* { return new TagComponent{}; };
+			reflection.Destroy     = [](void* p) { delete static_cast<TagComponent*>(p); };
+			reflection.Serialize   = [](void* p, nlohmann::json& json) { json["tag"] = static_cast<TagComponent*>(p)->tag; json["blob"] = static_cast<TagComponent*>(p)->blob; };
+			reflection.Deserialize = [](void* p, const nlohmann::json& json) { json.at("tag").get_to(static_cast<TagComponent*>(p)->tag); json.at("blob").get_to(static_cast<TagComponent*>(p)->blob); };
+			kernel.RegisterModule("Tag", reflection);
+		}
+	}
+
+	// GeBeBƂ́AtĂSẴR|[lg Serialize ̌
+	using SceneState = std::map<entityId, std::map<std::string, std::string>>;
+
+	class FlSceneEditHistoryTest : public ::testing::Test
+	{
+	protected:
+
+		static void SetUpTestSuite()
+		{
+			Kernel().initialize();
+			RegisterTestTypes();
+		}
+
+		void SetUp() override
+		{
+			History().Clear();
+			Kernel().AllDestroyEntities();
+		}
+
+		void TearDown() override
+		{
+			History().Clear();
+			History().SetCapacity(FlSceneEditHistory::DefaultCapacity);
+			Kernel().AllDestroyEntities();
+		}
+
+		static FlEntityComponentSystemKernel& Kernel() { return FlEntityComponentSystemKernel::Instance(); }
+
+		static FlSceneEditHistory& History() { return FlSceneEditHistory::Instance(); }
+
+		static TransformComponent* TransformOf(const entityId id)
+		{
+			return static_cast<TransformComponent*>(Kernel().GetComponent("Transform", id));
+		}
+
+		SceneState CaptureScene() const
+		{
+			auto state{ SceneState{} };
+			for (const auto id : Kernel().GetAllEntityIds())
+			{
+				auto& components{ state[id] };
+				for (const auto& typeName : Kernel().GetEntityComponentTypes(id))
+				{
+					nlohmann::json json;
+					Kernel().GetReflection(typeName)->Serialize(Kernel().GetComponent(typeName, id), json);
+					components[typeName] = json.dump();
+				}
+			}
+			return state;
+		}
+
+		// ȉ̓GfB^ (FlECSInspectorAndHierarchy) ƓL^̎d
+
+		static entityId Create()
+		{
+			History().BeginEdit("Create Entity");
+			const auto id{ Kernel().CreateEntity() };
+			if (id != InvalidEntityId) History().CaptureCreatedEntity(id);
+			History().EndEdit();
+			return id;
+		}
+
+		static void DestroyRecursive(const entityId id)
+		{
+			History().CaptureEntity(id);
+			if (auto* pTransform{ TransformOf(id) })
+			{
+				for (const auto child : std::vector<entityId>{ pTransform->m_children }) DestroyRecursive(child);
+				if (auto* pParent{ pTransform->m_parent != UINT32_MAX ? TransformOf(pTransform->m_parent) : nullptr })
+				{
+					History().Capture(pTransform->m_parent, "Transform");
+					std::erase(pParent->m_children, id);
+					Kernel().MarkComponentChanged("Transform", pTransform->m_parent);
+				}
+			}
+			Kernel().DestroyEntity(id);
+		}
+
+		static void Delete(const entityId id)
+		{
+			History().BeginEdit("Delete Entity");
+			DestroyRecursive(id);
+			History().EndEdit();
+		}
+
+		static void SetParent(const entityId child, const entityId newParent)
+		{
+			auto* pChild { TransformOf(child) };
+			auto* pParent{ newParent != UINT32_MAX ? TransformOf(newParent) : nullptr };
+			if (!pChild || (newParent != UINT32_MAX && !pParent) || child == newParent) return;
+
+			// ւɂȂtւ̓GfB^̃c[͂łȂ
+			for (auto ancestor{ newParent }; ancestor != UINT32_MAX; ancestor = TransformOf(ancestor)->m_parent)
+			{
+				if (ancestor == child) return;
+			}
+
+			History().BeginEdit("Set Parent");
+			History().Capture(child, "Transform");
+			if (pChild->m_parent != UINT32_MAX)
+			{
+				History().Capture(pChild->m_parent, "Transform");
+				std::erase(TransformOf(pChild->m_parent)->m_children, child);
+				Kernel().MarkComponentChanged("Transform", pChild->m_parent);
+			}
+			if (pParent)
+			{
+				History().Capture(newParent, "Transform");
+				pParent->m_children.push_back(child);
+				Kernel().MarkComponentChanged("Transform", newParent);
+			}
+			pChild->m_parent = newParent;
+			Kernel().MarkComponentChanged("Transform", child);
+			History().EndEdit();
+		}
+
+		static void Attach(const entityId id, const std::string& typeName)
+		{
+			History().BeginEdit("Add " + typeName);
+			History().Capture(id, typeName);
+			if (!Kernel().HasComponent(typeName, id)) Kernel().AddComponent(typeName, id);
+			History().EndEdit();
+		}
+
+		static void Remove(const entityId id, const std::string& typeName)
+		{
+			History().BeginEdit("Remove " + typeName);
+			History().Capture(id, typeName);
+			Kernel().RemoveComponent(typeName, id);
+			History().EndEdit();
+		}
+
+		// CXyN^1t[̕ҏW
+		static void Edit(const entityId id, const std::string& typeName, std::mt19937& rng, const uint64_t mergeKey)
+		{
+			auto before{ FlSceneEditHistory::Snapshot(id, typeName) };
+			auto* pComponent{ Kernel().GetComponent(typeName, id) };
+			if (!pComponent) return;
+
+			if (typeName == "Name") static_cast<NameComponent*>(pComponent)->m_name = "Entity" + std::to_string(rng() % 1000U);
+			else if (typeName == "Position")
+			{
+				static_cast<PositionComponent*>(pComponent)->x  = static_cast<float>(rng() % 100U);
+				static_cast<PositionComponent*>(pComponent)->y += 1.0f;
+			}
+			else if (typeName == "Tag") static_cast<TagComponent*>(pComponent)->tag = static_cast<int>(rng() % 5U);
+
+			Kernel().MarkComponentChanged(typeName, id);
+			History().PushComponentEdit("Edit " + typeName, id, typeName, std::move(before), mergeKey);
+		}
+
+		static uint64_t MergeKeyOf(const entityId id, const std::string& typeName)
+		{
+			return ((static_cast<uint64_t>(id) << 32U) ^ std::hash<std::string>{}(typeName)) | Def::ULongLongOne;
+		}
+	};
+}
+
+// ҏWEtOEE폜EtւƖ߂E蒼_ɍAV[ŜL^ԂƔׂ
+TEST_F(FlSceneEditHistoryTest, RandomEditsUndoAndRedoToTheRecordedStates)
+{
+	const auto types{ std::array<std::string, 3U>{ "Name", "Position", "Tag" } };
+
+	auto checks{ size_t{} };
+	for (auto seed{ 1U }; seed <= 20U; ++seed)
+	{
+		History().Clear();
+		Kernel().AllDestroyEntities();
+		for (auto i{ 0 }; i < 8; ++i) Kernel().CreateEntity();
+
+		auto rng{ std::mt19937{ seed } };
+
+		// states[pos] ̃V[A̐͂蒼
+		auto states{ std::vector<SceneState>{ CaptureScene() } };
+		auto pos   { size_t{} };
+		for (auto step{ 0 }; step < 300; ++step)
+		{
+			const auto op{ rng() % 10U };
+			if (op <= 2U && History().CanUndo())
+			{
+				ASSERT_TRUE(History().Undo());
+				--pos;
+				ASSERT_EQ(CaptureScene(), states[pos]) << "seed " << seed << ", step " << step;
+				++checks;
+				continue;
+			}
+			if (op == 3U && History().CanRedo())
+			{
+				ASSERT_TRUE(History().Redo());
+				++pos;
+				ASSERT_EQ(CaptureScene(), states[pos]) << "seed " << seed << ", step " << step;
+				++checks;
+				continue;
+			}
+
+			const auto alive    { Kernel().GetAllEntityIds() };
+			const auto undoCount{ History().GetUndoCount() };
+			const auto redoCount{ History().GetRedoCount() };
+			const auto id       { alive.empty() ? InvalidEntityId : alive[rng() % alive.size()] };
+			const auto kind     { rng() % 7U };
+			if (kind == 0U || id == InvalidEntityId) Create();
+			else if (kind == 1U) { if (alive.size() > 3U) Delete(id); }
+			else if (kind == 2U) SetParent(id, rng() % 3U == 0U ? UINT32_MAX : alive[rng() % alive.size()]);
+			else if (kind == 3U) Attach(id, types[1U + rng() % 2U]);
+			else if (kind == 4U)
+			{
+				const auto& typeName{ types[1U + rng() % 2U] };
+				if (Kernel().HasComponent(typeName, id)) Remove(id, typeName);
+			}
+			else
+			{
+				// hbOiR|[lgւ̑Ă̕ҏWj
+				const auto& typeName{ types[rng() % types.size()] };
+				const auto  frames  { 1U + rng() % 4U };
+				for (auto i{ 0U }; i < frames; ++i) Edit(id, typeName, rng, MergeKeyOf(id, typeName));
+			}
+
+			// ς܂ꂽEOɂ܂Ƃ߂ꂽE܂Ƃ߂Čɖ߂̂ŏÂǂꂩ
+			const auto scene{ CaptureScene() };
+			const auto count{ History().GetUndoCount() };
+			if (count == undoCount + 1U)
+			{
+				states.resize(pos + 1U);
+				states.push_back(scene);
+				++pos;
+			}
+			else if (count == undoCount)
+			{
+				if (History().GetRedoCount() != redoCount || scene != states[pos])
+				{
+					states.resize(pos + 1U);
+					states[pos] = scene;
+				}
+			}
+			else
+			{
+				ASSERT_EQ(count + 1U, undoCount);
+				states.resize(pos);
+				--pos;
+				ASSERT_EQ(scene, states[pos]);
+			}
+			ASSERT_EQ(History().GetRedoCount(), states.size() - 1U - pos);
+		}
+
+		// SĖ߂ĂSĂ蒼
+		while (History().CanUndo())
+		{
+			ASSERT_TRUE(History().Undo());
+			ASSERT_EQ(CaptureScene(), states[--pos]) << "seed " << seed;
+			++checks;
+		}
+		ASSERT_EQ(pos, 0U);
+		while (History().CanRedo())
+		{
+			ASSERT_TRUE(History().Redo());
+			ASSERT_EQ(CaptureScene(), states[++pos]) << "seed " << seed;
+			++checks;
+		}
+		ASSERT_EQ(pos, states.size() - 1U);
+	}
+	EXPECT_GT(checks, 1000U);
+}
+
+TEST_F(FlSceneEditHistoryTest, DragIsCoalescedIntoOneStep)
+{
+	const auto id    { Create() };
+	const auto before{ CaptureScene() };
+	const auto count { History().GetUndoCount() };
+
+	// 60 t[̃hbO1Aʂ̃R|[lgւ̃hbO͂1
+	auto rng{ std::mt19937{ 7U } };
+	for (auto frame{ 0 }; frame < 60; ++frame) Edit(id, "Name", rng, MergeKeyOf(id, "Name"));
+	EXPECT_EQ(History().GetUndoCount(), count + 1U);
+	const auto renamed{ CaptureScene() };
+
+	Attach(id, "Position");
+	const auto attached{ CaptureScene() };
+	for (auto frame{ 0 }; frame < 60; ++frame) Edit(id, "Position", rng, MergeKeyOf(id, "Position"));
+	EXPECT_EQ(History().GetUndoCount(), count + 3U);
+
+	ASSERT_TRUE(History().Undo());
+	EXPECT_EQ(CaptureScene(), attached);
+	ASSERT_TRUE(History().Undo());
+	EXPECT_EQ(CaptureScene(), renamed);
+	ASSERT_TRUE(History().Undo());
+	EXPECT_EQ(CaptureScene(), before);
+}
+
+// ߂E蒼ŐĜ͋L^R|[lg
+TEST_F(FlSceneEditHistoryTest, UndoOnlyTouchesTheEditedComponents)
+{
+	const auto ids{ Kernel().CreateEntities(1000U) };
+	for (const auto id : ids) Kernel().AddComponent("Position", id);
+
+	auto rng{ std::mt19937{ 1U } };
+	const auto edited{ ids[rng() % ids.size()] };
+	Edit(edited, "Position", rng, Def::ULongLongZero);
+
+	const auto other{ ids[0] == edited ? ids[1] : ids[0] };
+	const auto versions{ std::array<uint64_t, 2U>{ Kernel().GetComponentVersion("Position", other), Kernel().GetComponentVersion("Name", edited) } };
+
+	ASSERT_TRUE(History().Undo());
+	ASSERT_TRUE(History().Redo());
+	EXPECT_EQ(Kernel().GetComponentVersion("Position", other), versions[0]);
+	EXPECT_EQ(Kernel().GetComponentVersion("Name", edited), versions[1]);
+	EXPECT_GT(Kernel().GetComponentVersion("Position", edited), versions[0]);
+}
+
+TEST_F(FlSceneEditHistoryTest, CapacityDropsTheOldestEdits)
+{
+	constexpr auto capacity{ size_t{ 256U * 1024U } };
+
+	const auto id{ Create() };
+	Attach(id, "Tag");
+	History().SetCapacity(capacity);
+
+	const auto watch{ FlMemoryTracker::Instance().GetStatistics(FlMemoryTag::EditHistory).current - History().GetMemoryUsage() };
+	for (auto i{ 0 }; i < 2000; ++i)
+	{
+		auto before{ FlSceneEditHistory::Snapshot(id, "Tag") };
+		static_cast<TagComponent*>(Kernel().GetComponent("Tag", id))->blob.assign(64U, i);
+		History().PushComponentEdit("Edit Tag", id, "Tag", std::move(before));
+	}
+
+	EXPECT_LE(History().GetMemoryUsage(), capacity);
+	EXPECT_GT(History().GetUndoCount(), 1U);
+	EXPECT_LT(History().GetUndoCount(), 2000U);
+	EXPECT_EQ(FlMemoryTracker::Instance().GetStatistics(FlMemoryTag::EditHistory).current, watch + History().GetMemoryUsage());
+
+	// c͑SĖ߂
+	while (History().CanUndo()) ASSERT_TRUE(History().Undo());
+	EXPECT_FALSE(static_cast<TagComponent*>(Kernel().GetComponent("Tag", id))->blob.empty());
+}
+
+// 蒼ȂGeBeB΁Aɍ蒼̂܂߂ĉςȂ
+TEST_F(FlSceneEditHistoryTest, UndoThatCannotRecreateAnEntityLeavesTheSceneUntouched)
+{
+	const auto first { Kernel().CreateEntity() };
+	const auto second{ Kernel().CreateEntity() };
+
+	History().BeginEdit("Delete Entities");
+	DestroyRecursive(first);
+	DestroyRecursive(second);
+	History().EndEdit();
+
+	// 2ڂ̃Xbg̃GeBeBg
+	const auto taken{ MakeEntityId(GetEntityIndex(second), GetEntityGeneration(second) + 1U) };
+	ASSERT_TRUE(Kernel().CreateEntity(taken));
+	Kernel().DestroyEntity(taken);
+	ASSERT_TRUE(Kernel().CanCreateEntity(first, true));
+	ASSERT_FALSE(Kernel().CanCreateEntity(second, true));
+
+	const auto scene { CaptureScene() };
+	const auto errors{ FlEditorAdministrator::Instance().GetLogger()->Count(FlTestLogger::Severity::Error) };
+
+	EXPECT_FALSE(History().Undo());
+	EXPECT_EQ(CaptureScene(), scene);
+	EXPECT_FALSE(Kernel().IsActive(first));
+	EXPECT_FALSE(History().CanUndo());
+	EXPECT_EQ(FlEditorAdministrator::Instance().GetLogger()->Count(FlTestLogger::Severity::Error), errors + 1U);
+}
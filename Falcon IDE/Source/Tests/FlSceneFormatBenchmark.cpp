@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+
+#include "Core/FlEntityComponentSystemKernel.h"
+#include "Framework/Module/RuntimeModule/ResistCamera.h"
+#include "Framework/Module/RuntimeModule/ResistModelRender.h"
+#include "Framework/Module/RuntimeModule/ResistCollision.h"
+#include "Framework/Module/RuntimeModule/Transform.h"
+#include "Framework/Resource/Binary/FlSceneBinaryFormat.h"
+
+// `E蔻̃R|[lg DirectX Ɉˑ̂ŃeXgł͓o^Ȃ
+ResistCamera::ResistCamera() {}
+ResistModelRender::ResistModelRender() {}
+ResistCollision::ResistCollision() {}
+
+namespace
+{
+	namespace fs = std::filesystem;
+
+	struct Result
+	{
+		double saveMs = 0.0;
+		double loadMs = 0.0;
+		uintmax_t bytes = 0U;
+	};
+
+	double ElapsedMs(const std::chrono::steady_clock::time_point start)
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	// Name  Transform ̃GeBeB entityCount ׂi8 Ƃɐeqɂj
+	void BuildScene(const uint32_t entityCount)
+	{
+		auto& kernel{ FlEntityComponentSystemKernel::Instance() };
+		kernel.AllDestroyEntities();
+
+		const auto ids{ kernel.CreateEntities(entityCount) };
+		ASSERT_EQ(ids.size(), entityCount);
+		for (const auto id : ids)
+		{
+			kernel.AddComponent("Name", id);
+			kernel.AddComponent("Transform", id);
+		}
+		for (auto i{ size_t{} }; i < ids.size(); ++i)
+		{
+			auto* pTransform{ static_cast<TransformComponent*>(kernel.GetComponent("Transform", ids[i])) };
+			ASSERT_NE(pTransform, nullptr);
+			pTransform->m_transform->SetLocalPosition({ static_cast<float>(i % 1000U), static_cast<float>(i / 1000U), 0.5f * static_cast<float>(i % 7U) });
+
+			if (i % 8U == 0U) continue;
+			const auto parent{ ids[i - i % 8U] };
+			pTransform->m_parent = parent;
+			static_cast<TransformComponent*>(kernel.GetComponent("Transform", parent))->m_children.push_back(ids[i]);
+		}
+	}
+
+	// save ŏoAɂV[ LoadScene œǂݖ߂Bǂݍ݂ rounds ̍ŗ
+	template<class Save>
+	Result Measure(const fs::path& path, const uint32_t entityCount, const uint32_t rounds, Save&& save)
+	{
+		auto& kernel{ FlEntityComponentSystemKernel::Instance() };
+		auto result{ Result{} };
+
+		auto start{ std::chrono::steady_clock::now() };
+		EXPECT_TRUE(save(path));
+		result.saveMs = ElapsedMs(start);
+		result.bytes  = fs::file_size(path);
+
+		result.loadMs = std::numeric_limits<double>::max();
+		for (auto round{ 0U }; round < rounds; ++round)
+		{
+			kernel.AllDestroyEntities();
+			start = std::chrono::steady_clock::now();
+			EXPECT_TRUE(kernel.LoadScene(path));
+			result.loadMs = std::min(result.loadMs, ElapsedMs(start));
+			EXPECT_EQ(kernel.GetActiveIdCount(), entityCount);
+		}
+		return result;
+	}
+
+	// JSONEkoCiEkoCiœV[ۑEǂݍ݂AԂƃt@CTCYׂ
+	void Compare(const uint32_t entityCount, const uint32_t rounds)
+	{
+		auto& kernel{ FlEntityComponentSystemKernel::Instance() };
+		kernel.initialize();
+
+		const auto dir{ fs::temp_directory_path() / "FlSceneFormatBenchmark" };
+		fs::remove_all(dir);
+		fs::create_directories(dir);
+
+		BuildScene(entityCount);
+		const auto json{ Measure(dir / "Scene.flscene", entityCount, rounds, [&](const fs::path& path) {
+			return kernel.SaveScene(path);
+		}) };
+		const auto raw{ Measure(dir / "Raw.flsceneb", entityCount, rounds, [&](const fs::path& path) {
+			return FlSceneBinaryFormat::SaveFile(path, kernel.SerializeSceneBinary(false));
+		}) };
+		const auto compressed{ Measure(dir / "Compressed.flsceneb", entityCount, rounds, [&](const fs::path& path) {
+			return kernel.SaveScene(path);
+		}) };
+
+		for (const auto& [label, result] : { std::pair{ "json", json }, std::pair{ "raw", raw }, std::pair{ "compressed", compressed } })
+		{
+			std::printf("[ BENCH ] Scene %u entities %-10s: save %8.1f ms, load %8.1f ms, %6.2f MB\n",
+				entityCount, label, result.saveMs, result.loadMs, static_cast<double>(result.bytes) / (1024.0 * 1024.0));
+			const auto suffix{ std::string{ "_" } + label + "_" + std::to_string(entityCount) };
+			::testing::Test::RecordProperty("save_ms" + suffix, std::to_string(result.saveMs));
+			::testing::Test::RecordProperty("load_ms" + suffix, std::to_string(result.loadMs));
+			::testing::Test::RecordProperty("bytes" + suffix, std::to_string(result.bytes));
+		}
+
+		EXPECT_LT(raw.saveMs, json.saveMs);
+		EXPECT_LT(raw.loadMs, json.loadMs);
+		EXPECT_LT(raw.bytes, json.bytes);
+		EXPECT_LT(compressed.bytes, raw.bytes);
+
+		kernel.AllDestroyEntities();
+		fs::remove_all(dir);
+	}
+}
+
+TEST(FlSceneFormatBenchmark, TenThousandEntities)
+{
+	Compare(10000U, 3U);
+}
+
+TEST(FlSceneFormatBenchmark, HundredThousandEntities)
+{
+	Compare(100000U, 1U);
+}
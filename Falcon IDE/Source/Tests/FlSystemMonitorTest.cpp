@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+
+#include "Framework/System/Monitor/FlSystemMonitor.h"
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+namespace
+{
+	using Backend = FlSystemMonitorBackend;
+
+	// w莞Ԃ CPU 
+	void Spin(const std::chrono::milliseconds duration)
+	{
+		const auto end{ std::chrono::steady_clock::now() + duration };
+		auto sink{ uint64_t{} };
+		while (std::chrono::steady_clock::now() < end) sink = sink * 6364136223846793005ULL + 1U;
+		static volatile auto s_sink{ uint64_t{} };
+		s_sink = sink;
+	}
+
+	const Backend::ThreadSample* FindThread(const std::vector<Backend::ThreadSample>& threads, const uint32_t threadId)
+	{
+		const auto it{ std::ranges::find(threads, threadId, &Backend::ThreadSample::threadId) };
+		return it == threads.end() ? nullptr : &*it;
+	}
+
+	uint32_t CurrentThreadId()
+	{
+#ifdef _WIN32
+		return static_cast<uint32_t>(GetCurrentThreadId());
+#else
+		return static_cast<uint32_t>(::gettid());
+#endif
+	}
+}
+
+TEST(FlSystemMonitorBackend, SystemCpuTimesAreCumulative)
+{
+	auto backend{ Backend{} };
+	EXPECT_GE(backend.GetProcessorCount(), 1U);
+	EXPECT_NE(backend.GetProcessId(), 0U);
+
+	auto first{ Backend::CpuTimes{} };
+	ASSERT_TRUE(backend.ReadSystemCpu(first));
+	EXPECT_GT(first.total, 0U);
+	EXPECT_LE(first.idle, first.total);
+
+	Spin(std::chrono::milliseconds{ 50 });
+
+	auto second{ Backend::CpuTimes{} };
+	ASSERT_TRUE(backend.ReadSystemCpu(second));
+	EXPECT_GE(second.total, first.total);
+	EXPECT_GE(second.idle, first.idle);
+}
+
+TEST(FlSystemMonitorBackend, ProcessTimesAndMemoryFollowTheWork)
+{
+	auto backend{ Backend{} };
+
+	auto before{ Backend::ProcessSample{} };
+	ASSERT_TRUE(backend.ReadProcess(before));
+	EXPECT_GT(before.workingSet, 0U);
+	EXPECT_GE(before.peakWorkingSet, before.workingSet);
+
+	Spin(std::chrono::milliseconds{ 200 });
+
+	// Gy[W풓
+	constexpr auto allocationBytes{ size_t{ 64U } << 20 };
+	auto memory{ std::vector<uint8_t>(allocationBytes) };
+	for (auto i{ size_t{} }; i < memory.size(); i += 4096U) memory[i] = static_cast<uint8_t>(i);
+
+	auto after{ Backend::ProcessSample{} };
+	ASSERT_TRUE(backend.ReadProcess(after));
+
+	// clock tick ̗xi10msjł 200ms ̔͌vコ
+	EXPECT_GE((after.userSec + after.kernelSec) - (before.userSec + before.kernelSec), 0.1);
+	EXPECT_GE(after.workingSet, before.workingSet + allocationBytes / 2U);
+	EXPECT_GE(after.peakWorkingSet, after.workingSet);
+	EXPECT_EQ(memory[4096U], static_cast<uint8_t>(4096U));
+}
+
+TEST(FlSystemMonitorBackend, ThreadsIncludeCallerAndABusyWorker)
+{
+	auto backend{ Backend{} };
+
+	auto workerId{ std::atomic<uint32_t>{} };
+	auto isStop  { std::atomic<bool>{ false } };
+	auto worker  { std::thread{ [&] {
+		workerId.store(CurrentThreadId());
+		while (!isStop.load()) Spin(std::chrono::milliseconds{ 1 });
+	} } };
+	while (workerId.load() == 0U) std::this_thread::yield();
+
+	auto first{ std::vector<Backend::ThreadSample>{} };
+	ASSERT_TRUE(backend.ReadThreads(first));
+	ASSERT_NE(FindThread(first, CurrentThreadId()), nullptr);
+	ASSERT_NE(FindThread(first, workerId.load()), nullptr);
+
+	std::this_thread::sleep_for(std::chrono::milliseconds{ 200 });
+
+	auto second{ std::vector<Backend::ThreadSample>{} };
+	ASSERT_TRUE(backend.ReadThreads(second));
+	isStop.store(true);
+	worker.join();
+
+	const auto* pBefore{ FindThread(first, workerId.load()) };
+	const auto* pAfter { FindThread(second, workerId.load()) };
+	ASSERT_NE(pAfter, nullptr);
+	EXPECT_GE((pAfter->userSec + pAfter->kernelSec) - (pBefore->userSec + pBefore->kernelSec), 0.1);
+
+	// IXbh͗񋓂Ȃ
+	auto third{ std::vector<Backend::ThreadSample>{} };
+	ASSERT_TRUE(backend.ReadThreads(third));
+	EXPECT_EQ(FindThread(third, workerId.load()), nullptr);
+}
+
+TEST(FlSystemMonitor, PublishesSamplesAtTheIntervalAndStops)
+{
+	auto monitor{ FlSystemMonitor{ std::chrono::milliseconds{ 20 } } };
+	EXPECT_EQ(monitor.Acquire().sequence, 0U);
+
+	monitor.Start();
+	EXPECT_TRUE(monitor.IsRunning());
+
+	// 20ms ԊuȂ 1 b 5 ͏\ɒ
+	const auto deadline{ std::chrono::steady_clock::now() + std::chrono::seconds{ 5 } };
+	while (monitor.Acquire().sequence < 5U && std::chrono::steady_clock::now() < deadline)
+		std::this_thread::sleep_for(std::chrono::milliseconds{ 5 });
+
+	const auto& snapshot{ monitor.Acquire() };
+	ASSERT_GE(snapshot.sequence, 5U);
+	EXPECT_EQ(snapshot.processId, Backend{}.GetProcessId());
+	EXPECT_GE(snapshot.systemCpu.GetCount(), 5);
+	EXPECT_GT(snapshot.workingSet.GetLatest(), 0.0F);
+	EXPECT_TRUE(std::ranges::is_sorted(snapshot.threads, {}, &FlSystemMonitor::ThreadRow::threadId));
+	EXPECT_NE(std::ranges::find(snapshot.threads, CurrentThreadId(), &FlSystemMonitor::ThreadRow::threadId), snapshot.threads.end());
+
+	// Ԋu͔͈͂Ɋۂ߂A܂ܕς
+	monitor.SetInterval(std::chrono::milliseconds{ 1 });
+	EXPECT_EQ(monitor.GetInterval(), std::chrono::milliseconds{ 16 });
+	monitor.SetInterval(std::chrono::hours{ 1 });
+	EXPECT_EQ(monitor.GetInterval(), std::chrono::milliseconds{ 10000 });
+
+	// Ԋuő҂ĂĂ Stop ͂Ԃ
+	const auto stopBegin{ std::chrono::steady_clock::now() };
+	monitor.Stop();
+	EXPECT_LT(std::chrono::steady_clock::now() - stopBegin, std::chrono::seconds{ 1 });
+	EXPECT_FALSE(monitor.IsRunning());
+
+	const auto stopped{ monitor.Acquire().sequence };
+	std::this_thread::sleep_for(std::chrono::milliseconds{ 60 });
+	EXPECT_EQ(monitor.Acquire().sequence, stopped);
+}
+
+TEST(FlSystemMonitor, HistoryIsARingForPlotLines)
+{
+	auto history{ FlSystemMonitor::History{} };
+	EXPECT_EQ(history.GetCount(), 0);
+	EXPECT_EQ(history.GetLatest(), 0.0F);
+
+	for (auto i{ 0 }; i < 10; ++i) history.Push(static_cast<float>(i));
+	EXPECT_EQ(history.GetCount(), 10);
+	EXPECT_EQ(history.GetOffset(), 0);
+	EXPECT_EQ(history.GetLatest(), 9.0F);
+
+	for (auto i{ 10 }; i < static_cast<int>(FlSystemMonitor::HistoryLength) + 5; ++i) history.Push(static_cast<float>(i));
+	EXPECT_EQ(history.GetCount(), static_cast<int>(FlSystemMonitor::HistoryLength));
+	EXPECT_EQ(history.GetOffset(), 5);
+	// ŌÂ̒l offset ̈ʒu
+	EXPECT_EQ(history.GetData()[history.GetOffset()], 5.0F);
+	EXPECT_EQ(history.GetLatest(), static_cast<float>(FlSystemMonitor::HistoryLength + 4));
+}
@@ -0,0 +1,6 @@
+#pragma once
+
+// FlSystemMonitor.cpp  Pch.h 󂯎镨̑ieXgł̓vt@CgȂj
+#define FL_PROFILER_ENABLED 0
+#include "Framework/System/Debugger/Profiler/FlProfiler.h"
+#include "Framework/System/Multithread/FlTripleBuffer.hpp"
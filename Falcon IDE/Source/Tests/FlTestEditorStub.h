@@ -0,0 +1,105 @@
+#pragma once
+
+/// <summary>
+/// eXgp̃GfB^̑łBO͏ĊoĂAeXgdxƂɐ܂B
+/// </summary>
+class FlTestLogger
+{
+public:
+
+	enum class Severity : uint8_t
+	{
+		Log,
+		Warning,
+		Change,
+		Error,
+		Success,
+	};
+
+	struct Entry
+	{
+		Severity    severity;
+		std::string text;
+	};
+
+	template<class... Args> void AddLog       (const std::string& fmt, Args... args) { Push(Severity::Log,     fmt, args...); }
+	template<class... Args> void AddWarningLog(const std::string& fmt, Args... args) { Push(Severity::Warning, fmt, args...); }
+	template<class... Args> void AddChangeLog (const std::string& fmt, Args... args) { Push(Severity::Change,  fmt, args...); }
+	template<class... Args> void AddErrorLog  (const std::string& fmt, Args... args) { Push(Severity::Error,   fmt, args...); }
+	template<class... Args> void AddSuccessLog(const std::string& fmt, Args... args) { Push(Severity::Success, fmt, args...); }
+
+	size_t Count(const Severity severity) const
+	{
+		auto lock{ std::lock_guard{ m_mutex } };
+		return static_cast<size_t>(std::ranges::count(m_entries, severity, &Entry::severity));
+	}
+
+	std::vector<Entry> GetEntries() const
+	{
+		auto lock{ std::lock_guard{ m_mutex } };
+		return m_entries;
+	}
+
+	void Clear()
+	{
+		auto lock{ std::lock_guard{ m_mutex } };
+		m_entries.clear();
+	}
+
+private:
+
+	template<class... Args>
+	void Push(const Severity severity, const std::string& fmt, Args... args)
+	{
+		auto text{ fmt };
+		if constexpr (sizeof...(Args) > 0U)
+		{
+			const auto size{ std::snprintf(nullptr, 0U, fmt.c_str(), args...) };
+			if (size > 0)
+			{
+				text.resize(static_cast<size_t>(size) + 1U);
+				std::snprintf(text.data(), text.size(), fmt.c_str(), args...);
+				text.pop_back();
+			}
+		}
+
+		auto lock{ std::lock_guard{ m_mutex } };
+		m_entries.push_back({ severity, std::move(text) });
+	}
+
+	mutable std::mutex m_mutex;
+	std::vector<Entry> m_entries;
+};
+
+/// <summary> =Singleton= </summary>
+class FlEditorAdministrator
+{
+public:
+
+	const auto& GetLogger() const noexcept { return m_upLogger; }
+
+	static auto& Instance() noexcept
+	{
+		static FlEditorAdministrator instance;
+		return instance;
+	}
+
+private:
+	FlEditorAdministrator() = default;
+
+	std::unique_ptr<FlTestLogger> m_upLogger{ std::make_unique<FlTestLogger>() };
+};
+
+// {̂GfB^̕`悩Ă ImGui ֐̑i`͂AҏW̗LeXg^j
+namespace ImGui
+{
+	inline bool g_isItemEdited{ false };
+
+	inline void BeginGroup() noexcept {}
+	inline void EndGroup() noexcept {}
+	inline bool IsItemEdited() noexcept { return g_isItemEdited; }
+	inline bool DragFloat3(const char*, float*, float = 1.0F) noexcept { return false; }
+	inline bool InputText(const char*, std::string*) noexcept { return false; }
+	inline bool Button(const char*) noexcept { return false; }
+	inline void SetClipboardText(const char*) noexcept {}
+}
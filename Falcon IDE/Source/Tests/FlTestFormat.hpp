@@ -0,0 +1,100 @@
+#pragma once
+
+// <format> ̖WCuiGCC 12 Ȃǁj std::format ̑łB
+// {̂g "{}"  "{:[fill][align][0][width][.precision][type]}"  snprintf ɒuĈ܂B
+#if !defined(__cpp_lib_format)
+
+namespace FlTestFormat
+{
+	inline std::string ToPrintfSpec(const std::string_view spec, const char defaultType, const char* length)
+	{
+		auto fill { ' ' };
+		auto align{ '\0' };
+		auto i    { size_t{} };
+
+		if (spec.size() >= 2U && (spec[1] == '<' || spec[1] == '>' || spec[1] == '^')) { fill = spec[0]; align = spec[1]; i = 2U; }
+		else if (!spec.empty() && (spec[0] == '<' || spec[0] == '>' || spec[0] == '^')) { align = spec[0]; i = 1U; }
+
+		auto out{ std::string{ "%" } };
+		if (align == '<') out += '-';
+		if (fill == '0' || (i < spec.size() && spec[i] == '0')) { out += '0'; if (spec[i] == '0') ++i; }
+
+		while (i < spec.size() && (std::isdigit(static_cast<unsigned char>(spec[i])) || spec[i] == '.')) out += spec[i++];
+
+		out += length;
+		out += i < spec.size() ? spec[i] : defaultType;
+		return out;
+	}
+
+	template<class T>
+	std::string FormatOne(const std::string_view spec, const T& value)
+	{
+		auto buffer{ std::array<char, 128U>{} };
+
+		if constexpr (std::is_same_v<std::decay_t<T>, bool>)
+			return value ? "true" : "false";
+		else if constexpr (std::is_floating_point_v<T>)
+			std::snprintf(buffer.data(), buffer.size(), ToPrintfSpec(spec, 'g', "").c_str(), static_cast<double>(value));
+		else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>)
+			std::snprintf(buffer.data(), buffer.size(), ToPrintfSpec(spec, 'd', "ll").c_str(), static_cast<long long>(value));
+		else if constexpr (std::is_integral_v<T>)
+			std::snprintf(buffer.data(), buffer.size(), ToPrintfSpec(spec, 'u', "ll").c_str(), static_cast<unsigned long long>(value));
+		else if constexpr (std::is_pointer_v<T> && !std::is_convertible_v<T, const char*>)
+			std::snprintf(buffer.data(), buffer.size(), "%p", static_cast<const void*>(value));
+		else
+		{
+			auto stream{ std::ostringstream{} };
+			stream << value;
+			return stream.str();
+		}
+		return buffer.data();
+	}
+
+	inline void Append(std::string& out, std::string_view& fmt)
+	{
+		out += fmt;
+		fmt = {};
+	}
+
+	template<class T, class... Rest>
+	void Append(std::string& out, std::string_view& fmt, const T& value, const Rest&... rest)
+	{
+		while (!fmt.empty())
+		{
+			const auto brace{ fmt.find_first_of("{}") };
+			if (brace == std::string_view::npos) break;
+
+			out += fmt.substr(0U, brace);
+			if (brace + 1U < fmt.size() && fmt[brace + 1U] == fmt[brace])
+			{
+				out += fmt[brace];
+				fmt.remove_prefix(brace + 2U);
+				continue;
+			}
+
+			const auto close{ fmt.find('}', brace) };
+			auto spec{ fmt.substr(brace + 1U, close - brace - 1U) };
+			if (!spec.empty() && spec[0] == ':') spec.remove_prefix(1U);
+			fmt.remove_prefix(close + 1U);
+
+			out += FormatOne(spec, value);
+			Append(out, fmt, rest...);
+			return;
+		}
+		Append(out, fmt);
+	}
+}
+
+namespace std
+{
+	template<class... Args>
+	inline string format(const string_view fmt, const Args&... args)
+	{
+		auto out  { string{} };
+		auto rest { fmt };
+		::FlTestFormat::Append(out, rest, args...);
+		return out;
+	}
+}
+
+#endif // !__cpp_lib_format
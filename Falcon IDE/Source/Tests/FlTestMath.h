@@ -0,0 +1,216 @@
+#pragma once
+
+// DirectXMath / SimpleMath ŁAMath:: g{̂̃wb_gނ߂̍ŏ̑
+// FlTransform  Transform R|[lgg SimpleMath ƓKisxNgEsDjŎ܂B
+namespace DirectX
+{
+	constexpr float XM_PI{ 3.141592654F };
+
+	constexpr float XMConvertToRadians(const float degrees) noexcept { return degrees * (XM_PI / 180.0F); }
+	constexpr float XMConvertToDegrees(const float radians) noexcept { return radians * (180.0F / XM_PI); }
+}
+
+namespace Math
+{
+	struct Vector2 { float x, y; };
+	struct Vector4 { float x, y, z, w; };
+	struct Color   { float r, g, b, a; };
+
+	struct Vector3
+	{
+		float x, y, z;
+
+		float Length() const noexcept { return std::sqrt(x * x + y * y + z * z); }
+
+		Vector3 operator+(const Vector3& v) const noexcept { return { x + v.x, y + v.y, z + v.z }; }
+		Vector3 operator-(const Vector3& v) const noexcept { return { x - v.x, y - v.y, z - v.z }; }
+		Vector3 operator*(const float s)    const noexcept { return { x * s, y * s, z * s }; }
+		bool operator==(const Vector3&) const noexcept = default;
+
+		static const Vector3 Zero;
+		static const Vector3 One;
+		static const Vector3 UnitX;
+		static const Vector3 UnitY;
+		static const Vector3 UnitZ;
+	};
+	inline constexpr Vector3 Vector3::Zero { 0.0F, 0.0F, 0.0F };
+	inline constexpr Vector3 Vector3::One  { 1.0F, 1.0F, 1.0F };
+	inline constexpr Vector3 Vector3::UnitX{ 1.0F, 0.0F, 0.0F };
+	inline constexpr Vector3 Vector3::UnitY{ 0.0F, 1.0F, 0.0F };
+	inline constexpr Vector3 Vector3::UnitZ{ 0.0F, 0.0F, 1.0F };
+
+	struct Matrix;
+
+	struct Quaternion
+	{
+		float x, y, z, w;
+
+		// SimpleMath Ɠ q1 * q2 ́uq1 ̌ q2v̉]
+		Quaternion operator*(const Quaternion& q) const noexcept
+		{
+			return {
+				q.w * x + q.x * w + q.y * z - q.z * y,
+				q.w * y - q.x * z + q.y * w + q.z * x,
+				q.w * z + q.x * y - q.y * x + q.z * w,
+				q.w * w - q.x * x - q.y * y - q.z * z };
+		}
+
+		void Normalize() noexcept
+		{
+			const auto length{ std::sqrt(x * x + y * y + z * z + w * w) };
+			if (length <= 0.0F) return;
+			x /= length; y /= length; z /= length; w /= length;
+		}
+
+		// (pitch, yaw, roll) = (x, y, z)
+		Vector3 ToEuler() const noexcept
+		{
+			const auto xx{ x * x }, yy{ y * y }, zz{ z * z };
+			const auto m31{ 2.0F * x * z + 2.0F * y * w };
+			const auto m32{ 2.0F * y * z - 2.0F * x * w };
+			const auto m33{ 1.0F - 2.0F * xx - 2.0F * yy };
+			const auto cy { std::sqrt(m33 * m33 + m31 * m31) };
+			const auto cx { std::atan2(-m32, cy) };
+			if (cy > 16.0F * std::numeric_limits<float>::epsilon())
+				return { cx, std::atan2(m31, m33), std::atan2(2.0F * x * y + 2.0F * z * w, 1.0F - 2.0F * xx - 2.0F * zz) };
+			return { cx, 0.0F, std::atan2(-(2.0F * x * y - 2.0F * z * w), 1.0F - 2.0F * yy - 2.0F * zz) };
+		}
+
+		static Quaternion CreateFromAxisAngle(const Vector3& axis, const float angle) noexcept
+		{
+			const auto s{ std::sin(angle * 0.5F) };
+			return { axis.x * s, axis.y * s, axis.z * s, std::cos(angle * 0.5F) };
+		}
+
+		static Quaternion CreateFromYawPitchRoll(const float yaw, const float pitch, const float roll) noexcept
+		{
+			const auto cp{ std::cos(pitch * 0.5F) }, sp{ std::sin(pitch * 0.5F) };
+			const auto cy{ std::cos(yaw * 0.5F) },   sy{ std::sin(yaw * 0.5F) };
+			const auto cr{ std::cos(roll * 0.5F) },  sr{ std::sin(roll * 0.5F) };
+			return {
+				cy * sp * cr + sy * cp * sr,
+				sy * cp * cr - cy * sp * sr,
+				cy * cp * sr - sy * sp * cr,
+				cy * cp * cr + sy * sp * sr };
+		}
+
+		static Quaternion CreateFromRotationMatrix(const Matrix& m) noexcept;
+
+		static const Quaternion Identity;
+	};
+	inline constexpr Quaternion Quaternion::Identity{ 0.0F, 0.0F, 0.0F, 1.0F };
+
+	struct Matrix
+	{
+		float m[4][4];
+
+		Matrix operator*(const Matrix& o) const noexcept
+		{
+			auto r{ Matrix{} };
+			for (auto i{ 0 }; i < 4; ++i)
+				for (auto j{ 0 }; j < 4; ++j)
+					r.m[i][j] = m[i][0] * o.m[0][j] + m[i][1] * o.m[1][j] + m[i][2] * o.m[2][j] + m[i][3] * o.m[3][j];
+			return r;
+		}
+		Matrix& operator*=(const Matrix& o) noexcept { return *this = *this * o; }
+
+		Vector3 Translation() const noexcept { return { m[3][0], m[3][1], m[3][2] }; }
+
+		// AtBϊ̋ts
+		Matrix Invert() const noexcept
+		{
+			const auto det{
+				m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1]) -
+				m[0][1] * (m[1][0] * m[2][2] - m[1][2] * m[2][0]) +
+				m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]) };
+			if (det == 0.0F) return Identity;
+
+			const auto inv{ 1.0F / det };
+			auto r{ Identity };
+			r.m[0][0] =  (m[1][1] * m[2][2] - m[1][2] * m[2][1]) * inv;
+			r.m[0][1] = -(m[0][1] * m[2][2] - m[0][2] * m[2][1]) * inv;
+			r.m[0][2] =  (m[0][1] * m[1][2] - m[0][2] * m[1][1]) * inv;
+			r.m[1][0] = -(m[1][0] * m[2][2] - m[1][2] * m[2][0]) * inv;
+			r.m[1][1] =  (m[0][0] * m[2][2] - m[0][2] * m[2][0]) * inv;
+			r.m[1][2] = -(m[0][0] * m[1][2] - m[0][2] * m[1][0]) * inv;
+			r.m[2][0] =  (m[1][0] * m[2][1] - m[1][1] * m[2][0]) * inv;
+			r.m[2][1] = -(m[0][0] * m[2][1] - m[0][1] * m[2][0]) * inv;
+			r.m[2][2] =  (m[0][0] * m[1][1] - m[0][1] * m[1][0]) * inv;
+			for (auto j{ 0 }; j < 3; ++j)
+				r.m[3][j] = -(m[3][0] * r.m[0][j] + m[3][1] * r.m[1][j] + m[3][2] * r.m[2][j]);
+			return r;
+		}
+
+		bool Decompose(Vector3& scale, Quaternion& rotation, Vector3& translation) const noexcept
+		{
+			translation = Translation();
+			scale = {
+				Vector3{ m[0][0], m[0][1], m[0][2] }.Length(),
+				Vector3{ m[1][0], m[1][1], m[1][2] }.Length(),
+				Vector3{ m[2][0], m[2][1], m[2][2] }.Length() };
+			if (scale.x == 0.0F || scale.y == 0.0F || scale.z == 0.0F) return false;
+
+			auto r{ Identity };
+			for (auto j{ 0 }; j < 3; ++j)
+			{
+				r.m[0][j] = m[0][j] / scale.x;
+				r.m[1][j] = m[1][j] / scale.y;
+				r.m[2][j] = m[2][j] / scale.z;
+			}
+			rotation = Quaternion::CreateFromRotationMatrix(r);
+			return true;
+		}
+
+		static Matrix CreateScale(const Vector3& s) noexcept
+		{
+			auto r{ Identity };
+			r.m[0][0] = s.x; r.m[1][1] = s.y; r.m[2][2] = s.z;
+			return r;
+		}
+
+		static Matrix CreateTranslation(const Vector3& t) noexcept
+		{
+			auto r{ Identity };
+			r.m[3][0] = t.x; r.m[3][1] = t.y; r.m[3][2] = t.z;
+			return r;
+		}
+
+		static Matrix CreateFromQuaternion(const Quaternion& q) noexcept
+		{
+			const auto xx{ q.x * q.x }, yy{ q.y * q.y }, zz{ q.z * q.z };
+			const auto xy{ q.x * q.y }, xz{ q.x * q.z }, yz{ q.y * q.z };
+			const auto xw{ q.x * q.w }, yw{ q.y * q.w }, zw{ q.z * q.w };
+			return {
+				1.0F - 2.0F * (yy + zz), 2.0F * (xy + zw),        2.0F * (xz - yw),        0.0F,
+				2.0F * (xy - zw),        1.0F - 2.0F * (xx + zz), 2.0F * (yz + xw),        0.0F,
+				2.0F * (xz + yw),        2.0F * (yz - xw),        1.0F - 2.0F * (xx + yy), 0.0F,
+				0.0F,                    0.0F,                    0.0F,                    1.0F };
+		}
+
+		static const Matrix Identity;
+	};
+	inline constexpr Matrix Matrix::Identity{ 1.0F, 0.0F, 0.0F, 0.0F, 0.0F, 1.0F, 0.0F, 0.0F, 0.0F, 0.0F, 1.0F, 0.0F, 0.0F, 0.0F, 0.0F, 1.0F };
+
+	inline Quaternion Quaternion::CreateFromRotationMatrix(const Matrix& r) noexcept
+	{
+		const auto& m{ r.m };
+		const auto trace{ m[0][0] + m[1][1] + m[2][2] };
+		if (trace > 0.0F)
+		{
+			const auto s{ std::sqrt(trace + 1.0F) * 2.0F };
+			return { (m[1][2] - m[2][1]) / s, (m[2][0] - m[0][2]) / s, (m[0][1] - m[1][0]) / s, 0.25F * s };
+		}
+		if (m[0][0] > m[1][1] && m[0][0] > m[2][2])
+		{
+			const auto s{ std::sqrt(1.0F + m[0][0] - m[1][1] - m[2][2]) * 2.0F };
+			return { 0.25F * s, (m[0][1] + m[1][0]) / s, (m[2][0] + m[0][2]) / s, (m[1][2] - m[2][1]) / s };
+		}
+		if (m[1][1] > m[2][2])
+		{
+			const auto s{ std::sqrt(1.0F + m[1][1] - m[0][0] - m[2][2]) * 2.0F };
+			return { (m[0][1] + m[1][0]) / s, 0.25F * s, (m[1][2] + m[2][1]) / s, (m[2][0] - m[0][2]) / s };
+		}
+		const auto s{ std::sqrt(1.0F + m[2][2] - m[0][0] - m[1][1]) * 2.0F };
+		return { (m[2][0] + m[0][2]) / s, (m[1][2] + m[2][1]) / s, 0.25F * s, (m[0][1] - m[1][0]) / s };
+	}
+}
@@ -0,0 +1,90 @@
+#pragma once
+// <Precompilation Header for Tests>
+// Src/Pch.h ̑ɑSĂ̖|Pʂ֋CN[h܂B
+// Windows / DirectX / ImGui Ɉ˂Ȃgނ߁AGfB^̃K[ ImGui ͂ōŏ̑u܂B
+
+// ***** //
+// <STL> //
+// ***** //
+#include <map>
+#include <unordered_map>
+#include <unordered_set>
+#include <string>
+#include <string_view>
+#include <array>
+#include <span>
+#include <optional>
+#include <vector>
+#include <stack>
+#include <list>
+#include <iterator>
+#include <queue>
+#include <deque>
+#include <algorithm>
+#include <numeric>
+#include <memory>
+#include <random>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <functional>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <condition_variable>
+#include <future>
+#include <filesystem>
+#include <stdexcept>
+#include <chrono>
+#include <charconv>
+#include <type_traits>
+#include <set>
+#include <numbers>
+#include <bit>
+#include <ranges>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+// MSVC  <crtdbg.h> ɂ _ASSERT_EXPR ̑iNDEBUG Ȃ牽Ȃj
+#ifndef _ASSERT_EXPR
+#define _ASSERT_EXPR(expr, msg) assert((expr) && (msg))
+#endif
+
+// ******** //
+// <Format> //
+// ******** //
+#if __has_include(<format>)
+#include <format>
+#endif
+#include "FlTestFormat.hpp"
+
+// ****** //
+// <JSON> //
+// ****** //
+#include "Framework/Resource/Json/json.hpp"
+
+// ********** //
+// <Math> //
+// ********** //
+#if FL_TEST_DIRECTXMATH
+#include <DirectXMath.h>
+#include <DirectXCollision.h>
+#include <SimpleMath.h>
+namespace Math = DirectX::SimpleMath;
+#else
+// DirectXMath gȂeXg FlTestMath.h ̍ŏ̑őg
+#include "FlTestMath.h"
+#endif
+
+// ********** //
+// <Original> //
+// ********** //
+#include "Framework/Utility/FlUtilityDefault.hxx"
+#include "Framework/System/Memory/FlMemoryTracker.h"
+
+#include "FlTestEditorStub.h"
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include "Framework/System/Multithread/FlTripleBuffer.hpp"
+
+namespace
+{
+	// Svfɓԍiǂ񂾒lĂΔjĂj
+	struct Frame
+	{
+		uint64_t                 sequence = 0U;
+		std::array<uint64_t, 15> copies{};
+		std::vector<uint64_t>    payload;
+
+		void Write(const uint64_t value)
+		{
+			sequence = value;
+			copies.fill(value);
+			payload.assign(static_cast<size_t>(value % 7U) + 1U, value);
+		}
+
+		bool IsConsistent() const
+		{
+			return std::ranges::all_of(copies, [&](const auto copy) { return copy == sequence; })
+				&& (sequence == 0U || payload.size() == static_cast<size_t>(sequence % 7U) + 1U)
+				&& std::ranges::all_of(payload, [&](const auto value) { return value == sequence; });
+		}
+	};
+}
+
+TEST(FlTripleBuffer, ConsumerSeesOnlyTheLatestPublishedValue)
+{
+	auto buffer{ FlTripleBuffer<int>{} };
+	EXPECT_FALSE(buffer.Update());
+	EXPECT_EQ(buffer.GetFront(), 0);
+
+	buffer.WorkBack() = 1;
+	buffer.Publish();
+	EXPECT_TRUE(buffer.Update());
+	EXPECT_EQ(buffer.GetFront(), 1);
+
+	// VlΎ荞܂AO̒l̂܂
+	EXPECT_FALSE(buffer.Update());
+	EXPECT_EQ(buffer.GetFront(), 1);
+
+	// ǂޑOɉxoĂŐVc
+	for (auto value{ 2 }; value <= 5; ++value)
+	{
+		buffer.WorkBack() = value;
+		buffer.Publish();
+	}
+	EXPECT_TRUE(buffer.Update());
+	EXPECT_EQ(buffer.GetFront(), 5);
+	EXPECT_FALSE(buffer.Update());
+}
+
+TEST(FlTripleBuffer, BackBufferNeverAliasesTheFront)
+{
+	auto buffer{ FlTripleBuffer<int>{} };
+	for (auto round{ 1 }; round < 100; ++round)
+	{
+		buffer.WorkBack() = round;
+		buffer.Publish();
+		if (round % 3 == 0) buffer.Update();
+
+		// ݐ͓ǂݎ肪Ălƕʂ̗̈
+		EXPECT_NE(&buffer.WorkBack(), &buffer.GetFront()) << round;
+		const auto front{ buffer.GetFront() };
+		buffer.WorkBack() = -1;
+		EXPECT_EQ(buffer.GetFront(), front) << round;
+	}
+}
+
+TEST(FlTripleBuffer, ConcurrentPublishNeverTearsOrGoesBackwards)
+{
+	constexpr auto publishCount{ uint64_t{ 500000 } };
+
+	auto buffer{ FlTripleBuffer<Frame>{} };
+	auto isDone{ std::atomic<bool>{ false } };
+
+	auto producer{ std::thread{ [&] {
+		for (auto value{ uint64_t{ 1 } }; value <= publishCount; ++value)
+		{
+			buffer.WorkBack().Write(value);
+			buffer.Publish();
+		}
+		isDone.store(true, std::memory_order_release);
+	} } };
+
+	auto previous{ uint64_t{} };
+	auto updates { uint64_t{} };
+	for (;;)
+	{
+		const auto isFinal{ isDone.load(std::memory_order_acquire) };
+		if (buffer.Update())
+		{
+			++updates;
+			const auto& front{ buffer.GetFront() };
+			ASSERT_TRUE(front.IsConsistent()) << front.sequence;
+			ASSERT_GT(front.sequence, previous);
+			previous = front.sequence;
+		}
+		if (isFinal) break;
+	}
+	producer.join();
+
+	// Y҂I̎荞݂ōŌ̒lɒǂ
+	buffer.Update();
+	EXPECT_EQ(buffer.GetFront().sequence, publishCount);
+	EXPECT_GT(updates, 0U);
+}